@@ -573,6 +573,11 @@ if (PKG_CONFIG_FOUND)
     add_definitions( -DLIBBULLET_VERSION_GT_282 )
   endif()
 
+  # Multi-threaded dynamics world with a constraint solver pool
+  if (NOT BULLET_VERSION VERSION_LESS 2.88)
+    add_definitions( -DLIBBULLET_VERSION_GE_288 )
+  endif()
+
   ########################################
   # Find libusb
   pkg_check_modules(libusb-1.0 libusb-1.0)
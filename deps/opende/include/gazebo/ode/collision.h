@@ -362,6 +362,34 @@ ODE_API unsigned long dGeomGetCategoryBits (dGeomID);
 ODE_API unsigned long dGeomGetCollideBits (dGeomID);
 
 
+/**
+ * @brief Set the "filter" bitfield for the given geom.
+ *
+ * Unlike the category and collide bitfields, which let a pair through
+ * if either geom accepts the other, the filter bitfields of both geoms
+ * must have at least one bit in common for the pair to be passed to the
+ * near callback. Both tests are applied. Setting the filter bitfield of
+ * a space to the union of the bitfields of its geoms lets the pairs of
+ * spaces that can't collide be rejected without visiting their geoms.
+ * The default filter values for newly created geoms have all bits set.
+ *
+ * @param geom the geom to set
+ * @param bits the new bitfield value
+ * @ingroup collide
+ */
+ODE_API void dGeomSetFilterBits (dGeomID geom, unsigned long bits);
+
+
+/**
+ * @brief Get the "filter" bitfield for the given geom.
+ *
+ * @param geom the geom to get the bitfield of
+ * @sa dGeomSetFilterBits
+ * @ingroup collide
+ */
+ODE_API unsigned long dGeomGetFilterBits (dGeomID);
+
+
 /**
  * @brief Enable a geom.
  *
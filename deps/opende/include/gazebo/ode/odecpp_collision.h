@@ -100,6 +100,10 @@ public:
     { return dGeomGetCategoryBits (_id); }
   unsigned long getCollideBits()
     { return dGeomGetCollideBits (_id); }
+  void setFilterBits (unsigned long bits)
+    { dGeomSetFilterBits (_id, bits); }
+  unsigned long getFilterBits()
+    { return dGeomGetFilterBits (_id); }
 
   void enable()
     { dGeomEnable (_id); }
@@ -372,6 +372,7 @@ dxGeom::dxGeom (dSpaceID _space, int is_placeable)
   dSetZero (aabb,6);
   category_bits = ~0;
   collide_bits = ~0;
+  filter_bits = ~0;
 
   // put this geom in a space if required
   if (_space) dSpaceAdd (_space,this);
@@ -777,6 +778,21 @@ unsigned long dGeomGetCollideBits (dxGeom *g)
 }
 
 
+void dGeomSetFilterBits (dxGeom *g, unsigned long bits)
+{
+  dAASSERT (g);
+  CHECK_NOT_LOCKED (g->parent_space);
+  g->filter_bits = bits;
+}
+
+
+unsigned long dGeomGetFilterBits (dxGeom *g)
+{
+  dAASSERT (g);
+  return g->filter_bits;
+}
+
+
 void dGeomEnable (dxGeom *g)
 {
 	dAASSERT (g);
@@ -109,6 +109,7 @@ struct dxGeom : public dBase {
   dxSpace *parent_space;// the space this geom is contained in, 0 if none
   dReal aabb[6];	// cached AABB for this space
   unsigned long category_bits,collide_bits;
+  unsigned long filter_bits;	// geoms with disjoint filter bits never collide
 
   dxGeom (dSpaceID _space, int is_placeable);
   virtual ~dxGeom();
@@ -246,6 +246,10 @@ static void collideGeomsNoAABBs( dxGeom *g1, dxGeom *g2, void *data, dNearCallba
 		return;
 	}
 
+	// test if the filter bitfields intersect
+	if ( (g1->filter_bits & g2->filter_bits) == 0 )
+		return;
+
 	dReal *bounds1 = g1->aabb;
 	dReal *bounds2 = g2->aabb;
 
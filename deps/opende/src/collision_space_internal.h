@@ -60,6 +60,9 @@ inline static void collideAABBs (dxGeom *g1, dxGeom *g2,
     return;
   }
 
+  // test if the filter bitfields intersect
+  if ((g1->filter_bits & g2->filter_bits) == 0) return;
+
   // if the bounding boxes are disjoint then don't do anything
   dReal *bounds1 = g1->aabb;
   dReal *bounds2 = g2->aabb;
@@ -15,9 +15,12 @@
  *
 */
 
+#include <algorithm>
 #include <functional>
 #include <thread>
 #include <mutex>
+#include <unordered_map>
+#include <vector>
 
 #include <boost/bind.hpp>
 #include <boost/make_shared.hpp>
@@ -41,6 +44,22 @@ namespace gazebo
     /// \brief All the known subscribers.
     gazebo::Master::SubList subscribers;
 
+    /// \brief Publishers indexed by topic name, in advertisement order.
+    std::unordered_map<std::string,
+        std::vector<gazebo::Master::PubList::iterator>> publishersByTopic;
+
+    /// \brief Publishers indexed by the id of the owning connection.
+    std::unordered_map<unsigned int,
+        std::vector<gazebo::Master::PubList::iterator>> publishersByConn;
+
+    /// \brief Subscribers indexed by topic name, in subscription order.
+    std::unordered_map<std::string,
+        std::vector<gazebo::Master::SubList::iterator>> subscribersByTopic;
+
+    /// \brief Subscribers indexed by the id of the owning connection.
+    std::unordered_map<unsigned int,
+        std::vector<gazebo::Master::SubList::iterator>> subscribersByConn;
+
     /// \brief All the known connections.
     gazebo::Master::Connection_M connections;
 
@@ -65,6 +84,27 @@ namespace gazebo
     /// \brief Mutex to protect msg bufferes.
     std::recursive_mutex msgsMutex;
   };
+
+  /// \brief Remove an iterator from an index bucket, and drop the bucket
+  /// once it is empty.
+  /// \param[in] _index Index to update.
+  /// \param[in] _key Key of the bucket that holds _iter.
+  /// \param[in] _iter Iterator to remove.
+  template<typename K, typename I>
+  static void EraseFromIndex(std::unordered_map<K, std::vector<I>> &_index,
+      const K &_key, const I &_iter)
+  {
+    auto bucket = _index.find(_key);
+    if (bucket == _index.end())
+      return;
+
+    auto pos = std::find(bucket->second.begin(), bucket->second.end(), _iter);
+    if (pos != bucket->second.end())
+      bucket->second.erase(pos);
+
+    if (bucket->second.empty())
+      _index.erase(bucket);
+  }
 }
 
 /////////////////////////////////////////////////
@@ -177,11 +217,14 @@ void Master::OnRead(const unsigned int _connectionIndex,
 void Master::SendSubscribers(const std::string &_topic,
                              const std::string &_buffer)
 {
+  auto subs = this->dataPtr->subscribersByTopic.find(_topic);
+  if (subs == this->dataPtr->subscribersByTopic.end())
+    return;
+
   // Find all subscribers for this topic
   std::set<transport::ConnectionPtr> uniqueConnections;
-  for (auto const &subscriber : this->dataPtr->subscribers)
-    if (subscriber.first.topic() == _topic)
-      uniqueConnections.insert(subscriber.second);
+  for (auto const &subscriber : subs->second)
+    uniqueConnections.insert(subscriber->second);
 
   // Send message to all unique connections
   for (auto &conn : uniqueConnections)
@@ -226,21 +269,16 @@ void Master::ProcessMessage(const unsigned int _connectionIndex,
   }
   else if (packet.type() == "advertise")
   {
-    std::lock_guard<std::recursive_mutex> lock(this->dataPtr->connectionMutex);
     msgs::Publish pub;
     pub.ParseFromString(packet.serialized_data());
-
-    Connection_M::iterator iter2;
-    for (iter2 = this->dataPtr->connections.begin();
-         iter2 != this->dataPtr->connections.end(); ++iter2)
-    {
-      iter2->second->EnqueueMsg(msgs::Package("publisher_add", pub));
-    }
-
-    this->dataPtr->publishers.push_back(std::make_pair(pub, conn));
-
-    this->SendSubscribers(pub.topic(),
-        msgs::Package("publisher_advertise", pub));
+    this->AddPublisher(pub, conn);
+  }
+  else if (packet.type() == "advertise_batch")
+  {
+    msgs::Publishers pubs;
+    pubs.ParseFromString(packet.serialized_data());
+    for (auto const &pub : pubs.publisher())
+      this->AddPublisher(pub, conn);
   }
   else if (packet.type() == "unadvertise")
   {
@@ -258,20 +296,14 @@ void Master::ProcessMessage(const unsigned int _connectionIndex,
   {
     msgs::Subscribe sub;
     sub.ParseFromString(packet.serialized_data());
-
-    this->dataPtr->subscribers.push_back(std::make_pair(sub, conn));
-
-    PubList::iterator iter;
-
-    // Find all publishers of the topic
-    for (iter = this->dataPtr->publishers.begin();
-        iter != this->dataPtr->publishers.end(); ++iter)
-    {
-      if (iter->first.topic() == sub.topic())
-      {
-        conn->EnqueueMsg(msgs::Package("publisher_subscribe", iter->first));
-      }
-    }
+    this->AddSubscriber(sub, conn);
+  }
+  else if (packet.type() == "subscribe_batch")
+  {
+    msgs::Subscribers subs;
+    subs.ParseFromString(packet.serialized_data());
+    for (auto const &sub : subs.subscriber())
+      this->AddSubscriber(sub, conn);
   }
   else if (packet.type() == "request")
   {
@@ -296,18 +328,12 @@ void Master::ProcessMessage(const unsigned int _connectionIndex,
       msgs::GzString_V msg;
 
       // Add all topics that are published
-      for (PubList::iterator iter = this->dataPtr->publishers.begin();
-          iter != this->dataPtr->publishers.end(); ++iter)
-      {
-        topics.insert(iter->first.topic());
-      }
+      for (auto const &pubs : this->dataPtr->publishersByTopic)
+        topics.insert(pubs.first);
 
       // Add all topics that are subscribed
-      for (SubList::iterator iter = this->dataPtr->subscribers.begin();
-           iter != this->dataPtr->subscribers.end(); ++iter)
-      {
-        topics.insert(iter->first.topic());
-      }
+      for (auto const &subs : this->dataPtr->subscribersByTopic)
+        topics.insert(subs.first);
 
       // Construct the message of only unique names
       for (std::set<std::string>::iterator iter =
@@ -325,14 +351,11 @@ void Master::ProcessMessage(const unsigned int _connectionIndex,
       msgs::TopicInfo ti;
       ti.set_msg_type(pub.msg_type());
 
-      PubList::iterator piter;
-      SubList::iterator siter;
-
       // Find all publishers of the topic
-      for (piter = this->dataPtr->publishers.begin();
-          piter != this->dataPtr->publishers.end(); ++piter)
+      auto pubs = this->dataPtr->publishersByTopic.find(req.data());
+      if (pubs != this->dataPtr->publishersByTopic.end())
       {
-        if (piter->first.topic() == req.data())
+        for (auto const &piter : pubs->second)
         {
           msgs::Publish *pubPtr = ti.add_publisher();
           pubPtr->CopyFrom(piter->first);
@@ -340,10 +363,10 @@ void Master::ProcessMessage(const unsigned int _connectionIndex,
       }
 
       // Find all subscribers of the topic
-      for (siter = this->dataPtr->subscribers.begin();
-          siter != this->dataPtr->subscribers.end(); ++siter)
+      auto subs = this->dataPtr->subscribersByTopic.find(req.data());
+      if (subs != this->dataPtr->subscribersByTopic.end())
       {
-        if (siter->first.topic() == req.data())
+        for (auto const &siter : subs->second)
         {
           // If the topic info message type has not been set or the
           // topic info message type is an empty string, then set the topic
@@ -450,44 +473,25 @@ void Master::RemoveConnection(Connection_M::iterator _connIter)
     }
   }
 
-  // Remove all publishers for this connection
-  bool done = false;
-  while (!done)
+  const unsigned int connId = _connIter->second->GetId();
+
+  // Remove all publishers for this connection. RemovePublisher updates the
+  // index, so keep taking the first entry until the bucket is gone.
+  auto pubs = this->dataPtr->publishersByConn.find(connId);
+  while (pubs != this->dataPtr->publishersByConn.end())
   {
-    done = true;
-    PubList::iterator pubIter = this->dataPtr->publishers.begin();
-    while (pubIter != this->dataPtr->publishers.end())
-    {
-      if ((*pubIter).second->GetId() == _connIter->second->GetId())
-      {
-        this->RemovePublisher((*pubIter).first);
-        done = false;
-        break;
-      }
-      else
-        ++pubIter;
-    }
+    msgs::Publish pub = pubs->second.front()->first;
+    this->RemovePublisher(pub);
+    pubs = this->dataPtr->publishersByConn.find(connId);
   }
 
-
-  done = false;
-  while (!done)
+  // Remove all subscribers for this connection
+  auto subs = this->dataPtr->subscribersByConn.find(connId);
+  while (subs != this->dataPtr->subscribersByConn.end())
   {
-    done = true;
-
-    // Remove all subscribers for this connection
-    SubList::iterator subIter = this->dataPtr->subscribers.begin();
-    while (subIter != this->dataPtr->subscribers.end())
-    {
-      if ((*subIter).second->GetId() == _connIter->second->GetId())
-      {
-        this->RemoveSubscriber((*subIter).first);
-        done = false;
-        break;
-      }
-      else
-        ++subIter;
-    }
+    msgs::Subscribe sub = subs->second.front()->first;
+    this->RemoveSubscriber(sub);
+    subs = this->dataPtr->subscribersByConn.find(connId);
   }
 
   this->dataPtr->connections.erase(_connIter);
@@ -508,17 +512,22 @@ void Master::RemovePublisher(const msgs::Publish _pub)
 
   this->SendSubscribers(_pub.topic(), msgs::Package("unadvertise", _pub));
 
-  PubList::iterator pubIter = this->dataPtr->publishers.begin();
-  while (pubIter != this->dataPtr->publishers.end())
+  auto pubs = this->dataPtr->publishersByTopic.find(_pub.topic());
+  if (pubs == this->dataPtr->publishersByTopic.end())
+    return;
+
+  // Copy the bucket, since erasing from the index invalidates it.
+  std::vector<PubList::iterator> candidates = pubs->second;
+  for (auto const &pubIter : candidates)
   {
-    if (pubIter->first.topic() == _pub.topic() &&
-        pubIter->first.host() == _pub.host() &&
+    if (pubIter->first.host() == _pub.host() &&
         pubIter->first.port() == _pub.port())
     {
-      pubIter = this->dataPtr->publishers.erase(pubIter);
+      EraseFromIndex(this->dataPtr->publishersByTopic, _pub.topic(), pubIter);
+      EraseFromIndex(this->dataPtr->publishersByConn,
+          pubIter->second->GetId(), pubIter);
+      this->dataPtr->publishers.erase(pubIter);
     }
-    else
-      ++pubIter;
   }
 }
 
@@ -526,28 +535,72 @@ void Master::RemovePublisher(const msgs::Publish _pub)
 void Master::RemoveSubscriber(const msgs::Subscribe _sub)
 {
   // Find all publishers of the topic, and remove the subscriptions
-  for (PubList::iterator iter = this->dataPtr->publishers.begin();
-      iter != this->dataPtr->publishers.end(); ++iter)
+  auto pubs = this->dataPtr->publishersByTopic.find(_sub.topic());
+  if (pubs != this->dataPtr->publishersByTopic.end())
   {
-    if (iter->first.topic() == _sub.topic())
-    {
+    for (auto const &iter : pubs->second)
       iter->second->EnqueueMsg(msgs::Package("unsubscribe", _sub));
-    }
   }
 
+  auto subs = this->dataPtr->subscribersByTopic.find(_sub.topic());
+  if (subs == this->dataPtr->subscribersByTopic.end())
+    return;
+
   // Remove the subscribers from our list
-  SubList::iterator subiter = this->dataPtr->subscribers.begin();
-  while (subiter != this->dataPtr->subscribers.end())
+  std::vector<SubList::iterator> candidates = subs->second;
+  for (auto const &subIter : candidates)
   {
-    if (subiter->first.topic() == _sub.topic() &&
-        subiter->first.host() == _sub.host() &&
-        subiter->first.port() == _sub.port())
+    if (subIter->first.host() == _sub.host() &&
+        subIter->first.port() == _sub.port())
     {
-      subiter = this->dataPtr->subscribers.erase(subiter);
+      EraseFromIndex(this->dataPtr->subscribersByTopic, _sub.topic(), subIter);
+      EraseFromIndex(this->dataPtr->subscribersByConn,
+          subIter->second->GetId(), subIter);
+      this->dataPtr->subscribers.erase(subIter);
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+void Master::AddPublisher(const msgs::Publish &_pub,
+                          transport::ConnectionPtr _conn)
+{
+  {
+    std::lock_guard<std::recursive_mutex> lock(
+        this->dataPtr->connectionMutex);
+    Connection_M::iterator iter2;
+    for (iter2 = this->dataPtr->connections.begin();
+         iter2 != this->dataPtr->connections.end(); ++iter2)
+    {
+      iter2->second->EnqueueMsg(msgs::Package("publisher_add", _pub));
     }
-    else
-      ++subiter;
   }
+
+  PubList::iterator iter = this->dataPtr->publishers.insert(
+      this->dataPtr->publishers.end(), std::make_pair(_pub, _conn));
+  this->dataPtr->publishersByTopic[_pub.topic()].push_back(iter);
+  this->dataPtr->publishersByConn[_conn->GetId()].push_back(iter);
+
+  this->SendSubscribers(_pub.topic(),
+      msgs::Package("publisher_advertise", _pub));
+}
+
+/////////////////////////////////////////////////
+void Master::AddSubscriber(const msgs::Subscribe &_sub,
+                           transport::ConnectionPtr _conn)
+{
+  SubList::iterator iter = this->dataPtr->subscribers.insert(
+      this->dataPtr->subscribers.end(), std::make_pair(_sub, _conn));
+  this->dataPtr->subscribersByTopic[_sub.topic()].push_back(iter);
+  this->dataPtr->subscribersByConn[_conn->GetId()].push_back(iter);
+
+  // Find all publishers of the topic
+  auto pubs = this->dataPtr->publishersByTopic.find(_sub.topic());
+  if (pubs == this->dataPtr->publishersByTopic.end())
+    return;
+
+  for (auto const &pubIter : pubs->second)
+    _conn->EnqueueMsg(msgs::Package("publisher_subscribe", pubIter->first));
 }
 
 //////////////////////////////////////////////////
@@ -578,6 +631,10 @@ void Master::Fini()
   this->dataPtr->msgs.clear();
   this->dataPtr->worldNames.clear();
   this->dataPtr->connections.clear();
+  this->dataPtr->subscribersByTopic.clear();
+  this->dataPtr->subscribersByConn.clear();
+  this->dataPtr->publishersByTopic.clear();
+  this->dataPtr->publishersByConn.clear();
   this->dataPtr->subscribers.clear();
   this->dataPtr->publishers.clear();
 }
@@ -587,18 +644,10 @@ msgs::Publish Master::GetPublisher(const std::string &_topic)
 {
   msgs::Publish msg;
 
-  PubList::iterator iter;
-
-  // Find all publishers of the topic
-  for (iter = this->dataPtr->publishers.begin();
-       iter != this->dataPtr->publishers.end(); ++iter)
-  {
-    if (iter->first.topic() == _topic)
-    {
-      msg = iter->first;
-      break;
-    }
-  }
+  // Find the first publisher of the topic
+  auto pubs = this->dataPtr->publishersByTopic.find(_topic);
+  if (pubs != this->dataPtr->publishersByTopic.end())
+    msg = pubs->second.front()->first;
 
   return msg;
 }
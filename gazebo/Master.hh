@@ -118,6 +118,20 @@ namespace gazebo
     /// _connIter will be incremented when removed.
     private: void RemoveConnection(Connection_M::iterator _connIter);
 
+    /// \brief Register a publisher, and notify all connections and the
+    /// subscribers of the topic.
+    /// \param[in] _pub Publish message that describes the publisher.
+    /// \param[in] _conn Connection which advertised the publisher.
+    private: void AddPublisher(const msgs::Publish &_pub,
+                               transport::ConnectionPtr _conn);
+
+    /// \brief Register a subscriber, and send it all the current
+    /// publishers of the topic.
+    /// \param[in] _sub Subscribe message that describes the subscriber.
+    /// \param[in] _conn Connection which requested the subscription.
+    private: void AddSubscriber(const msgs::Subscribe &_sub,
+                                transport::ConnectionPtr _conn);
+
     /// \brief Remove a publisher.
     /// \param[in] _pub Publish message that contains the info necessary to
     /// remove a publisher.
@@ -24,7 +24,10 @@
 
 #include <stdio.h>
 #include <signal.h>
+#include <algorithm>
 #include <mutex>
+#include <string>
+#include <vector>
 #include <boost/algorithm/string.hpp>
 #include <boost/filesystem.hpp>
 #include <boost/lexical_cast.hpp>
@@ -103,7 +106,77 @@ namespace gazebo
 
     /// \brief Set whether to lockstep physics and rendering
     bool lockstep = false;
+
+    /// \brief Set whether to pipeline the sensors with physics in lockstep
+    bool lockstepPipelined = false;
+
+    /// \brief Number of copies of the world file to load. Each copy runs
+    /// its update loop on its own thread.
+    unsigned int worldCopies = 1;
+
+    /// \brief Additional world files to load next to the main world.
+    std::vector<std::string> extraWorlds;
   };
+
+  /// \brief Override the physics engine type of a world description.
+  /// \param[in] _elem Root SDF element that contains a <world>.
+  /// \param[in] _physics Physics engine type, or empty to keep the
+  /// engine of the world description.
+  static void OverridePhysics(sdf::ElementPtr _elem,
+                              const std::string &_physics)
+  {
+    if (_physics.empty())
+      return;
+
+    // Check if physics engine name is valid
+    // This must be done after physics::load();
+    if (!physics::PhysicsFactory::IsRegistered(_physics))
+    {
+      gzerr << "Unregistered physics engine [" << _physics
+            << "], the default will be used instead.\n";
+    }
+    // Try inserting physics engine name if one is given
+    else if (_elem->HasElement("world") &&
+             _elem->GetElement("world")->HasElement("physics"))
+    {
+      _elem->GetElement("world")->GetElement("physics")
+           ->GetAttribute("type")->Set(_physics);
+    }
+    else
+    {
+      gzerr << "Cannot set physics engine: <world> does not have <physics>\n";
+    }
+  }
+
+  /// \brief Create and load a world. The world name is made unique, since
+  /// it is also the topic namespace of the world.
+  /// \param[in] _worldElem The <world> element to load.
+  static void LoadWorldElem(sdf::ElementPtr _worldElem)
+  {
+    std::string baseName = _worldElem->Get<std::string>("name");
+    std::string name = baseName;
+    for (unsigned int i = 1; physics::has_world(name); ++i)
+      name = baseName + "_" + std::to_string(i);
+
+    if (name != baseName)
+    {
+      gzwarn << "A world named [" << baseName << "] already exists, "
+             << "loading as [" << name << "]\n";
+      _worldElem->GetAttribute("name")->Set(name);
+    }
+
+    physics::WorldPtr world = physics::create_world();
+
+    // Create the world
+    try
+    {
+      physics::load_world(world, _worldElem);
+    }
+    catch(common::Exception &e)
+    {
+      gzthrow("Failed to load the World\n"  << e);
+    }
+  }
 }
 
 bool ServerPrivate::stop = true;
@@ -153,6 +226,8 @@ bool Server::ParseArgs(int _argc, char **_argv)
     ("help,h", "Produce this help message.")
     ("pause,u", "Start the server in a paused state.")
     ("lockstep", "Lockstep simulation so sensor update rates are respected.")
+    ("lockstep_pipelined", "Lockstep simulation, with physics computing the "
+     "next step while the sensors process the current one.")
     ("physics,e", po::value<std::string>(),
      "Specify a physics engine (ode|bullet|dart|simbody).")
     ("play,p", po::value<std::string>(), "Play a log file.")
@@ -168,6 +243,10 @@ bool Server::ParseArgs(int _argc, char **_argv)
     ("record_resources", "Recording with model meshes and materials.")
     ("seed",  po::value<double>(), "Start with a given random number seed.")
     ("iters",  po::value<unsigned int>(), "Number of iterations to simulate.")
+    ("world_copies", po::value<unsigned int>(),
+     "Load N independent copies of the world, each on its own thread.")
+    ("extra_world", po::value<std::vector<std::string> >(),
+     "Load an additional world, simulated on its own thread.")
     ("minimal_comms", "Reduce the TCP/IP traffic output by gzserver")
     ("server-plugin,s", po::value<std::vector<std::string> >(),
      "Load a plugin.")
@@ -290,8 +369,29 @@ bool Server::ParseArgs(int _argc, char **_argv)
   {
     this->dataPtr->lockstep = true;
   }
+  if (this->dataPtr->vm.count("lockstep_pipelined"))
+  {
+    this->dataPtr->lockstep = true;
+    this->dataPtr->lockstepPipelined = true;
+  }
   rendering::set_lockstep_enabled(this->dataPtr->lockstep);
 
+  // Multiple worlds are only supported when loading from world files.
+  if (!this->dataPtr->vm.count("play"))
+  {
+    if (this->dataPtr->vm.count("world_copies"))
+    {
+      this->dataPtr->worldCopies = std::max(1u,
+          this->dataPtr->vm["world_copies"].as<unsigned int>());
+    }
+
+    if (this->dataPtr->vm.count("extra_world"))
+    {
+      this->dataPtr->extraWorlds =
+        this->dataPtr->vm["extra_world"].as<std::vector<std::string> >();
+    }
+  }
+
   if (!this->PreLoad())
   {
     gzerr << "Unable to load gazebo\n";
@@ -443,42 +543,46 @@ bool Server::LoadImpl(sdf::ElementPtr _elem,
                       const std::string &_physics)
 {
   // If a physics engine is specified,
-  if (_physics.length())
+  OverridePhysics(_elem, _physics);
+
+  sdf::ElementPtr worldElem = _elem->GetElement("world");
+  if (worldElem)
   {
-    // Check if physics engine name is valid
-    // This must be done after physics::load();
-    if (!physics::PhysicsFactory::IsRegistered(_physics))
-    {
-      gzerr << "Unregistered physics engine [" << _physics
-            << "], the default will be used instead.\n";
-    }
-    // Try inserting physics engine name if one is given
-    else if (_elem->HasElement("world") &&
-             _elem->GetElement("world")->HasElement("physics"))
+    if (this->dataPtr->worldCopies <= 1)
     {
-      _elem->GetElement("world")->GetElement("physics")
-           ->GetAttribute("type")->Set(_physics);
+      LoadWorldElem(worldElem);
     }
     else
     {
-      gzerr << "Cannot set physics engine: <world> does not have <physics>\n";
+      // Each copy gets its own name, and therefore its own topic namespace.
+      // Meshes are loaded once through the MeshManager, and shared.
+      const std::string baseName = worldElem->Get<std::string>("name");
+      for (unsigned int i = 0; i < this->dataPtr->worldCopies; ++i)
+      {
+        sdf::ElementPtr copyElem = worldElem->Clone();
+        copyElem->GetAttribute("name")->Set(baseName + "_" +
+            std::to_string(i));
+        LoadWorldElem(copyElem);
+      }
     }
   }
 
-  sdf::ElementPtr worldElem = _elem->GetElement("world");
-  if (worldElem)
+  // Load the additional worlds
+  for (auto const &filename : this->dataPtr->extraWorlds)
   {
-    physics::WorldPtr world = physics::create_world();
-
-    // Create the world
-    try
-    {
-      physics::load_world(world, worldElem);
-    }
-    catch(common::Exception &e)
+    sdf::SDFPtr sdf(new sdf::SDF);
+    if (!sdf::init(sdf) || !sdf::readFile(common::find_file(filename), sdf))
     {
-      gzthrow("Failed to load the World\n"  << e);
+      gzerr << "Unable to read sdf file[" << filename << "]\n";
+      continue;
     }
+
+    OverridePhysics(sdf->Root(), _physics);
+
+    if (sdf->Root()->HasElement("world"))
+      LoadWorldElem(sdf->Root()->GetElement("world"));
+    else
+      gzerr << "File[" << filename << "] does not contain a <world>\n";
   }
 
   this->dataPtr->node = transport::NodePtr(new transport::Node());
@@ -511,6 +615,7 @@ bool Server::LoadImpl(sdf::ElementPtr _elem,
     physics::init_worlds(rendering::update_scene_poses);
   else
     physics::init_worlds(nullptr);
+  physics::set_worlds_sensor_pipelining(this->dataPtr->lockstepPipelined);
 
   this->dataPtr->stop = false;
 
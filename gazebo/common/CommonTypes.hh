@@ -80,6 +80,7 @@ namespace gazebo
     class SubMesh;
     class MouseEvent;
     class NumericAnimation;
+    class Pacer;
     class Param;
     class PoseAnimation;
     class SkeletonAnimation;
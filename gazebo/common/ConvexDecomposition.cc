@@ -0,0 +1,958 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+#include <tuple>
+#include <unordered_map>
+
+#include <boost/filesystem.hpp>
+
+#include "gazebo/common/Console.hh"
+#include "gazebo/common/MeshCache.hh"
+#include "gazebo/common/ConvexDecomposition.hh"
+
+using namespace gazebo;
+using namespace common;
+
+namespace
+{
+  /// \brief Magic number at the start of cache files.
+  const char kMagic[4] = {'G', 'Z', 'H', 'L'};
+
+  /// \brief Version of the cache files, and of the decomposition
+  /// algorithm. Increment it when either changes.
+  const uint32_t kVersion = 1;
+
+  /// \brief Extension of cache files.
+  const char kExtension[] = ".gzhulls";
+
+  /// \brief Maximum number of points whose depth is measured per part.
+  const size_t kMaxDepthSamples = 4096;
+
+  /// \brief Plane of a hull face, n.p = d with n pointing out.
+  struct Plane
+  {
+    /// \brief Unit normal.
+    ignition::math::Vector3d n;
+
+    /// \brief Offset.
+    double d;
+  };
+
+  /// \brief Face of a hull being built by quickhull.
+  struct HullFace
+  {
+    /// \brief Vertex indices, counter-clockwise seen from outside.
+    unsigned int v[3];
+
+    /// \brief Plane of the face.
+    Plane plane;
+
+    /// \brief Points outside of the face, not assigned to another face.
+    std::vector<unsigned int> outside;
+
+    /// \brief True once the face is replaced.
+    bool removed;
+
+    /// \brief Last iteration that visited the face.
+    unsigned int visited;
+  };
+
+  /// \brief Piece of the mesh approximated by one hull.
+  struct Part
+  {
+    /// \brief Vertices of the triangles of the piece, three per triangle.
+    /// Triangles cut by a split are clipped, so they don't share vertices
+    /// with the mesh.
+    std::vector<ignition::math::Vector3d> triangles;
+
+    /// \brief Hull of the vertices of the triangles.
+    ConvexHull hull;
+
+    /// \brief Largest distance from a triangle to the hull.
+    double depth = 0;
+
+    /// \brief Point at that distance.
+    ignition::math::Vector3d deepest;
+
+    /// \brief True if the part can't be split.
+    bool final = false;
+  };
+
+  /////////////////////////////////////////////////
+  /// \brief Compute the plane of a triangle.
+  /// \param[in] _a First vertex.
+  /// \param[in] _b Second vertex.
+  /// \param[in] _c Third vertex.
+  /// \return The plane, with a zero normal if the triangle is degenerate.
+  Plane trianglePlane(const ignition::math::Vector3d &_a,
+      const ignition::math::Vector3d &_b, const ignition::math::Vector3d &_c)
+  {
+    Plane plane;
+    plane.n = (_b - _a).Cross(_c - _a);
+    const double length = plane.n.Length();
+    if (length > 0)
+      plane.n /= length;
+    else
+      plane.n.Set(0, 0, 0);
+    plane.d = plane.n.Dot(_a);
+    return plane;
+  }
+
+  /////////////////////////////////////////////////
+  /// \brief Key of a directed edge.
+  /// \param[in] _a Start vertex.
+  /// \param[in] _b End vertex.
+  /// \return The key.
+  uint64_t edgeKey(const unsigned int _a, const unsigned int _b)
+  {
+    return (static_cast<uint64_t>(_a) << 32) | _b;
+  }
+
+  /////////////////////////////////////////////////
+  /// \brief Update a 64-bit FNV-1a hash.
+  /// \param[in] _hash Current hash.
+  /// \param[in] _data Bytes to hash.
+  /// \param[in] _size Number of bytes.
+  /// \return Updated hash.
+  uint64_t fnv1a(uint64_t _hash, const void *_data, const size_t _size)
+  {
+    const unsigned char *data = static_cast<const unsigned char *>(_data);
+    for (size_t i = 0; i < _size; ++i)
+    {
+      _hash ^= data[i];
+      _hash *= 1099511628211ULL;
+    }
+    return _hash;
+  }
+
+  /////////////////////////////////////////////////
+  /// \brief Append a value to a buffer.
+  /// \param[in,out] _buffer The buffer.
+  /// \param[in] _value The value.
+  template<typename T>
+  void append(std::string &_buffer, const T &_value)
+  {
+    _buffer.append(reinterpret_cast<const char *>(&_value), sizeof(T));
+  }
+
+  /// \brief Reads values from a buffer, checking its bounds.
+  class Reader
+  {
+    /// \brief Constructor.
+    /// \param[in] _data The buffer.
+    public: explicit Reader(const std::string &_data)
+      : data(_data)
+    {
+    }
+
+    /// \brief Read a value.
+    /// \param[out] _value The value.
+    /// \return False if the buffer is too short.
+    public: template<typename T> bool Read(T &_value)
+    {
+      if (this->data.size() - this->offset < sizeof(T))
+        return false;
+      std::memcpy(&_value, this->data.data() + this->offset, sizeof(T));
+      this->offset += sizeof(T);
+      return true;
+    }
+
+    /// \brief Get the number of bytes left.
+    /// \return Number of bytes.
+    public: size_t Left() const
+    {
+      return this->data.size() - this->offset;
+    }
+
+    /// \brief The buffer.
+    private: const std::string &data;
+
+    /// \brief Offset of the next value.
+    private: size_t offset = 0;
+  };
+}
+
+namespace gazebo
+{
+  namespace common
+  {
+    /// \internal
+    /// \brief Private data for ConvexDecomposition.
+    class ConvexDecompositionPrivate
+    {
+      /// \brief Compute the hull of the vertices of a part, and its depth.
+      /// \param[in,out] _part The part.
+      /// \return False if the part is flat.
+      public: static bool Evaluate(Part &_part);
+
+      /// \brief Split a part in two with an axis aligned plane.
+      /// \param[in] _part The part.
+      /// \param[out] _first Half below the plane.
+      /// \param[out] _second Half above the plane.
+      /// \return False if the part can't be split in two parts that are
+      /// not flat.
+      public: static bool Split(const Part &_part, Part &_first,
+                  Part &_second);
+
+      /// \brief Compute the key of a decomposition in the cache.
+      /// \param[in] _vertices Vertices of the mesh.
+      /// \param[in] _indices Vertex indices of the triangles of the mesh.
+      /// \return The key.
+      public: uint64_t Key(
+                  const std::vector<ignition::math::Vector3d> &_vertices,
+                  const std::vector<unsigned int> &_indices) const;
+
+      /// \brief Load a decomposition from a cache file.
+      /// \param[in] _filename Path to the cache file.
+      /// \param[in] _key Key of the decomposition.
+      /// \param[out] _hulls The hulls.
+      /// \return False if the file doesn't exist, is invalid, or holds
+      /// another decomposition.
+      public: static bool Load(const std::string &_filename,
+                  const uint64_t _key, std::vector<ConvexHull> &_hulls);
+
+      /// \brief Save a decomposition to a cache file.
+      /// \param[in] _filename Path to the cache file.
+      /// \param[in] _key Key of the decomposition.
+      /// \param[in] _hulls The hulls.
+      /// \return False if the file can't be written.
+      public: static bool Save(const std::string &_filename,
+                  const uint64_t _key, const std::vector<ConvexHull> &_hulls);
+
+      /// \brief Maximum number of hulls.
+      public: unsigned int maxHulls = 16;
+
+      /// \brief Concavity below which a part is not split.
+      public: double concavity = 0.02;
+    };
+  }
+}
+
+/////////////////////////////////////////////////
+ConvexDecomposition::ConvexDecomposition()
+  : dataPtr(new ConvexDecompositionPrivate)
+{
+}
+
+/////////////////////////////////////////////////
+ConvexDecomposition::~ConvexDecomposition()
+{
+}
+
+/////////////////////////////////////////////////
+void ConvexDecomposition::SetMaxHulls(const unsigned int _count)
+{
+  this->dataPtr->maxHulls = std::max(_count, 1u);
+}
+
+/////////////////////////////////////////////////
+unsigned int ConvexDecomposition::MaxHulls() const
+{
+  return this->dataPtr->maxHulls;
+}
+
+/////////////////////////////////////////////////
+void ConvexDecomposition::SetConcavity(const double _concavity)
+{
+  this->dataPtr->concavity = std::max(_concavity, 0.0);
+}
+
+/////////////////////////////////////////////////
+double ConvexDecomposition::Concavity() const
+{
+  return this->dataPtr->concavity;
+}
+
+/////////////////////////////////////////////////
+std::vector<ConvexHull> ConvexDecomposition::Decompose(
+    const std::vector<ignition::math::Vector3d> &_vertices,
+    const std::vector<unsigned int> &_indices) const
+{
+  std::vector<ConvexHull> hulls;
+
+  // Ignore the triangles that reference missing vertices
+  Part whole;
+  ignition::math::Vector3d min(ignition::math::MAX_D, ignition::math::MAX_D,
+      ignition::math::MAX_D);
+  ignition::math::Vector3d max(-min);
+  for (unsigned int t = 0; t + 2 < _indices.size(); t += 3)
+  {
+    if (_indices[t] >= _vertices.size() ||
+        _indices[t + 1] >= _vertices.size() ||
+        _indices[t + 2] >= _vertices.size())
+    {
+      continue;
+    }
+
+    for (unsigned int i = 0; i < 3; ++i)
+    {
+      whole.triangles.push_back(_vertices[_indices[t + i]]);
+      min.Min(whole.triangles.back());
+      max.Max(whole.triangles.back());
+    }
+  }
+
+  if (whole.triangles.empty() ||
+      !ConvexDecompositionPrivate::Evaluate(whole))
+  {
+    return hulls;
+  }
+
+  const double threshold = this->dataPtr->concavity * (max - min).Length();
+
+  std::vector<Part> parts;
+  parts.push_back(std::move(whole));
+
+  // Split the most concave part until all parts are close enough to
+  // their hull.
+  while (parts.size() < this->dataPtr->maxHulls)
+  {
+    int deepest = -1;
+    for (unsigned int i = 0; i < parts.size(); ++i)
+    {
+      if (!parts[i].final && parts[i].depth > threshold &&
+          (deepest < 0 || parts[i].depth > parts[deepest].depth))
+      {
+        deepest = i;
+      }
+    }
+
+    if (deepest < 0)
+      break;
+
+    Part first, second;
+    if (!ConvexDecompositionPrivate::Split(parts[deepest], first, second))
+    {
+      parts[deepest].final = true;
+      continue;
+    }
+
+    parts[deepest] = std::move(first);
+    parts.push_back(std::move(second));
+  }
+
+  for (auto &part : parts)
+    hulls.push_back(std::move(part.hull));
+
+  return hulls;
+}
+
+/////////////////////////////////////////////////
+std::vector<ConvexHull> ConvexDecomposition::Decompose(
+    const std::vector<ignition::math::Vector3d> &_vertices,
+    const std::vector<unsigned int> &_indices,
+    const std::string &_cacheFilename) const
+{
+  const uint64_t key = this->dataPtr->Key(_vertices, _indices);
+
+  std::ostringstream stream;
+  stream << MeshCache::DefaultPath() << "/" << std::hex << std::setw(16)
+         << std::setfill('0') << key << kExtension;
+  const std::string fallbackFilename = stream.str();
+
+  std::vector<ConvexHull> hulls;
+  if ((!_cacheFilename.empty() &&
+       ConvexDecompositionPrivate::Load(_cacheFilename, key, hulls)) ||
+      ConvexDecompositionPrivate::Load(fallbackFilename, key, hulls))
+  {
+    return hulls;
+  }
+
+  hulls = this->Decompose(_vertices, _indices);
+
+  // Model directories are often read only, in which case the result is
+  // stored in the mesh cache directory.
+  if ((_cacheFilename.empty() ||
+       !ConvexDecompositionPrivate::Save(_cacheFilename, key, hulls)) &&
+      !ConvexDecompositionPrivate::Save(fallbackFilename, key, hulls))
+  {
+    gzwarn << "Unable to write convex decomposition cache file["
+           << fallbackFilename << "]\n";
+  }
+
+  return hulls;
+}
+
+/////////////////////////////////////////////////
+std::string ConvexDecomposition::CacheFilename(
+    const std::string &_meshFilename, const std::string &_submesh)
+{
+  std::string filename = _meshFilename;
+  if (!_submesh.empty())
+  {
+    filename += ".";
+    for (auto const c : _submesh)
+    {
+      filename += std::isalnum(static_cast<unsigned char>(c)) ||
+        c == '-' || c == '_' ? c : '_';
+    }
+  }
+  return filename + kExtension;
+}
+
+/////////////////////////////////////////////////
+bool ConvexDecomposition::Hull(
+    const std::vector<ignition::math::Vector3d> &_points, ConvexHull &_hull)
+{
+  _hull.vertices.clear();
+  _hull.indices.clear();
+
+  if (_points.size() < 4)
+    return false;
+
+  // Tolerance relative to the size of the point set
+  ignition::math::Vector3d min(_points[0]), max(_points[0]);
+  for (auto const &p : _points)
+  {
+    min.Min(p);
+    max.Max(p);
+  }
+  const double eps = 1e-9 * std::max((max - min).Length(), 1e-12);
+
+  // Initial tetrahedron: the two most distant extreme points, the point
+  // furthest from their line, and the point furthest from their plane.
+  unsigned int extremes[6] = {0, 0, 0, 0, 0, 0};
+  for (unsigned int i = 0; i < _points.size(); ++i)
+  {
+    for (unsigned int axis = 0; axis < 3; ++axis)
+    {
+      if (_points[i][axis] < _points[extremes[axis * 2]][axis])
+        extremes[axis * 2] = i;
+      if (_points[i][axis] > _points[extremes[axis * 2 + 1]][axis])
+        extremes[axis * 2 + 1] = i;
+    }
+  }
+
+  unsigned int v0 = 0, v1 = 0;
+  double best = -1;
+  for (unsigned int i = 0; i < 6; ++i)
+  {
+    for (unsigned int j = i + 1; j < 6; ++j)
+    {
+      const double dist =
+        _points[extremes[i]].Distance(_points[extremes[j]]);
+      if (dist > best)
+      {
+        best = dist;
+        v0 = extremes[i];
+        v1 = extremes[j];
+      }
+    }
+  }
+
+  if (best <= eps)
+    return false;
+
+  const ignition::math::Vector3d dir =
+    (_points[v1] - _points[v0]).Normalize();
+  unsigned int v2 = 0;
+  best = -1;
+  for (unsigned int i = 0; i < _points.size(); ++i)
+  {
+    const double dist = (_points[i] - _points[v0]).Cross(dir).Length();
+    if (dist > best)
+    {
+      best = dist;
+      v2 = i;
+    }
+  }
+
+  if (best <= eps)
+    return false;
+
+  const Plane base = trianglePlane(_points[v0], _points[v1], _points[v2]);
+  unsigned int v3 = 0;
+  best = -1;
+  for (unsigned int i = 0; i < _points.size(); ++i)
+  {
+    const double dist = std::abs(base.n.Dot(_points[i]) - base.d);
+    if (dist > best)
+    {
+      best = dist;
+      v3 = i;
+    }
+  }
+
+  if (best <= eps)
+    return false;
+
+  std::vector<HullFace> faces;
+  std::unordered_map<uint64_t, unsigned int> edges;
+
+  auto addFace = [&](const unsigned int _a, const unsigned int _b,
+      const unsigned int _c)
+  {
+    HullFace face;
+    face.v[0] = _a;
+    face.v[1] = _b;
+    face.v[2] = _c;
+    face.plane = trianglePlane(_points[_a], _points[_b], _points[_c]);
+    face.removed = false;
+    face.visited = 0;
+    for (unsigned int i = 0; i < 3; ++i)
+      edges[edgeKey(face.v[i], face.v[(i + 1) % 3])] = faces.size();
+    faces.push_back(std::move(face));
+  };
+
+  // Orient the faces of the tetrahedron away from its fourth vertex
+  const unsigned int tetra[4] = {v0, v1, v2, v3};
+  for (unsigned int i = 0; i < 4; ++i)
+  {
+    unsigned int a = tetra[(i + 1) % 4];
+    unsigned int b = tetra[(i + 2) % 4];
+    unsigned int c = tetra[(i + 3) % 4];
+    const Plane plane = trianglePlane(_points[a], _points[b], _points[c]);
+    if (plane.n.Dot(_points[tetra[i]]) - plane.d > 0)
+      std::swap(b, c);
+    addFace(a, b, c);
+  }
+
+  // Assign each point to a face it is outside of
+  auto assign = [&](const unsigned int _point, const unsigned int _first)
+  {
+    int bestFace = -1;
+    double bestDist = eps;
+    for (unsigned int f = _first; f < faces.size(); ++f)
+    {
+      const double dist =
+        faces[f].plane.n.Dot(_points[_point]) - faces[f].plane.d;
+      if (!faces[f].removed && dist > bestDist)
+      {
+        bestDist = dist;
+        bestFace = f;
+      }
+    }
+    if (bestFace >= 0)
+      faces[bestFace].outside.push_back(_point);
+  };
+
+  for (unsigned int i = 0; i < _points.size(); ++i)
+  {
+    if (i != v0 && i != v1 && i != v2 && i != v3)
+      assign(i, 0);
+  }
+
+  for (unsigned int f = 0; f < faces.size(); ++f)
+  {
+    if (faces[f].removed || faces[f].outside.empty())
+      continue;
+
+    // Furthest point outside of the face
+    unsigned int eye = faces[f].outside[0];
+    best = -1;
+    for (auto const p : faces[f].outside)
+    {
+      const double dist = faces[f].plane.n.Dot(_points[p]) - faces[f].plane.d;
+      if (dist > best)
+      {
+        best = dist;
+        eye = p;
+      }
+    }
+
+    // Faces visible from the point, and the edges of the horizon
+    std::vector<unsigned int> visible = {f};
+    std::vector<std::pair<unsigned int, unsigned int>> horizon;
+    faces[f].visited = f + 1;
+    for (unsigned int i = 0; i < visible.size(); ++i)
+    {
+      const HullFace &face = faces[visible[i]];
+      for (unsigned int e = 0; e < 3; ++e)
+      {
+        const unsigned int a = face.v[e];
+        const unsigned int b = face.v[(e + 1) % 3];
+        auto neighbor = edges.find(edgeKey(b, a));
+        if (neighbor == edges.end())
+          continue;
+
+        const unsigned int n = neighbor->second;
+        if (faces[n].visited == f + 1)
+          continue;
+
+        if (faces[n].plane.n.Dot(_points[eye]) - faces[n].plane.d > eps)
+        {
+          faces[n].visited = f + 1;
+          visible.push_back(n);
+        }
+        else
+        {
+          horizon.push_back(std::make_pair(a, b));
+        }
+      }
+    }
+
+    // Replace the visible faces by a cone from the horizon to the point
+    std::vector<unsigned int> orphans;
+    for (auto const v : visible)
+    {
+      faces[v].removed = true;
+      for (unsigned int e = 0; e < 3; ++e)
+        edges.erase(edgeKey(faces[v].v[e], faces[v].v[(e + 1) % 3]));
+      for (auto const p : faces[v].outside)
+      {
+        if (p != eye)
+          orphans.push_back(p);
+      }
+      faces[v].outside.clear();
+    }
+
+    const unsigned int first = faces.size();
+    for (auto const &edge : horizon)
+      addFace(edge.first, edge.second, eye);
+
+    for (auto const p : orphans)
+      assign(p, first);
+  }
+
+  // Keep the vertices of the remaining faces
+  std::unordered_map<unsigned int, unsigned int> remap;
+  for (auto const &face : faces)
+  {
+    if (face.removed)
+      continue;
+
+    for (unsigned int i = 0; i < 3; ++i)
+    {
+      auto it = remap.find(face.v[i]);
+      if (it == remap.end())
+      {
+        it = remap.emplace(face.v[i], _hull.vertices.size()).first;
+        _hull.vertices.push_back(_points[face.v[i]]);
+      }
+      _hull.indices.push_back(it->second);
+    }
+  }
+
+  return true;
+}
+
+/////////////////////////////////////////////////
+bool ConvexDecompositionPrivate::Evaluate(Part &_part)
+{
+  std::vector<ignition::math::Vector3d> points = _part.triangles;
+  auto less = [](const ignition::math::Vector3d &_a,
+      const ignition::math::Vector3d &_b)
+  {
+    return std::make_tuple(_a.X(), _a.Y(), _a.Z()) <
+      std::make_tuple(_b.X(), _b.Y(), _b.Z());
+  };
+  std::sort(points.begin(), points.end(), less);
+  points.erase(std::unique(points.begin(), points.end()), points.end());
+
+  if (!ConvexDecomposition::Hull(points, _part.hull))
+    return false;
+
+  std::vector<Plane> planes;
+  for (unsigned int i = 0; i + 2 < _part.hull.indices.size(); i += 3)
+  {
+    const Plane plane = trianglePlane(
+        _part.hull.vertices[_part.hull.indices[i]],
+        _part.hull.vertices[_part.hull.indices[i + 1]],
+        _part.hull.vertices[_part.hull.indices[i + 2]]);
+    if (plane.n != ignition::math::Vector3d::Zero)
+      planes.push_back(plane);
+  }
+
+  // The depth of the part is the largest distance from its vertices and
+  // the centroids of its triangles to the surface of the hull.
+  auto depth = [&planes](const ignition::math::Vector3d &_p)
+  {
+    double result = ignition::math::MAX_D;
+    for (auto const &plane : planes)
+      result = std::min(result, plane.d - plane.n.Dot(_p));
+    return result;
+  };
+
+  _part.depth = 0;
+  const size_t triangleCount = _part.triangles.size() / 3;
+  const size_t samples = points.size() + triangleCount;
+  const size_t stride = std::max<size_t>(samples / kMaxDepthSamples, 1);
+  for (size_t i = 0; i < samples; i += stride)
+  {
+    ignition::math::Vector3d p;
+    if (i < points.size())
+    {
+      p = points[i];
+    }
+    else
+    {
+      const size_t t = (i - points.size()) * 3;
+      p = (_part.triangles[t] + _part.triangles[t + 1] +
+           _part.triangles[t + 2]) / 3.0;
+    }
+
+    const double d = depth(p);
+    if (d > _part.depth)
+    {
+      _part.depth = d;
+      _part.deepest = p;
+    }
+  }
+
+  return true;
+}
+
+/////////////////////////////////////////////////
+bool ConvexDecompositionPrivate::Split(const Part &_part, Part &_first,
+    Part &_second)
+{
+  ignition::math::Vector3d min(ignition::math::MAX_D, ignition::math::MAX_D,
+      ignition::math::MAX_D);
+  ignition::math::Vector3d max(-min);
+  for (auto const &v : _part.triangles)
+  {
+    min.Min(v);
+    max.Max(v);
+  }
+
+  // Try the axes from the longest to the shortest
+  const ignition::math::Vector3d extent = max - min;
+  unsigned int axes[3] = {0, 1, 2};
+  std::sort(axes, axes + 3, [&extent](const unsigned int _a,
+        const unsigned int _b)
+      {
+        return extent[_a] > extent[_b];
+      });
+
+  for (auto const axis : axes)
+  {
+    if (extent[axis] <= 0)
+      break;
+
+    // Cut through the deepest point, unless it would leave a sliver
+    double cut = _part.deepest[axis];
+    if (cut < min[axis] + 0.1 * extent[axis] ||
+        cut > max[axis] - 0.1 * extent[axis])
+    {
+      cut = min[axis] + 0.5 * extent[axis];
+    }
+
+    _first = Part();
+    _second = Part();
+    for (size_t t = 0; t + 2 < _part.triangles.size(); t += 3)
+    {
+      const ignition::math::Vector3d *tri = &_part.triangles[t];
+
+      // A triangle in the plane goes to the side its back faces, where
+      // the inside of the mesh is.
+      if (tri[0][axis] == cut && tri[1][axis] == cut && tri[2][axis] == cut)
+      {
+        Part &side = (tri[1] - tri[0]).Cross(tri[2] - tri[0])[axis] > 0 ?
+          _first : _second;
+        side.triangles.insert(side.triangles.end(), tri, tri + 3);
+        continue;
+      }
+
+      // Clip the triangle against both sides of the plane, and add the
+      // resulting polygons as triangle fans.
+      for (auto *side : {&_first, &_second})
+      {
+        const double sign = side == &_first ? -1.0 : 1.0;
+        std::vector<ignition::math::Vector3d> polygon;
+        for (unsigned int i = 0; i < 3; ++i)
+        {
+          const ignition::math::Vector3d &a = tri[i];
+          const ignition::math::Vector3d &b = tri[(i + 1) % 3];
+          const double da = sign * (a[axis] - cut);
+          const double db = sign * (b[axis] - cut);
+          if (da >= 0)
+            polygon.push_back(a);
+          if ((da < 0 && db > 0) || (da > 0 && db < 0))
+            polygon.push_back(a + (b - a) * (da / (da - db)));
+        }
+
+        for (size_t i = 1; i + 1 < polygon.size(); ++i)
+        {
+          side->triangles.push_back(polygon[0]);
+          side->triangles.push_back(polygon[i]);
+          side->triangles.push_back(polygon[i + 1]);
+        }
+      }
+    }
+
+    if (!_first.triangles.empty() && !_second.triangles.empty() &&
+        Evaluate(_first) && Evaluate(_second))
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/////////////////////////////////////////////////
+uint64_t ConvexDecompositionPrivate::Key(
+    const std::vector<ignition::math::Vector3d> &_vertices,
+    const std::vector<unsigned int> &_indices) const
+{
+  uint64_t hash = fnv1a(14695981039346656037ULL, &kVersion,
+      sizeof(kVersion));
+  hash = fnv1a(hash, &this->maxHulls, sizeof(this->maxHulls));
+  hash = fnv1a(hash, &this->concavity, sizeof(this->concavity));
+  for (auto const &v : _vertices)
+  {
+    const double xyz[3] = {v.X(), v.Y(), v.Z()};
+    hash = fnv1a(hash, xyz, sizeof(xyz));
+  }
+  if (!_indices.empty())
+  {
+    hash = fnv1a(hash, _indices.data(),
+        _indices.size() * sizeof(_indices[0]));
+  }
+  return hash;
+}
+
+/////////////////////////////////////////////////
+bool ConvexDecompositionPrivate::Load(const std::string &_filename,
+    const uint64_t _key, std::vector<ConvexHull> &_hulls)
+{
+  std::ifstream file(_filename, std::ios::binary);
+  if (!file)
+    return false;
+
+  const std::string data((std::istreambuf_iterator<char>(file)),
+      std::istreambuf_iterator<char>());
+  Reader reader(data);
+
+  char magic[4];
+  uint32_t version;
+  uint64_t key;
+  uint32_t hullCount;
+  if (!reader.Read(magic) || std::memcmp(magic, kMagic, 4) != 0 ||
+      !reader.Read(version) || version != kVersion ||
+      !reader.Read(key) || !reader.Read(hullCount))
+  {
+    gzwarn << "Ignoring invalid convex decomposition cache file["
+           << _filename << "]\n";
+    return false;
+  }
+
+  // The file holds the decomposition of a previous version of the mesh
+  if (key != _key)
+    return false;
+
+  std::vector<ConvexHull> hulls;
+  for (uint32_t h = 0; h < hullCount; ++h)
+  {
+    uint32_t vertexCount, indexCount;
+    if (!reader.Read(vertexCount) || !reader.Read(indexCount) ||
+        indexCount % 3 != 0 ||
+        reader.Left() / (3 * sizeof(double)) < vertexCount)
+    {
+      break;
+    }
+
+    ConvexHull hull;
+    hull.vertices.resize(vertexCount);
+    for (auto &v : hull.vertices)
+    {
+      double xyz[3] = {0, 0, 0};
+      reader.Read(xyz);
+      v.Set(xyz[0], xyz[1], xyz[2]);
+    }
+
+    if (reader.Left() / sizeof(uint32_t) < indexCount)
+      break;
+
+    hull.indices.resize(indexCount);
+    for (auto &i : hull.indices)
+    {
+      uint32_t index = 0;
+      reader.Read(index);
+      i = index;
+    }
+
+    if (std::any_of(hull.indices.begin(), hull.indices.end(),
+          [vertexCount](const unsigned int _i) {return _i >= vertexCount;}))
+    {
+      break;
+    }
+
+    hulls.push_back(std::move(hull));
+  }
+
+  if (hulls.size() != hullCount || reader.Left() != 0)
+  {
+    gzwarn << "Ignoring invalid convex decomposition cache file["
+           << _filename << "]\n";
+    return false;
+  }
+
+  _hulls = std::move(hulls);
+  return true;
+}
+
+/////////////////////////////////////////////////
+bool ConvexDecompositionPrivate::Save(const std::string &_filename,
+    const uint64_t _key, const std::vector<ConvexHull> &_hulls)
+{
+  std::string data;
+  data.append(kMagic, 4);
+  append(data, kVersion);
+  append(data, _key);
+  append(data, static_cast<uint32_t>(_hulls.size()));
+  for (auto const &hull : _hulls)
+  {
+    append(data, static_cast<uint32_t>(hull.vertices.size()));
+    append(data, static_cast<uint32_t>(hull.indices.size()));
+    for (auto const &v : hull.vertices)
+    {
+      append(data, v.X());
+      append(data, v.Y());
+      append(data, v.Z());
+    }
+    for (auto const i : hull.indices)
+      append(data, static_cast<uint32_t>(i));
+  }
+
+  try
+  {
+    const boost::filesystem::path filename(_filename);
+    if (filename.has_parent_path())
+      boost::filesystem::create_directories(filename.parent_path());
+
+    // Write to a unique temporary file, then rename it, so that readers
+    // never see a partial file.
+    boost::filesystem::path tmpFilename = _filename +
+      boost::filesystem::unique_path(".%%%%-%%%%-%%%%.tmp").string();
+    {
+      std::ofstream file(tmpFilename.string(), std::ios::binary);
+      file.write(data.data(), data.size());
+      if (!file)
+      {
+        file.close();
+        boost::filesystem::remove(tmpFilename);
+        return false;
+      }
+    }
+    boost::filesystem::rename(tmpFilename, filename);
+  }
+  catch(boost::filesystem::filesystem_error &)
+  {
+    return false;
+  }
+
+  return true;
+}
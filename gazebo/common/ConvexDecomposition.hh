@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GAZEBO_COMMON_CONVEXDECOMPOSITION_HH_
+#define GAZEBO_COMMON_CONVEXDECOMPOSITION_HH_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ignition/math/Vector3.hh>
+
+#include "gazebo/util/system.hh"
+
+namespace gazebo
+{
+  namespace common
+  {
+    // Forward declare private data class
+    class ConvexDecompositionPrivate;
+
+    /// \addtogroup gazebo_common Common
+    /// \{
+
+    /// \class ConvexHull ConvexDecomposition.hh common/common.hh
+    /// \brief A convex polyhedron, as a triangle mesh.
+    class GZ_COMMON_VISIBLE ConvexHull
+    {
+      /// \brief Vertices of the hull.
+      public: std::vector<ignition::math::Vector3d> vertices;
+
+      /// \brief Vertex indices of the triangles of the hull, three per
+      /// triangle. Triangles are counter-clockwise seen from outside.
+      public: std::vector<unsigned int> indices;
+    };
+
+    /// \class ConvexDecomposition ConvexDecomposition.hh common/common.hh
+    /// \brief Approximate a concave triangle mesh by a set of convex hulls.
+    ///
+    /// The triangles of the mesh are split recursively. Each step splits
+    /// the part whose convex hull is furthest from its triangles, the most
+    /// concave one, with a plane through its deepest point, until every
+    /// part is close enough to its hull or the maximum number of hulls is
+    /// reached. Each part is then replaced by its hull.
+    class GZ_COMMON_VISIBLE ConvexDecomposition
+    {
+      /// \brief Constructor.
+      public: ConvexDecomposition();
+
+      /// \brief Destructor.
+      public: virtual ~ConvexDecomposition();
+
+      /// \brief Set the maximum number of hulls.
+      /// \param[in] _count Maximum number of hulls, at least 1.
+      public: void SetMaxHulls(const unsigned int _count);
+
+      /// \brief Get the maximum number of hulls.
+      /// \return Maximum number of hulls. Defaults to 16.
+      public: unsigned int MaxHulls() const;
+
+      /// \brief Set the concavity below which a part is not split.
+      /// \param[in] _concavity Maximum distance from the triangles of a
+      /// part to its hull, as a fraction of the diagonal of the bounding
+      /// box of the mesh.
+      public: void SetConcavity(const double _concavity);
+
+      /// \brief Get the concavity below which a part is not split.
+      /// \return The concavity. Defaults to 0.02.
+      public: double Concavity() const;
+
+      /// \brief Decompose a triangle mesh.
+      /// \param[in] _vertices Vertices of the mesh.
+      /// \param[in] _indices Vertex indices of the triangles.
+      /// \return The convex hulls, or an empty vector if the mesh is flat
+      /// or empty.
+      public: std::vector<ConvexHull> Decompose(
+                  const std::vector<ignition::math::Vector3d> &_vertices,
+                  const std::vector<unsigned int> &_indices) const;
+
+      /// \brief Decompose a triangle mesh, reusing the result stored in a
+      /// cache file by a previous call with the same mesh and parameters.
+      /// The result is stored in _cacheFilename, or in the mesh cache
+      /// directory if _cacheFilename can't be written.
+      /// \param[in] _vertices Vertices of the mesh.
+      /// \param[in] _indices Vertex indices of the triangles.
+      /// \param[in] _cacheFilename Path to the cache file.
+      /// \return The convex hulls, or an empty vector if the mesh is flat
+      /// or empty.
+      /// \sa CacheFilename
+      public: std::vector<ConvexHull> Decompose(
+                  const std::vector<ignition::math::Vector3d> &_vertices,
+                  const std::vector<unsigned int> &_indices,
+                  const std::string &_cacheFilename) const;
+
+      /// \brief Get the path of the cache file of a mesh, next to the mesh.
+      /// \param[in] _meshFilename Path to the mesh file.
+      /// \param[in] _submesh Name of the decomposed submesh, or an empty
+      /// string if the whole mesh is decomposed.
+      /// \return Path to the cache file.
+      public: static std::string CacheFilename(
+                  const std::string &_meshFilename,
+                  const std::string &_submesh = "");
+
+      /// \brief Compute the convex hull of a set of points.
+      /// \param[in] _points The points.
+      /// \param[out] _hull The hull.
+      /// \return False if the points are coplanar, or fewer than four.
+      public: static bool Hull(
+                  const std::vector<ignition::math::Vector3d> &_points,
+                  ConvexHull &_hull);
+
+      /// \internal
+      /// \brief Private data pointer.
+      private: std::unique_ptr<ConvexDecompositionPrivate> dataPtr;
+    };
+    /// \}
+  }
+}
+#endif
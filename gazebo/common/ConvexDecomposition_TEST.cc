@@ -0,0 +1,251 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include <gtest/gtest.h>
+
+#include "gazebo/common/ConvexDecomposition.hh"
+#include "test/util.hh"
+
+using namespace gazebo;
+
+class ConvexDecompositionTest : public gazebo::testing::AutoLogFixture
+{
+  /// \brief Create an empty directory for the cache files.
+  public: virtual void SetUp()
+  {
+    gazebo::testing::AutoLogFixture::SetUp();
+    this->cachePath = boost::filesystem::temp_directory_path() /
+      boost::filesystem::unique_path("gazebo_convex_%%%%-%%%%");
+    boost::filesystem::create_directories(this->cachePath);
+  }
+
+  /// \brief Remove the cache directory.
+  public: virtual void TearDown()
+  {
+    boost::filesystem::remove_all(this->cachePath);
+    gazebo::testing::AutoLogFixture::TearDown();
+  }
+
+  /// \brief Directory of the cache files.
+  public: boost::filesystem::path cachePath;
+};
+
+/////////////////////////////////////////////////
+/// \brief Append the triangles of an axis aligned box to a mesh.
+void addBox(const ignition::math::Vector3d &_min,
+    const ignition::math::Vector3d &_max,
+    std::vector<ignition::math::Vector3d> &_vertices,
+    std::vector<unsigned int> &_indices)
+{
+  const unsigned int first = _vertices.size();
+  for (unsigned int i = 0; i < 8; ++i)
+  {
+    _vertices.push_back(ignition::math::Vector3d(
+          i & 1 ? _max.X() : _min.X(),
+          i & 2 ? _max.Y() : _min.Y(),
+          i & 4 ? _max.Z() : _min.Z()));
+  }
+
+  const unsigned int quads[6][4] = {
+    {0, 2, 3, 1}, {4, 5, 7, 6}, {0, 1, 5, 4},
+    {2, 6, 7, 3}, {0, 4, 6, 2}, {1, 3, 7, 5}};
+  for (auto const &quad : quads)
+  {
+    for (auto const i : {0, 1, 2, 0, 2, 3})
+      _indices.push_back(first + quad[i]);
+  }
+}
+
+/////////////////////////////////////////////////
+/// \brief Check whether a point is inside a hull.
+bool inside(const common::ConvexHull &_hull,
+    const ignition::math::Vector3d &_point)
+{
+  for (unsigned int i = 0; i < _hull.indices.size(); i += 3)
+  {
+    const ignition::math::Vector3d &a = _hull.vertices[_hull.indices[i]];
+    const ignition::math::Vector3d &b = _hull.vertices[_hull.indices[i + 1]];
+    const ignition::math::Vector3d &c = _hull.vertices[_hull.indices[i + 2]];
+    ignition::math::Vector3d n = (b - a).Cross(c - a);
+    n.Normalize();
+    if (n.Dot(_point - a) > 1e-6)
+      return false;
+  }
+  return true;
+}
+
+/////////////////////////////////////////////////
+TEST_F(ConvexDecompositionTest, Hull)
+{
+  std::vector<ignition::math::Vector3d> points;
+  std::vector<unsigned int> indices;
+  addBox(ignition::math::Vector3d(-1, -2, -3),
+      ignition::math::Vector3d(1, 2, 3), points, indices);
+
+  // Interior points and points on the faces are not hull vertices
+  points.push_back(ignition::math::Vector3d(0, 0, 0));
+  points.push_back(ignition::math::Vector3d(0.5, -1, 2));
+  points.push_back(ignition::math::Vector3d(1, 0, 0));
+  points.push_back(ignition::math::Vector3d(0, 2, 3));
+
+  common::ConvexHull hull;
+  ASSERT_TRUE(common::ConvexDecomposition::Hull(points, hull));
+  EXPECT_EQ(8u, hull.vertices.size());
+  EXPECT_EQ(36u, hull.indices.size());
+
+  // All the triangles face out
+  for (auto const &p : points)
+    EXPECT_TRUE(inside(hull, p));
+  EXPECT_FALSE(inside(hull, ignition::math::Vector3d(1.1, 0, 0)));
+  EXPECT_FALSE(inside(hull, ignition::math::Vector3d(0, 0, -3.1)));
+
+  // Flat sets of points have no hull
+  std::vector<ignition::math::Vector3d> flat = {
+    ignition::math::Vector3d(0, 0, 0), ignition::math::Vector3d(1, 0, 0),
+    ignition::math::Vector3d(0, 1, 0), ignition::math::Vector3d(1, 1, 0)};
+  EXPECT_FALSE(common::ConvexDecomposition::Hull(flat, hull));
+  flat.pop_back();
+  EXPECT_FALSE(common::ConvexDecomposition::Hull(flat, hull));
+}
+
+/////////////////////////////////////////////////
+TEST_F(ConvexDecompositionTest, Convex)
+{
+  std::vector<ignition::math::Vector3d> vertices;
+  std::vector<unsigned int> indices;
+  addBox(ignition::math::Vector3d(0, 0, 0),
+      ignition::math::Vector3d(1, 1, 1), vertices, indices);
+
+  common::ConvexDecomposition decomposition;
+  EXPECT_EQ(16u, decomposition.MaxHulls());
+  EXPECT_DOUBLE_EQ(0.02, decomposition.Concavity());
+
+  std::vector<common::ConvexHull> hulls =
+    decomposition.Decompose(vertices, indices);
+  ASSERT_EQ(1u, hulls.size());
+  EXPECT_EQ(8u, hulls[0].vertices.size());
+
+  // A flat mesh has no hull
+  vertices.resize(4);
+  indices = {0, 2, 3, 0, 3, 1};
+  EXPECT_TRUE(decomposition.Decompose(vertices, indices).empty());
+
+  // Triangles with missing vertices are ignored
+  indices = {0, 2, 9};
+  EXPECT_TRUE(decomposition.Decompose(vertices, indices).empty());
+}
+
+/////////////////////////////////////////////////
+TEST_F(ConvexDecompositionTest, Concave)
+{
+  // A U shape
+  std::vector<ignition::math::Vector3d> vertices;
+  std::vector<unsigned int> indices;
+  addBox(ignition::math::Vector3d(0, 0, 0),
+      ignition::math::Vector3d(3, 1, 1), vertices, indices);
+  addBox(ignition::math::Vector3d(0, 0, 1),
+      ignition::math::Vector3d(1, 1, 3), vertices, indices);
+  addBox(ignition::math::Vector3d(2, 0, 1),
+      ignition::math::Vector3d(3, 1, 3), vertices, indices);
+
+  common::ConvexDecomposition decomposition;
+  std::vector<common::ConvexHull> hulls =
+    decomposition.Decompose(vertices, indices);
+  EXPECT_GT(hulls.size(), 1u);
+  EXPECT_LE(hulls.size(), decomposition.MaxHulls());
+
+  // The hulls cover the mesh, but not the inside of the U
+  for (auto const &v : vertices)
+  {
+    bool covered = false;
+    for (auto const &hull : hulls)
+      covered = covered || inside(hull, v);
+    EXPECT_TRUE(covered) << v.X() << " " << v.Y() << " " << v.Z();
+  }
+
+  for (auto const &hull : hulls)
+    EXPECT_FALSE(inside(hull, ignition::math::Vector3d(1.5, 0.5, 2)));
+
+  // The number of hulls is bounded
+  decomposition.SetMaxHulls(1);
+  hulls = decomposition.Decompose(vertices, indices);
+  ASSERT_EQ(1u, hulls.size());
+  EXPECT_TRUE(inside(hulls[0], ignition::math::Vector3d(1.5, 0.5, 2)));
+
+  // A large concavity keeps the mesh whole
+  decomposition.SetMaxHulls(16);
+  decomposition.SetConcavity(1.0);
+  EXPECT_EQ(1u, decomposition.Decompose(vertices, indices).size());
+}
+
+/////////////////////////////////////////////////
+TEST_F(ConvexDecompositionTest, Cache)
+{
+  EXPECT_EQ("/models/m/mesh.dae.gzhulls",
+      common::ConvexDecomposition::CacheFilename("/models/m/mesh.dae"));
+  EXPECT_EQ("/models/m/mesh.dae.arm_1_2.gzhulls",
+      common::ConvexDecomposition::CacheFilename("/models/m/mesh.dae",
+        "arm 1/2"));
+
+  std::vector<ignition::math::Vector3d> vertices;
+  std::vector<unsigned int> indices;
+  addBox(ignition::math::Vector3d(0, 0, 0),
+      ignition::math::Vector3d(3, 1, 1), vertices, indices);
+  addBox(ignition::math::Vector3d(0, 0, 1),
+      ignition::math::Vector3d(1, 1, 3), vertices, indices);
+
+  const std::string filename = (this->cachePath / "l.gzhulls").string();
+  common::ConvexDecomposition decomposition;
+  const std::vector<common::ConvexHull> hulls =
+    decomposition.Decompose(vertices, indices, filename);
+  ASSERT_TRUE(boost::filesystem::exists(filename));
+
+  // A second decomposition is loaded from the cache
+  std::vector<common::ConvexHull> cached =
+    decomposition.Decompose(vertices, indices, filename);
+  ASSERT_EQ(hulls.size(), cached.size());
+  for (unsigned int i = 0; i < hulls.size(); ++i)
+  {
+    EXPECT_EQ(hulls[i].vertices, cached[i].vertices);
+    EXPECT_EQ(hulls[i].indices, cached[i].indices);
+  }
+
+  // Other parameters don't use the cached decomposition
+  decomposition.SetMaxHulls(1);
+  cached = decomposition.Decompose(vertices, indices, filename);
+  EXPECT_EQ(1u, cached.size());
+
+  // Invalid cache files are ignored
+  {
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    file << "GZHL";
+  }
+  cached = decomposition.Decompose(vertices, indices, filename);
+  EXPECT_EQ(1u, cached.size());
+}
+
+/////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -25,7 +25,15 @@
 # pragma GCC diagnostic pop
 #endif
 
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+
+#include <map>
+#include <mutex>
+#include <set>
+
 #include "gazebo/common/Console.hh"
+#include "gazebo/common/Image.hh"
 #include "gazebo/common/ImageHeightmap.hh"
 #include "gazebo/common/HeightmapData.hh"
 #include "gazebo/common/Dem.hh"
@@ -34,6 +42,93 @@
 using namespace gazebo;
 using namespace common;
 
+/// \brief Terrain data loaded by HeightmapDataLoader::Preload, indexed by
+/// filename.
+static std::map<std::string, HeightmapData *> preloaded;
+
+/// \brief Mutex to protect the preloaded terrain data.
+static std::mutex preloadedMutex;
+
+//////////////////////////////////////////////////
+HeightmapData *HeightmapDataLoader::LoadTerrainFile(
+    const std::string &_filename)
+{
+  {
+    std::lock_guard<std::mutex> lock(preloadedMutex);
+    auto iter = preloaded.find(_filename);
+    if (iter != preloaded.end())
+    {
+      HeightmapData *data = iter->second;
+      preloaded.erase(iter);
+      return data;
+    }
+  }
+
+  return LoadTerrainFileImpl(_filename);
+}
+
+//////////////////////////////////////////////////
+unsigned int HeightmapDataLoader::Preload(
+    const std::vector<std::string> &_filenames)
+{
+  std::vector<std::string> filenames;
+  {
+    std::lock_guard<std::mutex> lock(preloadedMutex);
+    std::set<std::string> unique;
+    for (auto const &filename : _filenames)
+    {
+      if (!filename.empty() && preloaded.find(filename) == preloaded.end() &&
+          unique.insert(filename).second)
+      {
+        filenames.push_back(filename);
+      }
+    }
+  }
+
+  if (filenames.empty())
+    return 0;
+
+  // Keep FreeImage initialized while the images are loaded, so that it is
+  // not initialized from several threads.
+  Image keepFreeImageInitialized;
+
+#ifdef HAVE_GDAL
+  GDALAllRegister();
+#endif
+
+  std::vector<HeightmapData *> data(filenames.size(), nullptr);
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, filenames.size(), 1),
+      [&](const tbb::blocked_range<size_t> &_r)
+  {
+    for (size_t i = _r.begin(); i != _r.end(); ++i)
+      data[i] = LoadTerrainFileImpl(filenames[i]);
+  });
+
+  unsigned int count = 0;
+  std::lock_guard<std::mutex> lock(preloadedMutex);
+  for (size_t i = 0; i < filenames.size(); ++i)
+  {
+    if (!data[i])
+      continue;
+
+    if (!preloaded.insert(std::make_pair(filenames[i], data[i])).second)
+      delete data[i];
+    else
+      ++count;
+  }
+
+  return count;
+}
+
+//////////////////////////////////////////////////
+void HeightmapDataLoader::ClearPreloaded()
+{
+  std::lock_guard<std::mutex> lock(preloadedMutex);
+  for (auto &entry : preloaded)
+    delete entry.second;
+  preloaded.clear();
+}
+
 //////////////////////////////////////////////////
 HeightmapData *HeightmapDataLoader::LoadImageAsTerrain(
     const std::string &_filename)
@@ -65,7 +160,7 @@ HeightmapData *HeightmapDataLoader::LoadDEMAsTerrain(
 }
 
 //////////////////////////////////////////////////
-HeightmapData *HeightmapDataLoader::LoadTerrainFile(
+HeightmapData *HeightmapDataLoader::LoadTerrainFileImpl(
     const std::string &_filename)
 {
   // Register the GDAL drivers
@@ -96,7 +191,8 @@ HeightmapData *HeightmapDataLoader::LoadTerrainFile(
   }
 }
 #else
-HeightmapData *HeightmapDataLoader::LoadTerrainFile(
+//////////////////////////////////////////////////
+HeightmapData *HeightmapDataLoader::LoadTerrainFileImpl(
     const std::string &_filename)
 {
   // Load the terrain file as an image
@@ -82,6 +82,24 @@ namespace gazebo
       public: static HeightmapData *LoadTerrainFile(
           const std::string &_filename);
 
+      /// \brief Load several terrain files in parallel. The data of each
+      /// file is kept until LoadTerrainFile is called with the same
+      /// filename, which then returns it instead of reading the file again.
+      /// \param[in] _filenames Paths to the terrain files.
+      /// \return Number of terrain files that were loaded.
+      public: static unsigned int Preload(
+          const std::vector<std::string> &_filenames);
+
+      /// \brief Delete the preloaded terrain data that was not claimed by
+      /// LoadTerrainFile.
+      public: static void ClearPreloaded();
+
+      /// \brief Load a terrain file, without checking the preloaded data.
+      /// \param[in] _filename The path to the terrain file.
+      /// \return The terrain data, or nullptr on failure.
+      private: static HeightmapData *LoadTerrainFileImpl(
+          const std::string &_filename);
+
       /// \brief Load a DEM specified by _filename as a terrain file.
       /// \param[in] _filename The path to the terrain file.
       /// \return 0 when the operation succeeds to load a file or -1 when fails.
@@ -55,6 +55,39 @@ TEST_F(HeightmapDataLoaderTest, ImageHeightmap)
   EXPECT_NEAR(0.99607843, img->GetMaxElevation(), ELEVATION_TOL);
 }
 
+/////////////////////////////////////////////////
+TEST_F(HeightmapDataLoaderTest, Preload)
+{
+  const std::string path = common::find_file(
+      "file://media/materials/textures/heightmap_bowl.png");
+
+  EXPECT_EQ(common::HeightmapDataLoader::Preload({path, path, ""}), 1u);
+
+  // Preloading the same file again keeps the preloaded data
+  EXPECT_EQ(common::HeightmapDataLoader::Preload({path}), 0u);
+
+  // The preloaded data is returned once, then the file is loaded again
+  common::HeightmapData *first =
+    common::HeightmapDataLoader::LoadTerrainFile(path);
+  ASSERT_TRUE(first != nullptr);
+  EXPECT_EQ(129u, first->GetWidth());
+
+  common::HeightmapData *second =
+    common::HeightmapDataLoader::LoadTerrainFile(path);
+  ASSERT_TRUE(second != nullptr);
+  EXPECT_NE(first, second);
+  EXPECT_EQ(first->GetWidth(), second->GetWidth());
+  EXPECT_FLOAT_EQ(first->GetMaxElevation(), second->GetMaxElevation());
+  delete first;
+  delete second;
+
+  // Unclaimed data is deleted
+  EXPECT_EQ(common::HeightmapDataLoader::Preload({path}), 1u);
+  common::HeightmapDataLoader::ClearPreloaded();
+  EXPECT_EQ(common::HeightmapDataLoader::Preload({path}), 1u);
+  common::HeightmapDataLoader::ClearPreloaded();
+}
+
 #ifdef HAVE_GDAL
 /////////////////////////////////////////////////
 TEST_F(HeightmapDataLoaderTest, DemHeightmap)
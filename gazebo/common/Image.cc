@@ -21,6 +21,7 @@
 
 #include <FreeImage.h>
 #include <boost/filesystem.hpp>
+#include <mutex>
 #include <string>
 
 #include "gazebo/common/Assert.hh"
@@ -33,13 +34,20 @@ using namespace common;
 
 int Image::count = 0;
 
+/// \brief Protects Image::count, and the initialization of FreeImage, so
+/// that images can be created on several threads.
+static std::mutex g_countMutex;
+
 //////////////////////////////////////////////////
 Image::Image(const std::string &_filename)
 {
-  if (count == 0)
-    FreeImage_Initialise();
+  {
+    std::lock_guard<std::mutex> lock(g_countMutex);
+    if (count == 0)
+      FreeImage_Initialise();
 
-  count++;
+    count++;
+  }
 
   this->bitmap = nullptr;
   if (!_filename.empty())
@@ -55,12 +63,13 @@ Image::Image(const std::string &_filename)
 //////////////////////////////////////////////////
 Image::~Image()
 {
-  count--;
-
   if (this->bitmap)
     FreeImage_Unload(this->bitmap);
   this->bitmap = nullptr;
 
+  std::lock_guard<std::mutex> lock(g_countMutex);
+  count--;
+
   if (count == 0)
     FreeImage_DeInitialise();
 }
@@ -190,6 +199,36 @@ void Image::GetData(unsigned char **_data, unsigned int &_count) const
 //////////////////////////////////////////////////
 void Image::GetDataImpl(unsigned char **_data, unsigned int &_count,
                         FIBITMAP *_img) const
+{
+  int scanWidth = FreeImage_GetLine(_img);
+
+  if (*_data)
+    delete [] *_data;
+
+  _count = scanWidth * FreeImage_GetHeight(_img);
+  *_data = new unsigned char[_count];
+
+  this->CopyRawBits(*_data, _img);
+}
+
+//////////////////////////////////////////////////
+bool Image::GetData(unsigned char *_data, const unsigned int _size) const
+{
+  if (!this->bitmap || !_data)
+    return false;
+
+  if (_size < FreeImage_GetLine(this->bitmap) *
+      FreeImage_GetHeight(this->bitmap))
+  {
+    return false;
+  }
+
+  this->CopyRawBits(_data, this->bitmap);
+  return true;
+}
+
+//////////////////////////////////////////////////
+void Image::CopyRawBits(unsigned char *_data, FIBITMAP *_img) const
 {
   int redmask = FI_RGBA_RED_MASK;
   // int bluemask = 0x00ff0000;
@@ -200,16 +239,9 @@ void Image::GetDataImpl(unsigned char **_data, unsigned int &_count,
   int bluemask = FI_RGBA_BLUE_MASK;
   // int redmask = 0x000000ff;
 
-  int scanWidth = FreeImage_GetLine(_img);
-
-  if (*_data)
-    delete [] *_data;
-
-  _count = scanWidth * FreeImage_GetHeight(_img);
-  *_data = new unsigned char[_count];
-
-  FreeImage_ConvertToRawBits(reinterpret_cast<BYTE*>(*_data), _img,
-      scanWidth, FreeImage_GetBPP(_img), redmask, greenmask, bluemask, true);
+  FreeImage_ConvertToRawBits(reinterpret_cast<BYTE*>(_data), _img,
+      FreeImage_GetLine(_img), FreeImage_GetBPP(_img), redmask, greenmask,
+      bluemask, true);
 
 #ifdef FREEIMAGE_COLORORDER
   if (FREEIMAGE_COLORORDER != FREEIMAGE_COLORORDER_RGB)
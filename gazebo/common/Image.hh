@@ -128,6 +128,15 @@ namespace gazebo
       public: void GetData(unsigned char **_data,
                            unsigned int &_count) const;
 
+      /// \brief Copy the image data into a caller-provided buffer. This
+      /// avoids the allocation done by GetData(unsigned char **, ...).
+      /// \param[out] _data Buffer that receives the data.
+      /// \param[in] _size Size of _data in bytes. It must be at least
+      /// GetPitch() * GetHeight().
+      /// \return False if the image is invalid or _data is too small.
+      public: bool GetData(unsigned char *_data,
+                           const unsigned int _size) const;
+
       /// \brief Get only the RGB data from the image. This will drop the
       /// alpha channel if one is present.
       /// \param[out] _data Pointer to a nullptr array of char.
@@ -187,6 +196,11 @@ namespace gazebo
       private: void GetDataImpl(unsigned char **_data, unsigned int &_count,
           FIBITMAP *_img) const;
 
+      /// \brief Copy the raw bits of a bitmap into a buffer.
+      /// \param[out] _data Buffer of at least pitch * height bytes.
+      /// \param[in] _img Bitmap to copy.
+      private: void CopyRawBits(unsigned char *_data, FIBITMAP *_img) const;
+
       /// \brief Count the number of images created. Used for initialising
       /// free image
       private: static int count;
@@ -0,0 +1,290 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifdef __SSE2__
+  #include <emmintrin.h>
+#endif
+#ifdef __SSSE3__
+  #include <tmmintrin.h>
+#endif
+
+#include <cmath>
+#include <limits>
+
+#include "gazebo/common/ImageConversion.hh"
+
+using namespace gazebo;
+
+/////////////////////////////////////////////////
+bool common::swapRedBlue(const unsigned char *_src, unsigned char *_dst,
+    const size_t _pixelCount, const unsigned int _channels)
+{
+  if (_channels != 3 && _channels != 4)
+    return false;
+
+  const size_t bytes = _pixelCount * _channels;
+  size_t i = 0;
+
+#ifdef __SSSE3__
+  if (_channels == 3)
+  {
+    // Five pixels per 16 byte register. The last byte is passed through
+    // unchanged, and is written again by the next iteration. This also
+    // keeps an in-place conversion correct.
+    const __m128i mask = _mm_setr_epi8(
+        2, 1, 0, 5, 4, 3, 8, 7, 6, 11, 10, 9, 14, 13, 12, 15);
+    for (; i + 16 <= bytes; i += 15)
+    {
+      __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(_src + i));
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(_dst + i),
+          _mm_shuffle_epi8(v, mask));
+    }
+  }
+  else
+  {
+    const __m128i mask = _mm_setr_epi8(
+        2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+    for (; i + 16 <= bytes; i += 16)
+    {
+      __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(_src + i));
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(_dst + i),
+          _mm_shuffle_epi8(v, mask));
+    }
+  }
+#endif
+
+  for (; i < bytes; i += _channels)
+  {
+    const unsigned char red = _src[i];
+    _dst[i] = _src[i + 2];
+    _dst[i + 1] = _src[i + 1];
+    _dst[i + 2] = red;
+    if (_channels == 4)
+      _dst[i + 3] = _src[i + 3];
+  }
+
+  return true;
+}
+
+/////////////////////////////////////////////////
+void common::convertRGBAToRGB(const unsigned char *_src, unsigned char *_dst,
+    const size_t _pixelCount)
+{
+  size_t i = 0;
+
+#ifdef __SSSE3__
+  // Four pixels per iteration. The 16 byte store only touches bytes that
+  // have already been read, so an in-place conversion stays correct.
+  const __m128i mask = _mm_setr_epi8(
+      0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+  for (; i * 3 + 16 <= _pixelCount * 3 && i + 4 <= _pixelCount; i += 4)
+  {
+    __m128i v =
+      _mm_loadu_si128(reinterpret_cast<const __m128i *>(_src + i * 4));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(_dst + i * 3),
+        _mm_shuffle_epi8(v, mask));
+  }
+#endif
+
+  for (; i < _pixelCount; ++i)
+  {
+    _dst[i * 3] = _src[i * 4];
+    _dst[i * 3 + 1] = _src[i * 4 + 1];
+    _dst[i * 3 + 2] = _src[i * 4 + 2];
+  }
+}
+
+/////////////////////////////////////////////////
+void common::convertRGBToRGBA(const unsigned char *_src, unsigned char *_dst,
+    const size_t _pixelCount, const unsigned char _alpha)
+{
+  size_t i = 0;
+
+#ifdef __SSSE3__
+  // Four pixels per iteration, reading 16 bytes of which 12 are used.
+  const __m128i mask = _mm_setr_epi8(
+      0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+  const __m128i alpha = _mm_set1_epi32(static_cast<int>(_alpha) << 24);
+  for (; (i * 3) + 16 <= _pixelCount * 3; i += 4)
+  {
+    __m128i v =
+      _mm_loadu_si128(reinterpret_cast<const __m128i *>(_src + i * 3));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(_dst + i * 4),
+        _mm_or_si128(_mm_shuffle_epi8(v, mask), alpha));
+  }
+#endif
+
+  for (; i < _pixelCount; ++i)
+  {
+    _dst[i * 4] = _src[i * 3];
+    _dst[i * 4 + 1] = _src[i * 3 + 1];
+    _dst[i * 4 + 2] = _src[i * 3 + 2];
+    _dst[i * 4 + 3] = _alpha;
+  }
+}
+
+/////////////////////////////////////////////////
+void common::convertDepthToUInt16(const float *_src, uint16_t *_dst,
+    const size_t _count, const float _scale)
+{
+  size_t i = 0;
+
+#ifdef __SSE2__
+  const __m128 scale = _mm_set1_ps(_scale);
+  const __m128 limit = _mm_set1_ps(65536.0f);
+  const __m128 half = _mm_set1_ps(0.5f);
+  const __m128i bias = _mm_set1_epi32(32768);
+  const __m128i signBit = _mm_set1_epi16(static_cast<int16_t>(0x8000));
+
+  for (; i + 8 <= _count; i += 8)
+  {
+    __m128i packed[2];
+    for (int j = 0; j < 2; ++j)
+    {
+      __m128 v = _mm_add_ps(
+          _mm_mul_ps(_mm_loadu_ps(_src + i + j * 4), scale), half);
+
+      // NaN compares false, and +inf fails the upper bound.
+      __m128 valid = _mm_and_ps(_mm_cmpge_ps(v, half),
+                                _mm_cmplt_ps(v, limit));
+      v = _mm_and_ps(valid, v);
+
+      // Bias into the signed range, so that the saturating signed pack
+      // keeps all 16 bits.
+      packed[j] = _mm_sub_epi32(_mm_cvttps_epi32(v), bias);
+    }
+    __m128i out = _mm_xor_si128(_mm_packs_epi32(packed[0], packed[1]),
+        signBit);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(_dst + i), out);
+  }
+#endif
+
+  for (; i < _count; ++i)
+  {
+    const float v = _src[i] * _scale + 0.5f;
+    if (v >= 0.5f && v < 65536.0f)
+      _dst[i] = static_cast<uint16_t>(v);
+    else
+      _dst[i] = 0;
+  }
+}
+
+/////////////////////////////////////////////////
+void common::maskDepthRange(const float *_src, float *_dst,
+    const size_t _count, const float _near, const float _far)
+{
+  const float inf = std::numeric_limits<float>::infinity();
+  size_t i = 0;
+
+#ifdef __SSE2__
+  const __m128 nearClip = _mm_set1_ps(_near);
+  const __m128 farClip = _mm_set1_ps(_far);
+  const __m128 posInf = _mm_set1_ps(inf);
+  const __m128 negInf = _mm_set1_ps(-inf);
+
+  for (; i + 4 <= _count; i += 4)
+  {
+    __m128 v = _mm_loadu_ps(_src + i);
+    __m128 isFar = _mm_cmpge_ps(v, farClip);
+    __m128 isNear = _mm_andnot_ps(isFar, _mm_cmple_ps(v, nearClip));
+
+    v = _mm_or_ps(_mm_and_ps(isFar, posInf), _mm_andnot_ps(isFar, v));
+    v = _mm_or_ps(_mm_and_ps(isNear, negInf), _mm_andnot_ps(isNear, v));
+    _mm_storeu_ps(_dst + i, v);
+  }
+#endif
+
+  for (; i < _count; ++i)
+  {
+    if (_src[i] >= _far)
+      _dst[i] = inf;
+    else if (_src[i] <= _near)
+      _dst[i] = -inf;
+    else
+      _dst[i] = _src[i];
+  }
+}
+
+/////////////////////////////////////////////////
+bool common::convertRGBToBayer(const unsigned char *_src, unsigned char *_dst,
+    const unsigned int _width, const unsigned int _height,
+    const Image::PixelFormat _format)
+{
+  if (_format < Image::BAYER_RGGB8 || _format > Image::BAYER_GRBG8)
+    return false;
+
+  // RGB channel sampled at each position of the 2x2 pattern, in the order
+  // top-left, top-right, bottom-left, bottom-right. Rows follow the order
+  // of the BAYER_* pixel formats.
+  static const unsigned int patterns[4][4] =
+  {
+    {0, 1, 1, 2},  // RGGB
+    {2, 1, 1, 0},  // BGGR
+    {1, 2, 0, 1},  // GBRG
+    {1, 0, 2, 1}   // GRBG
+  };
+  const unsigned int *pattern = patterns[_format - Image::BAYER_RGGB8];
+
+  for (unsigned int y = 0; y < _height; ++y)
+  {
+    const unsigned char *srcRow = _src + static_cast<size_t>(y) * _width * 3;
+    unsigned char *dstRow = _dst + static_cast<size_t>(y) * _width;
+    const unsigned int even = pattern[(y % 2) * 2];
+    const unsigned int odd = pattern[(y % 2) * 2 + 1];
+
+    unsigned int x = 0;
+    for (; x + 1 < _width; x += 2)
+    {
+      dstRow[x] = srcRow[x * 3 + even];
+      dstRow[x + 1] = srcRow[x * 3 + 3 + odd];
+    }
+    if (x < _width)
+      dstRow[x] = srcRow[x * 3 + even];
+  }
+
+  return true;
+}
+
+/////////////////////////////////////////////////
+void common::downscaleHalf(const unsigned char *_src, unsigned char *_dst,
+    const unsigned int _width, const unsigned int _height,
+    const unsigned int _channels)
+{
+  const unsigned int dstWidth = _width / 2;
+  const unsigned int dstHeight = _height / 2;
+  const size_t srcStride = static_cast<size_t>(_width) * _channels;
+  const size_t dstStride = static_cast<size_t>(dstWidth) * _channels;
+
+  for (unsigned int y = 0; y < dstHeight; ++y)
+  {
+    const unsigned char *top = _src + (y * 2) * srcStride;
+    const unsigned char *bottom = top + srcStride;
+    unsigned char *dstRow = _dst + y * dstStride;
+
+    for (unsigned int x = 0; x < dstWidth; ++x)
+    {
+      const size_t left = static_cast<size_t>(x) * 2 * _channels;
+      const size_t right = left + _channels;
+      for (unsigned int c = 0; c < _channels; ++c)
+      {
+        const unsigned int sum = top[left + c] + top[right + c] +
+          bottom[left + c] + bottom[right + c];
+        dstRow[x * _channels + c] = static_cast<unsigned char>((sum + 2) / 4);
+      }
+    }
+  }
+}
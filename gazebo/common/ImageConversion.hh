@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GAZEBO_COMMON_IMAGECONVERSION_HH_
+#define GAZEBO_COMMON_IMAGECONVERSION_HH_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "gazebo/common/Image.hh"
+#include "gazebo/util/system.hh"
+
+namespace gazebo
+{
+  namespace common
+  {
+    /// \addtogroup gazebo_common
+    /// \{
+
+    /// \brief Pixel format conversions for camera pipelines.
+    ///
+    /// All conversions write into a caller-provided buffer, and use SSE
+    /// instructions when the library is built with them. Unless stated
+    /// otherwise, the source and destination buffers must either be the
+    /// same buffer, for an in-place conversion, or not overlap at all.
+
+    /// \brief Swap the red and blue channels of 8-bit pixels. This converts
+    /// RGB to BGR and RGBA to BGRA, and back.
+    /// \param[in] _src Source pixels.
+    /// \param[out] _dst Destination pixels, may be equal to _src.
+    /// \param[in] _pixelCount Number of pixels to convert.
+    /// \param[in] _channels Bytes per pixel, 3 or 4.
+    /// \return False if _channels is not supported.
+    GZ_COMMON_VISIBLE
+    bool swapRedBlue(const unsigned char *_src, unsigned char *_dst,
+                     const size_t _pixelCount, const unsigned int _channels);
+
+    /// \brief Convert 8-bit RGBA pixels to RGB by dropping the alpha
+    /// channel.
+    /// \param[in] _src Source pixels, 4 bytes per pixel.
+    /// \param[out] _dst Destination pixels, 3 bytes per pixel. May be equal
+    /// to _src.
+    /// \param[in] _pixelCount Number of pixels to convert.
+    GZ_COMMON_VISIBLE
+    void convertRGBAToRGB(const unsigned char *_src, unsigned char *_dst,
+                          const size_t _pixelCount);
+
+    /// \brief Convert 8-bit RGB pixels to RGBA with a constant alpha.
+    /// \param[in] _src Source pixels, 3 bytes per pixel.
+    /// \param[out] _dst Destination pixels, 4 bytes per pixel. Must not
+    /// overlap _src.
+    /// \param[in] _pixelCount Number of pixels to convert.
+    /// \param[in] _alpha Value of the alpha channel.
+    GZ_COMMON_VISIBLE
+    void convertRGBToRGBA(const unsigned char *_src, unsigned char *_dst,
+                          const size_t _pixelCount,
+                          const unsigned char _alpha = 255);
+
+    /// \brief Convert float depth values to unsigned 16-bit integers, as
+    /// used by 16UC1 depth images. Values are scaled and rounded. Values
+    /// that are negative, not finite or do not fit in 16 bits become 0.
+    /// \param[in] _src Source depth values.
+    /// \param[out] _dst Destination values.
+    /// \param[in] _count Number of values to convert.
+    /// \param[in] _scale Scale applied to the depth, e.g. 1000 to convert
+    /// meters to millimeters.
+    GZ_COMMON_VISIBLE
+    void convertDepthToUInt16(const float *_src, uint16_t *_dst,
+                              const size_t _count, const float _scale);
+
+    /// \brief Mask depth values outside of the clip range, as per REP 117.
+    /// Values at or beyond the far clip become +inf, values at or before
+    /// the near clip become -inf.
+    /// \param[in] _src Source depth values.
+    /// \param[out] _dst Destination values, may be equal to _src.
+    /// \param[in] _count Number of values to convert.
+    /// \param[in] _near Near clip distance.
+    /// \param[in] _far Far clip distance.
+    GZ_COMMON_VISIBLE
+    void maskDepthRange(const float *_src, float *_dst, const size_t _count,
+                        const float _near, const float _far);
+
+    /// \brief Encode 8-bit RGB pixels into a Bayer mosaic.
+    /// \param[in] _src Source pixels, 3 bytes per pixel.
+    /// \param[out] _dst Destination, 1 byte per pixel. Must not overlap
+    /// _src.
+    /// \param[in] _width Image width in pixels.
+    /// \param[in] _height Image height in pixels.
+    /// \param[in] _format One of the Image::BAYER_* formats.
+    /// \return False if _format is not a Bayer format.
+    GZ_COMMON_VISIBLE
+    bool convertRGBToBayer(const unsigned char *_src, unsigned char *_dst,
+                           const unsigned int _width,
+                           const unsigned int _height,
+                           const Image::PixelFormat _format);
+
+    /// \brief Halve the resolution of an 8-bit image by averaging each
+    /// block of 2x2 pixels. An odd last row or column is dropped.
+    /// \param[in] _src Source pixels.
+    /// \param[out] _dst Destination of (_width/2) x (_height/2) pixels.
+    /// Must not overlap _src.
+    /// \param[in] _width Source width in pixels.
+    /// \param[in] _height Source height in pixels.
+    /// \param[in] _channels Bytes per pixel.
+    GZ_COMMON_VISIBLE
+    void downscaleHalf(const unsigned char *_src, unsigned char *_dst,
+                       const unsigned int _width, const unsigned int _height,
+                       const unsigned int _channels);
+    /// \}
+  }
+}
+#endif
@@ -0,0 +1,206 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "gazebo/common/ImageConversion.hh"
+#include "test/util.hh"
+
+using namespace gazebo;
+
+class ImageConversionTest : public gazebo::testing::AutoLogFixture { };
+
+/// \brief Pixel counts that exercise both the vector and scalar paths.
+static const size_t kPixelCounts[] = {0, 1, 5, 6, 7, 17, 33, 1001};
+
+/////////////////////////////////////////////////
+/// \brief Fill a buffer with a deterministic pattern.
+static void Fill(std::vector<unsigned char> &_data)
+{
+  for (size_t i = 0; i < _data.size(); ++i)
+    _data[i] = static_cast<unsigned char>((i * 37 + 11) % 256);
+}
+
+/////////////////////////////////////////////////
+TEST_F(ImageConversionTest, SwapRedBlue)
+{
+  for (auto n : kPixelCounts)
+  {
+    for (unsigned int channels : {3u, 4u})
+    {
+      std::vector<unsigned char> src(n * channels);
+      Fill(src);
+      std::vector<unsigned char> dst(src.size());
+      std::vector<unsigned char> inPlace = src;
+
+      EXPECT_TRUE(common::swapRedBlue(src.data(), dst.data(), n, channels));
+      EXPECT_TRUE(common::swapRedBlue(inPlace.data(), inPlace.data(), n,
+            channels));
+
+      for (size_t i = 0; i < n; ++i)
+      {
+        const size_t p = i * channels;
+        EXPECT_EQ(src[p + 2], dst[p]);
+        EXPECT_EQ(src[p + 1], dst[p + 1]);
+        EXPECT_EQ(src[p], dst[p + 2]);
+        if (channels == 4)
+        {
+          EXPECT_EQ(src[p + 3], dst[p + 3]);
+        }
+      }
+      EXPECT_EQ(dst, inPlace);
+    }
+  }
+
+  unsigned char pixel[2] = {0, 0};
+  EXPECT_FALSE(common::swapRedBlue(pixel, pixel, 1, 2));
+}
+
+/////////////////////////////////////////////////
+TEST_F(ImageConversionTest, RGBAToRGB)
+{
+  for (auto n : kPixelCounts)
+  {
+    std::vector<unsigned char> rgba(n * 4);
+    Fill(rgba);
+    std::vector<unsigned char> rgb(n * 3);
+    common::convertRGBAToRGB(rgba.data(), rgb.data(), n);
+
+    std::vector<unsigned char> inPlace = rgba;
+    common::convertRGBAToRGB(inPlace.data(), inPlace.data(), n);
+
+    for (size_t i = 0; i < n; ++i)
+    {
+      for (size_t c = 0; c < 3; ++c)
+      {
+        EXPECT_EQ(rgba[i * 4 + c], rgb[i * 3 + c]);
+        EXPECT_EQ(rgba[i * 4 + c], inPlace[i * 3 + c]);
+      }
+    }
+
+    std::vector<unsigned char> back(n * 4);
+    common::convertRGBToRGBA(rgb.data(), back.data(), n, 7);
+    for (size_t i = 0; i < n; ++i)
+    {
+      for (size_t c = 0; c < 3; ++c)
+        EXPECT_EQ(rgba[i * 4 + c], back[i * 4 + c]);
+      EXPECT_EQ(7, back[i * 4 + 3]);
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+TEST_F(ImageConversionTest, DepthToUInt16)
+{
+  const float inf = std::numeric_limits<float>::infinity();
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+  std::vector<float> depth =
+    {0.0f, 0.4f, 0.6f, 1.0f, 1234.4f, 65535.0f, 65536.0f, 70000.0f,
+     -1.0f, inf, -inf, nan, 2.5f};
+  std::vector<uint16_t> out(depth.size(), 1);
+
+  common::convertDepthToUInt16(depth.data(), out.data(), depth.size(), 1.0f);
+
+  const std::vector<uint16_t> expected =
+    {0, 0, 1, 1, 1234, 65535, 0, 0, 0, 0, 0, 0, 3};
+  EXPECT_EQ(expected, out);
+}
+
+/////////////////////////////////////////////////
+TEST_F(ImageConversionTest, MaskDepthRange)
+{
+  const float inf = std::numeric_limits<float>::infinity();
+  std::vector<float> depth = {0.05f, 0.1f, 0.5f, 9.99f, 10.0f, 20.0f, 1.0f};
+  std::vector<float> out(depth.size());
+
+  common::maskDepthRange(depth.data(), out.data(), depth.size(), 0.1f, 10.0f);
+
+  const std::vector<float> expected =
+    {-inf, -inf, 0.5f, 9.99f, inf, inf, 1.0f};
+  EXPECT_EQ(expected, out);
+
+  common::maskDepthRange(depth.data(), depth.data(), depth.size(), 0.1f,
+      10.0f);
+  EXPECT_EQ(expected, depth);
+}
+
+/////////////////////////////////////////////////
+TEST_F(ImageConversionTest, RGBToBayer)
+{
+  const unsigned int width = 5;
+  const unsigned int height = 3;
+  std::vector<unsigned char> rgb(width * height * 3);
+  Fill(rgb);
+  std::vector<unsigned char> bayer(width * height);
+
+  // Channel sampled at top-left, top-right, bottom-left, bottom-right
+  struct Pattern
+  {
+    common::Image::PixelFormat format;
+    unsigned int channel[4];
+  };
+  const Pattern patterns[] =
+  {
+    {common::Image::BAYER_RGGB8, {0, 1, 1, 2}},
+    {common::Image::BAYER_BGGR8, {2, 1, 1, 0}},
+    {common::Image::BAYER_GBRG8, {1, 2, 0, 1}},
+    {common::Image::BAYER_GRBG8, {1, 0, 2, 1}}
+  };
+
+  for (const auto &pattern : patterns)
+  {
+    EXPECT_TRUE(common::convertRGBToBayer(rgb.data(), bayer.data(), width,
+          height, pattern.format));
+
+    for (unsigned int y = 0; y < height; ++y)
+    {
+      for (unsigned int x = 0; x < width; ++x)
+      {
+        const unsigned int c = pattern.channel[(y % 2) * 2 + x % 2];
+        EXPECT_EQ(rgb[(y * width + x) * 3 + c], bayer[y * width + x]);
+      }
+    }
+  }
+
+  EXPECT_FALSE(common::convertRGBToBayer(rgb.data(), bayer.data(), width,
+        height, common::Image::RGB_INT8));
+}
+
+/////////////////////////////////////////////////
+TEST_F(ImageConversionTest, DownscaleHalf)
+{
+  // 5x3 single channel image, the last row and column are dropped.
+  const std::vector<unsigned char> src =
+    {0,  4,  8,  12, 99,
+     2,  6,  10, 15, 99,
+     99, 99, 99, 99, 99};
+  std::vector<unsigned char> dst(2);
+
+  common::downscaleHalf(src.data(), dst.data(), 5, 3, 1);
+  EXPECT_EQ(3, dst[0]);
+  EXPECT_EQ(11, dst[1]);
+}
+
+/////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,634 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef _WIN32
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include "gazebo/common/Console.hh"
+#include "gazebo/common/Material.hh"
+#include "gazebo/common/Mesh.hh"
+#include "gazebo/common/SystemPaths.hh"
+#include "gazebo/common/MeshCache.hh"
+
+using namespace gazebo;
+using namespace common;
+
+/// \brief Magic number at the start of cache files.
+static const char kMagic[4] = {'G', 'Z', 'M', 'C'};
+
+/// \brief Version of the cache file format. Increment when the layout
+/// changes, or when the mesh loaders change their output.
+static const uint32_t kVersion = 1;
+
+/// \brief Extension of cache files.
+static const char kExtension[] = ".gzmesh";
+
+/// \brief Default maximum size of the cache, in megabytes.
+static const uint64_t kDefaultMaxSizeMB = 512;
+
+/////////////////////////////////////////////////
+/// \brief Append fixed size values to a byte buffer.
+class CacheWriter
+{
+  /// \brief Append a value.
+  /// \param[in] _value Value to append.
+  public: template<typename T> void Write(const T _value)
+  {
+    this->data.append(reinterpret_cast<const char *>(&_value), sizeof(T));
+  }
+
+  /// \brief Append a string, prefixed by its length.
+  /// \param[in] _str String to append.
+  public: void Write(const std::string &_str)
+  {
+    this->Write(static_cast<uint32_t>(_str.size()));
+    this->data.append(_str);
+  }
+
+  /// \brief Append a color as four floats.
+  /// \param[in] _color Color to append.
+  public: void Write(const ignition::math::Color &_color)
+  {
+    this->Write(_color.R());
+    this->Write(_color.G());
+    this->Write(_color.B());
+    this->Write(_color.A());
+  }
+
+  /// \brief Pad the buffer to a multiple of 8 bytes, so that the next
+  /// array of doubles is aligned in the mapped file.
+  public: void Align()
+  {
+    this->data.resize((this->data.size() + 7) & ~size_t(7), '\0');
+  }
+
+  /// \brief Written bytes.
+  public: std::string data;
+};
+
+/////////////////////////////////////////////////
+/// \brief Read fixed size values from a mapped cache file.
+class CacheReader
+{
+  /// \brief Constructor.
+  /// \param[in] _data Start of the file.
+  /// \param[in] _size Size of the file in bytes.
+  public: CacheReader(const char *_data, const size_t _size)
+    : data(_data), size(_size)
+  {
+  }
+
+  /// \brief Read a value.
+  /// \param[out] _value Value read.
+  /// \return False if the file is too short.
+  public: template<typename T> bool Read(T &_value)
+  {
+    if (this->offset + sizeof(T) > this->size)
+      return false;
+    std::memcpy(&_value, this->data + this->offset, sizeof(T));
+    this->offset += sizeof(T);
+    return true;
+  }
+
+  /// \brief Read a string, prefixed by its length.
+  /// \param[out] _str String read.
+  /// \return False if the file is too short.
+  public: bool Read(std::string &_str)
+  {
+    uint32_t length;
+    if (!this->Read(length) || this->offset + length > this->size)
+      return false;
+    _str.assign(this->data + this->offset, length);
+    this->offset += length;
+    return true;
+  }
+
+  /// \brief Read a color stored as four floats.
+  /// \param[out] _color Color read.
+  /// \return False if the file is too short.
+  public: bool Read(ignition::math::Color &_color)
+  {
+    float r, g, b, a;
+    if (!this->Read(r) || !this->Read(g) || !this->Read(b) || !this->Read(a))
+      return false;
+    _color.Set(r, g, b, a);
+    return true;
+  }
+
+  /// \brief Get a pointer to an array, and skip it.
+  /// \param[in] _count Number of values in the array.
+  /// \return Pointer to the array, or nullptr if the file is too short.
+  public: template<typename T> const T *Array(const size_t _count)
+  {
+    if (this->offset + _count * sizeof(T) > this->size)
+      return nullptr;
+    const T *result = reinterpret_cast<const T *>(this->data + this->offset);
+    this->offset += _count * sizeof(T);
+    return result;
+  }
+
+  /// \brief Skip the padding written by CacheWriter::Align.
+  public: void Align()
+  {
+    this->offset = (this->offset + 7) & ~size_t(7);
+  }
+
+  /// \brief Start of the file.
+  private: const char *data;
+
+  /// \brief Size of the file.
+  private: size_t size;
+
+  /// \brief Offset of the next value.
+  private: size_t offset = 0;
+};
+
+/////////////////////////////////////////////////
+/// \brief Deserialize a mesh from the content of a cache file.
+/// \param[in] _data Start of the file.
+/// \param[in] _size Size of the file in bytes.
+/// \return A new mesh, or nullptr if the file is invalid.
+static Mesh *readMesh(const char *_data, const size_t _size)
+{
+  CacheReader reader(_data, _size);
+
+  char magic[4];
+  uint32_t version, materialCount, subMeshCount;
+  if (!reader.Read(magic) || std::memcmp(magic, kMagic, sizeof(kMagic)) != 0 ||
+      !reader.Read(version) || version != kVersion ||
+      !reader.Read(materialCount) || !reader.Read(subMeshCount))
+  {
+    return nullptr;
+  }
+
+  std::unique_ptr<Mesh> mesh(new Mesh());
+
+  std::string path;
+  if (!reader.Read(path))
+    return nullptr;
+  mesh->SetPath(path);
+
+  for (uint32_t m = 0; m < materialCount; ++m)
+  {
+    std::string texImage;
+    ignition::math::Color ambient, diffuse, specular, emissive;
+    double transparency, shininess, pointSize, srcFactor, dstFactor;
+    uint32_t blendMode, shadeMode;
+    uint8_t depthWrite, lighting;
+    if (!reader.Read(texImage) || !reader.Read(ambient) ||
+        !reader.Read(diffuse) || !reader.Read(specular) ||
+        !reader.Read(emissive) || !reader.Read(transparency) ||
+        !reader.Read(shininess) || !reader.Read(pointSize) ||
+        !reader.Read(srcFactor) || !reader.Read(dstFactor) ||
+        !reader.Read(blendMode) || !reader.Read(shadeMode) ||
+        !reader.Read(depthWrite) || !reader.Read(lighting))
+    {
+      return nullptr;
+    }
+
+    Material *mat = new Material();
+    mat->SetTextureImage(texImage);
+    mat->SetAmbient(ambient);
+    mat->SetDiffuse(diffuse);
+    mat->SetSpecular(specular);
+    mat->SetEmissive(emissive);
+    mat->SetTransparency(transparency);
+    mat->SetShininess(shininess);
+    mat->SetPointSize(pointSize);
+    mat->SetBlendFactors(srcFactor, dstFactor);
+    mat->SetBlendMode(static_cast<Material::BlendMode>(blendMode));
+    mat->SetShadeMode(static_cast<Material::ShadeMode>(shadeMode));
+    mat->SetDepthWrite(depthWrite != 0);
+    mat->SetLighting(lighting != 0);
+    mesh->AddMaterial(mat);
+  }
+
+  for (uint32_t s = 0; s < subMeshCount; ++s)
+  {
+    std::string name;
+    uint32_t primitiveType, materialIndex;
+    uint32_t vertexCount, normalCount, texCoordCount, indexCount;
+    if (!reader.Read(name) || !reader.Read(primitiveType) ||
+        !reader.Read(materialIndex) || !reader.Read(vertexCount) ||
+        !reader.Read(normalCount) || !reader.Read(texCoordCount) ||
+        !reader.Read(indexCount))
+    {
+      return nullptr;
+    }
+
+    reader.Align();
+    const double *vertices = reader.Array<double>(size_t(vertexCount) * 3);
+    const double *normals = reader.Array<double>(size_t(normalCount) * 3);
+    const double *texCoords = reader.Array<double>(size_t(texCoordCount) * 2);
+    const uint32_t *indices = reader.Array<uint32_t>(indexCount);
+    reader.Align();
+    if (!vertices || !normals || !texCoords || !indices)
+      return nullptr;
+
+    SubMesh *subMesh = new SubMesh();
+    mesh->AddSubMesh(subMesh);
+    subMesh->SetName(name);
+    subMesh->SetPrimitiveType(
+        static_cast<SubMesh::PrimitiveType>(primitiveType));
+    subMesh->SetMaterialIndex(materialIndex);
+
+    subMesh->SetVertexCount(vertexCount);
+    for (uint32_t i = 0; i < vertexCount; ++i)
+    {
+      subMesh->SetVertex(i, ignition::math::Vector3d(
+          vertices[i * 3], vertices[i * 3 + 1], vertices[i * 3 + 2]));
+    }
+
+    subMesh->SetNormalCount(normalCount);
+    for (uint32_t i = 0; i < normalCount; ++i)
+    {
+      subMesh->SetNormal(i, ignition::math::Vector3d(
+          normals[i * 3], normals[i * 3 + 1], normals[i * 3 + 2]));
+    }
+
+    subMesh->SetTexCoordCount(texCoordCount);
+    for (uint32_t i = 0; i < texCoordCount; ++i)
+    {
+      subMesh->SetTexCoord(i, ignition::math::Vector2d(
+          texCoords[i * 2], texCoords[i * 2 + 1]));
+    }
+
+    for (uint32_t i = 0; i < indexCount; ++i)
+      subMesh->AddIndex(indices[i]);
+  }
+
+  return mesh.release();
+}
+
+/////////////////////////////////////////////////
+/// \brief Serialize a mesh.
+/// \param[in] _mesh Mesh to serialize.
+/// \return Content of the cache file.
+static std::string writeMesh(const Mesh *_mesh)
+{
+  CacheWriter writer;
+  writer.data.append(kMagic, sizeof(kMagic));
+  writer.Write(kVersion);
+  writer.Write(static_cast<uint32_t>(_mesh->GetMaterialCount()));
+  writer.Write(static_cast<uint32_t>(_mesh->GetSubMeshCount()));
+  writer.Write(_mesh->GetPath());
+
+  for (unsigned int m = 0; m < _mesh->GetMaterialCount(); ++m)
+  {
+    const Material *mat = _mesh->GetMaterial(m);
+    double srcFactor, dstFactor;
+    mat->GetBlendFactors(srcFactor, dstFactor);
+
+    writer.Write(mat->GetTextureImage());
+    writer.Write(mat->Ambient());
+    writer.Write(mat->Diffuse());
+    writer.Write(mat->Specular());
+    writer.Write(mat->Emissive());
+    writer.Write(mat->GetTransparency());
+    writer.Write(mat->GetShininess());
+    writer.Write(mat->GetPointSize());
+    writer.Write(srcFactor);
+    writer.Write(dstFactor);
+    writer.Write(static_cast<uint32_t>(mat->GetBlendMode()));
+    writer.Write(static_cast<uint32_t>(mat->GetShadeMode()));
+    writer.Write(static_cast<uint8_t>(mat->GetDepthWrite()));
+    writer.Write(static_cast<uint8_t>(mat->GetLighting()));
+  }
+
+  for (unsigned int s = 0; s < _mesh->GetSubMeshCount(); ++s)
+  {
+    const SubMesh *subMesh = _mesh->GetSubMesh(s);
+    writer.Write(subMesh->GetName());
+    writer.Write(static_cast<uint32_t>(subMesh->GetPrimitiveType()));
+    writer.Write(static_cast<uint32_t>(subMesh->GetMaterialIndex()));
+    writer.Write(static_cast<uint32_t>(subMesh->GetVertexCount()));
+    writer.Write(static_cast<uint32_t>(subMesh->GetNormalCount()));
+    writer.Write(static_cast<uint32_t>(subMesh->GetTexCoordCount()));
+    writer.Write(static_cast<uint32_t>(subMesh->GetIndexCount()));
+    writer.Align();
+
+    for (unsigned int i = 0; i < subMesh->GetVertexCount(); ++i)
+    {
+      const ignition::math::Vector3d v = subMesh->Vertex(i);
+      writer.Write(v.X());
+      writer.Write(v.Y());
+      writer.Write(v.Z());
+    }
+    for (unsigned int i = 0; i < subMesh->GetNormalCount(); ++i)
+    {
+      const ignition::math::Vector3d n = subMesh->Normal(i);
+      writer.Write(n.X());
+      writer.Write(n.Y());
+      writer.Write(n.Z());
+    }
+    for (unsigned int i = 0; i < subMesh->GetTexCoordCount(); ++i)
+    {
+      const ignition::math::Vector2d t = subMesh->TexCoord(i);
+      writer.Write(t.X());
+      writer.Write(t.Y());
+    }
+    for (unsigned int i = 0; i < subMesh->GetIndexCount(); ++i)
+      writer.Write(static_cast<uint32_t>(subMesh->GetIndex(i)));
+    writer.Align();
+  }
+
+  return writer.data;
+}
+
+/////////////////////////////////////////////////
+/// \brief Update a 64-bit FNV-1a hash.
+/// \param[in] _hash Current hash.
+/// \param[in] _data Bytes to hash.
+/// \param[in] _size Number of bytes.
+/// \return Updated hash.
+static uint64_t fnv1a(uint64_t _hash, const char *_data, const size_t _size)
+{
+  for (size_t i = 0; i < _size; ++i)
+  {
+    _hash ^= static_cast<unsigned char>(_data[i]);
+    _hash *= 1099511628211ULL;
+  }
+  return _hash;
+}
+
+/////////////////////////////////////////////////
+MeshCache::MeshCache(const std::string &_path)
+  : path(_path), maxSize(DefaultMaxSize())
+{
+}
+
+/////////////////////////////////////////////////
+std::string MeshCache::Path() const
+{
+  return this->path;
+}
+
+/////////////////////////////////////////////////
+void MeshCache::SetMaxSize(const uint64_t _size)
+{
+  this->maxSize = _size;
+}
+
+/////////////////////////////////////////////////
+uint64_t MeshCache::MaxSize() const
+{
+  return this->maxSize;
+}
+
+/////////////////////////////////////////////////
+std::string MeshCache::DefaultPath()
+{
+  const char *env = std::getenv("GAZEBO_MESH_CACHE_PATH");
+  if (env)
+    return env;
+
+  const char *home = std::getenv("HOME");
+  if (!home)
+    return SystemPaths::Instance()->TmpPath() + "/gazebo/mesh_cache";
+
+  return std::string(home) + "/.gazebo/mesh_cache";
+}
+
+/////////////////////////////////////////////////
+uint64_t MeshCache::DefaultMaxSize()
+{
+  const char *env = std::getenv("GAZEBO_MESH_CACHE_SIZE");
+  if (env)
+  {
+    char *end = nullptr;
+    const unsigned long long size = std::strtoull(env, &end, 10);
+    if (end != env && *end == '\0')
+      return static_cast<uint64_t>(size) << 20;
+
+    gzwarn << "Invalid GAZEBO_MESH_CACHE_SIZE[" << env << "], using "
+           << kDefaultMaxSizeMB << " MB\n";
+  }
+
+  return kDefaultMaxSizeMB << 20;
+}
+
+/////////////////////////////////////////////////
+std::string MeshCache::CacheFilename(const std::string &_filename) const
+{
+  std::ifstream file(_filename, std::ios::binary);
+  if (!file)
+    return std::string();
+
+  // The path is part of the key, since loaders resolve texture paths
+  // relative to the mesh file.
+  uint64_t hash = fnv1a(14695981039346656037ULL, _filename.data(),
+      _filename.size());
+  hash = fnv1a(hash, reinterpret_cast<const char *>(&kVersion),
+      sizeof(kVersion));
+
+  std::vector<char> buffer(1 << 16);
+  while (file)
+  {
+    file.read(buffer.data(), buffer.size());
+    hash = fnv1a(hash, buffer.data(), file.gcount());
+  }
+
+  std::ostringstream stream;
+  stream << this->path << "/" << std::hex << std::setw(16)
+         << std::setfill('0') << hash << kExtension;
+  return stream.str();
+}
+
+/////////////////////////////////////////////////
+Mesh *MeshCache::Load(const std::string &_filename) const
+{
+  std::string cacheFilename;
+  return this->Load(_filename, cacheFilename);
+}
+
+/////////////////////////////////////////////////
+Mesh *MeshCache::Load(const std::string &_filename,
+    std::string &_cacheFilename) const
+{
+  _cacheFilename.clear();
+  if (this->path.empty() || this->maxSize == 0)
+    return nullptr;
+
+  _cacheFilename = this->CacheFilename(_filename);
+  if (_cacheFilename.empty())
+    return nullptr;
+
+  Mesh *mesh = nullptr;
+
+#ifndef _WIN32
+  int fd = open(_cacheFilename.c_str(), O_RDONLY);
+  if (fd < 0)
+    return nullptr;
+
+  struct stat st;
+  if (fstat(fd, &st) == 0 && st.st_size > 0)
+  {
+    void *data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data != MAP_FAILED)
+    {
+      mesh = readMesh(static_cast<const char *>(data), st.st_size);
+      munmap(data, st.st_size);
+    }
+  }
+  close(fd);
+#else
+  std::ifstream file(_cacheFilename, std::ios::binary);
+  if (!file)
+    return nullptr;
+  std::string data((std::istreambuf_iterator<char>(file)),
+      std::istreambuf_iterator<char>());
+  mesh = readMesh(data.data(), data.size());
+#endif
+
+  if (!mesh)
+  {
+    gzwarn << "Ignoring invalid mesh cache file[" << _cacheFilename << "]\n";
+    return nullptr;
+  }
+
+  // Mark the file as recently used, so that it's evicted last.
+  boost::system::error_code ec;
+  boost::filesystem::last_write_time(_cacheFilename, std::time(nullptr), ec);
+
+  return mesh;
+}
+
+/////////////////////////////////////////////////
+bool MeshCache::Save(const std::string &_cacheFilename,
+    const Mesh *_mesh) const
+{
+  if (this->path.empty() || this->maxSize == 0 || _cacheFilename.empty() ||
+      !_mesh || _mesh->HasSkeleton())
+  {
+    return false;
+  }
+
+  const std::string data = writeMesh(_mesh);
+  if (data.size() > this->maxSize)
+    return false;
+
+  try
+  {
+    boost::filesystem::create_directories(this->path);
+
+    // Write to a unique temporary file, then rename it, so that readers
+    // never see a partial file.
+    boost::filesystem::path tmpFilename = _cacheFilename +
+      boost::filesystem::unique_path(".%%%%-%%%%-%%%%.tmp").string();
+    {
+      std::ofstream file(tmpFilename.string(), std::ios::binary);
+      file.write(data.data(), data.size());
+      if (!file)
+      {
+        file.close();
+        boost::filesystem::remove(tmpFilename);
+        return false;
+      }
+    }
+    boost::filesystem::rename(tmpFilename, _cacheFilename);
+  }
+  catch(boost::filesystem::filesystem_error &_e)
+  {
+    gzwarn << "Unable to write mesh cache file[" << _cacheFilename << "]: "
+           << _e.what() << "\n";
+    return false;
+  }
+
+  this->Evict(_cacheFilename);
+
+  return true;
+}
+
+/////////////////////////////////////////////////
+void MeshCache::Evict(const std::string &_keep) const
+{
+  /// \brief A cache file.
+  struct Entry
+  {
+    /// \brief Last time the file was used.
+    std::time_t time;
+
+    /// \brief Size of the file in bytes.
+    uint64_t size;
+
+    /// \brief Path to the file.
+    boost::filesystem::path path;
+  };
+
+  // Other processes may add or remove files while the directory is read,
+  // so errors on single files are ignored.
+  std::vector<Entry> entries;
+  uint64_t total = 0;
+  boost::system::error_code ec;
+  for (boost::filesystem::directory_iterator iter(this->path, ec), end;
+       !ec && iter != end; iter.increment(ec))
+  {
+    const boost::filesystem::path &file = iter->path();
+    if (file.extension() != kExtension)
+      continue;
+
+    boost::system::error_code fileEc;
+    const uint64_t size = boost::filesystem::file_size(file, fileEc);
+    if (fileEc)
+      continue;
+    const std::time_t time = boost::filesystem::last_write_time(file, fileEc);
+    if (fileEc)
+      continue;
+
+    entries.push_back({time, size, file});
+    total += size;
+  }
+
+  if (total <= this->maxSize)
+    return;
+
+  std::sort(entries.begin(), entries.end(),
+      [](const Entry &_a, const Entry &_b)
+      {
+        return _a.time < _b.time;
+      });
+
+  for (auto const &entry : entries)
+  {
+    if (total <= this->maxSize)
+      break;
+    if (entry.path.string() == _keep)
+      continue;
+
+    boost::system::error_code removeEc;
+    boost::filesystem::remove(entry.path, removeEc);
+    if (!removeEc)
+      total -= entry.size;
+  }
+}
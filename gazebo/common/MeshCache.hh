@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GAZEBO_COMMON_MESHCACHE_HH_
+#define GAZEBO_COMMON_MESHCACHE_HH_
+
+#include <cstdint>
+#include <string>
+
+#include "gazebo/util/system.hh"
+
+namespace gazebo
+{
+  namespace common
+  {
+    class Mesh;
+
+    /// \addtogroup gazebo_common Common
+    /// \{
+
+    /// \class MeshCache MeshCache.hh common/common.hh
+    /// \brief On-disk cache of loaded meshes.
+    ///
+    /// Meshes are stored in a flat binary file with the vertex, normal,
+    /// texture coordinate and index arrays laid out contiguously. Reading a
+    /// cached mesh maps the file into memory and copies the arrays, without
+    /// any parsing. Cache files are named after a hash of the content and
+    /// the path of the source file. A source file that changes gets a new
+    /// cache entry. Meshes with a skeleton are not cached.
+    ///
+    /// The total size of the cache files is bounded. When storing a mesh
+    /// exceeds the bound, the least recently used files are removed.
+    class GZ_COMMON_VISIBLE MeshCache
+    {
+      /// \brief Constructor. The maximum size of the cache is given by
+      /// DefaultMaxSize.
+      /// \param[in] _path Directory of the cache files. It is created when
+      /// the first mesh is stored.
+      public: explicit MeshCache(const std::string &_path);
+
+      /// \brief Get the directory of the cache files.
+      /// \return Path to the directory.
+      public: std::string Path() const;
+
+      /// \brief Set the maximum total size of the cache files.
+      /// \param[in] _size Size in bytes. Zero disables the cache.
+      public: void SetMaxSize(const uint64_t _size);
+
+      /// \brief Get the maximum total size of the cache files.
+      /// \return Size in bytes.
+      public: uint64_t MaxSize() const;
+
+      /// \brief Load the cached copy of a mesh file.
+      /// \param[in] _filename Path to the source mesh file.
+      /// \return A new mesh, owned by the caller, or nullptr if the file is
+      /// not in the cache.
+      public: Mesh *Load(const std::string &_filename) const;
+
+      /// \brief Load the cached copy of a mesh file, and get the path of
+      /// its cache file, so that a mesh loaded from the source file after a
+      /// miss can be stored without hashing the source file again.
+      /// \param[in] _filename Path to the source mesh file.
+      /// \param[out] _cacheFilename Path to the cache file, as returned by
+      /// CacheFilename.
+      /// \return A new mesh, owned by the caller, or nullptr if the file is
+      /// not in the cache.
+      public: Mesh *Load(const std::string &_filename,
+                         std::string &_cacheFilename) const;
+
+      /// \brief Store a mesh in the cache, then remove the least recently
+      /// used cache files if the cache is larger than MaxSize. Safe to call
+      /// from several threads or processes at the same time.
+      /// \param[in] _cacheFilename Path to the cache file of the source
+      /// mesh file, as returned by CacheFilename or Load.
+      /// \param[in] _mesh Mesh loaded from the source mesh file.
+      /// \return True if the mesh was stored.
+      public: bool Save(const std::string &_cacheFilename,
+                        const Mesh *_mesh) const;
+
+      /// \brief Get the default cache directory. This is the value of the
+      /// GAZEBO_MESH_CACHE_PATH environment variable if it is set, and
+      /// ~/.gazebo/mesh_cache otherwise. An empty GAZEBO_MESH_CACHE_PATH
+      /// disables the cache.
+      /// \return Path to the directory, or an empty string if caching is
+      /// disabled.
+      public: static std::string DefaultPath();
+
+      /// \brief Get the default maximum size of the cache. This is the
+      /// value of the GAZEBO_MESH_CACHE_SIZE environment variable, in
+      /// megabytes, if it is set, and 512 MB otherwise.
+      /// \return Size in bytes.
+      public: static uint64_t DefaultMaxSize();
+
+      /// \brief Get the path of the cache file of a mesh file.
+      /// \param[in] _filename Path to the source mesh file.
+      /// \return Path to the cache file, or an empty string if the source
+      /// file can't be read.
+      public: std::string CacheFilename(const std::string &_filename) const;
+
+      /// \brief Remove the least recently used cache files until the cache
+      /// fits in MaxSize.
+      /// \param[in] _keep Cache file that is never removed, since it was
+      /// just stored.
+      private: void Evict(const std::string &_keep) const;
+
+      /// \brief Directory of the cache files.
+      private: std::string path;
+
+      /// \brief Maximum total size of the cache files, in bytes.
+      private: uint64_t maxSize;
+    };
+    /// \}
+  }
+}
+#endif
@@ -0,0 +1,262 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <algorithm>
+#include <fstream>
+#include <memory>
+
+#include <boost/filesystem.hpp>
+#include <gtest/gtest.h>
+
+#include "test_config.h"
+#include "gazebo/common/ColladaLoader.hh"
+#include "gazebo/common/Material.hh"
+#include "gazebo/common/Mesh.hh"
+#include "gazebo/common/MeshCache.hh"
+#include "gazebo/common/STLLoader.hh"
+#include "test/util.hh"
+
+using namespace gazebo;
+
+class MeshCacheTest : public gazebo::testing::AutoLogFixture
+{
+  /// \brief Create an empty cache directory.
+  public: virtual void SetUp()
+  {
+    gazebo::testing::AutoLogFixture::SetUp();
+    this->cachePath = boost::filesystem::temp_directory_path() /
+      boost::filesystem::unique_path("gazebo_mesh_cache_%%%%-%%%%");
+  }
+
+  /// \brief Remove the cache directory.
+  public: virtual void TearDown()
+  {
+    boost::filesystem::remove_all(this->cachePath);
+    gazebo::testing::AutoLogFixture::TearDown();
+  }
+
+  /// \brief Directory of the cache files.
+  public: boost::filesystem::path cachePath;
+};
+
+/////////////////////////////////////////////////
+/// \brief Check that two meshes have the same content.
+void expectEqualMeshes(const common::Mesh *_a, const common::Mesh *_b)
+{
+  EXPECT_EQ(_a->GetPath(), _b->GetPath());
+  ASSERT_EQ(_a->GetSubMeshCount(), _b->GetSubMeshCount());
+  ASSERT_EQ(_a->GetMaterialCount(), _b->GetMaterialCount());
+
+  for (unsigned int m = 0; m < _a->GetMaterialCount(); ++m)
+  {
+    const common::Material *matA = _a->GetMaterial(m);
+    const common::Material *matB = _b->GetMaterial(m);
+    EXPECT_EQ(matA->GetTextureImage(), matB->GetTextureImage());
+    EXPECT_EQ(matA->Ambient(), matB->Ambient());
+    EXPECT_EQ(matA->Diffuse(), matB->Diffuse());
+    EXPECT_EQ(matA->Specular(), matB->Specular());
+    EXPECT_EQ(matA->Emissive(), matB->Emissive());
+    EXPECT_DOUBLE_EQ(matA->GetTransparency(), matB->GetTransparency());
+    EXPECT_DOUBLE_EQ(matA->GetShininess(), matB->GetShininess());
+    EXPECT_EQ(matA->GetBlendMode(), matB->GetBlendMode());
+    EXPECT_EQ(matA->GetShadeMode(), matB->GetShadeMode());
+    EXPECT_EQ(matA->GetLighting(), matB->GetLighting());
+  }
+
+  for (unsigned int s = 0; s < _a->GetSubMeshCount(); ++s)
+  {
+    const common::SubMesh *subA = _a->GetSubMesh(s);
+    const common::SubMesh *subB = _b->GetSubMesh(s);
+    EXPECT_EQ(subA->GetName(), subB->GetName());
+    EXPECT_EQ(subA->GetPrimitiveType(), subB->GetPrimitiveType());
+    EXPECT_EQ(subA->GetMaterialIndex(), subB->GetMaterialIndex());
+
+    ASSERT_EQ(subA->GetVertexCount(), subB->GetVertexCount());
+    for (unsigned int i = 0; i < subA->GetVertexCount(); ++i)
+      EXPECT_EQ(subA->Vertex(i), subB->Vertex(i));
+
+    ASSERT_EQ(subA->GetNormalCount(), subB->GetNormalCount());
+    for (unsigned int i = 0; i < subA->GetNormalCount(); ++i)
+      EXPECT_EQ(subA->Normal(i), subB->Normal(i));
+
+    ASSERT_EQ(subA->GetTexCoordCount(), subB->GetTexCoordCount());
+    for (unsigned int i = 0; i < subA->GetTexCoordCount(); ++i)
+      EXPECT_EQ(subA->TexCoord(i), subB->TexCoord(i));
+
+    ASSERT_EQ(subA->GetIndexCount(), subB->GetIndexCount());
+    for (unsigned int i = 0; i < subA->GetIndexCount(); ++i)
+      EXPECT_EQ(subA->GetIndex(i), subB->GetIndex(i));
+  }
+}
+
+/////////////////////////////////////////////////
+TEST_F(MeshCacheTest, SaveLoad)
+{
+  common::MeshCache cache(this->cachePath.string());
+  EXPECT_EQ(cache.Path(), this->cachePath.string());
+
+  for (auto const &name : {"box.dae", "box_with_multiple_geoms.dae"})
+  {
+    const std::string filename =
+      std::string(PROJECT_SOURCE_PATH) + "/test/data/" + name;
+
+    // Nothing cached yet
+    std::string cacheFilename;
+    EXPECT_TRUE(cache.Load(filename, cacheFilename) == nullptr);
+    EXPECT_EQ(cache.CacheFilename(filename), cacheFilename);
+
+    common::ColladaLoader loader;
+    std::unique_ptr<common::Mesh> mesh(loader.Load(filename));
+    ASSERT_TRUE(mesh != nullptr);
+
+    EXPECT_TRUE(cache.Save(cacheFilename, mesh.get()));
+    EXPECT_TRUE(boost::filesystem::exists(cacheFilename));
+
+    std::unique_ptr<common::Mesh> cached(cache.Load(filename));
+    ASSERT_TRUE(cached != nullptr);
+    expectEqualMeshes(mesh.get(), cached.get());
+  }
+
+  // Binary STL
+  const std::string filename =
+    std::string(PROJECT_SOURCE_PATH) + "/test/data/twoFaces.stlb";
+  common::STLLoader loader;
+  std::unique_ptr<common::Mesh> mesh(loader.Load(filename));
+  ASSERT_TRUE(mesh != nullptr);
+  EXPECT_TRUE(cache.Save(cache.CacheFilename(filename), mesh.get()));
+  std::unique_ptr<common::Mesh> cached(cache.Load(filename));
+  ASSERT_TRUE(cached != nullptr);
+  expectEqualMeshes(mesh.get(), cached.get());
+}
+
+/////////////////////////////////////////////////
+TEST_F(MeshCacheTest, Key)
+{
+  common::MeshCache cache(this->cachePath.string());
+
+  // Copy a mesh file, so that it can be modified
+  boost::filesystem::create_directories(this->cachePath);
+  const boost::filesystem::path filename = this->cachePath / "box.dae";
+  boost::filesystem::copy_file(
+      std::string(PROJECT_SOURCE_PATH) + "/test/data/box.dae", filename);
+
+  const std::string cacheFilename = cache.CacheFilename(filename.string());
+  EXPECT_FALSE(cacheFilename.empty());
+  EXPECT_EQ(cacheFilename, cache.CacheFilename(filename.string()));
+  EXPECT_EQ(0u, cacheFilename.find(this->cachePath.string()));
+
+  // Changing the content of the source file changes the key
+  {
+    std::ofstream file(filename.string(), std::ios::app);
+    file << "\n";
+  }
+  EXPECT_NE(cacheFilename, cache.CacheFilename(filename.string()));
+
+  // Missing files have no key
+  EXPECT_TRUE(cache.CacheFilename(
+        (this->cachePath / "missing.dae").string()).empty());
+}
+
+/////////////////////////////////////////////////
+TEST_F(MeshCacheTest, Invalid)
+{
+  const std::string filename =
+    std::string(PROJECT_SOURCE_PATH) + "/test/data/box.dae";
+  common::ColladaLoader loader;
+  std::unique_ptr<common::Mesh> mesh(loader.Load(filename));
+  ASSERT_TRUE(mesh != nullptr);
+
+  // An empty path disables the cache
+  common::MeshCache disabled("");
+  EXPECT_FALSE(disabled.Save(disabled.CacheFilename(filename), mesh.get()));
+  EXPECT_TRUE(disabled.Load(filename) == nullptr);
+
+  // Truncated cache files are ignored
+  common::MeshCache cache(this->cachePath.string());
+  const std::string cacheFilename = cache.CacheFilename(filename);
+  EXPECT_TRUE(cache.Save(cacheFilename, mesh.get()));
+  boost::filesystem::resize_file(cacheFilename,
+      boost::filesystem::file_size(cacheFilename) / 2);
+  EXPECT_TRUE(cache.Load(filename) == nullptr);
+
+  // Meshes with a skeleton are not cached
+  const std::string skinned = std::string(PROJECT_SOURCE_PATH) +
+    "/test/data/box_with_animation_outside_skeleton.dae";
+  std::unique_ptr<common::Mesh> skinnedMesh(loader.Load(skinned));
+  ASSERT_TRUE(skinnedMesh != nullptr);
+  if (skinnedMesh->HasSkeleton())
+  {
+    EXPECT_FALSE(cache.Save(cache.CacheFilename(skinned),
+          skinnedMesh.get()));
+    EXPECT_TRUE(cache.Load(skinned) == nullptr);
+  }
+}
+
+/////////////////////////////////////////////////
+TEST_F(MeshCacheTest, Evict)
+{
+  const std::string first =
+    std::string(PROJECT_SOURCE_PATH) + "/test/data/box.dae";
+  const std::string second = std::string(PROJECT_SOURCE_PATH) +
+    "/test/data/box_with_multiple_geoms.dae";
+  common::ColladaLoader loader;
+  std::unique_ptr<common::Mesh> firstMesh(loader.Load(first));
+  ASSERT_TRUE(firstMesh != nullptr);
+  std::unique_ptr<common::Mesh> secondMesh(loader.Load(second));
+  ASSERT_TRUE(secondMesh != nullptr);
+
+  common::MeshCache cache(this->cachePath.string());
+  EXPECT_EQ(common::MeshCache::DefaultMaxSize(), cache.MaxSize());
+  const std::string firstCache = cache.CacheFilename(first);
+  const std::string secondCache = cache.CacheFilename(second);
+
+  // Both files fit in the default size
+  EXPECT_TRUE(cache.Save(firstCache, firstMesh.get()));
+  EXPECT_TRUE(cache.Save(secondCache, secondMesh.get()));
+  const uint64_t firstSize = boost::filesystem::file_size(firstCache);
+  const uint64_t secondSize = boost::filesystem::file_size(secondCache);
+
+  // Only one of them fits in the smaller cache. The least recently used is
+  // removed when the other one is stored.
+  cache.SetMaxSize(std::max(firstSize, secondSize));
+  EXPECT_EQ(std::max(firstSize, secondSize), cache.MaxSize());
+  boost::filesystem::remove(secondCache);
+  boost::filesystem::last_write_time(firstCache,
+      boost::filesystem::last_write_time(firstCache) - 100);
+  EXPECT_TRUE(cache.Save(secondCache, secondMesh.get()));
+  EXPECT_FALSE(boost::filesystem::exists(firstCache));
+  EXPECT_TRUE(boost::filesystem::exists(secondCache));
+  EXPECT_TRUE(cache.Load(first) == nullptr);
+
+  // Meshes larger than the cache are not stored
+  cache.SetMaxSize(std::min(firstSize, secondSize) - 1);
+  boost::filesystem::remove(secondCache);
+  EXPECT_FALSE(cache.Save(firstCache, firstMesh.get()));
+  EXPECT_FALSE(cache.Save(secondCache, secondMesh.get()));
+
+  // A zero size disables the cache
+  cache.SetMaxSize(0);
+  EXPECT_FALSE(cache.Save(firstCache, firstMesh.get()));
+  EXPECT_TRUE(cache.Load(first) == nullptr);
+}
+
+/////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -16,16 +16,25 @@
  */
 
 #include <sys/stat.h>
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+
+#include <algorithm>
+#include <memory>
+#include <set>
 #include <string>
 #include <map>
+#include <boost/thread/recursive_mutex.hpp>
 
 #include "gazebo/common/CommonIface.hh"
 #include "gazebo/common/Exception.hh"
 #include "gazebo/common/Console.hh"
 #include "gazebo/common/Mesh.hh"
+#include "gazebo/common/MeshCache.hh"
 #include "gazebo/common/ColladaLoader.hh"
 #include "gazebo/common/ColladaExporter.hh"
 #include "gazebo/common/STLLoader.hh"
+#include "gazebo/common/SystemPaths.hh"
 #include "gazebo/common/OBJLoader.hh"
 #include "gazebo/gazebo_config.h"
 
@@ -62,9 +71,13 @@ class MeshManagerPrivate
   /// \brief supported file extensions for meshes
   public: std::vector<std::string> fileExtensions;
 
-  /// \brief Mutex to protect from loading the same mesh in different threads
-  /// at the same time.
-  public: boost::mutex mutex;
+  /// \brief On-disk cache of loaded meshes.
+  public: std::unique_ptr<MeshCache> cache;
+
+  /// \brief Mutex to protect the mesh dictionary, and to prevent loading
+  /// the same mesh in different threads at the same time. Worlds running
+  /// on separate threads share this manager.
+  public: boost::recursive_mutex mutex;
 };
 
 // added here for ABI compatibility
@@ -78,6 +91,7 @@ MeshManager::MeshManager()
   this->dataPtr->colladaLoader = new ColladaLoader();
   this->dataPtr->colladaExporter = new ColladaExporter();
   this->dataPtr->stlLoader = new STLLoader();
+  this->dataPtr->cache.reset(new MeshCache(MeshCache::DefaultPath()));
 
   // Create some basic shapes
   this->CreatePlane("unit_plane",
@@ -142,21 +156,24 @@ const Mesh *MeshManager::Load(const std::string &_filename)
 
   std::string extension;
 
-  if (this->HasMesh(_filename))
   {
-    return this->dataPtr->meshes[_filename];
-
-    // This breaks trimesh geom. Each new trimesh should have a unique name.
-    /*
-    // erase mesh from this->dataPtr->meshes.
-    // This allows a mesh to be modified and
-    // inserted into gazebo again without closing gazebo.
-    std::map<std::string, Mesh*>::iterator iter;
-    iter = this->dataPtr->meshes.find(_filename);
-    delete iter->second;
-    iter->second = nullptr;
-    this->dataPtr->meshes.erase(iter);
-    */
+    boost::recursive_mutex::scoped_lock lock(this->dataPtr->mutex);
+    if (this->HasMesh(_filename))
+    {
+      return this->dataPtr->meshes[_filename];
+
+      // This breaks trimesh geom. Each new trimesh should have a unique name.
+      /*
+      // erase mesh from this->dataPtr->meshes.
+      // This allows a mesh to be modified and
+      // inserted into gazebo again without closing gazebo.
+      std::map<std::string, Mesh*>::iterator iter;
+      iter = this->dataPtr->meshes.find(_filename);
+      delete iter->second;
+      iter->second = nullptr;
+      this->dataPtr->meshes.erase(iter);
+      */
+    }
   }
 
   std::string fullname = common::find_file(_filename);
@@ -184,10 +201,15 @@ const Mesh *MeshManager::Load(const std::string &_filename)
     {
       // This mutex prevents two threads from loading the same mesh at the
       // same time.
-      boost::mutex::scoped_lock lock(this->dataPtr->mutex);
+      boost::recursive_mutex::scoped_lock lock(this->dataPtr->mutex);
       if (!this->HasMesh(_filename))
       {
-        if ((mesh = loader->Load(fullname)) != nullptr)
+        std::string cacheFilename;
+        mesh = this->dataPtr->cache->Load(fullname, cacheFilename);
+        if (!mesh && (mesh = loader->Load(fullname)) != nullptr)
+          this->dataPtr->cache->Save(cacheFilename, mesh);
+
+        if (mesh != nullptr)
         {
           mesh->SetName(_filename);
           this->dataPtr->meshes.insert(std::make_pair(_filename, mesh));
@@ -213,6 +235,135 @@ const Mesh *MeshManager::Load(const std::string &_filename)
   return mesh;
 }
 
+//////////////////////////////////////////////////
+unsigned int MeshManager::Preload(const std::vector<std::string> &_filenames)
+{
+  /// \brief A mesh to load on a worker thread.
+  struct PreloadJob
+  {
+    /// \brief Name of the mesh in the cache.
+    std::string name;
+
+    /// \brief Path to the mesh file.
+    std::string fullname;
+
+    /// \brief Lower case file extension.
+    std::string extension;
+
+    /// \brief Loaded mesh, or nullptr if loading failed.
+    Mesh *mesh = nullptr;
+  };
+
+  // Resolve the paths on the calling thread, since SystemPaths is not
+  // thread safe.
+  std::vector<PreloadJob> jobs;
+  std::set<std::string> names;
+  for (auto const &filename : _filenames)
+  {
+    if (!names.insert(filename).second || this->HasMesh(filename) ||
+        !this->IsValidFilename(filename))
+    {
+      continue;
+    }
+
+    PreloadJob job;
+    job.name = filename;
+    job.fullname = common::find_file(filename);
+    if (job.fullname.empty())
+      continue;
+
+    job.extension = job.fullname.substr(job.fullname.rfind(".") + 1);
+    std::transform(job.extension.begin(), job.extension.end(),
+        job.extension.begin(), ::tolower);
+    jobs.push_back(job);
+  }
+
+  if (jobs.empty())
+    return 0;
+
+  // Loaders look up textures through SystemPaths. Update the search paths
+  // from the environment now, so that the workers only read them.
+  SystemPaths::Instance()->GetGazeboPaths();
+
+  std::unique_ptr<MeshCache> cache;
+  {
+    boost::recursive_mutex::scoped_lock lock(this->dataPtr->mutex);
+    cache.reset(new MeshCache(*this->dataPtr->cache));
+  }
+
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, jobs.size(), 1),
+      [&jobs, &cache](const tbb::blocked_range<size_t> &_r)
+  {
+    // Loaders keep state while parsing a file, so each task uses its own.
+    std::unique_ptr<MeshLoader> loader;
+    for (size_t i = _r.begin(); i != _r.end(); ++i)
+    {
+      PreloadJob &job = jobs[i];
+      std::string cacheFilename;
+      if ((job.mesh = cache->Load(job.fullname, cacheFilename)) != nullptr)
+        continue;
+
+      if (job.extension == "stl" || job.extension == "stlb" ||
+          job.extension == "stla")
+      {
+        loader.reset(new STLLoader());
+      }
+      else if (job.extension == "dae")
+        loader.reset(new ColladaLoader());
+      else if (job.extension == "obj")
+        loader.reset(new OBJLoader());
+      else
+        continue;
+
+      try
+      {
+        if ((job.mesh = loader->Load(job.fullname)) != nullptr)
+          cache->Save(cacheFilename, job.mesh);
+      }
+      catch(gazebo::common::Exception &e)
+      {
+        gzerr << "Error preloading mesh[" << job.fullname << "]\n";
+        gzerr << e << "\n";
+      }
+    }
+  });
+
+  unsigned int count = 0;
+  boost::recursive_mutex::scoped_lock lock(this->dataPtr->mutex);
+  for (auto &job : jobs)
+  {
+    if (!job.mesh)
+      continue;
+
+    // Another thread may have loaded the same mesh in the meantime.
+    if (this->HasMesh(job.name))
+    {
+      delete job.mesh;
+      continue;
+    }
+
+    job.mesh->SetName(job.name);
+    this->dataPtr->meshes.insert(std::make_pair(job.name, job.mesh));
+    ++count;
+  }
+
+  return count;
+}
+
+//////////////////////////////////////////////////
+void MeshManager::SetCachePath(const std::string &_path)
+{
+  boost::recursive_mutex::scoped_lock lock(this->dataPtr->mutex);
+  this->dataPtr->cache.reset(new MeshCache(_path));
+}
+
+//////////////////////////////////////////////////
+std::string MeshManager::CachePath() const
+{
+  boost::recursive_mutex::scoped_lock lock(this->dataPtr->mutex);
+  return this->dataPtr->cache->Path();
+}
+
 //////////////////////////////////////////////////
 void MeshManager::Export(const Mesh *_mesh, const std::string &_filename,
     const std::string &_extension, bool _exportTextures)
@@ -264,6 +415,7 @@ void MeshManager::GenSphericalTexCoord(const Mesh *_mesh,
 //////////////////////////////////////////////////
 void MeshManager::AddMesh(Mesh *_mesh)
 {
+  boost::recursive_mutex::scoped_lock lock(this->dataPtr->mutex);
   if (!this->HasMesh(_mesh->GetName()))
     this->dataPtr->meshes[_mesh->GetName()] = _mesh;
 }
@@ -271,6 +423,7 @@ void MeshManager::AddMesh(Mesh *_mesh)
 //////////////////////////////////////////////////
 const Mesh *MeshManager::GetMesh(const std::string &_name) const
 {
+  boost::recursive_mutex::scoped_lock lock(this->dataPtr->mutex);
   std::map<std::string, Mesh*>::const_iterator iter;
 
   iter = this->dataPtr->meshes.find(_name);
@@ -287,6 +440,7 @@ bool MeshManager::HasMesh(const std::string &_name) const
   if (_name.empty())
     return false;
 
+  boost::recursive_mutex::scoped_lock lock(this->dataPtr->mutex);
   std::map<std::string, Mesh*>::const_iterator iter;
   iter = this->dataPtr->meshes.find(_name);
 
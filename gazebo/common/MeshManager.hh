@@ -62,6 +62,28 @@ namespace gazebo
       /// \return a pointer to the created mesh
       public: const Mesh *Load(const std::string &_filename);
 
+      /// \brief Load several meshes in parallel, so that later calls to
+      /// Load find them in the cache. Meshes are resolved and named like
+      /// Load does. Filenames that are already loaded, or that can't be
+      /// found, are skipped.
+      /// \param[in] _filenames Paths to the meshes.
+      /// \return Number of meshes that were loaded.
+      public: unsigned int Preload(const std::vector<std::string> &_filenames);
+
+      /// \brief Set the directory of the on-disk mesh cache. Meshes loaded
+      /// from files are stored there, and loaded from there on later runs
+      /// without parsing the source file. The default is given by
+      /// MeshCache::DefaultPath, and the size of the cache is bounded by
+      /// MeshCache::DefaultMaxSize.
+      /// \param[in] _path Path to the cache directory, or an empty string
+      /// to disable the cache.
+      public: void SetCachePath(const std::string &_path);
+
+      /// \brief Get the directory of the on-disk mesh cache.
+      /// \return Path to the cache directory, empty if the cache is
+      /// disabled.
+      public: std::string CachePath() const;
+
       /// \brief Export a mesh to a file
       /// \param[in] _mesh Pointer to the mesh to be exported
       /// \param[in] _filename Exported file's path and name
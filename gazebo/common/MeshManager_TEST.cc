@@ -266,6 +266,43 @@ TEST_F(MeshManager, CreateExtrudedPolylineInvalid)
   EXPECT_TRUE(!common::MeshManager::Instance()->HasMesh(meshName));
 }
 
+/////////////////////////////////////////////////
+TEST_F(MeshManager, Preload)
+{
+  common::MeshManager *meshManager = common::MeshManager::Instance();
+
+  const std::string dae = std::string(PROJECT_SOURCE_PATH) +
+    "/test/data/box.dae";
+  const std::string obj = std::string(PROJECT_SOURCE_PATH) +
+    "/test/data/box.obj";
+  const std::string stl = std::string(PROJECT_SOURCE_PATH) +
+    "/test/data/twoFaces.stl";
+  const std::string missing = std::string(PROJECT_SOURCE_PATH) +
+    "/test/data/missing.dae";
+
+  EXPECT_FALSE(meshManager->HasMesh(dae));
+  EXPECT_FALSE(meshManager->HasMesh(obj));
+  EXPECT_FALSE(meshManager->HasMesh(stl));
+
+  // Duplicates, missing files and unsupported formats are skipped
+  EXPECT_EQ(meshManager->Preload(
+        {dae, obj, stl, dae, missing, "not_a_mesh.txt"}), 3u);
+  EXPECT_TRUE(meshManager->HasMesh(dae));
+  EXPECT_TRUE(meshManager->HasMesh(obj));
+  EXPECT_TRUE(meshManager->HasMesh(stl));
+  EXPECT_FALSE(meshManager->HasMesh(missing));
+
+  // Load returns the preloaded mesh
+  const common::Mesh *mesh = meshManager->GetMesh(dae);
+  ASSERT_TRUE(mesh != nullptr);
+  EXPECT_EQ(mesh->GetName(), dae);
+  EXPECT_EQ(meshManager->Load(dae), mesh);
+  EXPECT_EQ(mesh->GetVertexCount(), 24u);
+
+  // Meshes that are already loaded are not loaded again
+  EXPECT_EQ(meshManager->Preload({dae, obj, stl}), 0u);
+}
+
 /////////////////////////////////////////////////
 int main(int argc, char **argv)
 {
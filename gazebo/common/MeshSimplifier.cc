@@ -0,0 +1,777 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iterator>
+#include <map>
+#include <queue>
+#include <sstream>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <boost/filesystem.hpp>
+
+#include "gazebo/common/Console.hh"
+#include "gazebo/common/MeshSimplifier.hh"
+
+using namespace gazebo;
+using namespace common;
+
+namespace
+{
+  /// \brief Magic number at the start of cache files.
+  const char kMagic[4] = {'G', 'Z', 'S', 'M'};
+
+  /// \brief Version of the cache files, and of the simplification
+  /// algorithm. Increment it when either changes.
+  const uint32_t kVersion = 1;
+
+  /// \brief Extension of cache files.
+  const char kExtension[] = ".gzsimp";
+
+  /// \brief Weight of the planes that keep the boundary of open meshes in
+  /// place, relative to the planes of the triangles.
+  const double kBoundaryWeight = 1000.0;
+
+  /// \brief Sum of the squared distances to a set of planes, as a
+  /// symmetric 4x4 matrix.
+  class Quadric
+  {
+    /// \brief Add a plane.
+    /// \param[in] _n Unit normal of the plane.
+    /// \param[in] _p Point of the plane.
+    /// \param[in] _weight Weight of the plane.
+    public: void AddPlane(const ignition::math::Vector3d &_n,
+                const ignition::math::Vector3d &_p, const double _weight)
+    {
+      const double p[4] = {_n.X(), _n.Y(), _n.Z(), -_n.Dot(_p)};
+      unsigned int k = 0;
+      for (unsigned int i = 0; i < 4; ++i)
+      {
+        for (unsigned int j = i; j < 4; ++j)
+          this->q[k++] += _weight * p[i] * p[j];
+      }
+    }
+
+    /// \brief Add another quadric.
+    /// \param[in] _other The quadric.
+    public: void Add(const Quadric &_other)
+    {
+      for (unsigned int i = 0; i < 10; ++i)
+        this->q[i] += _other.q[i];
+    }
+
+    /// \brief Evaluate the quadric.
+    /// \param[in] _p The point.
+    /// \return Sum of the squared distances from _p to the planes.
+    public: double Error(const ignition::math::Vector3d &_p) const
+    {
+      const double x = _p.X(), y = _p.Y(), z = _p.Z();
+      const double error =
+        q[0]*x*x + 2*q[1]*x*y + 2*q[2]*x*z + 2*q[3]*x +
+        q[4]*y*y + 2*q[5]*y*z + 2*q[6]*y +
+        q[7]*z*z + 2*q[8]*z +
+        q[9];
+      return std::max(error, 0.0);
+    }
+
+    /// \brief Find the point of smallest error.
+    /// \param[out] _p The point.
+    /// \return False if the point isn't unique.
+    public: bool Minimum(ignition::math::Vector3d &_p) const
+    {
+      const double det =
+        q[0] * (q[4]*q[7] - q[5]*q[5]) -
+        q[1] * (q[1]*q[7] - q[5]*q[2]) +
+        q[2] * (q[1]*q[5] - q[4]*q[2]);
+      const double scale = std::max(q[0], std::max(q[4], q[7]));
+      if (std::abs(det) <= 1e-9 * scale * scale * scale)
+        return false;
+
+      // Cramer's rule
+      const double b[3] = {-q[3], -q[6], -q[8]};
+      _p.Set(
+          (b[0] * (q[4]*q[7] - q[5]*q[5]) -
+           q[1] * (b[1]*q[7] - q[5]*b[2]) +
+           q[2] * (b[1]*q[5] - q[4]*b[2])) / det,
+          (q[0] * (b[1]*q[7] - q[5]*b[2]) -
+           b[0] * (q[1]*q[7] - q[5]*q[2]) +
+           q[2] * (q[1]*b[2] - b[1]*q[2])) / det,
+          (q[0] * (q[4]*b[2] - b[1]*q[5]) -
+           q[1] * (q[1]*b[2] - b[1]*q[2]) +
+           b[0] * (q[1]*q[5] - q[4]*q[2])) / det);
+      return true;
+    }
+
+    /// \brief Upper triangle of the matrix, row by row.
+    private: double q[10] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+  };
+
+  /// \brief Candidate edge collapse.
+  struct Collapse
+  {
+    /// \brief Quadric error of the collapse.
+    double error;
+
+    /// \brief Vertex that is kept.
+    unsigned int a;
+
+    /// \brief Vertex that is removed.
+    unsigned int b;
+
+    /// \brief Versions of a and b when the collapse was computed.
+    unsigned int versionA, versionB;
+
+    /// \brief Position of the merged vertex.
+    ignition::math::Vector3d position;
+
+    /// \brief Order by decreasing error, for std::priority_queue.
+    /// \param[in] _other Other collapse.
+    /// \return True if this collapse has a larger error.
+    bool operator<(const Collapse &_other) const
+    {
+      return this->error > _other.error;
+    }
+  };
+
+  /////////////////////////////////////////////////
+  /// \brief Key of an undirected edge.
+  /// \param[in] _a First vertex.
+  /// \param[in] _b Second vertex.
+  /// \return The key.
+  uint64_t edgeKey(const unsigned int _a, const unsigned int _b)
+  {
+    return (static_cast<uint64_t>(std::min(_a, _b)) << 32) |
+      std::max(_a, _b);
+  }
+
+  /////////////////////////////////////////////////
+  /// \brief Update a 64-bit FNV-1a hash.
+  /// \param[in] _hash Current hash.
+  /// \param[in] _data Bytes to hash.
+  /// \param[in] _size Number of bytes.
+  /// \return Updated hash.
+  uint64_t fnv1a(uint64_t _hash, const void *_data, const size_t _size)
+  {
+    const unsigned char *data = static_cast<const unsigned char *>(_data);
+    for (size_t i = 0; i < _size; ++i)
+    {
+      _hash ^= data[i];
+      _hash *= 1099511628211ULL;
+    }
+    return _hash;
+  }
+
+  /////////////////////////////////////////////////
+  /// \brief Append a value to a buffer.
+  /// \param[in,out] _buffer The buffer.
+  /// \param[in] _value The value.
+  template<typename T>
+  void append(std::string &_buffer, const T &_value)
+  {
+    _buffer.append(reinterpret_cast<const char *>(&_value), sizeof(T));
+  }
+}
+
+namespace gazebo
+{
+  namespace common
+  {
+    /// \internal
+    /// \brief Private data for MeshSimplifier.
+    class MeshSimplifierPrivate
+    {
+      /// \brief Compute the best collapse of an edge.
+      /// \param[in] _a First vertex.
+      /// \param[in] _b Second vertex.
+      /// \return The collapse.
+      public: Collapse Candidate(const unsigned int _a,
+                  const unsigned int _b) const;
+
+      /// \brief Check whether a collapse keeps the mesh manifold and
+      /// doesn't flip triangles.
+      /// \param[in] _collapse The collapse.
+      /// \return True if the collapse is valid.
+      public: bool Valid(const Collapse &_collapse) const;
+
+      /// \brief Compute the key of a simplification in the cache.
+      /// \param[in] _vertices Vertices of the mesh.
+      /// \param[in] _indices Vertex indices of the triangles of the mesh.
+      /// \return The key.
+      public: uint64_t Key(
+                  const std::vector<ignition::math::Vector3d> &_vertices,
+                  const std::vector<unsigned int> &_indices) const;
+
+      /// \brief Load a simplified mesh from a cache file.
+      /// \param[in] _filename Path to the cache file.
+      /// \param[in] _key Key of the simplification.
+      /// \param[out] _vertices Vertices of the simplified mesh.
+      /// \param[out] _indices Vertex indices of its triangles.
+      /// \return False if the file doesn't exist or is invalid.
+      public: static bool Load(const std::string &_filename,
+                  const uint64_t _key,
+                  std::vector<ignition::math::Vector3d> &_vertices,
+                  std::vector<unsigned int> &_indices);
+
+      /// \brief Save a simplified mesh to a cache file.
+      /// \param[in] _filename Path to the cache file.
+      /// \param[in] _key Key of the simplification.
+      /// \param[in] _vertices Vertices of the simplified mesh.
+      /// \param[in] _indices Vertex indices of its triangles.
+      /// \return False if the file can't be written.
+      public: static bool Save(const std::string &_filename,
+                  const uint64_t _key,
+                  const std::vector<ignition::math::Vector3d> &_vertices,
+                  const std::vector<unsigned int> &_indices);
+
+      /// \brief Number of triangles at which to stop.
+      public: unsigned int targetTriangles = 0;
+
+      /// \brief Largest error allowed for a collapse, negative if
+      /// unbounded.
+      public: double maxError = -1;
+
+      /// \brief Positions of the vertices being simplified.
+      public: std::vector<ignition::math::Vector3d> positions;
+
+      /// \brief Quadric of each vertex.
+      public: std::vector<Quadric> quadrics;
+
+      /// \brief Version of each vertex, incremented when it changes.
+      public: std::vector<unsigned int> versions;
+
+      /// \brief True for the vertices removed by a collapse.
+      public: std::vector<bool> removed;
+
+      /// \brief Triangles being simplified.
+      public: std::vector<std::array<unsigned int, 3>> triangles;
+
+      /// \brief True for the triangles removed by a collapse.
+      public: std::vector<bool> removedTriangles;
+
+      /// \brief Triangles around each vertex. May hold removed triangles.
+      public: std::vector<std::vector<unsigned int>> vertexTriangles;
+    };
+  }
+}
+
+/////////////////////////////////////////////////
+MeshSimplifier::MeshSimplifier()
+  : dataPtr(new MeshSimplifierPrivate)
+{
+}
+
+/////////////////////////////////////////////////
+MeshSimplifier::~MeshSimplifier()
+{
+}
+
+/////////////////////////////////////////////////
+void MeshSimplifier::SetTargetTriangles(const unsigned int _count)
+{
+  this->dataPtr->targetTriangles = _count;
+}
+
+/////////////////////////////////////////////////
+unsigned int MeshSimplifier::TargetTriangles() const
+{
+  return this->dataPtr->targetTriangles;
+}
+
+/////////////////////////////////////////////////
+void MeshSimplifier::SetMaxError(const double _error)
+{
+  this->dataPtr->maxError = _error;
+}
+
+/////////////////////////////////////////////////
+double MeshSimplifier::MaxError() const
+{
+  return this->dataPtr->maxError;
+}
+
+/////////////////////////////////////////////////
+void MeshSimplifier::Simplify(
+    const std::vector<ignition::math::Vector3d> &_vertices,
+    const std::vector<unsigned int> &_indices,
+    std::vector<ignition::math::Vector3d> &_outVertices,
+    std::vector<unsigned int> &_outIndices) const
+{
+  MeshSimplifierPrivate &d = *this->dataPtr;
+
+  if (d.targetTriangles == 0 && d.maxError < 0)
+  {
+    _outVertices = _vertices;
+    _outIndices = _indices;
+    return;
+  }
+
+  // Merge the vertices at the same position, which mesh formats split
+  // to give them different normals or texture coordinates.
+  d.positions.clear();
+  std::vector<unsigned int> remap(_vertices.size());
+  std::map<std::tuple<double, double, double>, unsigned int> unique;
+  for (unsigned int i = 0; i < _vertices.size(); ++i)
+  {
+    auto it = unique.emplace(std::make_tuple(_vertices[i].X(),
+          _vertices[i].Y(), _vertices[i].Z()), d.positions.size()).first;
+    if (it->second == d.positions.size())
+      d.positions.push_back(_vertices[i]);
+    remap[i] = it->second;
+  }
+
+  const unsigned int vertexCount = d.positions.size();
+  d.quadrics.assign(vertexCount, Quadric());
+  d.versions.assign(vertexCount, 0);
+  d.removed.assign(vertexCount, false);
+  d.vertexTriangles.assign(vertexCount, std::vector<unsigned int>());
+  d.triangles.clear();
+
+  // Quadrics of the planes of the triangles
+  std::unordered_map<uint64_t, unsigned int> edgeCounts;
+  for (unsigned int i = 0; i + 2 < _indices.size(); i += 3)
+  {
+    if (_indices[i] >= _vertices.size() ||
+        _indices[i + 1] >= _vertices.size() ||
+        _indices[i + 2] >= _vertices.size())
+    {
+      continue;
+    }
+
+    const std::array<unsigned int, 3> t = {remap[_indices[i]],
+      remap[_indices[i + 1]], remap[_indices[i + 2]]};
+    if (t[0] == t[1] || t[1] == t[2] || t[2] == t[0])
+      continue;
+
+    ignition::math::Vector3d n = (d.positions[t[1]] - d.positions[t[0]]).Cross(
+        d.positions[t[2]] - d.positions[t[0]]);
+    if (n.Length() > 0)
+    {
+      n.Normalize();
+      for (auto const v : t)
+        d.quadrics[v].AddPlane(n, d.positions[t[0]], 1.0);
+    }
+
+    for (auto const v : t)
+      d.vertexTriangles[v].push_back(d.triangles.size());
+    for (unsigned int e = 0; e < 3; ++e)
+      ++edgeCounts[edgeKey(t[e], t[(e + 1) % 3])];
+    d.triangles.push_back(t);
+  }
+  d.removedTriangles.assign(d.triangles.size(), false);
+
+  // Planes perpendicular to the boundary edges keep open meshes from
+  // shrinking.
+  for (auto const &t : d.triangles)
+  {
+    ignition::math::Vector3d n = (d.positions[t[1]] - d.positions[t[0]]).Cross(
+        d.positions[t[2]] - d.positions[t[0]]);
+    for (unsigned int e = 0; e < 3; ++e)
+    {
+      const unsigned int a = t[e];
+      const unsigned int b = t[(e + 1) % 3];
+      if (edgeCounts[edgeKey(a, b)] != 1)
+        continue;
+
+      ignition::math::Vector3d side =
+        (d.positions[b] - d.positions[a]).Cross(n);
+      if (side.Length() <= 0)
+        continue;
+      side.Normalize();
+      d.quadrics[a].AddPlane(side, d.positions[a], kBoundaryWeight);
+      d.quadrics[b].AddPlane(side, d.positions[a], kBoundaryWeight);
+    }
+  }
+
+  std::priority_queue<Collapse> queue;
+  for (auto const &edge : edgeCounts)
+  {
+    queue.push(d.Candidate(static_cast<unsigned int>(edge.first >> 32),
+          static_cast<unsigned int>(edge.first & 0xffffffff)));
+  }
+
+  const double maxError = d.maxError < 0 ? -1 : d.maxError * d.maxError;
+  unsigned int triangleCount = d.triangles.size();
+  while (!queue.empty() && triangleCount > d.targetTriangles)
+  {
+    const Collapse collapse = queue.top();
+    queue.pop();
+
+    if (maxError >= 0 && collapse.error > maxError)
+      break;
+
+    // Skip the collapses of edges that changed since they were queued
+    if (d.removed[collapse.a] || d.removed[collapse.b] ||
+        d.versions[collapse.a] != collapse.versionA ||
+        d.versions[collapse.b] != collapse.versionB ||
+        !d.Valid(collapse))
+    {
+      continue;
+    }
+
+    // Merge b into a
+    d.positions[collapse.a] = collapse.position;
+    d.quadrics[collapse.a].Add(d.quadrics[collapse.b]);
+    d.removed[collapse.b] = true;
+    ++d.versions[collapse.a];
+
+    for (auto const t : d.vertexTriangles[collapse.b])
+    {
+      if (d.removedTriangles[t])
+        continue;
+
+      std::array<unsigned int, 3> &tri = d.triangles[t];
+      if (std::find(tri.begin(), tri.end(), collapse.a) != tri.end())
+      {
+        d.removedTriangles[t] = true;
+        --triangleCount;
+      }
+      else
+      {
+        std::replace(tri.begin(), tri.end(), collapse.b, collapse.a);
+        d.vertexTriangles[collapse.a].push_back(t);
+      }
+    }
+    d.vertexTriangles[collapse.b].clear();
+
+    std::vector<unsigned int> &around = d.vertexTriangles[collapse.a];
+    around.erase(std::remove_if(around.begin(), around.end(),
+          [&d](const unsigned int _t) {return d.removedTriangles[_t];}),
+        around.end());
+
+    // Queue the collapses of the edges around the merged vertex
+    std::unordered_set<unsigned int> neighbors;
+    for (auto const t : around)
+    {
+      for (auto const v : d.triangles[t])
+      {
+        if (v != collapse.a && neighbors.insert(v).second)
+          queue.push(d.Candidate(collapse.a, v));
+      }
+    }
+  }
+
+  // Keep the vertices of the remaining triangles
+  _outVertices.clear();
+  _outIndices.clear();
+  std::vector<int> outIndex(vertexCount, -1);
+  for (unsigned int t = 0; t < d.triangles.size(); ++t)
+  {
+    if (d.removedTriangles[t])
+      continue;
+
+    for (auto const v : d.triangles[t])
+    {
+      if (outIndex[v] < 0)
+      {
+        outIndex[v] = _outVertices.size();
+        _outVertices.push_back(d.positions[v]);
+      }
+      _outIndices.push_back(outIndex[v]);
+    }
+  }
+
+  d.positions.clear();
+  d.quadrics.clear();
+  d.versions.clear();
+  d.removed.clear();
+  d.triangles.clear();
+  d.removedTriangles.clear();
+  d.vertexTriangles.clear();
+}
+
+/////////////////////////////////////////////////
+void MeshSimplifier::Simplify(
+    const std::vector<ignition::math::Vector3d> &_vertices,
+    const std::vector<unsigned int> &_indices,
+    std::vector<ignition::math::Vector3d> &_outVertices,
+    std::vector<unsigned int> &_outIndices,
+    const std::string &_cachePath) const
+{
+  if (_cachePath.empty())
+  {
+    this->Simplify(_vertices, _indices, _outVertices, _outIndices);
+    return;
+  }
+
+  const uint64_t key = this->dataPtr->Key(_vertices, _indices);
+
+  std::ostringstream stream;
+  stream << _cachePath << "/" << std::hex << std::setw(16)
+         << std::setfill('0') << key << kExtension;
+  const std::string filename = stream.str();
+
+  if (MeshSimplifierPrivate::Load(filename, key, _outVertices, _outIndices))
+    return;
+
+  this->Simplify(_vertices, _indices, _outVertices, _outIndices);
+
+  if (!MeshSimplifierPrivate::Save(filename, key, _outVertices, _outIndices))
+  {
+    gzwarn << "Unable to write simplified mesh cache file[" << filename
+           << "]\n";
+  }
+}
+
+/////////////////////////////////////////////////
+Collapse MeshSimplifierPrivate::Candidate(const unsigned int _a,
+    const unsigned int _b) const
+{
+  Quadric quadric = this->quadrics[_a];
+  quadric.Add(this->quadrics[_b]);
+
+  // The minimum of the quadric, unless it's not unique, in which case
+  // the best of the end points and the middle of the edge.
+  Collapse collapse;
+  collapse.a = _a;
+  collapse.b = _b;
+  collapse.versionA = this->versions[_a];
+  collapse.versionB = this->versions[_b];
+
+  const ignition::math::Vector3d &pa = this->positions[_a];
+  const ignition::math::Vector3d &pb = this->positions[_b];
+  const ignition::math::Vector3d candidates[3] = {pa, pb, (pa + pb) * 0.5};
+
+  collapse.error = -1;
+  if (quadric.Minimum(collapse.position))
+  {
+    collapse.error = quadric.Error(collapse.position);
+
+    // Reject minima far from the edge, caused by nearly singular quadrics
+    const double length = pa.Distance(pb);
+    if (collapse.position.Distance(candidates[2]) > 2 * length)
+      collapse.error = -1;
+  }
+
+  for (auto const &p : candidates)
+  {
+    const double error = quadric.Error(p);
+    if (collapse.error < 0 || error < collapse.error)
+    {
+      collapse.error = error;
+      collapse.position = p;
+    }
+  }
+
+  return collapse;
+}
+
+/////////////////////////////////////////////////
+bool MeshSimplifierPrivate::Valid(const Collapse &_collapse) const
+{
+  // The vertices of the edge must share at most two neighbors, the other
+  // vertices of the triangles of the edge, for the mesh to stay manifold.
+  std::unordered_set<unsigned int> neighborsA;
+  for (auto const t : this->vertexTriangles[_collapse.a])
+  {
+    if (!this->removedTriangles[t])
+      neighborsA.insert(this->triangles[t].begin(), this->triangles[t].end());
+  }
+
+  std::unordered_set<unsigned int> shared;
+  for (auto const t : this->vertexTriangles[_collapse.b])
+  {
+    if (this->removedTriangles[t])
+      continue;
+
+    for (auto const v : this->triangles[t])
+    {
+      if (v != _collapse.a && v != _collapse.b && neighborsA.count(v))
+        shared.insert(v);
+    }
+  }
+
+  if (shared.size() > 2)
+    return false;
+
+  // The triangles that are kept must not flip
+  for (auto const v : {_collapse.a, _collapse.b})
+  {
+    for (auto const t : this->vertexTriangles[v])
+    {
+      const std::array<unsigned int, 3> &tri = this->triangles[t];
+      if (this->removedTriangles[t] ||
+          (std::find(tri.begin(), tri.end(), _collapse.a) != tri.end() &&
+           std::find(tri.begin(), tri.end(), _collapse.b) != tri.end()))
+      {
+        continue;
+      }
+
+      ignition::math::Vector3d before[3], after[3];
+      for (unsigned int i = 0; i < 3; ++i)
+      {
+        before[i] = this->positions[tri[i]];
+        after[i] = tri[i] == v ? _collapse.position : before[i];
+      }
+
+      const ignition::math::Vector3d n0 =
+        (before[1] - before[0]).Cross(before[2] - before[0]);
+      const ignition::math::Vector3d n1 =
+        (after[1] - after[0]).Cross(after[2] - after[0]);
+      if (n0.Dot(n1) <= 0)
+        return false;
+    }
+  }
+
+  return true;
+}
+
+/////////////////////////////////////////////////
+uint64_t MeshSimplifierPrivate::Key(
+    const std::vector<ignition::math::Vector3d> &_vertices,
+    const std::vector<unsigned int> &_indices) const
+{
+  uint64_t hash = fnv1a(14695981039346656037ULL, &kVersion,
+      sizeof(kVersion));
+  hash = fnv1a(hash, &this->targetTriangles, sizeof(this->targetTriangles));
+  hash = fnv1a(hash, &this->maxError, sizeof(this->maxError));
+  for (auto const &v : _vertices)
+  {
+    const double xyz[3] = {v.X(), v.Y(), v.Z()};
+    hash = fnv1a(hash, xyz, sizeof(xyz));
+  }
+  if (!_indices.empty())
+  {
+    hash = fnv1a(hash, _indices.data(),
+        _indices.size() * sizeof(_indices[0]));
+  }
+  return hash;
+}
+
+/////////////////////////////////////////////////
+bool MeshSimplifierPrivate::Load(const std::string &_filename,
+    const uint64_t _key, std::vector<ignition::math::Vector3d> &_vertices,
+    std::vector<unsigned int> &_indices)
+{
+  std::ifstream file(_filename, std::ios::binary);
+  if (!file)
+    return false;
+
+  const std::string data((std::istreambuf_iterator<char>(file)),
+      std::istreambuf_iterator<char>());
+
+  const size_t headerSize = sizeof(kMagic) + sizeof(uint32_t) +
+    sizeof(uint64_t) + 2 * sizeof(uint32_t);
+
+  uint32_t version = 0, vertexCount = 0, indexCount = 0;
+  uint64_t key = 0;
+  if (data.size() >= headerSize)
+  {
+    const char *ptr = data.data() + sizeof(kMagic);
+    std::memcpy(&version, ptr, sizeof(version));
+    std::memcpy(&key, ptr + 4, sizeof(key));
+    std::memcpy(&vertexCount, ptr + 12, sizeof(vertexCount));
+    std::memcpy(&indexCount, ptr + 16, sizeof(indexCount));
+  }
+
+  if (data.size() < headerSize ||
+      std::memcmp(data.data(), kMagic, sizeof(kMagic)) != 0 ||
+      version != kVersion || key != _key || indexCount % 3 != 0 ||
+      data.size() != headerSize + vertexCount * 3 * sizeof(double) +
+      indexCount * sizeof(uint32_t))
+  {
+    gzwarn << "Ignoring invalid simplified mesh cache file[" << _filename
+           << "]\n";
+    return false;
+  }
+
+  const char *ptr = data.data() + headerSize;
+  std::vector<ignition::math::Vector3d> vertices(vertexCount);
+  for (auto &v : vertices)
+  {
+    double xyz[3];
+    std::memcpy(xyz, ptr, sizeof(xyz));
+    ptr += sizeof(xyz);
+    v.Set(xyz[0], xyz[1], xyz[2]);
+  }
+
+  std::vector<unsigned int> indices(indexCount);
+  for (auto &i : indices)
+  {
+    uint32_t index;
+    std::memcpy(&index, ptr, sizeof(index));
+    ptr += sizeof(index);
+    if (index >= vertexCount)
+    {
+      gzwarn << "Ignoring invalid simplified mesh cache file[" << _filename
+             << "]\n";
+      return false;
+    }
+    i = index;
+  }
+
+  _vertices = std::move(vertices);
+  _indices = std::move(indices);
+  return true;
+}
+
+/////////////////////////////////////////////////
+bool MeshSimplifierPrivate::Save(const std::string &_filename,
+    const uint64_t _key,
+    const std::vector<ignition::math::Vector3d> &_vertices,
+    const std::vector<unsigned int> &_indices)
+{
+  std::string data;
+  data.append(kMagic, sizeof(kMagic));
+  append(data, kVersion);
+  append(data, _key);
+  append(data, static_cast<uint32_t>(_vertices.size()));
+  append(data, static_cast<uint32_t>(_indices.size()));
+  for (auto const &v : _vertices)
+  {
+    append(data, v.X());
+    append(data, v.Y());
+    append(data, v.Z());
+  }
+  for (auto const i : _indices)
+    append(data, static_cast<uint32_t>(i));
+
+  try
+  {
+    const boost::filesystem::path filename(_filename);
+    boost::filesystem::create_directories(filename.parent_path());
+
+    // Write to a unique temporary file, then rename it, so that readers
+    // never see a partial file.
+    boost::filesystem::path tmpFilename = _filename +
+      boost::filesystem::unique_path(".%%%%-%%%%-%%%%.tmp").string();
+    {
+      std::ofstream file(tmpFilename.string(), std::ios::binary);
+      file.write(data.data(), data.size());
+      if (!file)
+      {
+        file.close();
+        boost::filesystem::remove(tmpFilename);
+        return false;
+      }
+    }
+    boost::filesystem::rename(tmpFilename, filename);
+  }
+  catch(boost::filesystem::filesystem_error &)
+  {
+    return false;
+  }
+
+  return true;
+}
@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GAZEBO_COMMON_MESHSIMPLIFIER_HH_
+#define GAZEBO_COMMON_MESHSIMPLIFIER_HH_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ignition/math/Vector3.hh>
+
+#include "gazebo/util/system.hh"
+
+namespace gazebo
+{
+  namespace common
+  {
+    // Forward declare private data class
+    class MeshSimplifierPrivate;
+
+    /// \addtogroup gazebo_common Common
+    /// \{
+
+    /// \class MeshSimplifier MeshSimplifier.hh common/common.hh
+    /// \brief Reduce the number of triangles of a mesh.
+    ///
+    /// Edges are collapsed in order of increasing quadric error, the sum of
+    /// the squared distances from the new vertex to the planes of the
+    /// original triangles around it, until the target number of triangles
+    /// is reached or the next collapse would exceed the maximum error.
+    /// Vertices at the same position are merged first, and collapses that
+    /// would flip a triangle or detach the boundary of an open mesh are
+    /// skipped.
+    class GZ_COMMON_VISIBLE MeshSimplifier
+    {
+      /// \brief Constructor.
+      public: MeshSimplifier();
+
+      /// \brief Destructor.
+      public: virtual ~MeshSimplifier();
+
+      /// \brief Set the number of triangles at which to stop.
+      /// \param[in] _count Number of triangles, 0 for no target.
+      public: void SetTargetTriangles(const unsigned int _count);
+
+      /// \brief Get the number of triangles at which to stop.
+      /// \return Number of triangles. Defaults to 0, no target.
+      public: unsigned int TargetTriangles() const;
+
+      /// \brief Set the largest error allowed for a collapse.
+      /// \param[in] _error Square root of the quadric error, in the units
+      /// of the mesh. A negative value removes the bound.
+      public: void SetMaxError(const double _error);
+
+      /// \brief Get the largest error allowed for a collapse.
+      /// \return The error, negative if unbounded, the default.
+      public: double MaxError() const;
+
+      /// \brief Simplify a triangle mesh. The mesh is returned unchanged if
+      /// there is neither a target nor a maximum error.
+      /// \param[in] _vertices Vertices of the mesh.
+      /// \param[in] _indices Vertex indices of the triangles.
+      /// \param[out] _outVertices Vertices of the simplified mesh.
+      /// \param[out] _outIndices Vertex indices of its triangles.
+      public: void Simplify(
+                  const std::vector<ignition::math::Vector3d> &_vertices,
+                  const std::vector<unsigned int> &_indices,
+                  std::vector<ignition::math::Vector3d> &_outVertices,
+                  std::vector<unsigned int> &_outIndices) const;
+
+      /// \brief Simplify a triangle mesh, reusing the result stored in a
+      /// cache directory by a previous call with the same mesh and
+      /// parameters.
+      /// \param[in] _vertices Vertices of the mesh.
+      /// \param[in] _indices Vertex indices of the triangles.
+      /// \param[out] _outVertices Vertices of the simplified mesh.
+      /// \param[out] _outIndices Vertex indices of its triangles.
+      /// \param[in] _cachePath Path to the cache directory, or an empty
+      /// string to disable the cache.
+      public: void Simplify(
+                  const std::vector<ignition::math::Vector3d> &_vertices,
+                  const std::vector<unsigned int> &_indices,
+                  std::vector<ignition::math::Vector3d> &_outVertices,
+                  std::vector<unsigned int> &_outIndices,
+                  const std::string &_cachePath) const;
+
+      /// \internal
+      /// \brief Private data pointer.
+      private: std::unique_ptr<MeshSimplifierPrivate> dataPtr;
+    };
+    /// \}
+  }
+}
+#endif
@@ -0,0 +1,274 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <cmath>
+#include <fstream>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include <gtest/gtest.h>
+
+#include "gazebo/common/MeshSimplifier.hh"
+#include "test/util.hh"
+
+using namespace gazebo;
+
+class MeshSimplifierTest : public gazebo::testing::AutoLogFixture
+{
+  /// \brief Create an empty directory for the cache files.
+  public: virtual void SetUp()
+  {
+    gazebo::testing::AutoLogFixture::SetUp();
+    this->cachePath = boost::filesystem::temp_directory_path() /
+      boost::filesystem::unique_path("gazebo_simplify_%%%%-%%%%");
+    boost::filesystem::create_directories(this->cachePath);
+  }
+
+  /// \brief Remove the cache directory.
+  public: virtual void TearDown()
+  {
+    boost::filesystem::remove_all(this->cachePath);
+    gazebo::testing::AutoLogFixture::TearDown();
+  }
+
+  /// \brief Directory of the cache files.
+  public: boost::filesystem::path cachePath;
+};
+
+/////////////////////////////////////////////////
+/// \brief Create a flat square grid of triangles in the XY plane.
+void grid(const unsigned int _size,
+    std::vector<ignition::math::Vector3d> &_vertices,
+    std::vector<unsigned int> &_indices)
+{
+  for (unsigned int y = 0; y <= _size; ++y)
+  {
+    for (unsigned int x = 0; x <= _size; ++x)
+      _vertices.push_back(ignition::math::Vector3d(x, y, 0));
+  }
+
+  for (unsigned int y = 0; y < _size; ++y)
+  {
+    for (unsigned int x = 0; x < _size; ++x)
+    {
+      const unsigned int i = y * (_size + 1) + x;
+      for (auto const j : {i, i + 1, i + _size + 2, i, i + _size + 2,
+          i + _size + 1})
+      {
+        _indices.push_back(j);
+      }
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+/// \brief Create a unit UV sphere, with split vertices at the seam.
+void sphere(const unsigned int _rings, const unsigned int _segments,
+    std::vector<ignition::math::Vector3d> &_vertices,
+    std::vector<unsigned int> &_indices)
+{
+  for (unsigned int r = 0; r <= _rings; ++r)
+  {
+    // Exact positions at the poles and the seam, where the vertices are
+    // merged
+    const double theta = M_PI * r / _rings;
+    const double radius = r == 0 || r == _rings ? 0 : std::sin(theta);
+    for (unsigned int s = 0; s <= _segments; ++s)
+    {
+      const double phi = 2 * M_PI * (s % _segments) / _segments;
+      _vertices.push_back(ignition::math::Vector3d(
+            radius * std::cos(phi), radius * std::sin(phi),
+            std::cos(theta)));
+    }
+  }
+
+  for (unsigned int r = 0; r < _rings; ++r)
+  {
+    for (unsigned int s = 0; s < _segments; ++s)
+    {
+      const unsigned int i = r * (_segments + 1) + s;
+      const unsigned int j = i + _segments + 1;
+      if (r > 0)
+      {
+        for (auto const k : {i, j, i + 1})
+          _indices.push_back(k);
+      }
+      if (r + 1 < _rings)
+      {
+        for (auto const k : {i + 1, j, j + 1})
+          _indices.push_back(k);
+      }
+    }
+  }
+}
+
+/////////////////////////////////////////////////
+TEST_F(MeshSimplifierTest, Unchanged)
+{
+  std::vector<ignition::math::Vector3d> vertices, outVertices;
+  std::vector<unsigned int> indices, outIndices;
+  grid(4, vertices, indices);
+
+  common::MeshSimplifier simplifier;
+  EXPECT_EQ(0u, simplifier.TargetTriangles());
+  EXPECT_LT(simplifier.MaxError(), 0.0);
+
+  simplifier.Simplify(vertices, indices, outVertices, outIndices);
+  EXPECT_EQ(vertices, outVertices);
+  EXPECT_EQ(indices, outIndices);
+
+  // A target above the number of triangles only merges the vertices
+  simplifier.SetTargetTriangles(1000);
+  EXPECT_EQ(1000u, simplifier.TargetTriangles());
+  simplifier.Simplify(vertices, indices, outVertices, outIndices);
+  EXPECT_EQ(vertices.size(), outVertices.size());
+  EXPECT_EQ(indices.size(), outIndices.size());
+}
+
+/////////////////////////////////////////////////
+TEST_F(MeshSimplifierTest, Flat)
+{
+  std::vector<ignition::math::Vector3d> vertices, outVertices;
+  std::vector<unsigned int> indices, outIndices;
+  grid(8, vertices, indices);
+
+  // Collapses in the plane cost nothing
+  common::MeshSimplifier simplifier;
+  simplifier.SetMaxError(1e-6);
+  EXPECT_DOUBLE_EQ(1e-6, simplifier.MaxError());
+  simplifier.Simplify(vertices, indices, outVertices, outIndices);
+
+  ASSERT_FALSE(outIndices.empty());
+  EXPECT_EQ(0u, outIndices.size() % 3);
+  EXPECT_LT(outIndices.size(), indices.size() / 4);
+
+  // The square keeps its shape and orientation
+  double area = 0;
+  for (unsigned int i = 0; i < outIndices.size(); i += 3)
+  {
+    ASSERT_LT(outIndices[i + 2], outVertices.size());
+    const ignition::math::Vector3d n =
+      (outVertices[outIndices[i + 1]] - outVertices[outIndices[i]]).Cross(
+       outVertices[outIndices[i + 2]] - outVertices[outIndices[i]]);
+    EXPECT_GT(n.Z(), 0.0);
+    area += n.Z() / 2;
+  }
+  EXPECT_NEAR(64.0, area, 1e-6);
+
+  for (auto const &v : outVertices)
+  {
+    EXPECT_NEAR(0.0, v.Z(), 1e-9);
+    EXPECT_GE(v.X(), -1e-9);
+    EXPECT_LE(v.X(), 8 + 1e-9);
+    EXPECT_GE(v.Y(), -1e-9);
+    EXPECT_LE(v.Y(), 8 + 1e-9);
+  }
+}
+
+/////////////////////////////////////////////////
+TEST_F(MeshSimplifierTest, Target)
+{
+  std::vector<ignition::math::Vector3d> vertices, outVertices;
+  std::vector<unsigned int> indices, outIndices;
+  sphere(24, 48, vertices, indices);
+  ASSERT_GT(indices.size() / 3, 2000u);
+
+  common::MeshSimplifier simplifier;
+  simplifier.SetTargetTriangles(200);
+  simplifier.Simplify(vertices, indices, outVertices, outIndices);
+
+  EXPECT_LE(outIndices.size() / 3, 200u);
+  EXPECT_GT(outIndices.size() / 3, 150u);
+
+  // The shape is kept, and every edge still has two triangles
+  for (auto const &v : outVertices)
+    EXPECT_NEAR(1.0, v.Length(), 0.1);
+
+  std::map<std::pair<unsigned int, unsigned int>, int> edges;
+  for (unsigned int i = 0; i < outIndices.size(); i += 3)
+  {
+    for (unsigned int e = 0; e < 3; ++e)
+    {
+      const unsigned int a = outIndices[i + e];
+      const unsigned int b = outIndices[i + (e + 1) % 3];
+      ++edges[std::make_pair(a, b)];
+      --edges[std::make_pair(b, a)];
+    }
+  }
+  for (auto const &edge : edges)
+    EXPECT_EQ(0, edge.second);
+
+  // A bound on the error stops earlier
+  simplifier.SetMaxError(0.001);
+  std::vector<unsigned int> boundedIndices;
+  simplifier.Simplify(vertices, indices, outVertices, boundedIndices);
+  EXPECT_GT(boundedIndices.size(), outIndices.size());
+}
+
+/////////////////////////////////////////////////
+TEST_F(MeshSimplifierTest, Cache)
+{
+  std::vector<ignition::math::Vector3d> vertices, outVertices, cachedVertices;
+  std::vector<unsigned int> indices, outIndices, cachedIndices;
+  sphere(12, 24, vertices, indices);
+
+  common::MeshSimplifier simplifier;
+  simplifier.SetTargetTriangles(100);
+  simplifier.Simplify(vertices, indices, outVertices, outIndices,
+      this->cachePath.string());
+
+  std::vector<boost::filesystem::path> files;
+  for (boost::filesystem::directory_iterator it(this->cachePath);
+       it != boost::filesystem::directory_iterator(); ++it)
+  {
+    files.push_back(it->path());
+  }
+  ASSERT_EQ(1u, files.size());
+  EXPECT_EQ(".gzsimp", files[0].extension().string());
+
+  // A second simplification is loaded from the cache
+  simplifier.Simplify(vertices, indices, cachedVertices, cachedIndices,
+      this->cachePath.string());
+  EXPECT_EQ(outVertices, cachedVertices);
+  EXPECT_EQ(outIndices, cachedIndices);
+
+  // Other parameters don't use the cached simplification
+  simplifier.SetTargetTriangles(50);
+  simplifier.Simplify(vertices, indices, cachedVertices, cachedIndices,
+      this->cachePath.string());
+  EXPECT_LE(cachedIndices.size() / 3, 50u);
+
+  // Invalid cache files are ignored
+  {
+    std::ofstream file(files[0].string(), std::ios::binary | std::ios::trunc);
+    file << "GZSM";
+  }
+  simplifier.SetTargetTriangles(100);
+  simplifier.Simplify(vertices, indices, cachedVertices, cachedIndices,
+      this->cachePath.string());
+  EXPECT_EQ(outIndices, cachedIndices);
+}
+
+/////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
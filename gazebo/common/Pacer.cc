@@ -0,0 +1,344 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <mutex>
+#include <thread>
+
+#include "gazebo/common/Console.hh"
+#include "gazebo/common/Pacer.hh"
+
+/// \brief Number of buckets of the latency histogram.
+static const unsigned int kLatencyBuckets = 16;
+
+namespace gazebo
+{
+  namespace common
+  {
+    /// \internal
+    /// \brief Private data for the Pacer class
+    class PacerPrivate
+    {
+      /// \brief Period in nanoseconds.
+      public: int64_t period = 0;
+
+      /// \brief Spin time in nanoseconds.
+      public: int64_t spinTime = 50000;
+
+      /// \brief Catch up policy.
+      public: Pacer::CatchUp catchUp = Pacer::CATCH_UP_NONE;
+
+      /// \brief Number of missed steps run with CATCH_UP_BOUNDED.
+      public: unsigned int maxCatchUpSteps = 10;
+
+      /// \brief CPUs of the pacing thread.
+      public: std::vector<unsigned int> cpus;
+
+      /// \brief True if the affinity must be applied by the next Wait.
+      public: bool applyAffinity = false;
+
+      /// \brief Deadline of the next step, in nanoseconds. Negative if the
+      /// schedule must restart.
+      public: int64_t next = -1;
+
+      /// \brief Start of the previous step, in nanoseconds. Negative if
+      /// there was none since the schedule restarted.
+      public: int64_t prevStart = -1;
+
+      /// \brief Accumulated statistics, with means stored as sums.
+      public: PacerStatistics stats;
+
+      /// \brief Number of jitter samples.
+      public: uint64_t jitterCount = 0;
+
+      /// \brief Protects all of the above. Not held while waiting.
+      public: mutable std::mutex mutex;
+    };
+  }
+}
+
+using namespace gazebo;
+using namespace common;
+
+/////////////////////////////////////////////////
+/// \brief Get the time of the monotonic clock.
+/// \return Time in nanoseconds.
+static int64_t monotonicNow()
+{
+#ifdef __linux__
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+#else
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+/////////////////////////////////////////////////
+/// \brief Sleep until an absolute time of the monotonic clock.
+/// \param[in] _time Time in nanoseconds.
+static void sleepUntil(const int64_t _time)
+{
+#ifdef __linux__
+  struct timespec ts;
+  ts.tv_sec = _time / 1000000000LL;
+  ts.tv_nsec = _time % 1000000000LL;
+  while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) ==
+      EINTR)
+  {
+  }
+#else
+  std::this_thread::sleep_until(std::chrono::steady_clock::time_point(
+      std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+      std::chrono::nanoseconds(_time))));
+#endif
+}
+
+/////////////////////////////////////////////////
+/// \brief Restrict the calling thread to a set of CPUs.
+/// \param[in] _cpus Indices of the CPUs.
+static void setAffinity(const std::vector<unsigned int> &_cpus)
+{
+#ifdef __linux__
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (auto const cpu : _cpus)
+  {
+    if (cpu >= CPU_SETSIZE)
+    {
+      gzerr << "Invalid CPU index [" << cpu << "]\n";
+      return;
+    }
+    CPU_SET(cpu, &set);
+  }
+
+  int result = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+  if (result != 0)
+    gzerr << "Unable to set the CPU affinity, error [" << result << "]\n";
+#else
+  gzwarn << "CPU affinity is only supported on Linux, ignoring it\n";
+#endif
+}
+
+/////////////////////////////////////////////////
+double PacerStatistics::LatencyBound(const unsigned int _bucket)
+{
+  if (_bucket + 1 >= kLatencyBuckets)
+    return std::numeric_limits<double>::infinity();
+  return std::ldexp(1e-6, static_cast<int>(_bucket));
+}
+
+/////////////////////////////////////////////////
+Pacer::Pacer()
+  : dataPtr(new PacerPrivate)
+{
+  this->dataPtr->stats.latencyHistogram.resize(kLatencyBuckets, 0);
+}
+
+/////////////////////////////////////////////////
+Pacer::~Pacer()
+{
+}
+
+/////////////////////////////////////////////////
+void Pacer::SetPeriod(const double _period)
+{
+  const int64_t period = _period > 0 ? std::llround(_period * 1e9) : 0;
+
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  if (period == this->dataPtr->period)
+    return;
+
+  this->dataPtr->period = period;
+  this->dataPtr->next = -1;
+  this->dataPtr->prevStart = -1;
+}
+
+/////////////////////////////////////////////////
+double Pacer::Period() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->period * 1e-9;
+}
+
+/////////////////////////////////////////////////
+void Pacer::SetSpinTime(const double _time)
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->spinTime = std::max<int64_t>(0, std::llround(_time * 1e9));
+}
+
+/////////////////////////////////////////////////
+double Pacer::SpinTime() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->spinTime * 1e-9;
+}
+
+/////////////////////////////////////////////////
+void Pacer::SetCatchUpPolicy(const CatchUp _policy)
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->catchUp = _policy;
+}
+
+/////////////////////////////////////////////////
+Pacer::CatchUp Pacer::CatchUpPolicy() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->catchUp;
+}
+
+/////////////////////////////////////////////////
+void Pacer::SetMaxCatchUpSteps(const unsigned int _steps)
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->maxCatchUpSteps = _steps;
+}
+
+/////////////////////////////////////////////////
+unsigned int Pacer::MaxCatchUpSteps() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->maxCatchUpSteps;
+}
+
+/////////////////////////////////////////////////
+void Pacer::SetCpuAffinity(const std::vector<unsigned int> &_cpus)
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->cpus = _cpus;
+  this->dataPtr->applyAffinity = !_cpus.empty();
+}
+
+/////////////////////////////////////////////////
+std::vector<unsigned int> Pacer::CpuAffinity() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->cpus;
+}
+
+/////////////////////////////////////////////////
+void Pacer::Reset()
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->next = -1;
+  this->dataPtr->prevStart = -1;
+}
+
+/////////////////////////////////////////////////
+void Pacer::Wait()
+{
+  std::unique_lock<std::mutex> lock(this->dataPtr->mutex);
+
+  if (this->dataPtr->applyAffinity)
+  {
+    setAffinity(this->dataPtr->cpus);
+    this->dataPtr->applyAffinity = false;
+  }
+
+  const int64_t period = this->dataPtr->period;
+  const int64_t spinTime = this->dataPtr->spinTime;
+  int64_t now = monotonicNow();
+
+  if (this->dataPtr->next < 0 || period == 0)
+    this->dataPtr->next = now;
+
+  // Drop the missed steps the policy doesn't catch up with, by moving the
+  // schedule forward.
+  const int64_t scheduled = this->dataPtr->next;
+  int64_t deadline = scheduled;
+  int64_t maxLag = 0;
+  if (this->dataPtr->catchUp == CATCH_UP_BOUNDED)
+    maxLag = period * this->dataPtr->maxCatchUpSteps;
+  else if (this->dataPtr->catchUp == CATCH_UP_FULL)
+    maxLag = std::numeric_limits<int64_t>::max();
+  if (now - deadline > maxLag)
+    deadline = now - maxLag;
+  this->dataPtr->next = deadline + period;
+
+  lock.unlock();
+
+  // Sleep until shortly before the deadline, then spin
+  if (now < deadline - spinTime)
+    sleepUntil(deadline - spinTime);
+  while ((now = monotonicNow()) < deadline)
+  {
+  }
+
+  lock.lock();
+
+  PacerStatistics &stats = this->dataPtr->stats;
+  const int64_t latency = now - scheduled;
+  stats.steps++;
+  if (period > 0 && latency > period)
+    stats.lateSteps++;
+  stats.meanLatency += latency * 1e-9;
+  stats.maxLatency = std::max(stats.maxLatency, latency * 1e-9);
+
+  unsigned int bucket = 0;
+  while (bucket + 1 < kLatencyBuckets &&
+      latency * 1e-9 >= PacerStatistics::LatencyBound(bucket))
+  {
+    ++bucket;
+  }
+  stats.latencyHistogram[bucket]++;
+
+  if (this->dataPtr->prevStart >= 0 && period > 0)
+  {
+    const double jitter =
+        std::abs(now - this->dataPtr->prevStart - period) * 1e-9;
+    stats.meanJitter += jitter;
+    stats.maxJitter = std::max(stats.maxJitter, jitter);
+    this->dataPtr->jitterCount++;
+  }
+  this->dataPtr->prevStart = now;
+}
+
+/////////////////////////////////////////////////
+PacerStatistics Pacer::Statistics() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+
+  PacerStatistics stats = this->dataPtr->stats;
+  if (stats.steps > 0)
+    stats.meanLatency /= stats.steps;
+  if (this->dataPtr->jitterCount > 0)
+    stats.meanJitter /= this->dataPtr->jitterCount;
+  return stats;
+}
+
+/////////////////////////////////////////////////
+void Pacer::ResetStatistics()
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->stats = PacerStatistics();
+  this->dataPtr->stats.latencyHistogram.resize(kLatencyBuckets, 0);
+  this->dataPtr->jitterCount = 0;
+}
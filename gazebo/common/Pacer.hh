@@ -0,0 +1,172 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GAZEBO_COMMON_PACER_HH_
+#define GAZEBO_COMMON_PACER_HH_
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "gazebo/util/system.hh"
+
+namespace gazebo
+{
+  namespace common
+  {
+    // Forward declare private data class.
+    class PacerPrivate;
+
+    /// \addtogroup gazebo_common
+    /// \{
+
+    /// \class PacerStatistics Pacer.hh common/common.hh
+    /// \brief Timing statistics of the steps paced by a Pacer. The latency
+    /// of a step is the delay between its deadline and the moment it
+    /// started. The jitter is the deviation of the interval between two
+    /// consecutive steps from the period. All times are in seconds.
+    class GZ_COMMON_VISIBLE PacerStatistics
+    {
+      /// \brief Get the upper bound of a latency histogram bucket. Bucket i
+      /// holds latencies below 2^i microseconds, the last one is unbounded.
+      /// \param[in] _bucket Index of the bucket.
+      /// \return Upper bound in seconds, infinity for the last bucket.
+      public: static double LatencyBound(const unsigned int _bucket);
+
+      /// \brief Number of steps.
+      public: uint64_t steps = 0;
+
+      /// \brief Steps that started more than a period after their deadline.
+      public: uint64_t lateSteps = 0;
+
+      /// \brief Mean latency.
+      public: double meanLatency = 0;
+
+      /// \brief Maximum latency.
+      public: double maxLatency = 0;
+
+      /// \brief Mean jitter.
+      public: double meanJitter = 0;
+
+      /// \brief Maximum jitter.
+      public: double maxJitter = 0;
+
+      /// \brief Number of steps in each latency bucket.
+      /// \sa LatencyBound
+      public: std::vector<uint64_t> latencyHistogram;
+    };
+
+    /// \class Pacer Pacer.hh common/common.hh
+    /// \brief Paces a loop at a fixed period. Each step waits for an
+    /// absolute deadline, so that errors don't accumulate from one step to
+    /// the next: the thread sleeps until shortly before the deadline, then
+    /// spins until it is reached. The latency and jitter of the steps are
+    /// recorded in a PacerStatistics.
+    class GZ_COMMON_VISIBLE Pacer
+    {
+      /// \brief What to do with the steps missed when the loop falls
+      /// behind its schedule.
+      public: enum CatchUp
+      {
+        /// \brief Drop the missed steps, the schedule restarts from the
+        /// late step.
+        CATCH_UP_NONE,
+
+        /// \brief Run the missed steps back to back, up to
+        /// MaxCatchUpSteps. Steps beyond that are dropped.
+        CATCH_UP_BOUNDED,
+
+        /// \brief Run all of the missed steps back to back.
+        CATCH_UP_FULL
+      };
+
+      /// \brief Constructor.
+      public: Pacer();
+
+      /// \brief Destructor.
+      public: ~Pacer();
+
+      /// \brief Set the period of the steps. Changing the period restarts
+      /// the schedule.
+      /// \param[in] _period Period in seconds, 0 to not wait at all.
+      public: void SetPeriod(const double _period);
+
+      /// \brief Get the period of the steps.
+      /// \return Period in seconds.
+      public: double Period() const;
+
+      /// \brief Set how long to spin before each deadline, instead of
+      /// sleeping. A longer spin time lowers the latency, but wastes CPU.
+      /// The default of 50 microseconds covers the usual wake up latency
+      /// of a Linux thread sleeping on clock_nanosleep, while keeping the
+      /// CPU time spent spinning below 5% at a 1 kHz update rate.
+      /// \param[in] _time Spin time in seconds, 0 to only sleep.
+      public: void SetSpinTime(const double _time);
+
+      /// \brief Get the spin time.
+      /// \return Spin time in seconds.
+      public: double SpinTime() const;
+
+      /// \brief Set the catch up policy. Defaults to CATCH_UP_NONE.
+      /// \param[in] _policy The policy.
+      public: void SetCatchUpPolicy(const CatchUp _policy);
+
+      /// \brief Get the catch up policy.
+      /// \return The policy.
+      public: CatchUp CatchUpPolicy() const;
+
+      /// \brief Set the number of missed steps run with CATCH_UP_BOUNDED.
+      /// \param[in] _steps Number of steps.
+      public: void SetMaxCatchUpSteps(const unsigned int _steps);
+
+      /// \brief Get the number of missed steps run with CATCH_UP_BOUNDED.
+      /// \return Number of steps.
+      public: unsigned int MaxCatchUpSteps() const;
+
+      /// \brief Set the CPUs the pacing thread may run on. Applied by the
+      /// next call to Wait, to the thread that calls it. Only supported on
+      /// Linux.
+      /// \param[in] _cpus Indices of the CPUs. Empty to leave the affinity
+      /// unchanged.
+      public: void SetCpuAffinity(const std::vector<unsigned int> &_cpus);
+
+      /// \brief Get the CPUs the pacing thread may run on.
+      /// \return Indices of the CPUs, empty if not set.
+      public: std::vector<unsigned int> CpuAffinity() const;
+
+      /// \brief Restart the schedule. The next call to Wait returns
+      /// immediately, and the following steps are paced from it.
+      public: void Reset();
+
+      /// \brief Wait for the deadline of the next step.
+      public: void Wait();
+
+      /// \brief Get the statistics accumulated since the last call to
+      /// ResetStatistics.
+      /// \return The statistics.
+      public: PacerStatistics Statistics() const;
+
+      /// \brief Reset the statistics.
+      public: void ResetStatistics();
+
+      /// \internal
+      /// \brief Private data pointer.
+      private: std::unique_ptr<PacerPrivate> dataPtr;
+    };
+    /// \}
+  }
+}
+#endif
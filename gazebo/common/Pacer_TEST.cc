@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+#include <cmath>
+
+#include "gazebo/common/Pacer.hh"
+#include "gazebo/common/Timer.hh"
+#include "test/util.hh"
+
+using namespace gazebo;
+
+class PacerTest : public gazebo::testing::AutoLogFixture
+{
+};
+
+/////////////////////////////////////////////////
+TEST_F(PacerTest, Period)
+{
+  common::Pacer pacer;
+  EXPECT_DOUBLE_EQ(0.0, pacer.Period());
+  EXPECT_EQ(common::Pacer::CATCH_UP_NONE, pacer.CatchUpPolicy());
+
+  // Without a period, steps don't wait
+  common::Timer timer;
+  timer.Start();
+  for (int i = 0; i < 100; ++i)
+    pacer.Wait();
+  EXPECT_LT(timer.GetElapsed().Double(), 0.01);
+
+  // The first step starts immediately, the following ones are paced
+  pacer.SetPeriod(0.01);
+  EXPECT_DOUBLE_EQ(0.01, pacer.Period());
+  pacer.ResetStatistics();
+  timer.Reset();
+  timer.Start();
+  for (int i = 0; i < 21; ++i)
+    pacer.Wait();
+  EXPECT_GE(timer.GetElapsed().Double(), 0.2);
+  EXPECT_LT(timer.GetElapsed().Double(), 0.25);
+
+  common::PacerStatistics stats = pacer.Statistics();
+  EXPECT_EQ(21u, stats.steps);
+  EXPECT_GE(stats.maxLatency, stats.meanLatency);
+  EXPECT_GE(stats.maxJitter, stats.meanJitter);
+
+  uint64_t total = 0;
+  for (auto const count : stats.latencyHistogram)
+    total += count;
+  EXPECT_EQ(stats.steps, total);
+
+  pacer.ResetStatistics();
+  EXPECT_EQ(0u, pacer.Statistics().steps);
+}
+
+/////////////////////////////////////////////////
+TEST_F(PacerTest, LatencyBound)
+{
+  EXPECT_DOUBLE_EQ(1e-6, common::PacerStatistics::LatencyBound(0));
+  EXPECT_DOUBLE_EQ(1.6e-5, common::PacerStatistics::LatencyBound(4));
+  EXPECT_TRUE(std::isinf(common::PacerStatistics::LatencyBound(15)));
+}
+
+/////////////////////////////////////////////////
+TEST_F(PacerTest, CatchUp)
+{
+  common::Pacer pacer;
+  pacer.SetPeriod(0.01);
+  common::Timer timer;
+
+  // Missed steps are dropped
+  pacer.Wait();
+  common::Time::MSleep(55);
+  pacer.ResetStatistics();
+  timer.Start();
+  pacer.Wait();
+  pacer.Wait();
+  EXPECT_GE(timer.GetElapsed().Double(), 0.01);
+  EXPECT_EQ(1u, pacer.Statistics().lateSteps);
+
+  // Missed steps run back to back
+  pacer.SetCatchUpPolicy(common::Pacer::CATCH_UP_FULL);
+  pacer.Reset();
+  pacer.Wait();
+  common::Time::MSleep(55);
+  timer.Reset();
+  timer.Start();
+  for (int i = 0; i < 5; ++i)
+    pacer.Wait();
+  EXPECT_LT(timer.GetElapsed().Double(), 0.01);
+
+  // At most two missed steps run back to back
+  pacer.SetCatchUpPolicy(common::Pacer::CATCH_UP_BOUNDED);
+  pacer.SetMaxCatchUpSteps(2);
+  pacer.Reset();
+  pacer.Wait();
+  common::Time::MSleep(55);
+  timer.Reset();
+  timer.Start();
+  pacer.Wait();
+  pacer.Wait();
+  pacer.Wait();
+  EXPECT_LT(timer.GetElapsed().Double(), 0.005);
+  pacer.Wait();
+  EXPECT_GE(timer.GetElapsed().Double(), 0.01);
+}
+
+/////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -74,6 +74,10 @@ void help()
   << "                                the world file.\n"
   << "  --lockstep                    Lockstep simulation so sensor update "
   <<                                  "rates are respected.\n"
+  << "  --lockstep_pipelined          Lockstep simulation, with physics "
+  <<                                  "computing the next\n"
+  << "                                step while the sensors process the "
+  <<                                  "current one.\n"
   << "\n";
 }
 
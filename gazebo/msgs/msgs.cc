@@ -244,13 +244,14 @@ namespace gazebo
       _msg->set_pixel_format(_i.GetPixelFormat());
       _msg->set_step(_i.GetPitch());
 
-      unsigned char *data = NULL;
-      unsigned int size;
-      _i.GetData(&data, size);
-      _msg->set_data(data, size);
-      if (data)
-      {
-        delete[] data;
+      // Fill the message buffer directly, rather than copying through a
+      // temporary buffer.
+      std::string *data = _msg->mutable_data();
+      data->resize(_i.GetPitch() * _i.GetHeight());
+      if (data->empty() || !_i.GetData(
+            reinterpret_cast<unsigned char *>(&(*data)[0]), data->size()))
+      {
+        data->clear();
       }
     }
 
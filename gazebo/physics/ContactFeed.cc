@@ -0,0 +1,236 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+
+#include "gazebo/common/Assert.hh"
+#include "gazebo/physics/Collision.hh"
+#include "gazebo/physics/Contact.hh"
+#include "gazebo/physics/ContactFeed.hh"
+#include "gazebo/physics/World.hh"
+
+/// \brief Flag of ContactFeedPrivate::middle set when the middle buffer
+/// holds contacts the reader hasn't taken yet.
+static const unsigned int kFresh = 4;
+
+namespace gazebo
+{
+  namespace physics
+  {
+    /// \internal
+    /// \brief Contacts of a number of steps.
+    class ContactFeedBuffer
+    {
+      /// \brief Records, only the first count ones are valid. The others
+      /// are kept for their storage.
+      public: std::vector<ContactRecord> records;
+
+      /// \brief Number of valid records.
+      public: unsigned int count = 0;
+
+      /// \brief Number of records of each step, oldest first.
+      public: std::vector<unsigned int> steps;
+    };
+
+    /// \internal
+    /// \brief Private data for the ContactFeed class
+    class ContactFeedPrivate
+    {
+      /// \brief Number of steps kept while the reader doesn't read.
+      public: unsigned int maxSteps;
+
+      /// \brief The three buffers.
+      public: ContactFeedBuffer buffers[3];
+
+      /// \brief Buffer filled by the writer.
+      public: unsigned int back = 0;
+
+      /// \brief Index of the exchanged buffer, with kFresh set if the
+      /// writer handed it over and the reader didn't take it.
+      public: std::atomic<unsigned int> middle{1};
+
+      /// \brief Buffer read by the reader.
+      public: unsigned int front = 2;
+
+      /// \brief First record of the current step in the back buffer.
+      public: unsigned int stepStart = 0;
+
+      /// \brief Function telling if the reader is active.
+      public: std::function<bool ()> readerActive;
+
+      /// \brief Protects readerActive, so that the reader can clear it
+      /// before it is destroyed.
+      public: mutable std::mutex readerActiveMutex;
+    };
+  }
+}
+
+using namespace gazebo;
+using namespace physics;
+
+/////////////////////////////////////////////////
+void ContactRecord::Set(const Contact &_contact)
+{
+  this->world = _contact.world ? _contact.world->Name() : std::string();
+  this->collision1 = _contact.collision1->GetScopedName();
+  this->collision2 = _contact.collision2->GetScopedName();
+  this->collision1Id = _contact.collision1->GetId();
+  this->collision2Id = _contact.collision2->GetId();
+  this->positions.assign(_contact.positions,
+      _contact.positions + _contact.count);
+  this->normals.assign(_contact.normals, _contact.normals + _contact.count);
+  this->depths.assign(_contact.depths, _contact.depths + _contact.count);
+  this->wrenches.assign(_contact.wrench, _contact.wrench + _contact.count);
+  this->time = _contact.time;
+}
+
+/////////////////////////////////////////////////
+void ContactRecord::FillMsg(msgs::Contact &_msg) const
+{
+  _msg.set_world(this->world);
+  _msg.set_collision1(this->collision1);
+  _msg.set_collision2(this->collision2);
+  msgs::Set(_msg.mutable_time(), this->time);
+
+  for (size_t j = 0; j < this->positions.size(); ++j)
+  {
+    _msg.add_depth(this->depths[j]);
+
+    msgs::Set(_msg.add_position(), this->positions[j]);
+    msgs::Set(_msg.add_normal(), this->normals[j]);
+
+    msgs::JointWrench *jntWrench = _msg.add_wrench();
+    jntWrench->set_body_1_name(this->collision1);
+    jntWrench->set_body_1_id(this->collision1Id);
+    jntWrench->set_body_2_name(this->collision2);
+    jntWrench->set_body_2_id(this->collision2Id);
+
+    msgs::Wrench *wrenchMsg =  jntWrench->mutable_body_1_wrench();
+    msgs::Set(wrenchMsg->mutable_force(), this->wrenches[j].body1Force);
+    msgs::Set(wrenchMsg->mutable_torque(), this->wrenches[j].body1Torque);
+
+    wrenchMsg =  jntWrench->mutable_body_2_wrench();
+    msgs::Set(wrenchMsg->mutable_force(), this->wrenches[j].body2Force);
+    msgs::Set(wrenchMsg->mutable_torque(), this->wrenches[j].body2Torque);
+  }
+}
+
+/////////////////////////////////////////////////
+ContactFeed::ContactFeed(const unsigned int _maxSteps)
+  : dataPtr(new ContactFeedPrivate)
+{
+  this->dataPtr->maxSteps = std::max(1u, _maxSteps);
+}
+
+/////////////////////////////////////////////////
+ContactFeed::~ContactFeed()
+{
+}
+
+/////////////////////////////////////////////////
+ContactRecord &ContactFeed::Add()
+{
+  ContactFeedBuffer &buffer = this->dataPtr->buffers[this->dataPtr->back];
+  if (buffer.count == buffer.records.size())
+    buffer.records.emplace_back();
+  return buffer.records[buffer.count++];
+}
+
+/////////////////////////////////////////////////
+void ContactFeed::EndStep()
+{
+  ContactFeedBuffer &buffer = this->dataPtr->buffers[this->dataPtr->back];
+
+  const unsigned int stepCount = buffer.count - this->dataPtr->stepStart;
+  if (stepCount > 0)
+  {
+    buffer.steps.push_back(stepCount);
+
+    // Drop the oldest step, keeping the storage of its records
+    if (buffer.steps.size() > this->dataPtr->maxSteps)
+    {
+      std::rotate(buffer.records.begin(),
+          buffer.records.begin() + buffer.steps.front(),
+          buffer.records.begin() + buffer.count);
+      buffer.count -= buffer.steps.front();
+      buffer.steps.erase(buffer.steps.begin());
+    }
+  }
+
+  // Hand the buffer over once the reader took the previous one. Until
+  // then, the reader leaves the middle buffer alone.
+  if (buffer.count > 0 && !(this->dataPtr->middle.load() & kFresh))
+  {
+    const unsigned int previous =
+      this->dataPtr->middle.exchange(this->dataPtr->back | kFresh);
+    this->dataPtr->back = previous & ~kFresh;
+
+    ContactFeedBuffer &next = this->dataPtr->buffers[this->dataPtr->back];
+    next.count = 0;
+    next.steps.clear();
+  }
+
+  this->dataPtr->stepStart =
+    this->dataPtr->buffers[this->dataPtr->back].count;
+}
+
+/////////////////////////////////////////////////
+bool ContactFeed::Read()
+{
+  // Until the reader takes it, the writer leaves the middle buffer alone
+  if (this->dataPtr->middle.load() & kFresh)
+  {
+    const unsigned int previous =
+      this->dataPtr->middle.exchange(this->dataPtr->front);
+    this->dataPtr->front = previous & ~kFresh;
+    return true;
+  }
+
+  this->dataPtr->buffers[this->dataPtr->front].count = 0;
+  return false;
+}
+
+/////////////////////////////////////////////////
+unsigned int ContactFeed::RecordCount() const
+{
+  return this->dataPtr->buffers[this->dataPtr->front].count;
+}
+
+/////////////////////////////////////////////////
+const ContactRecord &ContactFeed::Record(const unsigned int _index) const
+{
+  const ContactFeedBuffer &buffer =
+    this->dataPtr->buffers[this->dataPtr->front];
+  GZ_ASSERT(_index < buffer.count, "Invalid contact record index");
+  return buffer.records[_index];
+}
+
+/////////////////////////////////////////////////
+void ContactFeed::SetReaderActive(const std::function<bool ()> &_active)
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->readerActiveMutex);
+  this->dataPtr->readerActive = _active;
+}
+
+/////////////////////////////////////////////////
+bool ContactFeed::ReaderActive() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->readerActiveMutex);
+  return !this->dataPtr->readerActive || this->dataPtr->readerActive();
+}
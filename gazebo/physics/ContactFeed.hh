@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GAZEBO_PHYSICS_CONTACTFEED_HH_
+#define GAZEBO_PHYSICS_CONTACTFEED_HH_
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include <ignition/math/Vector3.hh>
+
+#include "gazebo/common/Time.hh"
+#include "gazebo/msgs/msgs.hh"
+#include "gazebo/physics/JointWrench.hh"
+#include "gazebo/physics/PhysicsTypes.hh"
+#include "gazebo/util/system.hh"
+
+namespace gazebo
+{
+  namespace physics
+  {
+    // Forward declare private data class.
+    class ContactFeedPrivate;
+
+    /// \addtogroup gazebo_physics
+    /// \{
+
+    /// \class ContactRecord ContactFeed.hh physics/physics.hh
+    /// \brief Copy of a Contact that doesn't refer to its collisions, so
+    /// that it can be read after they are deleted.
+    class GZ_PHYSICS_VISIBLE ContactRecord
+    {
+      /// \brief Copy a contact. The storage of the record is reused.
+      /// \param[in] _contact Contact to copy.
+      public: void Set(const Contact &_contact);
+
+      /// \brief Populate a contact message, the same way as
+      /// Contact::FillMsg.
+      /// \param[out] _msg Contact message.
+      public: void FillMsg(msgs::Contact &_msg) const;
+
+      /// \brief Name of the world.
+      public: std::string world;
+
+      /// \brief Scoped name of the first collision.
+      public: std::string collision1;
+
+      /// \brief Scoped name of the second collision.
+      public: std::string collision2;
+
+      /// \brief Id of the first collision.
+      public: uint32_t collision1Id = 0;
+
+      /// \brief Id of the second collision.
+      public: uint32_t collision2Id = 0;
+
+      /// \brief Contact positions.
+      public: std::vector<ignition::math::Vector3d> positions;
+
+      /// \brief Contact normals.
+      public: std::vector<ignition::math::Vector3d> normals;
+
+      /// \brief Contact depths.
+      public: std::vector<double> depths;
+
+      /// \brief Contact wrenches.
+      public: std::vector<JointWrench> wrenches;
+
+      /// \brief Time of the contact.
+      public: common::Time time;
+    };
+
+    /// \class ContactFeed ContactFeed.hh physics/physics.hh
+    /// \brief In-process feed of the contacts of a ContactManager filter.
+    ///
+    /// The physics thread adds the contacts of each step, and a single
+    /// reader, such as a sensor, takes all the contacts added since its
+    /// previous read. The records are exchanged through three buffers
+    /// swapped atomically, so neither side ever blocks and the buffers are
+    /// reused without allocating.
+    class GZ_PHYSICS_VISIBLE ContactFeed
+    {
+      /// \brief Constructor.
+      /// \param[in] _maxSteps Number of steps with contacts kept while the
+      /// reader doesn't read. The oldest ones are dropped.
+      public: explicit ContactFeed(const unsigned int _maxSteps = 100);
+
+      /// \brief Destructor.
+      public: ~ContactFeed();
+
+      /// \brief Add a contact to the current step. Only called by the
+      /// writer.
+      /// \return Record to fill.
+      public: ContactRecord &Add();
+
+      /// \brief End the current step, and hand its contacts over to the
+      /// reader if it took the previous ones. Only called by the writer.
+      public: void EndStep();
+
+      /// \brief Take the contacts added since the previous read, which
+      /// replace the ones taken before. Only called by the reader.
+      /// \return True if there are new contacts.
+      public: bool Read();
+
+      /// \brief Get the number of contacts taken by the last Read. Only
+      /// called by the reader.
+      /// \return Number of contacts.
+      public: unsigned int RecordCount() const;
+
+      /// \brief Get a contact taken by the last Read. Only called by the
+      /// reader.
+      /// \param[in] _index Index between 0 and RecordCount.
+      /// \return The contact.
+      public: const ContactRecord &Record(const unsigned int _index) const;
+
+      /// \brief Set the function telling if the reader is active. The
+      /// writer only adds contacts while it is, so that the steps the
+      /// reader ignored aren't read later. Only called by the reader.
+      /// \param[in] _active The function, or an empty function if the
+      /// reader is always active.
+      public: void SetReaderActive(const std::function<bool ()> &_active);
+
+      /// \brief Get if the reader is active. Only called by the writer.
+      /// \return True if the reader is active.
+      public: bool ReaderActive() const;
+
+      /// \internal
+      /// \brief Private data pointer.
+      private: std::unique_ptr<ContactFeedPrivate> dataPtr;
+    };
+    /// \}
+  }
+}
+#endif
@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+#include <functional>
+#include <string>
+
+#include "gazebo/physics/ContactFeed.hh"
+#include "test/util.hh"
+
+using namespace gazebo;
+
+class ContactFeedTest : public gazebo::testing::AutoLogFixture { };
+
+/////////////////////////////////////////////////
+/// \brief Add a contact with one point.
+/// \param[in] _feed Feed to add to.
+/// \param[in] _name Name of the first collision.
+static void addContact(physics::ContactFeed &_feed, const std::string &_name)
+{
+  physics::ContactRecord &record = _feed.Add();
+  record.world = "default";
+  record.collision1 = _name;
+  record.collision2 = "ground";
+  record.positions.assign(1, ignition::math::Vector3d(1, 2, 3));
+  record.normals.assign(1, ignition::math::Vector3d::UnitZ);
+  record.depths.assign(1, 0.01);
+  record.wrenches.assign(1, physics::JointWrench());
+}
+
+/////////////////////////////////////////////////
+TEST_F(ContactFeedTest, ReadWrite)
+{
+  physics::ContactFeed feed;
+  EXPECT_FALSE(feed.Read());
+  EXPECT_EQ(0u, feed.RecordCount());
+
+  // Steps without contacts aren't handed over
+  feed.EndStep();
+  EXPECT_FALSE(feed.Read());
+
+  addContact(feed, "a");
+  feed.EndStep();
+  EXPECT_TRUE(feed.Read());
+  ASSERT_EQ(1u, feed.RecordCount());
+  EXPECT_EQ("a", feed.Record(0).collision1);
+
+  // Contacts accumulate until the reader takes them
+  addContact(feed, "b");
+  addContact(feed, "c");
+  feed.EndStep();
+  addContact(feed, "d");
+  feed.EndStep();
+  EXPECT_TRUE(feed.Read());
+  ASSERT_EQ(2u, feed.RecordCount());
+  EXPECT_EQ("b", feed.Record(0).collision1);
+  EXPECT_EQ("c", feed.Record(1).collision1);
+
+  // The last step was kept back while the reader held the middle buffer
+  addContact(feed, "e");
+  feed.EndStep();
+  EXPECT_TRUE(feed.Read());
+  ASSERT_EQ(2u, feed.RecordCount());
+  EXPECT_EQ("d", feed.Record(0).collision1);
+  EXPECT_EQ("e", feed.Record(1).collision1);
+
+  // Nothing new
+  EXPECT_FALSE(feed.Read());
+  EXPECT_EQ(0u, feed.RecordCount());
+
+  // Message
+  msgs::Contact msg;
+  addContact(feed, "f");
+  feed.EndStep();
+  EXPECT_TRUE(feed.Read());
+  feed.Record(0).FillMsg(msg);
+  EXPECT_EQ("f", msg.collision1());
+  EXPECT_EQ("ground", msg.collision2());
+  EXPECT_EQ(1, msg.position_size());
+  EXPECT_EQ(1, msg.wrench_size());
+  EXPECT_DOUBLE_EQ(0.01, msg.depth(0));
+  EXPECT_EQ(ignition::math::Vector3d(1, 2, 3),
+      msgs::ConvertIgn(msg.position(0)));
+}
+
+/////////////////////////////////////////////////
+TEST_F(ContactFeedTest, MaxSteps)
+{
+  physics::ContactFeed feed(3);
+
+  // The first step is handed over, the others wait for the reader
+  for (int i = 0; i < 10; ++i)
+  {
+    addContact(feed, std::to_string(i));
+    feed.EndStep();
+  }
+  EXPECT_TRUE(feed.Read());
+  ASSERT_EQ(1u, feed.RecordCount());
+  EXPECT_EQ("0", feed.Record(0).collision1);
+
+  // Only the last 3 steps were kept
+  addContact(feed, "10");
+  feed.EndStep();
+  EXPECT_TRUE(feed.Read());
+  ASSERT_EQ(3u, feed.RecordCount());
+  EXPECT_EQ("8", feed.Record(0).collision1);
+  EXPECT_EQ("9", feed.Record(1).collision1);
+  EXPECT_EQ("10", feed.Record(2).collision1);
+}
+
+/////////////////////////////////////////////////
+TEST_F(ContactFeedTest, ReaderActive)
+{
+  physics::ContactFeed feed;
+  EXPECT_TRUE(feed.ReaderActive());
+
+  bool active = false;
+  feed.SetReaderActive([&active]() {return active;});
+  EXPECT_FALSE(feed.ReaderActive());
+
+  active = true;
+  EXPECT_TRUE(feed.ReaderActive());
+
+  // An empty function means always active
+  active = false;
+  feed.SetReaderActive(std::function<bool ()>());
+  EXPECT_TRUE(feed.ReaderActive());
+}
+
+/////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -14,8 +14,13 @@
  * limitations under the License.
  *
 */
+#include <map>
+#include <memory>
+#include <mutex>
+
 #include <boost/algorithm/string.hpp>
 
+#include "gazebo/transport/MessagePool.hh"
 #include "gazebo/transport/Node.hh"
 #include "gazebo/transport/Publisher.hh"
 #include "gazebo/transport/TransportIface.hh"
@@ -25,11 +30,57 @@
 #include "gazebo/physics/World.hh"
 #include "gazebo/physics/Collision.hh"
 #include "gazebo/physics/Contact.hh"
+#include "gazebo/physics/ContactFeed.hh"
 #include "gazebo/physics/ContactManager.hh"
 
 using namespace gazebo;
 using namespace physics;
 
+// Added here to avoid breaking the ABI
+// TODO move to ContactManager when merging forward
+/// \brief Contact messages published by the contact managers, recycled
+/// once they are sent.
+static transport::MessagePool<msgs::Contacts> contactsPool;
+
+// Added here to avoid breaking the ABI
+// TODO move to ContactPublisher when merging forward
+/// \brief In-process feeds of the contacts of the filters, filled while
+/// someone other than the contact manager holds them.
+static std::map<const ContactPublisher *, ContactFeedPtr> contactFeeds;
+
+/// \brief Protects contactFeeds, shared by the contact managers of all
+/// the worlds.
+static std::mutex contactFeedsMutex;
+
+/////////////////////////////////////////////////
+/// \brief Set the feed of a contact publisher.
+/// \param[in] _publisher The contact publisher.
+/// \param[in] _feed The feed, or null to remove it.
+static void setContactFeed(const ContactPublisher *_publisher,
+    const ContactFeedPtr &_feed)
+{
+  std::lock_guard<std::mutex> lock(contactFeedsMutex);
+  if (_feed)
+    contactFeeds[_publisher] = _feed;
+  else
+    contactFeeds.erase(_publisher);
+}
+
+/////////////////////////////////////////////////
+/// \brief Get the feed of a contact publisher.
+/// \param[in] _publisher The contact publisher.
+/// \param[in] _held True to only return a feed held by a reader.
+/// \return The feed, or null.
+static ContactFeedPtr contactFeed(const ContactPublisher *_publisher,
+    const bool _held)
+{
+  std::lock_guard<std::mutex> lock(contactFeedsMutex);
+  auto iter = contactFeeds.find(_publisher);
+  if (iter == contactFeeds.end() || (_held && iter->second.use_count() < 2))
+    return ContactFeedPtr();
+  return iter->second;
+}
+
 /////////////////////////////////////////////////
 ContactManager::ContactManager()
 {
@@ -57,6 +108,7 @@ ContactManager::~ContactManager()
       iter->second->collisions.clear();
       iter->second->collisionNames.clear();
       iter->second->publisher.reset();
+      setContactFeed(iter->second, ContactFeedPtr());
       delete iter->second;
       iter->second = NULL;
     }
@@ -296,19 +348,19 @@ void ContactManager::PublishContacts()
   }
 
   // publish to default topic, ~/physics/contacts
-  if (!transport::getMinimalComms())
+  if (!transport::getMinimalComms() && this->contactPub->HasConnections())
   {
-    msgs::Contacts msg;
+    boost::shared_ptr<msgs::Contacts> msg = contactsPool.Acquire();
     for (unsigned int i = 0; i < this->contactIndex; ++i)
     {
       if (this->contacts[i]->count == 0)
         continue;
 
-      msgs::Contact *contactMsg = msg.add_contact();
+      msgs::Contact *contactMsg = msg->add_contact();
       this->contacts[i]->FillMsg(*contactMsg);
     }
 
-    msgs::Set(msg.mutable_time(), this->world->SimTime());
+    msgs::Set(msg->mutable_time(), this->world->SimTime());
     this->contactPub->Publish(msg);
   }
 
@@ -319,18 +371,35 @@ void ContactManager::PublishContacts()
       iter != this->customContactPublishers.end(); ++iter)
   {
     ContactPublisher *contactPublisher = iter->second;
-    msgs::Contacts msg2;
-    for (unsigned int j = 0;
-        j < contactPublisher->contacts.size(); ++j)
+
+    // Feed in-process readers, such as sensors, without building messages.
+    // The feed is only filled while an active reader holds it.
+    ContactFeedPtr feed = contactFeed(contactPublisher, true);
+    if (feed && feed->ReaderActive())
     {
-      if (contactPublisher->contacts[j]->count == 0)
-        continue;
+      for (auto const contact : contactPublisher->contacts)
+      {
+        if (contact->count > 0)
+          feed->Add().Set(*contact);
+      }
+      feed->EndStep();
+    }
+
+    if (contactPublisher->publisher->HasConnections())
+    {
+      boost::shared_ptr<msgs::Contacts> msg2 = contactsPool.Acquire();
+      for (unsigned int j = 0;
+          j < contactPublisher->contacts.size(); ++j)
+      {
+        if (contactPublisher->contacts[j]->count == 0)
+          continue;
 
-      msgs::Contact *contactMsg = msg2.add_contact();
-      contactPublisher->contacts[j]->FillMsg(*contactMsg);
+        msgs::Contact *contactMsg = msg2->add_contact();
+        contactPublisher->contacts[j]->FillMsg(*contactMsg);
+      }
+      msgs::Set(msg2->mutable_time(), this->world->SimTime());
+      contactPublisher->publisher->Publish(msg2);
     }
-    msgs::Set(msg2.mutable_time(), this->world->SimTime());
-    contactPublisher->publisher->Publish(msg2);
     contactPublisher->contacts.clear();
   }
 }
@@ -363,6 +432,7 @@ std::string ContactManager::CreateFilter(const std::string &_name,
 
   ContactPublisher *contactPublisher = new ContactPublisher;
   contactPublisher->publisher = this->node->Advertise<msgs::Contacts>(topic);
+  setContactFeed(contactPublisher, std::make_shared<ContactFeed>());
 
   std::map<std::string, physics::CollisionPtr>::const_iterator iter;
   for (iter = _collisions.begin(); iter != _collisions.end(); ++iter)
@@ -441,10 +511,24 @@ void ContactManager::RemoveFilter(const std::string &_name)
     contactPublisher->collisions.clear();
     contactPublisher->publisher->Fini();
     contactPublisher->publisher.reset();
+    setContactFeed(contactPublisher, ContactFeedPtr());
     this->customContactPublishers.erase(iter);
   }
 }
 
+/////////////////////////////////////////////////
+ContactFeedPtr ContactManager::Feed(const std::string &_name)
+{
+  std::string name = _name;
+  boost::replace_all(name, "::", "/");
+
+  boost::recursive_mutex::scoped_lock lock(*this->customMutex);
+  auto iter = this->customContactPublishers.find(name);
+  if (iter == this->customContactPublishers.end())
+    return ContactFeedPtr();
+  return contactFeed(iter->second, false);
+}
+
 /////////////////////////////////////////////////
 unsigned int ContactManager::GetFilterCount()
 {
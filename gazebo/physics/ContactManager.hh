@@ -159,7 +159,9 @@ namespace gazebo
       /// \brief Clear all stored contacts.
       public: void Clear();
 
-      /// \brief Publish all contacts in a msgs::Contacts message.
+      /// \brief Publish all contacts in a msgs::Contacts message, and
+      /// the filtered contacts to their topics and feeds. Messages are only
+      /// built for topics with subscribers.
       public: void PublishContacts();
 
       /// \brief Set the contact count to zero.
@@ -195,6 +197,13 @@ namespace gazebo
       /// param[in] _name Filter name.
       public: void RemoveFilter(const std::string &_name);
 
+      /// \brief Get the in-process feed of a filter. It carries the same
+      /// contacts as the filter topic without serializing them, and is
+      /// only filled while the returned pointer is held.
+      /// \param[in] _name Filter name.
+      /// \return The feed, null if the filter doesn't exist.
+      public: ContactFeedPtr Feed(const std::string &_name);
+
       /// \brief Get the number of filters in the contact manager.
       /// return Number of filters
       public: unsigned int GetFilterCount();
@@ -0,0 +1,336 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <utility>
+
+#include "gazebo/common/Console.hh"
+#include "gazebo/physics/ForceField.hh"
+#include "gazebo/physics/Link.hh"
+#include "gazebo/physics/Wind.hh"
+#include "gazebo/physics/World.hh"
+
+namespace gazebo
+{
+  namespace physics
+  {
+    /// \internal
+    /// \brief Private data for the ForceField class
+    class ForceFieldPrivate
+    {
+      /// \brief Constructor.
+      /// \param[in] _world Reference to the world.
+      public: explicit ForceFieldPrivate(World &_world)
+        : world(_world)
+      {
+      }
+
+      /// \brief Reference to the world.
+      public: World &world;
+
+      /// \brief Packed link state.
+      public: ForceFieldState state;
+
+      /// \brief Reference count of each row, 0 for unused rows.
+      public: std::vector<unsigned int> refCounts;
+
+      /// \brief Rows released, to be reused.
+      public: std::vector<unsigned int> freeRows;
+
+      /// \brief Row of each link.
+      public: std::map<const Link *, unsigned int> rows;
+
+      /// \brief Number of rows with wind enabled.
+      public: unsigned int windCount = 0;
+
+      /// \brief Providers, in the order they were added.
+      public: std::vector<std::pair<std::string, ForceFieldProviderPtr>>
+              providers;
+
+      /// \brief Protects all of the above.
+      public: mutable std::recursive_mutex mutex;
+    };
+  }
+}
+
+using namespace gazebo;
+using namespace physics;
+
+//////////////////////////////////////////////////
+bool ForceFieldState::Valid(const unsigned int _row) const
+{
+  return _row < this->links.size() && this->links[_row] != nullptr;
+}
+
+//////////////////////////////////////////////////
+ignition::math::Vector3d ForceFieldState::PointLinearVel(
+    const unsigned int _row, const ignition::math::Vector3d &_pos) const
+{
+  return this->linearVels[_row] +
+    this->angularVels[_row].Cross(_pos - this->cogs[_row]);
+}
+
+//////////////////////////////////////////////////
+void ForceFieldState::AddForceAtWorldPosition(const unsigned int _row,
+    const ignition::math::Vector3d &_force,
+    const ignition::math::Vector3d &_pos)
+{
+  this->forces[_row] += _force;
+  this->torques[_row] += (_pos - this->cogs[_row]).Cross(_force);
+}
+
+//////////////////////////////////////////////////
+void ForceFieldState::AddTorque(const unsigned int _row,
+    const ignition::math::Vector3d &_torque)
+{
+  this->torques[_row] += _torque;
+}
+
+//////////////////////////////////////////////////
+ForceFieldProvider::~ForceFieldProvider()
+{
+}
+
+//////////////////////////////////////////////////
+ForceField::ForceField(World &_world)
+  : dataPtr(new ForceFieldPrivate(_world))
+{
+}
+
+//////////////////////////////////////////////////
+ForceField::~ForceField()
+{
+}
+
+//////////////////////////////////////////////////
+unsigned int ForceField::AddLink(Link *_link)
+{
+  std::lock_guard<std::recursive_mutex> lock(this->dataPtr->mutex);
+
+  auto iter = this->dataPtr->rows.find(_link);
+  if (iter != this->dataPtr->rows.end())
+  {
+    this->dataPtr->refCounts[iter->second]++;
+    return iter->second;
+  }
+
+  ForceFieldState &state = this->dataPtr->state;
+  unsigned int row;
+  if (!this->dataPtr->freeRows.empty())
+  {
+    row = this->dataPtr->freeRows.back();
+    this->dataPtr->freeRows.pop_back();
+  }
+  else
+  {
+    row = static_cast<unsigned int>(state.links.size());
+    state.links.push_back(nullptr);
+    state.poses.emplace_back();
+    state.cogs.emplace_back();
+    state.linearVels.emplace_back();
+    state.angularVels.emplace_back();
+    state.windVels.emplace_back();
+    state.windEnabled.push_back(false);
+    state.forces.emplace_back();
+    state.torques.emplace_back();
+    this->dataPtr->refCounts.push_back(0);
+  }
+
+  state.links[row] = _link;
+  state.windVels[row] = ignition::math::Vector3d::Zero;
+  state.windEnabled[row] = false;
+  this->dataPtr->refCounts[row] = 1;
+  this->dataPtr->rows[_link] = row;
+  return row;
+}
+
+//////////////////////////////////////////////////
+void ForceField::RemoveLink(const unsigned int _row)
+{
+  std::lock_guard<std::recursive_mutex> lock(this->dataPtr->mutex);
+
+  if (_row >= this->dataPtr->refCounts.size() ||
+      this->dataPtr->refCounts[_row] == 0)
+  {
+    gzerr << "Invalid force field row [" << _row << "]\n";
+    return;
+  }
+
+  if (--this->dataPtr->refCounts[_row] > 0)
+    return;
+
+  ForceFieldState &state = this->dataPtr->state;
+  if (state.links[_row])
+    this->dataPtr->rows.erase(state.links[_row]);
+  if (state.windEnabled[_row])
+    this->dataPtr->windCount--;
+  state.links[_row] = nullptr;
+  state.windEnabled[_row] = false;
+  this->dataPtr->freeRows.push_back(_row);
+}
+
+//////////////////////////////////////////////////
+void ForceField::DetachLink(const Link *_link)
+{
+  std::lock_guard<std::recursive_mutex> lock(this->dataPtr->mutex);
+
+  auto iter = this->dataPtr->rows.find(_link);
+  if (iter == this->dataPtr->rows.end())
+    return;
+
+  this->dataPtr->state.links[iter->second] = nullptr;
+  this->dataPtr->rows.erase(iter);
+}
+
+//////////////////////////////////////////////////
+void ForceField::SetWindEnabled(const unsigned int _row, const bool _enable)
+{
+  std::lock_guard<std::recursive_mutex> lock(this->dataPtr->mutex);
+
+  ForceFieldState &state = this->dataPtr->state;
+  if (_row >= state.windEnabled.size() ||
+      static_cast<bool>(state.windEnabled[_row]) == _enable)
+  {
+    return;
+  }
+
+  state.windEnabled[_row] = _enable;
+  state.windVels[_row] = ignition::math::Vector3d::Zero;
+  if (_enable)
+    this->dataPtr->windCount++;
+  else
+    this->dataPtr->windCount--;
+}
+
+//////////////////////////////////////////////////
+unsigned int ForceField::LinkCount() const
+{
+  std::lock_guard<std::recursive_mutex> lock(this->dataPtr->mutex);
+  return static_cast<unsigned int>(this->dataPtr->state.links.size() -
+      this->dataPtr->freeRows.size());
+}
+
+//////////////////////////////////////////////////
+bool ForceField::AddProvider(const std::string &_name,
+    ForceFieldProviderPtr _provider)
+{
+  std::lock_guard<std::recursive_mutex> lock(this->dataPtr->mutex);
+
+  if (!_provider || this->Provider(_name))
+    return false;
+
+  this->dataPtr->providers.emplace_back(_name, _provider);
+  return true;
+}
+
+//////////////////////////////////////////////////
+ForceFieldProviderPtr ForceField::Provider(const std::string &_name) const
+{
+  std::lock_guard<std::recursive_mutex> lock(this->dataPtr->mutex);
+
+  for (auto const &provider : this->dataPtr->providers)
+  {
+    if (provider.first == _name)
+      return provider.second;
+  }
+  return nullptr;
+}
+
+//////////////////////////////////////////////////
+bool ForceField::RemoveProvider(const std::string &_name)
+{
+  std::lock_guard<std::recursive_mutex> lock(this->dataPtr->mutex);
+
+  auto &providers = this->dataPtr->providers;
+  for (auto iter = providers.begin(); iter != providers.end(); ++iter)
+  {
+    if (iter->first == _name)
+    {
+      providers.erase(iter);
+      return true;
+    }
+  }
+  return false;
+}
+
+//////////////////////////////////////////////////
+void ForceField::Update()
+{
+  std::lock_guard<std::recursive_mutex> lock(this->dataPtr->mutex);
+
+  ForceFieldState &state = this->dataPtr->state;
+  const bool hasProviders = !this->dataPtr->providers.empty();
+  if (!hasProviders && this->dataPtr->windCount == 0)
+    return;
+
+  const size_t count = state.links.size();
+
+  // Wind velocity, cached in the links for Link::WorldWindLinearVel
+  if (this->dataPtr->windCount > 0)
+  {
+    const Wind &wind = this->dataPtr->world.Wind();
+    for (size_t i = 0; i < count; ++i)
+    {
+      if (!state.windEnabled[i] || !state.links[i])
+        continue;
+      state.windVels[i] = wind.WorldLinearVel(state.links[i]);
+      state.links[i]->SetWorldWindLinearVel(state.windVels[i]);
+    }
+  }
+
+  if (!hasProviders)
+    return;
+
+  // Gather the link state
+  state.gravity = this->dataPtr->world.Gravity();
+  for (size_t i = 0; i < count; ++i)
+  {
+    Link *link = state.links[i];
+    if (!link)
+      continue;
+    state.poses[i] = link->WorldPose();
+    state.cogs[i] = link->WorldCoGPose().Pos();
+    state.linearVels[i] = link->WorldCoGLinearVel();
+    state.angularVels[i] = link->WorldAngularVel();
+  }
+  std::fill(state.forces.begin(), state.forces.end(),
+      ignition::math::Vector3d::Zero);
+  std::fill(state.torques.begin(), state.torques.end(),
+      ignition::math::Vector3d::Zero);
+
+  for (auto const &provider : this->dataPtr->providers)
+    provider.second->Update(state);
+
+  // Apply the accumulated wrenches
+  for (size_t i = 0; i < count; ++i)
+  {
+    Link *link = state.links[i];
+    if (!link)
+      continue;
+
+    // Correct for nan or inf
+    state.forces[i].Correct();
+    state.torques[i].Correct();
+
+    if (state.forces[i] != ignition::math::Vector3d::Zero)
+      link->AddForceAtWorldPosition(state.forces[i], state.cogs[i]);
+    if (state.torques[i] != ignition::math::Vector3d::Zero)
+      link->AddTorque(state.torques[i]);
+  }
+}
@@ -0,0 +1,195 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GAZEBO_PHYSICS_FORCEFIELD_HH_
+#define GAZEBO_PHYSICS_FORCEFIELD_HH_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ignition/math/Pose3.hh>
+#include <ignition/math/Vector3.hh>
+
+#include "gazebo/physics/PhysicsTypes.hh"
+#include "gazebo/util/system.hh"
+
+namespace gazebo
+{
+  namespace physics
+  {
+    // Forward declare private data class.
+    class ForceFieldPrivate;
+
+    /// \addtogroup gazebo_physics
+    /// \{
+
+    /// \class ForceFieldState ForceField.hh physics/physics.hh
+    /// \brief Packed state of the links affected by force fields. All
+    /// arrays are indexed by the row returned by ForceField::AddLink, and
+    /// all values are expressed in the world frame.
+    class GZ_PHYSICS_VISIBLE ForceFieldState
+    {
+      /// \brief Check if a row holds a link.
+      /// \param[in] _row Row of the link.
+      /// \return False if the row is unused, or if its link was removed.
+      public: bool Valid(const unsigned int _row) const;
+
+      /// \brief Get the velocity of a point fixed to a link.
+      /// \param[in] _row Row of the link.
+      /// \param[in] _pos Position of the point in the world frame.
+      /// \return Linear velocity of the point.
+      public: ignition::math::Vector3d PointLinearVel(const unsigned int _row,
+                  const ignition::math::Vector3d &_pos) const;
+
+      /// \brief Add a force to a link.
+      /// \param[in] _row Row of the link.
+      /// \param[in] _force Force in the world frame.
+      /// \param[in] _pos Point of application in the world frame.
+      public: void AddForceAtWorldPosition(const unsigned int _row,
+                  const ignition::math::Vector3d &_force,
+                  const ignition::math::Vector3d &_pos);
+
+      /// \brief Add a torque to a link.
+      /// \param[in] _row Row of the link.
+      /// \param[in] _torque Torque in the world frame.
+      public: void AddTorque(const unsigned int _row,
+                  const ignition::math::Vector3d &_torque);
+
+      /// \brief Links, nullptr for unused rows.
+      public: std::vector<Link *> links;
+
+      /// \brief Pose of the link frames.
+      public: std::vector<ignition::math::Pose3d> poses;
+
+      /// \brief Position of the centers of gravity.
+      public: std::vector<ignition::math::Vector3d> cogs;
+
+      /// \brief Linear velocity of the centers of gravity.
+      public: std::vector<ignition::math::Vector3d> linearVels;
+
+      /// \brief Angular velocity of the links.
+      public: std::vector<ignition::math::Vector3d> angularVels;
+
+      /// \brief Wind velocity at the links. Zero for links without wind.
+      public: std::vector<ignition::math::Vector3d> windVels;
+
+      /// \brief True for links with wind enabled.
+      public: std::vector<char> windEnabled;
+
+      /// \brief Forces accumulated during an update, applied at the centers
+      /// of gravity.
+      public: std::vector<ignition::math::Vector3d> forces;
+
+      /// \brief Torques accumulated during an update.
+      public: std::vector<ignition::math::Vector3d> torques;
+
+      /// \brief Gravity of the world.
+      public: ignition::math::Vector3d gravity;
+    };
+
+    /// \class ForceFieldProvider ForceField.hh physics/physics.hh
+    /// \brief Base class of the providers of a force field, such as
+    /// buoyancy or aerodynamic loads. A provider is registered once with the
+    /// ForceField of a world, and computes the forces on all of its links
+    /// in a single pass.
+    class GZ_PHYSICS_VISIBLE ForceFieldProvider
+    {
+      /// \brief Destructor.
+      public: virtual ~ForceFieldProvider();
+
+      /// \brief Add the forces of the provider to the links. Called on every
+      /// world update, before the physics update, with the ForceField lock
+      /// held.
+      /// \param[in,out] _state State of the links. Forces and torques are
+      /// to be accumulated in it.
+      public: virtual void Update(ForceFieldState &_state) = 0;
+    };
+
+    /// \def ForceFieldProviderPtr
+    /// \brief Shared pointer to a force field provider.
+    typedef std::shared_ptr<ForceFieldProvider> ForceFieldProviderPtr;
+
+    /// \class ForceField ForceField.hh physics/physics.hh
+    /// \brief World-level stage that evaluates wind and external force
+    /// fields. Links are packed into rows once, when they are added. On every
+    /// update their state is gathered in one pass, the wind and the
+    /// providers are evaluated, and the accumulated forces are applied.
+    /// This replaces the per-link and per-plugin world update callbacks.
+    class GZ_PHYSICS_VISIBLE ForceField
+    {
+      /// \brief Constructor.
+      /// \param[in] _world Reference to the world.
+      public: explicit ForceField(World &_world);
+
+      /// \brief Destructor.
+      public: ~ForceField();
+
+      /// \brief Add a link. Adding a link several times returns the same
+      /// row, and increments its reference count.
+      /// \param[in] _link Link to add.
+      /// \return Row of the link.
+      /// \sa RemoveLink
+      public: unsigned int AddLink(Link *_link);
+
+      /// \brief Release a row returned by AddLink. The row is reused once all
+      /// of its references have been released.
+      /// \param[in] _row Row of the link.
+      public: void RemoveLink(const unsigned int _row);
+
+      /// \brief Detach a link that is being deleted from its row. The row
+      /// stays allocated until it is released, but is skipped by updates.
+      /// \param[in] _link Link being deleted.
+      public: void DetachLink(const Link *_link);
+
+      /// \brief Enable or disable the wind for a link.
+      /// \param[in] _row Row of the link.
+      /// \param[in] _enable True to compute the wind velocity at the link.
+      public: void SetWindEnabled(const unsigned int _row, const bool _enable);
+
+      /// \brief Get the number of links.
+      /// \return Number of rows in use.
+      public: unsigned int LinkCount() const;
+
+      /// \brief Add a provider.
+      /// \param[in] _name Unique name of the provider.
+      /// \param[in] _provider The provider.
+      /// \return False if a provider with the same name exists.
+      public: bool AddProvider(const std::string &_name,
+                  ForceFieldProviderPtr _provider);
+
+      /// \brief Get a provider.
+      /// \param[in] _name Name of the provider.
+      /// \return The provider, or nullptr if it doesn't exist.
+      public: ForceFieldProviderPtr Provider(const std::string &_name) const;
+
+      /// \brief Remove a provider.
+      /// \param[in] _name Name of the provider.
+      /// \return False if the provider doesn't exist.
+      public: bool RemoveProvider(const std::string &_name);
+
+      /// \brief Gather the link state, evaluate the wind and the providers,
+      /// and apply the forces. Called by World::Update.
+      public: void Update();
+
+      /// \internal
+      /// \brief Private data pointer.
+      private: std::unique_ptr<ForceFieldPrivate> dataPtr;
+    };
+    /// \}
+  }
+}
+#endif
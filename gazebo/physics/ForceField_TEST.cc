@@ -0,0 +1,204 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gazebo/physics/ForceField.hh"
+#include "gazebo/test/ServerFixture.hh"
+#include "gazebo/test/helper_physics_generator.hh"
+
+using namespace gazebo;
+
+class ForceFieldTest : public ServerFixture {};
+
+class ForceFieldEngineTest : public ServerFixture,
+                             public testing::WithParamInterface<const char*>
+{
+  /// \brief Lift a box with a provider, and check its motion.
+  /// \param[in] _physicsEngine Physics engine to use.
+  public: void Provider(const std::string &_physicsEngine);
+};
+
+/// \brief Provider that lifts its links with twice their weight.
+class LiftProvider : public physics::ForceFieldProvider
+{
+  // Documentation inherited
+  public: virtual void Update(physics::ForceFieldState &_state)
+  {
+    this->updates++;
+    for (size_t i = 0; i < this->rows.size(); ++i)
+    {
+      if (!_state.Valid(this->rows[i]))
+        continue;
+      _state.AddForceAtWorldPosition(this->rows[i],
+          -2.0 * this->masses[i] * _state.gravity,
+          _state.cogs[this->rows[i]]);
+    }
+  }
+
+  /// \brief Rows of the links.
+  public: std::vector<unsigned int> rows;
+
+  /// \brief Mass of the links.
+  public: std::vector<double> masses;
+
+  /// \brief Number of updates.
+  public: int updates = 0;
+};
+
+/////////////////////////////////////////////////
+TEST_F(ForceFieldTest, Rows)
+{
+  this->Load("worlds/shapes.world", true);
+  physics::WorldPtr world = physics::get_world("default");
+  ASSERT_TRUE(world != nullptr);
+
+  physics::ForceField *forceField = world->ForceField();
+  ASSERT_TRUE(forceField != nullptr);
+  const unsigned int initialCount = forceField->LinkCount();
+
+  physics::LinkPtr box = world->ModelByName("box")->GetLink("link");
+  physics::LinkPtr sphere = world->ModelByName("sphere")->GetLink("link");
+  ASSERT_TRUE(box != nullptr);
+  ASSERT_TRUE(sphere != nullptr);
+
+  // Adding a link twice returns the same row
+  const unsigned int boxRow = forceField->AddLink(box.get());
+  EXPECT_EQ(boxRow, forceField->AddLink(box.get()));
+  const unsigned int sphereRow = forceField->AddLink(sphere.get());
+  EXPECT_NE(boxRow, sphereRow);
+  EXPECT_EQ(initialCount + 2, forceField->LinkCount());
+
+  // The row is released with its last reference
+  forceField->RemoveLink(boxRow);
+  EXPECT_EQ(initialCount + 2, forceField->LinkCount());
+  forceField->RemoveLink(boxRow);
+  EXPECT_EQ(initialCount + 1, forceField->LinkCount());
+
+  // Released rows are reused
+  EXPECT_EQ(boxRow, forceField->AddLink(box.get()));
+
+  // Detached rows stay allocated until they are released
+  forceField->DetachLink(sphere.get());
+  EXPECT_EQ(initialCount + 2, forceField->LinkCount());
+  forceField->RemoveLink(sphereRow);
+  forceField->RemoveLink(boxRow);
+  EXPECT_EQ(initialCount, forceField->LinkCount());
+
+  // Providers
+  auto provider = std::make_shared<LiftProvider>();
+  EXPECT_TRUE(forceField->AddProvider("lift", provider));
+  EXPECT_FALSE(forceField->AddProvider("lift", provider));
+  EXPECT_EQ(provider, forceField->Provider("lift"));
+  EXPECT_TRUE(forceField->Provider("missing") == nullptr);
+  EXPECT_TRUE(forceField->RemoveProvider("lift"));
+  EXPECT_FALSE(forceField->RemoveProvider("lift"));
+}
+
+/////////////////////////////////////////////////
+void ForceFieldEngineTest::Provider(const std::string &_physicsEngine)
+{
+  if (_physicsEngine == "bullet")
+  {
+    gzerr << "Aborting test for bullet, BulletLink::AddForceAtWorldPosition "
+          << "is not implemented." << std::endl;
+    return;
+  }
+
+  this->Load("worlds/shapes.world", true, _physicsEngine);
+  physics::WorldPtr world = physics::get_world("default");
+  ASSERT_TRUE(world != nullptr);
+  physics::ForceField *forceField = world->ForceField();
+  ASSERT_TRUE(forceField != nullptr);
+
+  physics::LinkPtr box = world->ModelByName("box")->GetLink("link");
+  physics::LinkPtr sphere = world->ModelByName("sphere")->GetLink("link");
+  ASSERT_TRUE(box != nullptr);
+  ASSERT_TRUE(sphere != nullptr);
+
+  auto provider = std::make_shared<LiftProvider>();
+  provider->rows.push_back(forceField->AddLink(box.get()));
+  provider->masses.push_back(box->GetInertial()->Mass());
+  EXPECT_TRUE(forceField->AddProvider("lift", provider));
+
+  const double boxZ = box->WorldPose().Pos().Z();
+  const double sphereZ = sphere->WorldPose().Pos().Z();
+
+  // The box rises with an acceleration of g, the sphere stays on the ground
+  const int steps = 100;
+  world->Step(steps);
+  EXPECT_EQ(steps, provider->updates);
+
+  const double t = steps * world->Physics()->GetMaxStepSize();
+  const double g = world->Gravity().Length();
+  EXPECT_NEAR(box->WorldLinearVel().Z(), g * t, 1e-2);
+  EXPECT_NEAR(box->WorldLinearVel().X(), 0.0, 1e-3);
+  EXPECT_NEAR(box->WorldLinearVel().Y(), 0.0, 1e-3);
+  EXPECT_NEAR(box->WorldAngularVel().Length(), 0.0, 1e-3);
+  EXPECT_GT(box->WorldPose().Pos().Z(), boxZ + 0.4 * g * t * t);
+  EXPECT_NEAR(sphere->WorldPose().Pos().Z(), sphereZ, 1e-3);
+
+  // Without the provider the box falls back
+  EXPECT_TRUE(forceField->RemoveProvider("lift"));
+  world->Step(steps);
+  EXPECT_EQ(steps, provider->updates);
+  EXPECT_NEAR(box->WorldLinearVel().Z(), 0.0, 1e-2);
+}
+
+/////////////////////////////////////////////////
+TEST_P(ForceFieldEngineTest, Provider)
+{
+  Provider(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(PhysicsEngines, ForceFieldEngineTest,
+                        PHYSICS_ENGINE_VALUES,);  // NOLINT
+
+/////////////////////////////////////////////////
+TEST_F(ForceFieldTest, Wind)
+{
+  this->Load("worlds/shapes.world", true);
+  physics::WorldPtr world = physics::get_world("default");
+  ASSERT_TRUE(world != nullptr);
+
+  physics::LinkPtr box = world->ModelByName("box")->GetLink("link");
+  ASSERT_TRUE(box != nullptr);
+
+  const ignition::math::Vector3d windVel(1, 2, 0);
+  world->Wind().SetLinearVel(windVel);
+
+  // No wind until the link enables it
+  box->SetWindMode(false);
+  world->Step(1);
+  EXPECT_EQ(ignition::math::Vector3d::Zero, box->WorldWindLinearVel());
+
+  box->SetWindMode(true);
+  world->Step(1);
+  EXPECT_EQ(windVel, box->WorldWindLinearVel());
+
+  box->SetWindMode(false);
+  EXPECT_EQ(ignition::math::Vector3d::Zero, box->WorldWindLinearVel());
+}
+
+/////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
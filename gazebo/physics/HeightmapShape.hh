@@ -161,6 +161,9 @@ namespace gazebo
       /// \brief The amount of subsampling. Default is 2.
       protected: int subSampling;
 
+      /// Friend LineOfSightPrivate so that it has access to the heights
+      private: friend class LineOfSightPrivate;
+
       /// \brief Transportation node.
       private: transport::NodePtr node;
 
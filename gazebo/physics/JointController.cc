@@ -15,6 +15,9 @@
  *
 */
 
+#include <algorithm>
+#include <cmath>
+
 #include <boost/algorithm/string.hpp>
 
 #include "gazebo/transport/Node.hh"
@@ -67,49 +70,174 @@ JointController::~JointController()
 }
 
 /////////////////////////////////////////////////
-void JointController::AddJoint(JointPtr _joint)
+void JointPidList::Resize(const size_t _size)
 {
-  this->dataPtr->joints[_joint->GetScopedName()] = _joint;
-  this->dataPtr->posPids[_joint->GetScopedName()].Init(
-      1, 0.1, 0.01, 1, -1, 1000, -1000);
-  this->dataPtr->velPids[_joint->GetScopedName()].Init(
-      1, 0.1, 0.01, 1, -1, 1000, -1000);
+  // Same defaults as the controllers created by JointController::AddJoint
+  this->pids.resize(_size, common::PID(1, 0.1, 0.01, 1, -1, 1000, -1000));
 }
 
 /////////////////////////////////////////////////
-void JointController::RemoveJoint(Joint *_joint)
+void JointPidList::Erase(const size_t _index)
+{
+  this->pids.erase(this->pids.begin() + _index);
+}
+
+/////////////////////////////////////////////////
+void JointPidList::Set(const size_t _index, const common::PID &_pid)
+{
+  this->pids[_index] = _pid;
+}
+
+/////////////////////////////////////////////////
+const common::PID &JointPidList::Get(const size_t _index) const
+{
+  return this->pids[_index];
+}
+
+/////////////////////////////////////////////////
+void JointPidList::Reset()
+{
+  for (auto &pid : this->pids)
+    pid.Reset();
+}
+
+/////////////////////////////////////////////////
+void JointPidList::Update(const double *_errors, const uint8_t *_mask,
+    const common::Time &_dt, double *_cmds)
+{
+  const size_t count = this->pids.size();
+  for (size_t i = 0; i < count; ++i)
+    _cmds[i] = _mask[i] ? this->pids[i].Update(_errors[i], _dt) : 0.0;
+}
+
+/////////////////////////////////////////////////
+/// \brief Set or clear an entry of a flag array, and keep count of the
+/// entries that are set.
+/// \param[in,out] _flags Flag array.
+/// \param[in,out] _count Number of entries set in _flags.
+/// \param[in] _index Entry to change.
+/// \param[in] _value New value of the entry.
+static void setFlag(std::vector<uint8_t> &_flags, unsigned int &_count,
+    const unsigned int _index, const bool _value)
 {
-  if (_joint)
+  if (static_cast<bool>(_flags[_index]) != _value)
   {
-    this->dataPtr->joints.erase(_joint->GetScopedName());
-    this->dataPtr->posPids.erase(_joint->GetScopedName());
-    this->dataPtr->velPids.erase(_joint->GetScopedName());
+    _flags[_index] = _value;
+    _count = _value ? _count + 1 : _count - 1;
   }
 }
 
 /////////////////////////////////////////////////
-void JointController::Reset()
+/// \brief Build a map of joint names to values, for the entries whose
+/// flag is set.
+/// \param[in] _indices Map of joint names to indices.
+/// \param[in] _values Values, in index order.
+/// \param[in] _flags Flags, in index order.
+/// \return The map.
+static std::map<std::string, double> toMap(
+    const std::map<std::string, unsigned int> &_indices,
+    const std::vector<double> &_values, const std::vector<uint8_t> &_flags)
 {
-  // Reset setpoints and feed-forward.
-  this->dataPtr->positions.clear();
-  this->dataPtr->velocities.clear();
-  this->dataPtr->forces.clear();
+  std::map<std::string, double> result;
+  for (auto const &index : _indices)
+  {
+    if (_flags[index.second])
+      result[index.first] = _values[index.second];
+  }
+  return result;
+}
 
-  std::map<std::string, common::PID>::iterator iter;
+/////////////////////////////////////////////////
+void JointController::AddJoint(JointPtr _joint)
+{
+  const std::string name = _joint->GetScopedName();
 
-  for (iter = this->dataPtr->posPids.begin();
-    iter != this->dataPtr->posPids.end(); ++iter)
+  unsigned int index;
+  auto iter = this->dataPtr->jointIndices.find(name);
+  if (iter != this->dataPtr->jointIndices.end())
+  {
+    index = iter->second;
+    this->dataPtr->joints[index] = _joint;
+  }
+  else
   {
-    iter->second.Reset();
+    index = this->dataPtr->joints.size();
+    this->dataPtr->jointIndices[name] = index;
+    this->dataPtr->joints.push_back(_joint);
+
+    const size_t size = this->dataPtr->joints.size();
+    this->dataPtr->posPids.Resize(size);
+    this->dataPtr->velPids.Resize(size);
+    this->dataPtr->forces.resize(size, 0);
+    this->dataPtr->hasForce.resize(size, 0);
+    this->dataPtr->positions.resize(size, 0);
+    this->dataPtr->hasPosition.resize(size, 0);
+    this->dataPtr->velocities.resize(size, 0);
+    this->dataPtr->hasVelocity.resize(size, 0);
   }
 
-  for (iter = this->dataPtr->velPids.begin();
-    iter != this->dataPtr->velPids.end(); ++iter)
+  const common::PID pid(1, 0.1, 0.01, 1, -1, 1000, -1000);
+  this->dataPtr->posPids.Set(index, pid);
+  this->dataPtr->velPids.Set(index, pid);
+}
+
+/////////////////////////////////////////////////
+void JointController::RemoveJoint(Joint *_joint)
+{
+  if (!_joint)
+    return;
+
+  auto iter = this->dataPtr->jointIndices.find(_joint->GetScopedName());
+  if (iter == this->dataPtr->jointIndices.end())
+    return;
+
+  const unsigned int index = iter->second;
+  this->dataPtr->jointIndices.erase(iter);
+
+  setFlag(this->dataPtr->hasForce, this->dataPtr->forceCount, index, false);
+  setFlag(this->dataPtr->hasPosition, this->dataPtr->positionCount, index,
+      false);
+  setFlag(this->dataPtr->hasVelocity, this->dataPtr->velocityCount, index,
+      false);
+
+  // Keep the arrays dense. This shifts the index of the following joints.
+  this->dataPtr->joints.erase(this->dataPtr->joints.begin() + index);
+  this->dataPtr->posPids.Erase(index);
+  this->dataPtr->velPids.Erase(index);
+  this->dataPtr->forces.erase(this->dataPtr->forces.begin() + index);
+  this->dataPtr->hasForce.erase(this->dataPtr->hasForce.begin() + index);
+  this->dataPtr->positions.erase(this->dataPtr->positions.begin() + index);
+  this->dataPtr->hasPosition.erase(
+      this->dataPtr->hasPosition.begin() + index);
+  this->dataPtr->velocities.erase(this->dataPtr->velocities.begin() + index);
+  this->dataPtr->hasVelocity.erase(
+      this->dataPtr->hasVelocity.begin() + index);
+
+  for (auto &jointIndex : this->dataPtr->jointIndices)
   {
-    iter->second.Reset();
+    if (jointIndex.second > index)
+      --jointIndex.second;
   }
 }
 
+/////////////////////////////////////////////////
+void JointController::Reset()
+{
+  // Reset setpoints and feed-forward.
+  std::fill(this->dataPtr->hasPosition.begin(),
+      this->dataPtr->hasPosition.end(), 0);
+  std::fill(this->dataPtr->hasVelocity.begin(),
+      this->dataPtr->hasVelocity.end(), 0);
+  std::fill(this->dataPtr->hasForce.begin(),
+      this->dataPtr->hasForce.end(), 0);
+  this->dataPtr->positionCount = 0;
+  this->dataPtr->velocityCount = 0;
+  this->dataPtr->forceCount = 0;
+
+  this->dataPtr->posPids.Reset();
+  this->dataPtr->velPids.Reset();
+}
+
 /////////////////////////////////////////////////
 void JointController::Update()
 {
@@ -123,41 +251,59 @@ void JointController::Update()
   // TODO: fix this when World::ResetTime is improved
   if (stepTime > 0)
   {
-    if (!this->dataPtr->forces.empty())
+    const Joint_V &joints = this->dataPtr->joints;
+    const size_t count = joints.size();
+
+    this->dataPtr->errors.resize(count);
+    this->dataPtr->cmds.resize(count);
+    double *errors = this->dataPtr->errors.data();
+    double *cmds = this->dataPtr->cmds.data();
+
+    if (this->dataPtr->forceCount > 0)
     {
-      std::map<std::string, double>::iterator iter;
-      for (iter = this->dataPtr->forces.begin();
-          iter != this->dataPtr->forces.end(); ++iter)
+      const uint8_t *mask = this->dataPtr->hasForce.data();
+      for (size_t i = 0; i < count; ++i)
       {
-        this->dataPtr->joints[iter->first]->SetForce(0, iter->second);
+        if (mask[i])
+          joints[i]->SetForce(0, this->dataPtr->forces[i]);
       }
     }
 
-    if (!this->dataPtr->positions.empty())
+    // Gather the errors of all joints, update all the PIDs in one pass,
+    // then scatter the commands.
+    if (this->dataPtr->positionCount > 0)
     {
-      std::map<std::string, double>::iterator iter;
+      const uint8_t *mask = this->dataPtr->hasPosition.data();
+      for (size_t i = 0; i < count; ++i)
+      {
+        errors[i] = mask[i] ?
+          joints[i]->Position(0) - this->dataPtr->positions[i] : 0.0;
+      }
+
+      this->dataPtr->posPids.Update(errors, mask, stepTime, cmds);
 
-      for (iter = this->dataPtr->positions.begin();
-           iter != this->dataPtr->positions.end(); ++iter)
+      for (size_t i = 0; i < count; ++i)
       {
-        double cmd = this->dataPtr->posPids[iter->first].Update(
-            this->dataPtr->joints[iter->first]->Position(0) -
-            iter->second, stepTime);
-        this->dataPtr->joints[iter->first]->SetForce(0, cmd);
+        if (mask[i])
+          joints[i]->SetForce(0, cmds[i]);
       }
     }
 
-    if (!this->dataPtr->velocities.empty())
+    if (this->dataPtr->velocityCount > 0)
     {
-      std::map<std::string, double>::iterator iter;
+      const uint8_t *mask = this->dataPtr->hasVelocity.data();
+      for (size_t i = 0; i < count; ++i)
+      {
+        errors[i] = mask[i] ?
+          joints[i]->GetVelocity(0) - this->dataPtr->velocities[i] : 0.0;
+      }
+
+      this->dataPtr->velPids.Update(errors, mask, stepTime, cmds);
 
-      for (iter = this->dataPtr->velocities.begin();
-           iter != this->dataPtr->velocities.end(); ++iter)
+      for (size_t i = 0; i < count; ++i)
       {
-        double cmd = this->dataPtr->velPids[iter->first].Update(
-            this->dataPtr->joints[iter->first]->GetVelocity(0) - iter->second,
-            stepTime);
-        this->dataPtr->joints[iter->first]->SetForce(0, cmd);
+        if (mask[i])
+          joints[i]->SetForce(0, cmds[i]);
       }
     }
   }
@@ -189,199 +335,121 @@ bool JointController::OnJointCmdReq(const ignition::msgs::StringMsg &_req,
   const std::string &jointName = _req.data();
   _rep.set_name(jointName);
 
-  if (this->dataPtr->forces.find(jointName) !=
-      this->dataPtr->forces.end())
-  {
-    _rep.mutable_force_optional()->set_data(this->dataPtr->forces[jointName]);
-  }
+  const int index = this->JointIndex(jointName);
+  if (index < 0)
+    return true;
+
+  if (this->dataPtr->hasForce[index])
+    _rep.mutable_force_optional()->set_data(this->dataPtr->forces[index]);
 
-  if (this->dataPtr->positions.find(jointName) !=
-      this->dataPtr->positions.end())
+  if (this->dataPtr->hasPosition[index])
   {
     _rep.mutable_position()->mutable_target_optional()->set_data(
-        this->dataPtr->positions[jointName]);
+        this->dataPtr->positions[index]);
   }
 
-  if (this->dataPtr->velocities.find(jointName) !=
-      this->dataPtr->velocities.end())
+  if (this->dataPtr->hasVelocity[index])
   {
     _rep.mutable_velocity()->mutable_target_optional()->set_data(
-        this->dataPtr->velocities[jointName]);
+        this->dataPtr->velocities[index]);
   }
 
-  if (this->dataPtr->posPids.find(jointName) !=
-      this->dataPtr->posPids.end())
-  {
-    _rep.mutable_position()->mutable_p_gain_optional()->set_data(
-        this->dataPtr->posPids[jointName].GetPGain());
-    _rep.mutable_position()->mutable_d_gain_optional()->set_data(
-        this->dataPtr->posPids[jointName].GetDGain());
-    _rep.mutable_position()->mutable_i_gain_optional()->set_data(
-        this->dataPtr->posPids[jointName].GetIGain());
-  }
+  _rep.mutable_position()->mutable_p_gain_optional()->set_data(
+      this->dataPtr->posPids.Get(index).GetPGain());
+  _rep.mutable_position()->mutable_d_gain_optional()->set_data(
+      this->dataPtr->posPids.Get(index).GetDGain());
+  _rep.mutable_position()->mutable_i_gain_optional()->set_data(
+      this->dataPtr->posPids.Get(index).GetIGain());
 
-  if (this->dataPtr->velPids.find(jointName) !=
-      this->dataPtr->velPids.end())
-  {
-    _rep.mutable_velocity()->mutable_p_gain_optional()->set_data(
-        this->dataPtr->velPids[jointName].GetPGain());
-    _rep.mutable_velocity()->mutable_d_gain_optional()->set_data(
-        this->dataPtr->velPids[jointName].GetDGain());
-    _rep.mutable_velocity()->mutable_i_gain_optional()->set_data(
-        this->dataPtr->velPids[jointName].GetIGain());
-  }
+  _rep.mutable_velocity()->mutable_p_gain_optional()->set_data(
+      this->dataPtr->velPids.Get(index).GetPGain());
+  _rep.mutable_velocity()->mutable_d_gain_optional()->set_data(
+      this->dataPtr->velPids.Get(index).GetDGain());
+  _rep.mutable_velocity()->mutable_i_gain_optional()->set_data(
+      this->dataPtr->velPids.Get(index).GetIGain());
 
   return true;
 }
 
 /////////////////////////////////////////////////
-void JointController::OnJointCommand(const ignition::msgs::JointCmd &_msg)
+/// \brief Apply the optional fields of a joint PID message to a controller.
+/// \param[in] _msg Message with the new values.
+/// \param[in] _index Index of the controller.
+/// \param[in,out] _pids Controllers to update.
+static void setPidFields(const ignition::msgs::PID &_msg,
+    const unsigned int _index, JointPidList &_pids)
 {
-  std::map<std::string, JointPtr>::iterator iter;
-  iter = this->dataPtr->joints.find(_msg.name());
-  if (iter != this->dataPtr->joints.end())
-  {
-    if (_msg.reset())
-    {
-      if (this->dataPtr->forces.find(_msg.name()) !=
-          this->dataPtr->forces.end())
-      {
-        this->dataPtr->forces.erase(this->dataPtr->forces.find(_msg.name()));
-      }
+  common::PID &pid = _pids.pids[_index];
 
-      if (this->dataPtr->positions.find(_msg.name()) !=
-          this->dataPtr->positions.end())
-      {
-        this->dataPtr->positions.erase(
-            this->dataPtr->positions.find(_msg.name()));
-      }
+  if (_msg.has_p_gain_optional())
+    pid.SetPGain(_msg.p_gain_optional().data());
 
-      if (this->dataPtr->velocities.find(_msg.name()) !=
-          this->dataPtr->velocities.end())
-      {
-        this->dataPtr->velocities.erase(
-            this->dataPtr->velocities.find(_msg.name()));
-      }
-    }
+  if (_msg.has_i_gain_optional())
+    pid.SetIGain(_msg.i_gain_optional().data());
 
-    if (_msg.has_force_optional())
-      this->dataPtr->forces[_msg.name()] = _msg.force_optional().data();
+  if (_msg.has_d_gain_optional())
+    pid.SetDGain(_msg.d_gain_optional().data());
 
-    if (_msg.has_position())
-    {
-      if (_msg.position().has_target_optional())
-      {
-        if (!this->SetPositionTarget(_msg.name(),
-            _msg.position().target_optional().data()))
-        {
-          gzerr << "Unable to set position target for joint["
-            << _msg.name() << "]. Joint is not found.\n";
-        }
-      }
-
-      if (_msg.position().has_p_gain_optional())
-      {
-        this->dataPtr->posPids[_msg.name()].SetPGain(
-            _msg.position().p_gain_optional().data());
-      }
+  if (_msg.has_i_max_optional())
+    pid.SetIMax(_msg.i_max_optional().data());
 
-      if (_msg.position().has_i_gain_optional())
-      {
-        this->dataPtr->posPids[_msg.name()].SetIGain(
-            _msg.position().i_gain_optional().data());
-      }
-
-      if (_msg.position().has_d_gain_optional())
-      {
-        this->dataPtr->posPids[_msg.name()].SetDGain(
-            _msg.position().d_gain_optional().data());
-      }
+  if (_msg.has_i_min_optional())
+    pid.SetIMin(_msg.i_min_optional().data());
 
-      if (_msg.position().has_i_max_optional())
-      {
-        this->dataPtr->posPids[_msg.name()].SetIMax(
-            _msg.position().i_max_optional().data());
-      }
-
-      if (_msg.position().has_i_min_optional())
-      {
-        this->dataPtr->posPids[_msg.name()].SetIMin(
-            _msg.position().i_min_optional().data());
-      }
-
-      if (_msg.position().has_limit_optional())
-      {
-        this->dataPtr->posPids[_msg.name()].SetCmdMax(
-            _msg.position().limit_optional().data());
-        this->dataPtr->posPids[_msg.name()].SetCmdMin(
-            -_msg.position().limit_optional().data());
-      }
-    }
+  if (_msg.has_limit_optional())
+  {
+    pid.SetCmdMax(_msg.limit_optional().data());
+    pid.SetCmdMin(-_msg.limit_optional().data());
+  }
+}
 
-    if (_msg.has_velocity())
-    {
-      if (_msg.velocity().has_target_optional())
-      {
-        if (!this->SetVelocityTarget(_msg.name(),
-            _msg.velocity().target_optional().data()))
-        {
-          gzerr << "Unable to set velocity target for joint["
-            << _msg.name() << "]. Joint is not found.\n";
-        }
-      }
+/////////////////////////////////////////////////
+void JointController::OnJointCommand(const ignition::msgs::JointCmd &_msg)
+{
+  const int index = this->JointIndex(_msg.name());
+  if (index < 0)
+  {
+    gzerr << "Unable to find joint[" << _msg.name() << "]\n";
+    return;
+  }
 
-      if (_msg.velocity().has_p_gain_optional())
-      {
-        this->dataPtr->velPids[_msg.name()].SetPGain(
-            _msg.velocity().p_gain_optional().data());
-      }
+  if (_msg.reset())
+  {
+    setFlag(this->dataPtr->hasForce, this->dataPtr->forceCount, index,
+        false);
+    setFlag(this->dataPtr->hasPosition, this->dataPtr->positionCount, index,
+        false);
+    setFlag(this->dataPtr->hasVelocity, this->dataPtr->velocityCount, index,
+        false);
+  }
 
-      if (_msg.velocity().has_i_gain_optional())
-      {
-        this->dataPtr->velPids[_msg.name()].SetIGain(
-            _msg.velocity().i_gain_optional().data());
-      }
+  if (_msg.has_force_optional())
+    this->SetForce(index, _msg.force_optional().data());
 
-      if (_msg.velocity().has_d_gain_optional())
-      {
-        this->dataPtr->velPids[_msg.name()].SetDGain(
-            _msg.velocity().d_gain_optional().data());
-      }
+  if (_msg.has_position())
+  {
+    if (_msg.position().has_target_optional())
+      this->SetPositionTarget(index, _msg.position().target_optional().data());
 
-      if (_msg.velocity().has_i_max_optional())
-      {
-        this->dataPtr->velPids[_msg.name()].SetIMax(
-            _msg.velocity().i_max_optional().data());
-      }
+    setPidFields(_msg.position(), index, this->dataPtr->posPids);
+  }
 
-      if (_msg.velocity().has_i_min_optional())
-      {
-        this->dataPtr->velPids[_msg.name()].SetIMin(
-            _msg.velocity().i_min_optional().data());
-      }
+  if (_msg.has_velocity())
+  {
+    if (_msg.velocity().has_target_optional())
+      this->SetVelocityTarget(index, _msg.velocity().target_optional().data());
 
-      if (_msg.velocity().has_limit_optional())
-      {
-        this->dataPtr->velPids[_msg.name()].SetCmdMax(
-            _msg.velocity().limit_optional().data());
-        this->dataPtr->velPids[_msg.name()].SetCmdMin(
-            -_msg.velocity().limit_optional().data());
-      }
-    }
+    setPidFields(_msg.velocity(), index, this->dataPtr->velPids);
   }
-  else
-    gzerr << "Unable to find joint[" << _msg.name() << "]\n";
 }
 
 //////////////////////////////////////////////////
 void JointController::SetJointPosition(const std::string & _name,
                                        double _position, int _index)
 {
-  std::map<std::string, JointPtr>::iterator jiter =
-    this->dataPtr->joints.find(_name);
-
-  if (jiter != this->dataPtr->joints.end())
-    this->SetJointPosition(jiter->second, _position, _index);
+  const int index = this->JointIndex(_name);
+  if (index >= 0)
+    this->SetJointPosition(this->dataPtr->joints[index], _position, _index);
   else
     gzwarn << "SetJointPosition [" << _name << "] not found\n";
 }
@@ -392,24 +460,22 @@ void JointController::SetJointPositions(
 {
   // go through all joints in this model and update each one
   //   for each joint update, recursively update all children
-  std::map<std::string, JointPtr>::iterator iter;
   std::map<std::string, double>::const_iterator jiter;
 
-  for (iter = this->dataPtr->joints.begin();
-      iter != this->dataPtr->joints.end(); ++iter)
+  for (auto const &joint : this->dataPtr->joints)
   {
     // First try name without scope, i.e. joint_name
-    jiter = _jointPositions.find(iter->second->GetName());
+    jiter = _jointPositions.find(joint->GetName());
 
     if (jiter == _jointPositions.end())
     {
       // Second try name with scope, i.e. model_name::joint_name
-      jiter = _jointPositions.find(iter->second->GetScopedName());
+      jiter = _jointPositions.find(joint->GetScopedName());
       if (jiter == _jointPositions.end())
         continue;
     }
 
-    this->SetJointPosition(iter->second, jiter->second);
+    this->SetJointPosition(joint, jiter->second);
   }
 }
 
@@ -429,48 +495,58 @@ common::Time JointController::GetLastUpdateTime() const
 /////////////////////////////////////////////////
 std::map<std::string, JointPtr> JointController::GetJoints() const
 {
-  return this->dataPtr->joints;
+  std::map<std::string, JointPtr> result;
+  for (auto const &index : this->dataPtr->jointIndices)
+    result[index.first] = this->dataPtr->joints[index.second];
+  return result;
 }
 
 /////////////////////////////////////////////////
 std::map<std::string, common::PID> JointController::GetPositionPIDs() const
 {
-  return this->dataPtr->posPids;
+  std::map<std::string, common::PID> result;
+  for (auto const &index : this->dataPtr->jointIndices)
+    result.emplace(index.first, this->dataPtr->posPids.Get(index.second));
+  return result;
 }
 
 /////////////////////////////////////////////////
 std::map<std::string, common::PID> JointController::GetVelocityPIDs() const
 {
-  return this->dataPtr->velPids;
+  std::map<std::string, common::PID> result;
+  for (auto const &index : this->dataPtr->jointIndices)
+    result.emplace(index.first, this->dataPtr->velPids.Get(index.second));
+  return result;
 }
 
 /////////////////////////////////////////////////
 std::map<std::string, double> JointController::GetForces() const
 {
-  return this->dataPtr->forces;
+  return toMap(this->dataPtr->jointIndices, this->dataPtr->forces,
+      this->dataPtr->hasForce);
 }
 
 /////////////////////////////////////////////////
 std::map<std::string, double> JointController::GetPositions() const
 {
-  return this->dataPtr->positions;
+  return toMap(this->dataPtr->jointIndices, this->dataPtr->positions,
+      this->dataPtr->hasPosition);
 }
 
 /////////////////////////////////////////////////
 std::map<std::string, double> JointController::GetVelocities() const
 {
-  return this->dataPtr->velocities;
+  return toMap(this->dataPtr->jointIndices, this->dataPtr->velocities,
+      this->dataPtr->hasVelocity);
 }
 
 //////////////////////////////////////////////////
 void JointController::SetPositionPID(const std::string &_jointName,
                                      const common::PID &_pid)
 {
-  std::map<std::string, JointPtr>::iterator iter;
-  iter = this->dataPtr->joints.find(_jointName);
-
-  if (iter != this->dataPtr->joints.end())
-    this->dataPtr->posPids[_jointName] = _pid;
+  const int index = this->JointIndex(_jointName);
+  if (index >= 0)
+    this->dataPtr->posPids.Set(index, _pid);
   else
     gzerr << "Unable to find joint with name[" << _jointName << "]\n";
 }
@@ -479,27 +555,17 @@ void JointController::SetPositionPID(const std::string &_jointName,
 bool JointController::SetPositionTarget(const std::string &_jointName,
     const double _target)
 {
-  bool result = false;
-
-  if (this->dataPtr->posPids.find(_jointName) !=
-      this->dataPtr->posPids.end())
-  {
-    this->dataPtr->positions[_jointName] = _target;
-    result = true;
-  }
-
-  return result;
+  const int index = this->JointIndex(_jointName);
+  return index >= 0 && this->SetPositionTarget(index, _target);
 }
 
 //////////////////////////////////////////////////
 void JointController::SetVelocityPID(const std::string &_jointName,
                                      const common::PID &_pid)
 {
-  std::map<std::string, JointPtr>::iterator iter;
-  iter = this->dataPtr->joints.find(_jointName);
-
-  if (iter != this->dataPtr->joints.end())
-    this->dataPtr->velPids[_jointName] = _pid;
+  const int index = this->JointIndex(_jointName);
+  if (index >= 0)
+    this->dataPtr->velPids.Set(index, _pid);
   else
     gzerr << "Unable to find joint with name[" << _jointName << "]\n";
 }
@@ -508,30 +574,125 @@ void JointController::SetVelocityPID(const std::string &_jointName,
 bool JointController::SetVelocityTarget(const std::string &_jointName,
     const double _target)
 {
-  bool result = false;
+  const int index = this->JointIndex(_jointName);
+  return index >= 0 && this->SetVelocityTarget(index, _target);
+}
+
+/////////////////////////////////////////////////
+bool JointController::SetForce(const std::string &_jointName,
+    const double _force)
+{
+  const int index = this->JointIndex(_jointName);
+  return index >= 0 && this->SetForce(index, _force);
+}
+
+/////////////////////////////////////////////////
+int JointController::JointIndex(const std::string &_jointName) const
+{
+  auto iter = this->dataPtr->jointIndices.find(_jointName);
+  if (iter == this->dataPtr->jointIndices.end())
+    return -1;
+  return static_cast<int>(iter->second);
+}
+
+/////////////////////////////////////////////////
+unsigned int JointController::JointCount() const
+{
+  return this->dataPtr->joints.size();
+}
+
+/////////////////////////////////////////////////
+JointPtr JointController::JointByIndex(const unsigned int _index) const
+{
+  if (_index >= this->dataPtr->joints.size())
+    return JointPtr();
+  return this->dataPtr->joints[_index];
+}
+
+/////////////////////////////////////////////////
+bool JointController::SetPositionTarget(const unsigned int _index,
+    const double _target)
+{
+  if (_index >= this->dataPtr->joints.size())
+    return false;
+
+  this->dataPtr->positions[_index] = _target;
+  setFlag(this->dataPtr->hasPosition, this->dataPtr->positionCount, _index,
+      true);
+  return true;
+}
+
+/////////////////////////////////////////////////
+bool JointController::SetVelocityTarget(const unsigned int _index,
+    const double _target)
+{
+  if (_index >= this->dataPtr->joints.size())
+    return false;
 
-  if (this->dataPtr->velPids.find(_jointName) !=
-      this->dataPtr->velPids.end())
+  this->dataPtr->velocities[_index] = _target;
+  setFlag(this->dataPtr->hasVelocity, this->dataPtr->velocityCount, _index,
+      true);
+  return true;
+}
+
+/////////////////////////////////////////////////
+bool JointController::SetForce(const unsigned int _index, const double _force)
+{
+  if (_index >= this->dataPtr->joints.size())
+    return false;
+
+  this->dataPtr->forces[_index] = _force;
+  setFlag(this->dataPtr->hasForce, this->dataPtr->forceCount, _index, true);
+  return true;
+}
+
+/////////////////////////////////////////////////
+bool JointController::SetPositionTargets(const std::vector<double> &_targets)
+{
+  if (_targets.size() != this->dataPtr->joints.size())
   {
-    this->dataPtr->velocities[_jointName] = _target;
-    result = true;
+    gzerr << "Expected " << this->dataPtr->joints.size()
+      << " position targets, got " << _targets.size() << "\n";
+    return false;
   }
 
-  return result;
+  this->dataPtr->positions = _targets;
+  std::fill(this->dataPtr->hasPosition.begin(),
+      this->dataPtr->hasPosition.end(), 1);
+  this->dataPtr->positionCount = _targets.size();
+  return true;
 }
 
 /////////////////////////////////////////////////
-bool JointController::SetForce(const std::string &_jointName,
-    const double _force)
+bool JointController::SetVelocityTargets(const std::vector<double> &_targets)
 {
-  bool result = false;
+  if (_targets.size() != this->dataPtr->joints.size())
+  {
+    gzerr << "Expected " << this->dataPtr->joints.size()
+      << " velocity targets, got " << _targets.size() << "\n";
+    return false;
+  }
 
-  if (this->dataPtr->joints.find(_jointName) !=
-      this->dataPtr->joints.end())
+  this->dataPtr->velocities = _targets;
+  std::fill(this->dataPtr->hasVelocity.begin(),
+      this->dataPtr->hasVelocity.end(), 1);
+  this->dataPtr->velocityCount = _targets.size();
+  return true;
+}
+
+/////////////////////////////////////////////////
+bool JointController::SetForces(const std::vector<double> &_forces)
+{
+  if (_forces.size() != this->dataPtr->joints.size())
   {
-    this->dataPtr->forces[_jointName] = _force;
-    result = true;
+    gzerr << "Expected " << this->dataPtr->joints.size()
+      << " forces, got " << _forces.size() << "\n";
+    return false;
   }
 
-  return result;
+  this->dataPtr->forces = _forces;
+  std::fill(this->dataPtr->hasForce.begin(),
+      this->dataPtr->hasForce.end(), 1);
+  this->dataPtr->forceCount = _forces.size();
+  return true;
 }
@@ -141,6 +141,59 @@ namespace gazebo
       /// set by the user of the JointController.
       public: std::map<std::string, double> GetVelocities() const;
 
+      /// \brief Get the index of a joint. Joints are stored in the order
+      /// they were added, and the index can be used to set targets without
+      /// looking up names. Indices of the following joints shift down when
+      /// a joint is removed.
+      /// \param[in] _jointName Scoped name of the joint.
+      /// \return Index of the joint, or -1 if the joint was not found.
+      public: int JointIndex(const std::string &_jointName) const;
+
+      /// \brief Get the number of controlled joints.
+      /// \return Number of joints.
+      public: unsigned int JointCount() const;
+
+      /// \brief Get a joint by index.
+      /// \param[in] _index Index of the joint.
+      /// \return The joint, or NULL if the index is out of range.
+      public: JointPtr JointByIndex(const unsigned int _index) const;
+
+      /// \brief Set the target position for the position PID controller.
+      /// \param[in] _index Index of the joint, see JointIndex.
+      /// \param[in] _target Position target.
+      /// \return False if the index is out of range.
+      public: bool SetPositionTarget(const unsigned int _index,
+                  const double _target);
+
+      /// \brief Set the target velocity for the velocity PID controller.
+      /// \param[in] _index Index of the joint, see JointIndex.
+      /// \param[in] _target Velocity target.
+      /// \return False if the index is out of range.
+      public: bool SetVelocityTarget(const unsigned int _index,
+                  const double _target);
+
+      /// \brief Set the applied effort for a joint.
+      /// This force will persist across time steps.
+      /// \param[in] _index Index of the joint, see JointIndex.
+      /// \param[in] _force Force to apply.
+      /// \return False if the index is out of range.
+      public: bool SetForce(const unsigned int _index, const double _force);
+
+      /// \brief Set the position targets of all joints.
+      /// \param[in] _targets One target per joint, in index order.
+      /// \return False if the size does not match JointCount.
+      public: bool SetPositionTargets(const std::vector<double> &_targets);
+
+      /// \brief Set the velocity targets of all joints.
+      /// \param[in] _targets One target per joint, in index order.
+      /// \return False if the size does not match JointCount.
+      public: bool SetVelocityTargets(const std::vector<double> &_targets);
+
+      /// \brief Set the applied efforts of all joints.
+      /// \param[in] _forces One force per joint, in index order.
+      /// \return False if the size does not match JointCount.
+      public: bool SetForces(const std::vector<double> &_forces);
+
       /// \brief Callback for service to request the current control parameters.
       /// \param[in] _req The service request. The service expects a joint
       /// name.
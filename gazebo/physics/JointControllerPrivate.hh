@@ -17,8 +17,10 @@
 #ifndef _GAZEBO_JOINTCONTROLLER_PRIVATE_HH_
 #define _GAZEBO_JOINTCONTROLLER_PRIVATE_HH_
 
+#include <cstdint>
 #include <string>
 #include <map>
+#include <vector>
 #include <ignition/transport.hh>
 
 #include "gazebo/transport/TransportTypes.hh"
@@ -30,6 +32,48 @@ namespace gazebo
 {
   namespace physics
   {
+    /// \brief The PID controllers of a model, stored by joint index
+    /// instead of by joint name. Each controller is a plain common::PID,
+    /// which holds its own gains and state.
+    class JointPidList
+    {
+      /// \brief Resize the list. New controllers use the default gains
+      /// of the joint controller.
+      /// \param[in] _size New number of controllers.
+      public: void Resize(const size_t _size);
+
+      /// \brief Remove a controller, shifting the following ones.
+      /// \param[in] _index Index of the controller.
+      public: void Erase(const size_t _index);
+
+      /// \brief Copy the gains and limits of a PID, and reset the state, as
+      /// common::PID::operator= does.
+      /// \param[in] _index Index of the controller.
+      /// \param[in] _pid PID to copy.
+      public: void Set(const size_t _index, const common::PID &_pid);
+
+      /// \brief Get a controller, with its current command and errors.
+      /// \param[in] _index Index of the controller.
+      /// \return The controller.
+      public: const common::PID &Get(const size_t _index) const;
+
+      /// \brief Reset the state of all controllers.
+      public: void Reset();
+
+      /// \brief Call common::PID::Update on each controller whose mask is
+      /// set. The state of the other controllers is left untouched.
+      /// \param[in] _errors Error of each controller.
+      /// \param[in] _mask 1 for controllers to update, 0 otherwise.
+      /// \param[in] _dt Time step, must be positive.
+      /// \param[out] _cmds Command of each controller, 0 for the controllers
+      /// that weren't updated.
+      public: void Update(const double *_errors, const uint8_t *_mask,
+                          const common::Time &_dt, double *_cmds);
+
+      /// \brief The controllers, in index order.
+      public: std::vector<common::PID> pids;
+    };
+
     class JointControllerPrivate
     {
       /// \brief Model to control.
@@ -38,23 +82,52 @@ namespace gazebo
       /// \brief List of links that have been updated.
       public: Link_V updatedLinks;
 
-      /// \brief Map of joint names to the joint pointer.
-      public: std::map<std::string, JointPtr> joints;
+      /// \brief Map of joint names to the index of the joint in the
+      /// arrays below.
+      public: std::map<std::string, unsigned int> jointIndices;
+
+      /// \brief Controlled joints, in index order.
+      public: Joint_V joints;
+
+      /// \brief Position PID controllers, in index order.
+      public: JointPidList posPids;
+
+      /// \brief Velocity PID controllers, in index order.
+      public: JointPidList velPids;
+
+      /// \brief Forces applied to joints, in index order.
+      public: std::vector<double> forces;
+
+      /// \brief 1 if a force is applied to the joint.
+      public: std::vector<uint8_t> hasForce;
+
+      /// \brief Joint position targets, in index order.
+      public: std::vector<double> positions;
+
+      /// \brief 1 if the joint has a position target.
+      public: std::vector<uint8_t> hasPosition;
+
+      /// \brief Joint velocity targets, in index order.
+      public: std::vector<double> velocities;
+
+      /// \brief 1 if the joint has a velocity target.
+      public: std::vector<uint8_t> hasVelocity;
 
-      /// \brief Position PID controllers.
-      public: std::map<std::string, common::PID> posPids;
+      /// \brief Number of set entries in hasForce, hasPosition and
+      /// hasVelocity, to skip empty passes quickly.
+      public: unsigned int forceCount = 0;
 
-      /// \brief Velocity PID controllers.
-      public: std::map<std::string, common::PID> velPids;
+      /// \brief Number of joints with a position target.
+      public: unsigned int positionCount = 0;
 
-      /// \brief Forces applied to joints.
-      public: std::map<std::string, double> forces;
+      /// \brief Number of joints with a velocity target.
+      public: unsigned int velocityCount = 0;
 
-      /// \brief Joint positions.
-      public: std::map<std::string, double> positions;
+      /// \brief Scratch buffer for errors, reused across updates.
+      public: std::vector<double> errors;
 
-      /// \brief Joint velocities.
-      public: std::map<std::string, double> velocities;
+      /// \brief Scratch buffer for commands, reused across updates.
+      public: std::vector<double> cmds;
 
       /// \brief Node for communication.
       /// \deprecated See JointControllerPrivate::node.
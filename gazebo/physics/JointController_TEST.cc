@@ -280,6 +280,106 @@ TEST_F(JointControllerTest, SetJointPositions)
   EXPECT_NO_THROW(jointController->SetJointPositions(positions));
 }
 
+/////////////////////////////////////////////////
+TEST_F(JointControllerTest, JointIndex)
+{
+  // Create a dummy model
+  physics::ModelPtr model(new physics::Model(physics::BasePtr()));
+  EXPECT_TRUE(model != NULL);
+
+  // Create the joint controller
+  physics::JointControllerPtr jointController(
+      new physics::JointController(model));
+  EXPECT_TRUE(jointController != NULL);
+
+  std::vector<physics::JointPtr> joints;
+  for (auto const &name : {"joint0", "joint1", "joint2"})
+  {
+    physics::JointPtr joint(new FakeJoint(model));
+    joint->SetName(name);
+    jointController->AddJoint(joint);
+    joints.push_back(joint);
+  }
+
+  // Joints are indexed in the order they were added
+  EXPECT_EQ(jointController->JointCount(), 3u);
+  for (unsigned int i = 0; i < joints.size(); ++i)
+  {
+    EXPECT_EQ(jointController->JointIndex(joints[i]->GetScopedName()),
+        static_cast<int>(i));
+    EXPECT_EQ(jointController->JointByIndex(i), joints[i]);
+  }
+  EXPECT_EQ(jointController->JointIndex("my_bad_name"), -1);
+  EXPECT_TRUE(jointController->JointByIndex(3) == NULL);
+
+  // Adding a joint again keeps its index
+  jointController->AddJoint(joints[1]);
+  EXPECT_EQ(jointController->JointCount(), 3u);
+  EXPECT_EQ(jointController->JointIndex(joints[1]->GetScopedName()), 1);
+
+  // Set targets by index
+  EXPECT_TRUE(jointController->SetPositionTarget(0u, 1.5));
+  EXPECT_TRUE(jointController->SetVelocityTarget(1u, -2.5));
+  EXPECT_TRUE(jointController->SetForce(2u, 3.5));
+  EXPECT_FALSE(jointController->SetPositionTarget(3u, 1.0));
+  EXPECT_FALSE(jointController->SetVelocityTarget(3u, 1.0));
+  EXPECT_FALSE(jointController->SetForce(3u, 1.0));
+
+  std::map<std::string, double> positions = jointController->GetPositions();
+  EXPECT_EQ(positions.size(), 1u);
+  EXPECT_DOUBLE_EQ(positions[joints[0]->GetScopedName()], 1.5);
+
+  std::map<std::string, double> velocities =
+    jointController->GetVelocities();
+  EXPECT_EQ(velocities.size(), 1u);
+  EXPECT_DOUBLE_EQ(velocities[joints[1]->GetScopedName()], -2.5);
+
+  std::map<std::string, double> forces = jointController->GetForces();
+  EXPECT_EQ(forces.size(), 1u);
+  EXPECT_DOUBLE_EQ(forces[joints[2]->GetScopedName()], 3.5);
+
+  // Set the targets of all joints at once
+  EXPECT_FALSE(jointController->SetPositionTargets({1.0, 2.0}));
+  EXPECT_FALSE(jointController->SetVelocityTargets({1.0, 2.0, 3.0, 4.0}));
+  EXPECT_FALSE(jointController->SetForces({}));
+  EXPECT_TRUE(jointController->SetPositionTargets({0.1, 0.2, 0.3}));
+  EXPECT_TRUE(jointController->SetVelocityTargets({1.1, 1.2, 1.3}));
+  EXPECT_TRUE(jointController->SetForces({2.1, 2.2, 2.3}));
+
+  positions = jointController->GetPositions();
+  velocities = jointController->GetVelocities();
+  forces = jointController->GetForces();
+  EXPECT_EQ(positions.size(), 3u);
+  EXPECT_EQ(velocities.size(), 3u);
+  EXPECT_EQ(forces.size(), 3u);
+  EXPECT_DOUBLE_EQ(positions[joints[2]->GetScopedName()], 0.3);
+  EXPECT_DOUBLE_EQ(velocities[joints[0]->GetScopedName()], 1.1);
+  EXPECT_DOUBLE_EQ(forces[joints[1]->GetScopedName()], 2.2);
+
+  // Removing a joint shifts the index of the following joints, and keeps
+  // their targets
+  jointController->SetPositionPID(joints[2]->GetScopedName(),
+      common::PID(4, 1, 9));
+  jointController->RemoveJoint(joints[1].get());
+  EXPECT_EQ(jointController->JointCount(), 2u);
+  EXPECT_EQ(jointController->JointIndex(joints[1]->GetScopedName()), -1);
+  EXPECT_EQ(jointController->JointIndex(joints[2]->GetScopedName()), 1);
+  EXPECT_EQ(jointController->JointByIndex(1), joints[2]);
+
+  positions = jointController->GetPositions();
+  EXPECT_EQ(positions.size(), 2u);
+  EXPECT_DOUBLE_EQ(positions[joints[2]->GetScopedName()], 0.3);
+  EXPECT_DOUBLE_EQ(jointController->GetPositionPIDs()[
+      joints[2]->GetScopedName()].GetPGain(), 4);
+
+  // Reset clears all targets
+  jointController->Reset();
+  EXPECT_TRUE(jointController->GetPositions().empty());
+  EXPECT_TRUE(jointController->GetVelocities().empty());
+  EXPECT_TRUE(jointController->GetForces().empty());
+  EXPECT_EQ(jointController->JointCount(), 2u);
+}
+
 /////////////////////////////////////////////////
 TEST_F(JointControllerTest, JointCmd)
 {
@@ -0,0 +1,798 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <boost/thread/recursive_mutex.hpp>
+#include <ignition/math/AxisAlignedBox.hh>
+#include <ignition/math/Helpers.hh>
+#include <ignition/math/Pose3.hh>
+
+#include "gazebo/common/Mesh.hh"
+#include "gazebo/physics/BoxShape.hh"
+#include "gazebo/physics/Collision.hh"
+#include "gazebo/physics/CylinderShape.hh"
+#include "gazebo/physics/HeightmapShape.hh"
+#include "gazebo/physics/LineOfSight.hh"
+#include "gazebo/physics/Link.hh"
+#include "gazebo/physics/MeshShape.hh"
+#include "gazebo/physics/Model.hh"
+#include "gazebo/physics/PhysicsEngine.hh"
+#include "gazebo/physics/PlaneShape.hh"
+#include "gazebo/physics/PolylineShape.hh"
+#include "gazebo/physics/SpatialIndex.hh"
+#include "gazebo/physics/SphereShape.hh"
+#include "gazebo/physics/World.hh"
+
+namespace gazebo
+{
+  namespace physics
+  {
+    /// \internal
+    /// \brief Triangles of a mesh, a polyline or a heightmap in the frame
+    /// of its collision, in a bounding volume hierarchy.
+    class LineOfSightMesh
+    {
+      /// \brief Node of the hierarchy.
+      public: class Node
+      {
+        /// \brief Minimum corner of the box of the triangles of the node.
+        public: ignition::math::Vector3d min;
+
+        /// \brief Maximum corner of the box of the triangles of the node.
+        public: ignition::math::Vector3d max;
+
+        /// \brief First triangle of a leaf, or second child of an inner
+        /// node. The first child of an inner node follows it.
+        public: unsigned int index = 0;
+
+        /// \brief Number of triangles of a leaf, 0 for an inner node.
+        public: unsigned int count = 0;
+      };
+
+      /// \brief Build the hierarchy.
+      /// \param[in] _vertices Vertices of the triangles, three for each.
+      public: void Build(const std::vector<ignition::math::Vector3d>
+                  &_vertices);
+
+      /// \brief Find where a segment first hits a triangle.
+      /// \param[in] _p Start of the segment.
+      /// \param[in] _d Direction of the segment, from its start to its end.
+      /// \param[out] _t Fraction of the segment where it hits.
+      /// \return False if the segment misses all the triangles.
+      public: bool Intersect(const ignition::math::Vector3d &_p,
+                  const ignition::math::Vector3d &_d, double &_t) const;
+
+      /// \brief Build the node of a range of triangles and its children.
+      /// \param[in] _vertices Vertices of the triangles.
+      /// \param[in] _centroids Centroids of the triangles.
+      /// \param[in,out] _triangles Triangles, reordered by node.
+      /// \param[in] _first First triangle of the range.
+      /// \param[in] _count Number of triangles of the range.
+      /// \return Index of the node.
+      private: unsigned int BuildNode(
+                   const std::vector<ignition::math::Vector3d> &_vertices,
+                   const std::vector<ignition::math::Vector3d> &_centroids,
+                   std::vector<unsigned int> &_triangles,
+                   const unsigned int _first, const unsigned int _count);
+
+      /// \brief Data the triangles were built from, to detect changes.
+      public: const void *source = nullptr;
+
+      /// \brief Scale or size the triangles were built with.
+      public: ignition::math::Vector3d scale;
+
+      /// \brief Vertices of the triangles, three for each, in the order
+      /// of the leaves.
+      public: std::vector<ignition::math::Vector3d> vertices;
+
+      /// \brief Nodes of the hierarchy, the root first.
+      public: std::vector<Node> nodes;
+    };
+
+    /// \internal
+    /// \brief Copy of a collision in a snapshot.
+    class LineOfSightShape
+    {
+      /// \brief Base::BOX_SHAPE, Base::SPHERE_SHAPE, Base::CYLINDER_SHAPE,
+      /// Base::PLANE_SHAPE or Base::MESH_SHAPE for the shapes tested
+      /// against their triangles, 0 to only use the bounding box.
+      public: unsigned int type = 0;
+
+      /// \brief World pose of the collision.
+      public: ignition::math::Pose3d pose;
+
+      /// \brief Half size of a box, radius of a sphere in X, radius and
+      /// half length of a cylinder in X and Z, or normal of a plane.
+      public: ignition::math::Vector3d size;
+
+      /// \brief World bounding box of the collision.
+      public: ignition::math::AxisAlignedBox box;
+
+      /// \brief Triangles of a Base::MESH_SHAPE.
+      public: std::shared_ptr<const LineOfSightMesh> mesh;
+    };
+
+    /// \internal
+    /// \brief Collisions of a world at one revision.
+    class LineOfSightSnapshot
+    {
+      /// \brief Revision of the spatial index.
+      public: uint64_t revision = 0;
+
+      /// \brief The collisions.
+      public: std::vector<LineOfSightShape> shapes;
+    };
+
+    /// \internal
+    /// \brief Private data for the LineOfSight class
+    class LineOfSightPrivate
+    {
+      /// \brief Constructor.
+      /// \param[in] _world World whose collisions are tested.
+      public: explicit LineOfSightPrivate(World &_world)
+              : world(_world)
+      {
+      }
+
+      /// \brief Get a snapshot of the current revision, taking a new one
+      /// if needed.
+      /// \return The snapshot.
+      public: std::shared_ptr<const LineOfSightSnapshot> Snapshot();
+
+      /// \brief Add the collisions of a model and of its nested models.
+      /// \param[in] _model The model.
+      /// \param[out] _snapshot Snapshot to add the collisions to.
+      public: void AddModel(const ModelPtr &_model,
+                  LineOfSightSnapshot &_snapshot);
+
+      /// \brief Get the triangles of a mesh, a polyline or a heightmap,
+      /// reusing the ones of the previous snapshot if it didn't change.
+      /// \param[in] _shape The shape.
+      /// \return The triangles, null if the shape has none.
+      public: std::shared_ptr<const LineOfSightMesh> Mesh(
+                  const ShapePtr &_shape);
+
+      /// \brief World whose collisions are tested.
+      public: World &world;
+
+      /// \brief Latest snapshot.
+      public: std::shared_ptr<const LineOfSightSnapshot> snapshot;
+
+      /// \brief Protects the snapshot pointer.
+      public: std::mutex mutex;
+
+      /// \brief Triangles of the shapes of the latest snapshot. Only used
+      /// under the physics update mutex.
+      public: std::map<const Shape *, std::shared_ptr<const LineOfSightMesh> >
+              meshes;
+
+      /// \brief Triangles of the shapes of the snapshot being taken.
+      public: std::map<const Shape *, std::shared_ptr<const LineOfSightMesh> >
+              nextMeshes;
+    };
+  }
+}
+
+using namespace gazebo;
+using namespace physics;
+
+/// \brief Directions shorter than this are considered null.
+static const double kEpsilon = 1e-12;
+
+/////////////////////////////////////////////////
+/// \brief Clip a segment interval with a slab on one axis.
+/// \param[in] _p Start of the segment on the axis.
+/// \param[in] _d Direction of the segment on the axis.
+/// \param[in] _lo Lower bound of the slab.
+/// \param[in] _hi Upper bound of the slab.
+/// \param[in,out] _t0 Start of the interval.
+/// \param[in,out] _t1 End of the interval.
+/// \return False if the interval is empty.
+static bool clipSlab(const double _p, const double _d, const double _lo,
+    const double _hi, double &_t0, double &_t1)
+{
+  if (std::abs(_d) < kEpsilon)
+    return _p >= _lo && _p <= _hi;
+
+  double a = (_lo - _p) / _d;
+  double b = (_hi - _p) / _d;
+  if (a > b)
+    std::swap(a, b);
+  _t0 = std::max(_t0, a);
+  _t1 = std::min(_t1, b);
+  return _t0 <= _t1;
+}
+
+/////////////////////////////////////////////////
+/// \brief Clip a segment interval with the inside of a quadric
+/// a t^2 + b t + c <= 0.
+/// \param[in] _a Quadratic coefficient, not negative.
+/// \param[in] _b Linear coefficient.
+/// \param[in] _c Constant coefficient.
+/// \param[in,out] _t0 Start of the interval.
+/// \param[in,out] _t1 End of the interval.
+/// \return False if the interval is empty.
+static bool clipQuadric(const double _a, const double _b, const double _c,
+    double &_t0, double &_t1)
+{
+  if (_a < kEpsilon)
+    return _c <= 0;
+
+  const double disc = _b * _b - 4 * _a * _c;
+  if (disc < 0)
+    return false;
+
+  const double root = std::sqrt(disc);
+  _t0 = std::max(_t0, (-_b - root) / (2 * _a));
+  _t1 = std::min(_t1, (-_b + root) / (2 * _a));
+  return _t0 <= _t1;
+}
+
+/////////////////////////////////////////////////
+/// \brief Clip a segment interval with a box.
+/// \param[in] _min Minimum corner of the box.
+/// \param[in] _max Maximum corner of the box.
+/// \param[in] _p Start of the segment.
+/// \param[in] _d Direction of the segment.
+/// \param[in,out] _t0 Start of the interval.
+/// \param[in,out] _t1 End of the interval.
+/// \return False if the interval is empty.
+static bool clipBox(const ignition::math::Vector3d &_min,
+    const ignition::math::Vector3d &_max,
+    const ignition::math::Vector3d &_p, const ignition::math::Vector3d &_d,
+    double &_t0, double &_t1)
+{
+  for (int i = 0; i < 3; ++i)
+  {
+    if (!clipSlab(_p[i], _d[i], _min[i], _max[i], _t0, _t1))
+      return false;
+  }
+  return true;
+}
+
+/////////////////////////////////////////////////
+/// \brief Clip a segment interval with a box.
+/// \param[in] _box The box.
+/// \param[in] _p Start of the segment.
+/// \param[in] _d Direction of the segment.
+/// \param[in,out] _t0 Start of the interval.
+/// \param[in,out] _t1 End of the interval.
+/// \return False if the interval is empty.
+static bool clipBox(const ignition::math::AxisAlignedBox &_box,
+    const ignition::math::Vector3d &_p, const ignition::math::Vector3d &_d,
+    double &_t0, double &_t1)
+{
+  return clipBox(_box.Min(), _box.Max(), _p, _d, _t0, _t1);
+}
+
+/////////////////////////////////////////////////
+/// \brief Find where a segment hits a triangle, from either side.
+/// \param[in] _v The three vertices of the triangle.
+/// \param[in] _p Start of the segment.
+/// \param[in] _d Direction of the segment.
+/// \param[out] _t Fraction of the segment where it hits.
+/// \return False if the segment misses the triangle.
+static bool intersectTriangle(const ignition::math::Vector3d *_v,
+    const ignition::math::Vector3d &_p, const ignition::math::Vector3d &_d,
+    double &_t)
+{
+  const ignition::math::Vector3d e1 = _v[1] - _v[0];
+  const ignition::math::Vector3d e2 = _v[2] - _v[0];
+  const ignition::math::Vector3d h = _d.Cross(e2);
+  const double a = e1.Dot(h);
+  if (std::abs(a) < kEpsilon)
+    return false;
+
+  const double f = 1.0 / a;
+  const ignition::math::Vector3d s = _p - _v[0];
+  const double u = f * s.Dot(h);
+  if (u < 0 || u > 1)
+    return false;
+
+  const ignition::math::Vector3d q = s.Cross(e1);
+  const double v = f * _d.Dot(q);
+  if (v < 0 || u + v > 1)
+    return false;
+
+  _t = f * e2.Dot(q);
+  return _t >= 0 && _t <= 1;
+}
+
+/// \brief Maximum number of triangles in a leaf of a LineOfSightMesh.
+static const unsigned int kLeafSize = 4;
+
+/////////////////////////////////////////////////
+void LineOfSightMesh::Build(
+    const std::vector<ignition::math::Vector3d> &_vertices)
+{
+  const unsigned int count = _vertices.size() / 3;
+  std::vector<ignition::math::Vector3d> centroids(count);
+  std::vector<unsigned int> triangles(count);
+  for (unsigned int i = 0; i < count; ++i)
+  {
+    centroids[i] =
+      (_vertices[i * 3] + _vertices[i * 3 + 1] + _vertices[i * 3 + 2]) / 3.0;
+    triangles[i] = i;
+  }
+
+  this->nodes.clear();
+  if (count > 0)
+    this->BuildNode(_vertices, centroids, triangles, 0, count);
+
+  // Store the vertices in the order of the leaves
+  this->vertices.resize(count * 3);
+  for (unsigned int i = 0; i < count; ++i)
+  {
+    for (unsigned int k = 0; k < 3; ++k)
+      this->vertices[i * 3 + k] = _vertices[triangles[i] * 3 + k];
+  }
+}
+
+/////////////////////////////////////////////////
+unsigned int LineOfSightMesh::BuildNode(
+    const std::vector<ignition::math::Vector3d> &_vertices,
+    const std::vector<ignition::math::Vector3d> &_centroids,
+    std::vector<unsigned int> &_triangles,
+    const unsigned int _first, const unsigned int _count)
+{
+  const unsigned int index = this->nodes.size();
+  this->nodes.emplace_back();
+
+  const ignition::math::Vector3d inf(ignition::math::INF_D,
+      ignition::math::INF_D, ignition::math::INF_D);
+  ignition::math::Vector3d min = inf;
+  ignition::math::Vector3d max = -inf;
+  ignition::math::Vector3d centroidMin = inf;
+  ignition::math::Vector3d centroidMax = -inf;
+  for (unsigned int i = _first; i < _first + _count; ++i)
+  {
+    for (unsigned int k = 0; k < 3; ++k)
+    {
+      min.Min(_vertices[_triangles[i] * 3 + k]);
+      max.Max(_vertices[_triangles[i] * 3 + k]);
+    }
+    centroidMin.Min(_centroids[_triangles[i]]);
+    centroidMax.Max(_centroids[_triangles[i]]);
+  }
+  this->nodes[index].min = min;
+  this->nodes[index].max = max;
+
+  // Split on the longest axis of the centroids
+  const ignition::math::Vector3d extent = centroidMax - centroidMin;
+  int axis = 0;
+  if (extent.Y() > extent[axis])
+    axis = 1;
+  if (extent.Z() > extent[axis])
+    axis = 2;
+
+  if (_count <= kLeafSize || extent[axis] < kEpsilon)
+  {
+    this->nodes[index].index = _first;
+    this->nodes[index].count = _count;
+    return index;
+  }
+
+  const unsigned int middle = _first + _count / 2;
+  std::nth_element(_triangles.begin() + _first, _triangles.begin() + middle,
+      _triangles.begin() + _first + _count,
+      [&_centroids, axis](const unsigned int _a, const unsigned int _b)
+      {
+        return _centroids[_a][axis] < _centroids[_b][axis];
+      });
+
+  this->BuildNode(_vertices, _centroids, _triangles, _first,
+      middle - _first);
+  const unsigned int second = this->BuildNode(_vertices, _centroids,
+      _triangles, middle, _first + _count - middle);
+  this->nodes[index].index = second;
+  return index;
+}
+
+/////////////////////////////////////////////////
+bool LineOfSightMesh::Intersect(const ignition::math::Vector3d &_p,
+    const ignition::math::Vector3d &_d, double &_t) const
+{
+  if (this->nodes.empty())
+    return false;
+
+  // The median splits keep the depth below the number of bits of the
+  // triangle count, and each node pushes at most two children
+  unsigned int stack[64];
+  unsigned int size = 0;
+  stack[size++] = 0;
+
+  double nearest = ignition::math::INF_D;
+  while (size > 0)
+  {
+    const unsigned int index = stack[--size];
+    const Node &node = this->nodes[index];
+
+    double t0 = 0;
+    double t1 = std::min(1.0, nearest);
+    if (!clipBox(node.min, node.max, _p, _d, t0, t1))
+      continue;
+
+    if (node.count > 0)
+    {
+      for (unsigned int i = node.index; i < node.index + node.count; ++i)
+      {
+        double t;
+        if (intersectTriangle(&this->vertices[i * 3], _p, _d, t) &&
+            t < nearest)
+        {
+          nearest = t;
+        }
+      }
+    }
+    else
+    {
+      stack[size++] = node.index;
+      stack[size++] = index + 1;
+    }
+  }
+
+  _t = nearest;
+  return nearest < ignition::math::INF_D;
+}
+
+/////////////////////////////////////////////////
+/// \brief Find where a segment enters a shape.
+/// \param[in] _shape The shape.
+/// \param[in] _p Start of the segment.
+/// \param[in] _d Direction of the segment, from its start to its end.
+/// \param[out] _t Fraction of the segment where it enters the shape.
+/// \return False if the segment misses the shape.
+static bool intersect(const LineOfSightShape &_shape,
+    const ignition::math::Vector3d &_p, const ignition::math::Vector3d &_d,
+    double &_t)
+{
+  double t0 = 0;
+  double t1 = 1;
+
+  if (_shape.type == Base::PLANE_SHAPE)
+  {
+    // The plane is the boundary of a half space, below it is inside
+    const ignition::math::Vector3d normal = _shape.pose.Rot() * _shape.size;
+    const double s = normal.Dot(_p - _shape.pose.Pos());
+    const double ds = normal.Dot(_d);
+    if (!clipSlab(s, ds, -ignition::math::INF_D, 0, t0, t1))
+      return false;
+    _t = t0;
+    return true;
+  }
+
+  // Cheap rejection first
+  if (!clipBox(_shape.box, _p, _d, t0, t1))
+    return false;
+
+  if (_shape.type == 0)
+  {
+    _t = t0;
+    return true;
+  }
+
+  // Segment in the frame of the shape
+  const ignition::math::Vector3d p =
+    _shape.pose.Rot().RotateVectorReverse(_p - _shape.pose.Pos());
+  const ignition::math::Vector3d d = _shape.pose.Rot().RotateVectorReverse(_d);
+
+  t0 = 0;
+  t1 = 1;
+  bool hit = false;
+  if (_shape.type == Base::BOX_SHAPE)
+  {
+    hit = clipBox(ignition::math::AxisAlignedBox(-_shape.size, _shape.size),
+        p, d, t0, t1);
+  }
+  else if (_shape.type == Base::SPHERE_SHAPE)
+  {
+    const double r = _shape.size.X();
+    hit = clipQuadric(d.Dot(d), 2 * p.Dot(d), p.Dot(p) - r * r, t0, t1);
+  }
+  else if (_shape.type == Base::CYLINDER_SHAPE)
+  {
+    const double r = _shape.size.X();
+    hit = clipSlab(p.Z(), d.Z(), -_shape.size.Z(), _shape.size.Z(), t0, t1) &&
+      clipQuadric(d.X() * d.X() + d.Y() * d.Y(),
+          2 * (p.X() * d.X() + p.Y() * d.Y()),
+          p.X() * p.X() + p.Y() * p.Y() - r * r, t0, t1);
+  }
+  else if (_shape.type == Base::MESH_SHAPE)
+  {
+    // Only the surface is hit, segments inside closed meshes don't hit
+    // until they leave them
+    hit = _shape.mesh->Intersect(p, d, t0);
+  }
+
+  _t = t0;
+  return hit;
+}
+
+/////////////////////////////////////////////////
+std::shared_ptr<const LineOfSightMesh> LineOfSightPrivate::Mesh(
+    const ShapePtr &_shape)
+{
+  const void *source = nullptr;
+  ignition::math::Vector3d scale = ignition::math::Vector3d::One;
+  common::SubMesh *submesh = nullptr;
+  const common::Mesh *mesh = nullptr;
+  HeightmapShape *heightmap = nullptr;
+
+  if (_shape->HasType(Base::HEIGHTMAP_SHAPE))
+  {
+    heightmap = static_cast<HeightmapShape *>(_shape.get());
+    if (heightmap->heights.empty())
+      return nullptr;
+    source = heightmap->heights.data();
+    scale = heightmap->Size();
+  }
+  else if (_shape->HasType(Base::POLYLINE_SHAPE))
+  {
+    mesh = static_cast<PolylineShape *>(_shape.get())->mesh;
+    source = mesh;
+  }
+  else if (_shape->HasType(Base::MESH_SHAPE))
+  {
+    MeshShape *meshShape = static_cast<MeshShape *>(_shape.get());
+    submesh = meshShape->submesh;
+    mesh = meshShape->mesh;
+    source = submesh ? static_cast<const void *>(submesh) : mesh;
+    scale = meshShape->Size();
+  }
+
+  if (!source)
+    return nullptr;
+
+  // Reuse the triangles of the previous snapshot
+  auto iter = this->meshes.find(_shape.get());
+  if (iter != this->meshes.end() && iter->second->source == source &&
+      iter->second->scale == scale)
+  {
+    this->nextMeshes[_shape.get()] = iter->second;
+    return iter->second;
+  }
+
+  std::vector<ignition::math::Vector3d> vertices;
+  if (heightmap)
+  {
+    const int count = heightmap->VertexCount().X();
+    const double z = heightmap->Pos().Z();
+    auto vertex = [&](const int _x, const int _y)
+    {
+      // Rows go from +Y to -Y, unless the engine flipped them
+      const double y = _y * scale.Y() / (count - 1);
+      return ignition::math::Vector3d(
+          -scale.X() * 0.5 + _x * scale.X() / (count - 1),
+          heightmap->flipY ? y - scale.Y() * 0.5 : scale.Y() * 0.5 - y,
+          heightmap->GetHeight(_x, _y) + z);
+    };
+
+    for (int y = 0; y + 1 < count; ++y)
+    {
+      for (int x = 0; x + 1 < count; ++x)
+      {
+        for (auto const &corner : {std::make_pair(x, y),
+            std::make_pair(x + 1, y), std::make_pair(x + 1, y + 1),
+            std::make_pair(x, y), std::make_pair(x + 1, y + 1),
+            std::make_pair(x, y + 1)})
+        {
+          vertices.push_back(vertex(corner.first, corner.second));
+        }
+      }
+    }
+  }
+  else
+  {
+    float *vertArray = nullptr;
+    int *indArray = nullptr;
+    unsigned int indCount;
+    if (submesh)
+    {
+      submesh->FillArrays(&vertArray, &indArray);
+      indCount = submesh->GetIndexCount();
+    }
+    else
+    {
+      mesh->FillArrays(&vertArray, &indArray);
+      indCount = mesh->GetIndexCount();
+    }
+
+    vertices.resize(indCount - indCount % 3);
+    for (unsigned int i = 0; i < vertices.size(); ++i)
+    {
+      const int index = indArray[i];
+      vertices[i].Set(vertArray[index * 3] * scale.X(),
+          vertArray[index * 3 + 1] * scale.Y(),
+          vertArray[index * 3 + 2] * scale.Z());
+    }
+    delete [] vertArray;
+    delete [] indArray;
+  }
+
+  auto result = std::make_shared<LineOfSightMesh>();
+  result->source = source;
+  result->scale = scale;
+  result->Build(vertices);
+
+  this->nextMeshes[_shape.get()] = result;
+  return result;
+}
+
+/////////////////////////////////////////////////
+void LineOfSightPrivate::AddModel(const ModelPtr &_model,
+    LineOfSightSnapshot &_snapshot)
+{
+  for (auto const &link : _model->GetLinks())
+  {
+    for (auto const &collision : link->GetCollisions())
+    {
+      const unsigned int type = collision->GetShapeType();
+      if (type & (Base::RAY_SHAPE | Base::MULTIRAY_SHAPE))
+        continue;
+
+      LineOfSightShape shape;
+      shape.pose = collision->WorldPose();
+      shape.box = collision->BoundingBox();
+
+      ShapePtr collisionShape = collision->GetShape();
+      if (type & Base::BOX_SHAPE)
+      {
+        shape.type = Base::BOX_SHAPE;
+        shape.size = boost::static_pointer_cast<BoxShape>(
+            collisionShape)->Size() * 0.5;
+      }
+      else if (type & Base::SPHERE_SHAPE)
+      {
+        shape.type = Base::SPHERE_SHAPE;
+        shape.size.X(boost::static_pointer_cast<SphereShape>(
+              collisionShape)->GetRadius());
+      }
+      else if (type & Base::CYLINDER_SHAPE)
+      {
+        auto cylinder = boost::static_pointer_cast<CylinderShape>(
+            collisionShape);
+        shape.type = Base::CYLINDER_SHAPE;
+        shape.size.Set(cylinder->GetRadius(), 0, cylinder->GetLength() * 0.5);
+      }
+      else if (type & Base::PLANE_SHAPE)
+      {
+        shape.type = Base::PLANE_SHAPE;
+        shape.size = boost::static_pointer_cast<PlaneShape>(
+            collisionShape)->Normal().Normalize();
+      }
+      else if (type & (Base::MESH_SHAPE | Base::POLYLINE_SHAPE |
+            Base::HEIGHTMAP_SHAPE))
+      {
+        shape.mesh = this->Mesh(collisionShape);
+        if (shape.mesh)
+          shape.type = Base::MESH_SHAPE;
+      }
+
+      const bool validBox = shape.box.Min().X() <= shape.box.Max().X() &&
+        shape.box.Min().Y() <= shape.box.Max().Y() &&
+        shape.box.Min().Z() <= shape.box.Max().Z();
+      if (!validBox)
+      {
+        // Shapes only approximated by their box can't be tested, the others
+        // are tested without the cheap rejection
+        if (shape.type == 0)
+          continue;
+        shape.box = ignition::math::AxisAlignedBox(
+            -ignition::math::Vector3d(ignition::math::INF_D,
+              ignition::math::INF_D, ignition::math::INF_D),
+            ignition::math::Vector3d(ignition::math::INF_D,
+              ignition::math::INF_D, ignition::math::INF_D));
+      }
+
+      _snapshot.shapes.push_back(shape);
+    }
+  }
+
+  for (auto const &nested : _model->NestedModels())
+    AddModel(nested, _snapshot);
+}
+
+/////////////////////////////////////////////////
+std::shared_ptr<const LineOfSightSnapshot> LineOfSightPrivate::Snapshot()
+{
+  const uint64_t revision = this->world.SpatialIndex()->Revision();
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    if (this->snapshot && this->snapshot->revision == revision)
+      return this->snapshot;
+  }
+
+  auto next = std::make_shared<LineOfSightSnapshot>();
+  {
+    // The index is refreshed under the same mutex, so the revision
+    // matches the collected poses
+    boost::recursive_mutex::scoped_lock lock(
+        *this->world.Physics()->GetPhysicsUpdateMutex());
+
+    next->revision = this->world.SpatialIndex()->Revision();
+    for (auto const &model : this->world.Models())
+      this->AddModel(model, *next);
+
+    // Forget the triangles of the shapes that are gone
+    this->meshes.swap(this->nextMeshes);
+    this->nextMeshes.clear();
+  }
+
+  std::lock_guard<std::mutex> lock(this->mutex);
+  this->snapshot = next;
+  return next;
+}
+
+/////////////////////////////////////////////////
+LineOfSight::LineOfSight(World &_world)
+  : dataPtr(new LineOfSightPrivate(_world))
+{
+}
+
+/////////////////////////////////////////////////
+LineOfSight::~LineOfSight()
+{
+}
+
+/////////////////////////////////////////////////
+uint64_t LineOfSight::Revision() const
+{
+  return this->dataPtr->world.SpatialIndex()->Revision();
+}
+
+/////////////////////////////////////////////////
+uint64_t LineOfSight::Evaluate(
+    const std::vector<ignition::math::Line3d> &_segments,
+    std::vector<double> &_distances)
+{
+  std::shared_ptr<const LineOfSightSnapshot> snapshot =
+    this->dataPtr->Snapshot();
+  const std::vector<LineOfSightShape> &shapes = snapshot->shapes;
+
+  _distances.assign(_segments.size(), ignition::math::INF_D);
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, _segments.size(), 64),
+      [&](const tbb::blocked_range<size_t> &_r)
+      {
+        for (size_t i = _r.begin(); i != _r.end(); ++i)
+        {
+          const ignition::math::Vector3d &start = _segments[i][0];
+          const ignition::math::Vector3d d = _segments[i][1] - start;
+
+          double nearest = ignition::math::INF_D;
+          for (auto const &shape : shapes)
+          {
+            double t;
+            if (intersect(shape, start, d, t) && t < nearest)
+              nearest = t;
+          }
+
+          if (nearest < ignition::math::INF_D)
+            _distances[i] = nearest * d.Length();
+        }
+      });
+
+  return snapshot->revision;
+}
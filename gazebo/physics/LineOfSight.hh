@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GAZEBO_PHYSICS_LINEOFSIGHT_HH_
+#define GAZEBO_PHYSICS_LINEOFSIGHT_HH_
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <ignition/math/Line3.hh>
+
+#include "gazebo/physics/PhysicsTypes.hh"
+#include "gazebo/util/system.hh"
+
+namespace gazebo
+{
+  namespace physics
+  {
+    // Forward declare private data class.
+    class LineOfSightPrivate;
+
+    /// \addtogroup gazebo_physics
+    /// \{
+
+    /// \class LineOfSight LineOfSight.hh physics/physics.hh
+    /// \brief Batched line of sight queries against the collisions of a
+    /// world.
+    ///
+    /// Segments are tested against a snapshot of the collisions, taken
+    /// under the physics update mutex when the SpatialIndex revision
+    /// changed since the previous snapshot. The tests then run in parallel
+    /// without holding any lock, so large batches don't stall the physics.
+    ///
+    /// Boxes, spheres, cylinders and planes are tested exactly. Meshes,
+    /// polylines and heightmaps are tested against their triangles, which
+    /// are kept between snapshots, so segments inside a closed mesh only
+    /// hit its surface. Other shapes are approximated by their axis aligned
+    /// bounding boxes. Ray shapes are ignored.
+    class GZ_PHYSICS_VISIBLE LineOfSight
+    {
+      /// \brief Constructor.
+      /// \param[in] _world World whose collisions are tested.
+      public: explicit LineOfSight(World &_world);
+
+      /// \brief Destructor.
+      public: ~LineOfSight();
+
+      /// \brief Get the revision of the collisions of the world, which
+      /// doesn't change as long as the scene is static. Results computed
+      /// for a revision remain valid for that revision.
+      /// \return The revision.
+      public: uint64_t Revision() const;
+
+      /// \brief Find where segments first hit a collision.
+      /// \param[in] _segments Segments, from their start to their end.
+      /// \param[out] _distances Distance from the start of each segment to
+      /// the first collision it hits, 0 if it starts inside a solid one,
+      /// and ignition::math::INF_D if it hits none.
+      /// \return Revision of the snapshot the segments were tested against.
+      public: uint64_t Evaluate(
+                  const std::vector<ignition::math::Line3d> &_segments,
+                  std::vector<double> &_distances);
+
+      /// \internal
+      /// \brief Private data pointer.
+      private: std::unique_ptr<LineOfSightPrivate> dataPtr;
+    };
+    /// \}
+  }
+}
+#endif
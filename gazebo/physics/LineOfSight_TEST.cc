@@ -0,0 +1,156 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <cmath>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "gazebo/physics/LineOfSight.hh"
+#include "gazebo/test/ServerFixture.hh"
+
+using namespace gazebo;
+
+class LineOfSightTest : public ServerFixture {};
+
+/////////////////////////////////////////////////
+TEST_F(LineOfSightTest, Evaluate)
+{
+  this->Load("worlds/shapes.world", true);
+  physics::WorldPtr world = physics::get_world("default");
+  ASSERT_TRUE(world != nullptr);
+
+  physics::LineOfSight *lineOfSight = world->LineOfSight();
+  ASSERT_TRUE(lineOfSight != nullptr);
+
+  // The box is at the origin, the sphere at y = 1.5 and the cylinder, along
+  // the X axis, at y = -1.5. All have a size of 1 and lie on the ground.
+  std::vector<ignition::math::Line3d> segments = {
+    // Through the box, the sphere and the cylinder
+    {-5, 0, 0.5, 5, 0, 0.5},
+    {-5, 1.5, 0.5, 5, 1.5, 0.5},
+    {0, -1.5, 3, 0, -1.5, 0.5},
+    // Above the cylinder
+    {0, -1.5, 3, 0, -1.5, 2},
+    // Through the ground
+    {5, 5, 1, 5, 5, -1},
+    // From inside the box
+    {0, 0, 0.5, 0, 0, 0.6},
+    // Through the bounding box of the sphere, but not the sphere
+    {-5, 1.05, 0.05, 5, 1.05, 0.05}};
+
+  std::vector<double> distances;
+  const uint64_t revision = lineOfSight->Evaluate(segments, distances);
+  ASSERT_EQ(segments.size(), distances.size());
+  EXPECT_NEAR(4.5, distances[0], 1e-6);
+  EXPECT_NEAR(4.5, distances[1], 1e-6);
+  EXPECT_NEAR(2.0, distances[2], 1e-6);
+  EXPECT_DOUBLE_EQ(ignition::math::INF_D, distances[3]);
+  EXPECT_NEAR(1.0, distances[4], 1e-6);
+  EXPECT_DOUBLE_EQ(0.0, distances[5]);
+  EXPECT_DOUBLE_EQ(ignition::math::INF_D, distances[6]);
+
+  // The revision doesn't change while the scene is static
+  world->SetPhysicsEnabled(false);
+  world->Step(1);
+  EXPECT_EQ(revision, lineOfSight->Revision());
+  EXPECT_EQ(revision, lineOfSight->Evaluate(segments, distances));
+
+  // Moving an entity changes the revision and the results
+  world->ModelByName("box")->SetWorldPose(
+      ignition::math::Pose3d(2, 0, 0.5, 0, 0, 0));
+  world->Step(1);
+  EXPECT_NE(revision, lineOfSight->Revision());
+  EXPECT_NE(revision, lineOfSight->Evaluate(segments, distances));
+  EXPECT_NEAR(6.5, distances[0], 1e-6);
+  EXPECT_DOUBLE_EQ(ignition::math::INF_D, distances[5]);
+}
+
+/////////////////////////////////////////////////
+/// \brief Get the SDF of a static model with a hollow cube mesh of size 4.
+/// \param[in] _name Name of the model.
+/// \param[in] _pose Pose of the model.
+/// \return The SDF.
+static std::string hollowCube(const std::string &_name,
+    const ignition::math::Pose3d &_pose)
+{
+  // The mesh is the surface of a cube of size 2
+  std::ostringstream stream;
+  stream << "<sdf version='" << SDF_VERSION << "'>"
+    << "<model name='" << _name << "'>"
+    << "  <static>true</static>"
+    << "  <pose>" << _pose << "</pose>"
+    << "  <link name='link'>"
+    << "    <collision name='collision'>"
+    << "      <geometry>"
+    << "        <mesh>"
+    << "          <uri>" << TEST_PATH << "/data/box.obj</uri>"
+    << "          <scale>2 2 2</scale>"
+    << "        </mesh>"
+    << "      </geometry>"
+    << "    </collision>"
+    << "  </link>"
+    << "</model>"
+    << "</sdf>";
+  return stream.str();
+}
+
+/////////////////////////////////////////////////
+TEST_F(LineOfSightTest, HollowMesh)
+{
+  this->Load("worlds/empty.world", true);
+  physics::WorldPtr world = physics::get_world("default");
+  ASSERT_TRUE(world != nullptr);
+
+  this->SpawnSDF(hollowCube("room",
+        ignition::math::Pose3d(10, 0, 3, 0, 0, 0)));
+  this->SpawnSDF(hollowCube("diamond",
+        ignition::math::Pose3d(-10, 0, 3, 0, 0, IGN_PI_4)));
+  world->Step(1);
+
+  physics::LineOfSight *lineOfSight = world->LineOfSight();
+  ASSERT_TRUE(lineOfSight != nullptr);
+
+  const double halfDiagonal = 2 * std::sqrt(2.0);
+  std::vector<ignition::math::Line3d> segments = {
+    // Inside the room
+    {9, 0, 3, 11, 0, 3},
+    // From inside the room, through its wall
+    {10, 0, 3, 15, 0, 3},
+    // Through the room
+    {5, 0, 3, 15, 0, 3},
+    // Through the bounding box of the diamond, but not the diamond
+    {-10 + 2.7, 2, 3, -10 + 2, 2.7, 3},
+    // Through the diamond
+    {-5, 0.5, 3, -10, 0.5, 3}};
+
+  std::vector<double> distances;
+  lineOfSight->Evaluate(segments, distances);
+  ASSERT_EQ(segments.size(), distances.size());
+  EXPECT_DOUBLE_EQ(ignition::math::INF_D, distances[0]);
+  EXPECT_NEAR(2.0, distances[1], 1e-6);
+  EXPECT_NEAR(3.0, distances[2], 1e-6);
+  EXPECT_DOUBLE_EQ(ignition::math::INF_D, distances[3]);
+  EXPECT_NEAR(5 - (halfDiagonal - 0.5), distances[4], 1e-5);
+}
+
+/////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
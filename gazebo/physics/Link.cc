@@ -39,6 +39,8 @@
 #include "gazebo/physics/ContactManager.hh"
 #include "gazebo/physics/PhysicsEngine.hh"
 #include "gazebo/physics/Collision.hh"
+#include "gazebo/physics/ForceField.hh"
+#include "gazebo/physics/SpatialIndex.hh"
 #include "gazebo/physics/Link.hh"
 #include "gazebo/physics/Wind.hh"
 
@@ -97,8 +99,9 @@ class gazebo::physics::LinkPrivate
   /// \brief Wind velocity.
   public: ignition::math::Vector3d windLinearVel;
 
-  /// \brief Update connection to calculate wind velocity.
-  public: event::ConnectionPtr updateConnection;
+  /// \brief Row of this link in the world force field while the wind is
+  /// enabled, -1 otherwise.
+  public: int windRow = -1;
 
   /// \brief All the attached batteries.
   public: std::vector<common::BatteryPtr> batteries;
@@ -338,13 +341,21 @@ void Link::Init()
   if (this->WindMode() && this->world->WindEnabled())
     this->SetWindEnabled(true);
 
+  if (this->world && this->world->SpatialIndex())
+    this->world->SpatialIndex()->Add(this);
+
   this->initialized = true;
 }
 
 //////////////////////////////////////////////////
 void Link::Fini()
 {
-  this->dataPtr->updateConnection.reset();
+  if (this->dataPtr->windRow >= 0)
+    this->SetWindEnabled(false);
+  if (this->world && this->world->ForceField())
+    this->world->ForceField()->DetachLink(this);
+  if (this->world && this->world->SpatialIndex())
+    this->world->SpatialIndex()->Remove(this);
 
   this->dataPtr->attachedModels.clear();
   this->dataPtr->parentJoints.clear();
@@ -842,28 +853,44 @@ void Link::SetWindMode(const bool _mode)
 {
   this->sdf->GetElement("enable_wind")->Set(_mode);
 
-  if (!this->WindMode() && this->dataPtr->updateConnection)
+  if (!this->WindMode() && this->dataPtr->windRow >= 0)
     this->SetWindEnabled(false);
-  else if (this->WindMode() && !this->dataPtr->updateConnection)
+  else if (this->WindMode() && this->dataPtr->windRow < 0)
     this->SetWindEnabled(true);
 }
 
 /////////////////////////////////////////////////
 void Link::SetWindEnabled(const bool _enable)
 {
+  // The wind velocity is computed by the force field stage of the world
+  ForceField *forceField = this->world ? this->world->ForceField() : nullptr;
   if (_enable)
   {
-    this->dataPtr->updateConnection = event::Events::ConnectWorldUpdateBegin(
-        std::bind(&Link::UpdateWind, this, std::placeholders::_1));
+    if (forceField && this->dataPtr->windRow < 0)
+    {
+      this->dataPtr->windRow = forceField->AddLink(this);
+      forceField->SetWindEnabled(this->dataPtr->windRow, true);
+    }
   }
   else
   {
-    this->dataPtr->updateConnection.reset();
+    if (forceField && this->dataPtr->windRow >= 0)
+    {
+      forceField->SetWindEnabled(this->dataPtr->windRow, false);
+      forceField->RemoveLink(this->dataPtr->windRow);
+    }
+    this->dataPtr->windRow = -1;
     // Make sure wind velocity is null
     this->dataPtr->windLinearVel.Set(0, 0, 0);
   }
 }
 
+//////////////////////////////////////////////////
+void Link::SetWorldWindLinearVel(const ignition::math::Vector3d &_vel)
+{
+  this->dataPtr->windLinearVel = _vel;
+}
+
 //////////////////////////////////////////////////
 const ignition::math::Vector3d Link::WorldWindLinearVel() const
 {
@@ -1161,6 +1188,9 @@ void Link::DetachAllStaticModels()
 //////////////////////////////////////////////////
 void Link::OnPoseChange()
 {
+  if (this->world && this->world->SpatialIndex())
+    this->world->SpatialIndex()->MarkDirty(this);
+
   ignition::math::Pose3d p;
   for (unsigned int i = 0; i < this->dataPtr->attachedModels.size(); i++)
   {
@@ -574,6 +574,12 @@ namespace gazebo
       /// \param[in] _info Update information.
       public: void UpdateWind(const common::UpdateInfo &_info);
 
+      /// \brief Set this link's wind velocity in the world coordinate frame.
+      /// This is called by the force field stage of the world on every
+      /// update while the wind is enabled.
+      /// \param[in] _vel Wind velocity.
+      public: void SetWorldWindLinearVel(const ignition::math::Vector3d &_vel);
+
       /// \brief Get a battery by name.
       /// \param[in] _name Name of the battery to get.
       /// \return Pointer to the battery, NULL if the name is invalid.
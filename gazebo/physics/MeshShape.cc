@@ -14,10 +14,14 @@
  * limitations under the License.
  *
 */
+#include <sstream>
+#include <vector>
+
 #include <boost/thread/recursive_mutex.hpp>
 #include "gazebo/common/CommonIface.hh"
 #include "gazebo/common/Console.hh"
 #include "gazebo/common/MeshManager.hh"
+#include "gazebo/common/MeshSimplifier.hh"
 #include "gazebo/common/Mesh.hh"
 #include "gazebo/common/Exception.hh"
 
@@ -94,6 +98,115 @@ void MeshShape::Init()
       }
     }
   }
+
+  if (this->mesh && this->sdf->HasElement("gazebo:simplify"))
+    this->Simplify();
+}
+
+//////////////////////////////////////////////////
+void MeshShape::Simplify()
+{
+  sdf::ElementPtr simplifyElem = this->sdf->GetElement("gazebo:simplify");
+
+  common::MeshSimplifier simplifier;
+  if (simplifyElem->HasElement("gazebo:triangles"))
+  {
+    simplifier.SetTargetTriangles(
+        simplifyElem->GetElement("gazebo:triangles")->Get<unsigned int>());
+  }
+  if (simplifyElem->HasElement("gazebo:max_error"))
+  {
+    simplifier.SetMaxError(
+        simplifyElem->GetElement("gazebo:max_error")->Get<double>());
+  }
+
+  if (simplifier.TargetTriangles() == 0 && simplifier.MaxError() < 0)
+  {
+    gzwarn << "Mesh[" << this->GetMeshURI() << "] has a <gazebo:simplify> "
+           << "element without <gazebo:triangles> or <gazebo:max_error>, "
+           << "using the full mesh\n";
+    return;
+  }
+
+  // Shapes that simplify the same mesh the same way share the result
+  std::ostringstream stream;
+  stream << this->mesh->GetName();
+  if (this->submesh)
+  {
+    stream << "::" << this->submesh->GetName();
+    if (this->sdf->GetElement("submesh")->Get<bool>("center"))
+      stream << "::centered";
+  }
+  stream << "::simplified_" << simplifier.TargetTriangles() << "_"
+         << simplifier.MaxError();
+  const std::string name = stream.str();
+
+  common::MeshManager *meshManager = common::MeshManager::Instance();
+  const common::Mesh *simplified = meshManager->GetMesh(name);
+  if (!simplified)
+  {
+    float *vertArray = NULL;
+    int *indArray = NULL;
+    unsigned int vertCount, indCount;
+    if (this->submesh)
+    {
+      this->submesh->FillArrays(&vertArray, &indArray);
+      vertCount = this->submesh->GetVertexCount();
+      indCount = this->submesh->GetIndexCount();
+    }
+    else
+    {
+      this->mesh->FillArrays(&vertArray, &indArray);
+      vertCount = this->mesh->GetVertexCount();
+      indCount = this->mesh->GetIndexCount();
+    }
+
+    std::vector<ignition::math::Vector3d> vertices(vertCount);
+    for (unsigned int i = 0; i < vertCount; ++i)
+    {
+      vertices[i].Set(vertArray[i * 3], vertArray[i * 3 + 1],
+          vertArray[i * 3 + 2]);
+    }
+    std::vector<unsigned int> indices(indArray, indArray + indCount);
+    delete [] vertArray;
+    delete [] indArray;
+
+    std::vector<ignition::math::Vector3d> outVertices;
+    std::vector<unsigned int> outIndices;
+    simplifier.Simplify(vertices, indices, outVertices, outIndices,
+        meshManager->CachePath());
+
+    if (outIndices.empty())
+    {
+      gzwarn << "Simplifying mesh[" << this->GetMeshURI() << "] removed "
+             << "all its triangles, using the full mesh\n";
+      return;
+    }
+
+    common::SubMesh *subMesh = new common::SubMesh();
+    subMesh->SetName(name);
+    subMesh->SetPrimitiveType(common::SubMesh::TRIANGLES);
+    for (auto const &v : outVertices)
+      subMesh->AddVertex(v);
+    for (auto const i : outIndices)
+      subMesh->AddIndex(i);
+    subMesh->RecalculateNormals();
+
+    common::Mesh *newMesh = new common::Mesh();
+    newMesh->SetName(name);
+    newMesh->SetPath(this->mesh->GetPath());
+    newMesh->AddSubMesh(subMesh);
+    meshManager->AddMesh(newMesh);
+    simplified = newMesh;
+
+    gzmsg << "Simplified mesh[" << this->GetMeshURI() << "] from "
+          << indCount / 3 << " to " << outIndices.size() / 3
+          << " triangles\n";
+  }
+
+  this->mesh = simplified;
+  delete this->submesh;
+  this->submesh = NULL;
 }
 
 //////////////////////////////////////////////////
@@ -78,11 +78,20 @@ namespace gazebo
       /// \param[in] _msg Message that contains triangle mesh info.
       public: virtual void ProcessMsg(const msgs::Geometry &_msg);
 
+      /// \brief Replace the mesh with a simplified copy, if the SDF has a
+      /// <gazebo:simplify> element. The copy is shared through the
+      /// MeshManager by the shapes that simplify the same mesh the same
+      /// way.
+      private: void Simplify();
+
       /// \brief Pointer to the mesh data.
       protected: const common::Mesh *mesh;
 
       /// \brief The submesh to use from within the parent mesh.
       protected: common::SubMesh *submesh;
+
+      /// Friend LineOfSightPrivate so that it has access to the triangles
+      private: friend class LineOfSightPrivate;
     };
     /// \}
   }
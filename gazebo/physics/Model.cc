@@ -44,6 +44,7 @@
 #include "gazebo/physics/Link.hh"
 #include "gazebo/physics/World.hh"
 #include "gazebo/physics/PhysicsEngine.hh"
+#include "gazebo/physics/SpatialIndex.hh"
 #include "gazebo/physics/Model.hh"
 #include "gazebo/physics/Contact.hh"
 
@@ -293,6 +294,9 @@ void Model::Init()
       boost::static_pointer_cast<Model>(*iter)->Init();
   }
 
+  if (this->world && this->world->SpatialIndex())
+    this->world->SpatialIndex()->Add(this);
+
   // Initialize the joints last.
   for (Joint_V::iterator iter = this->joints.begin();
        iter != this->joints.end(); ++iter)
@@ -445,6 +449,9 @@ boost::shared_ptr<Model> Model::shared_from_this()
 //////////////////////////////////////////////////
 void Model::Fini()
 {
+  if (this->world && this->world->SpatialIndex())
+    this->world->SpatialIndex()->Remove(this);
+
   // Destroy all attached models
   for (auto &model : this->attachedModels)
   {
@@ -15,10 +15,15 @@
  *
 */
 
+#include <algorithm>
+#include <mutex>
+#include <tbb/parallel_for.h>
 #include <boost/thread/mutex.hpp>
+#include <boost/thread/recursive_mutex.hpp>
 #include "gazebo/common/Console.hh"
 #include "gazebo/common/Exception.hh"
 #include "gazebo/physics/World.hh"
+#include "gazebo/physics/WorldPrivate.hh"
 #include "gazebo/physics/AtmosphereFactory.hh"
 #include "gazebo/physics/PhysicsFactory.hh"
 #include "gazebo/physics/PhysicsIface.hh"
@@ -28,6 +33,10 @@ using namespace gazebo;
 
 std::vector<physics::WorldPtr> g_worlds;
 
+/// \brief Protects g_worlds, since worlds can be forked and removed from
+/// threads other than the server thread.
+boost::recursive_mutex g_worldsMutex;
+
 boost::mutex g_uniqueIdMutex;
 uint32_t g_uniqueId = 0;
 
@@ -49,6 +58,7 @@ bool physics::fini()
 /////////////////////////////////////////////////
 physics::WorldPtr physics::create_world(const std::string &_name)
 {
+  boost::recursive_mutex::scoped_lock lock(g_worldsMutex);
   physics::WorldPtr world(new physics::World(_name));
   g_worlds.push_back(world);
   return world;
@@ -57,6 +67,7 @@ physics::WorldPtr physics::create_world(const std::string &_name)
 /////////////////////////////////////////////////
 physics::WorldPtr physics::get_world(const std::string &_name)
 {
+  boost::recursive_mutex::scoped_lock lock(g_worldsMutex);
   if (_name.empty())
   {
     if (g_worlds.empty())
@@ -81,6 +92,7 @@ physics::WorldPtr physics::get_world(const std::string &_name)
 /////////////////////////////////////////////////
 bool physics::has_world(const std::string &_name)
 {
+  boost::recursive_mutex::scoped_lock lock(g_worldsMutex);
   if (_name.empty())
   {
     return !g_worlds.empty();
@@ -96,9 +108,17 @@ bool physics::has_world(const std::string &_name)
   return false;
 }
 
+/////////////////////////////////////////////////
+std::vector<physics::WorldPtr> physics::get_worlds()
+{
+  boost::recursive_mutex::scoped_lock lock(g_worldsMutex);
+  return g_worlds;
+}
+
 /////////////////////////////////////////////////
 void physics::load_worlds(sdf::ElementPtr _sdf)
 {
+  boost::recursive_mutex::scoped_lock lock(g_worldsMutex);
   for (auto &world : g_worlds)
     world->Load(_sdf);
 }
@@ -112,6 +132,7 @@ void physics::init_worlds()
 /////////////////////////////////////////////////
 void physics::init_worlds(UpdateScenePosesFunc _func)
 {
+  boost::recursive_mutex::scoped_lock lock(g_worldsMutex);
   for (auto &world : g_worlds)
     world->Init(_func);
 }
@@ -119,6 +140,7 @@ void physics::init_worlds(UpdateScenePosesFunc _func)
 /////////////////////////////////////////////////
 void physics::run_worlds(unsigned int _steps)
 {
+  boost::recursive_mutex::scoped_lock lock(g_worldsMutex);
   for (auto &world : g_worlds)
     world->Run(_steps);
 }
@@ -126,13 +148,23 @@ void physics::run_worlds(unsigned int _steps)
 /////////////////////////////////////////////////
 void physics::pause_worlds(bool _pause)
 {
+  boost::recursive_mutex::scoped_lock lock(g_worldsMutex);
   for (auto &world : g_worlds)
     world->SetPaused(_pause);
 }
 
+/////////////////////////////////////////////////
+void physics::set_worlds_sensor_pipelining(bool _enable)
+{
+  boost::recursive_mutex::scoped_lock lock(g_worldsMutex);
+  for (auto &world : g_worlds)
+    world->SetSensorPipelining(_enable);
+}
+
 /////////////////////////////////////////////////
 void physics::stop_worlds()
 {
+  boost::recursive_mutex::scoped_lock lock(g_worldsMutex);
   for (auto &world : g_worlds)
     world->Stop();
 }
@@ -176,6 +208,7 @@ void physics::stop_world(WorldPtr _world)
 /////////////////////////////////////////////////
 void physics::remove_worlds()
 {
+  boost::recursive_mutex::scoped_lock lock(g_worldsMutex);
   for (auto &world : g_worlds)
   {
     world->Fini();
@@ -185,9 +218,91 @@ void physics::remove_worlds()
   g_worlds.clear();
 }
 
+/////////////////////////////////////////////////
+void physics::remove_world(WorldPtr _world)
+{
+  if (!_world)
+    return;
+
+  boost::recursive_mutex::scoped_lock lock(g_worldsMutex);
+  auto iter = std::find(g_worlds.begin(), g_worlds.end(), _world);
+  if (iter == g_worlds.end())
+  {
+    gzerr << "World[" << _world->Name() << "] is not loaded\n";
+    return;
+  }
+
+  g_worlds.erase(iter);
+  _world->Fini();
+}
+
+/////////////////////////////////////////////////
+physics::WorldPtr physics::fork_world(WorldPtr _world,
+                                      const std::string &_name)
+{
+  if (!_world)
+  {
+    gzerr << "Unable to fork a null world\n";
+    return WorldPtr();
+  }
+
+  if (_name.empty() || has_world(_name))
+  {
+    gzerr << "Unable to fork world[" << _world->Name() << "]. The name ["
+          << _name << "] is empty or already in use\n";
+    return WorldPtr();
+  }
+
+  // The SDF of a world contains every entity, including the ones inserted
+  // at run time, and a <state> element with the current state. The state is
+  // applied to the new world in World::Init.
+  // The update mutex keeps the world from stepping while its state is
+  // written to the SDF and copied.
+  sdf::ElementPtr worldElem;
+  {
+    std::lock_guard<std::recursive_mutex> lock(
+        _world->dataPtr->worldUpdateMutex);
+    worldElem = _world->SDF()->Clone();
+  }
+  worldElem->GetAttribute("name")->Set(_name);
+
+  WorldPtr fork = create_world(_name);
+  try
+  {
+    load_world(fork, worldElem);
+  }
+  catch(common::Exception &_e)
+  {
+    gzerr << "Unable to fork world[" << _world->Name() << "]: "
+          << _e.GetErrorStr() << "\n";
+    remove_world(fork);
+    return WorldPtr();
+  }
+
+  init_world(fork, nullptr);
+
+  return fork;
+}
+
+/////////////////////////////////////////////////
+void physics::step_worlds(const std::vector<WorldPtr> &_worlds,
+                          const unsigned int _steps)
+{
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, _worlds.size(), 1),
+      [&](const tbb::blocked_range<size_t> &_r)
+      {
+        for (size_t i = _r.begin(); i != _r.end(); ++i)
+        {
+          if (_worlds[i])
+            _worlds[i]->StepDetached(_steps);
+        }
+      });
+}
+
 /////////////////////////////////////////////////
 bool physics::worlds_running()
 {
+  boost::recursive_mutex::scoped_lock lock(g_worldsMutex);
   for (auto const &world : g_worlds)
   {
     if (world && world->Running())
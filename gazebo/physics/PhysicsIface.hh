@@ -18,6 +18,7 @@
 #define _PHYSICSIFACE_HH_
 
 #include <string>
+#include <vector>
 #include <sdf/sdf.hh>
 
 #include "gazebo/physics/PhysicsTypes.hh"
@@ -61,6 +62,11 @@ namespace gazebo
     GZ_PHYSICS_VISIBLE
     bool has_world(const std::string &_name = "");
 
+    /// \brief Get all the worlds.
+    /// \return Pointers to the worlds, in the order they were created.
+    GZ_PHYSICS_VISIBLE
+    std::vector<WorldPtr> get_worlds();
+
     /// \brief Load world from sdf::Element pointer.
     /// \param[in] _world Pointer to a world.
     /// \param[in] _sdf SDF values to load from.
@@ -132,11 +138,44 @@ namespace gazebo
     GZ_PHYSICS_VISIBLE
     void pause_worlds(bool pause);
 
+    /// \brief pipeline the sensors with physics in multiple worlds stored
+    /// in static variable gazebo::g_worlds
+    /// \param[in] _enable True to enable pipelining.
+    /// \sa World::SetSensorPipelining
+    GZ_PHYSICS_VISIBLE
+    void set_worlds_sensor_pipelining(bool _enable);
+
     /// \brief remove multiple worlds stored in static variable
     /// gazebo::g_worlds
     GZ_PHYSICS_VISIBLE
     void remove_worlds();
 
+    /// \brief Finalize a single world, and remove it from the static
+    /// variable gazebo::g_worlds.
+    /// \param[in] _world World to remove.
+    GZ_PHYSICS_VISIBLE
+    void remove_world(WorldPtr _world);
+
+    /// \brief Fork a world into a new world with the same entities and
+    /// state. The fork has its own physics engine and state, and shares
+    /// immutable assets such as meshes with the original through the
+    /// global resource managers. The fork does not run its own update
+    /// loop, use step_worlds or World::StepDetached to advance it.
+    /// The original world doesn't step while its state is copied.
+    /// \param[in] _world World to fork.
+    /// \param[in] _name Name of the fork, which is also its topic namespace.
+    /// \return Pointer to the new world, or NULL on failure.
+    GZ_PHYSICS_VISIBLE
+    WorldPtr fork_world(WorldPtr _world, const std::string &_name);
+
+    /// \brief Step several worlds in parallel on a pool of worker threads.
+    /// The worlds must not be running their own update loop.
+    /// \param[in] _worlds Worlds to step.
+    /// \param[in] _steps Number of steps each world takes.
+    GZ_PHYSICS_VISIBLE
+    void step_worlds(const std::vector<WorldPtr> &_worlds,
+                     const unsigned int _steps);
+
     /// \brief Return true if any world is running.
     /// \return True if any world is running.
     GZ_PHYSICS_VISIBLE
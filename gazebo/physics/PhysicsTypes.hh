@@ -47,11 +47,15 @@ namespace gazebo
     class Joint;
     class JointController;
     class Contact;
+    class ContactFeed;
     class PresetManager;
     class UserCmd;
     class UserCmdManager;
     class PhysicsEngine;
     class Wind;
+    class ForceField;
+    class SpatialIndex;
+    class LineOfSight;
     class Atmosphere;
     class Mass;
     class Road;
@@ -81,6 +85,10 @@ namespace gazebo
     /// \brief Boost shared pointer to a Contact object
     typedef boost::shared_ptr<Contact> ContactPtr;
 
+    /// \def ContactFeedPtr
+    /// \brief Shared pointer to a ContactFeed object
+    typedef std::shared_ptr<ContactFeed> ContactFeedPtr;
+
     /// \def EntityPtr
     /// \brief Boost shared pointer to an Entity object
     typedef boost::shared_ptr<Entity> EntityPtr;
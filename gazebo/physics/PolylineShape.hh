@@ -95,6 +95,9 @@ namespace gazebo
 
       /// \brief Pointer to the mesh data.
       protected: const common::Mesh *mesh;
+
+      /// Friend LineOfSightPrivate so that it has access to the triangles
+      private: friend class LineOfSightPrivate;
     };
     /// \}
   }
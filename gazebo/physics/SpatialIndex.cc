@@ -0,0 +1,759 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <algorithm>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "gazebo/common/Assert.hh"
+#include "gazebo/physics/Link.hh"
+#include "gazebo/physics/Model.hh"
+#include "gazebo/physics/SpatialIndex.hh"
+
+namespace gazebo
+{
+  namespace physics
+  {
+    /// \internal
+    /// \brief A model or link in the index.
+    class SpatialIndexProxy
+    {
+      /// \brief The entity.
+      public: EntityWeakPtr entity;
+
+      /// \brief Base::MODEL or Base::LINK.
+      public: unsigned int type = 0;
+
+      /// \brief Model of a link, only used as a key.
+      public: const Entity *model = nullptr;
+
+      /// \brief Box of the entity.
+      public: ignition::math::AxisAlignedBox box;
+
+      /// \brief False if the entity has no collisions.
+      public: bool hasBox = false;
+
+      /// \brief Leaf of the entity, -1 if it isn't in the tree.
+      public: int node = -1;
+    };
+
+    /// \internal
+    /// \brief A node of the tree.
+    class SpatialIndexNode
+    {
+      /// \brief Box of the node, enlarged by the margin for leaves.
+      public: ignition::math::AxisAlignedBox box;
+
+      /// \brief Parent node, or next free node. -1 if none.
+      public: int parent = -1;
+
+      /// \brief First child, -1 for leaves.
+      public: int child1 = -1;
+
+      /// \brief Second child, -1 for leaves.
+      public: int child2 = -1;
+
+      /// \brief Height of the node, 0 for leaves, -1 for free nodes.
+      public: int height = -1;
+
+      /// \brief Proxy of a leaf.
+      public: SpatialIndexProxy *proxy = nullptr;
+    };
+
+    /// \internal
+    /// \brief Private data for the SpatialIndex class
+    class SpatialIndexPrivate
+    {
+      /// \brief Allocate a node.
+      /// \return Index of the node.
+      public: int AllocateNode();
+
+      /// \brief Release a node.
+      /// \param[in] _node Index of the node.
+      public: void FreeNode(const int _node);
+
+      /// \brief Insert a leaf in the tree.
+      /// \param[in] _leaf Index of the leaf.
+      public: void InsertLeaf(const int _leaf);
+
+      /// \brief Remove a leaf from the tree, without releasing it.
+      /// \param[in] _leaf Index of the leaf.
+      public: void RemoveLeaf(const int _leaf);
+
+      /// \brief Rotate a node if its children are unbalanced.
+      /// \param[in] _node Index of the node.
+      /// \return Index of the node that took its place.
+      public: int Balance(const int _node);
+
+      /// \brief Refit the boxes and heights of the ancestors of a node.
+      /// \param[in] _node Index of the node.
+      public: void Refit(int _node);
+
+      /// \brief Update the leaf of a proxy after its box changed.
+      /// \param[in] _proxy The proxy.
+      public: void UpdateLeaf(SpatialIndexProxy &_proxy);
+
+      /// \brief Visit the leaves whose boxes pass a test.
+      /// \param[in] _test Test of a box.
+      /// \param[in] _types Types of entities to return.
+      /// \return The entities of the leaves.
+      public: template<typename Test>
+              std::vector<EntityPtr> Query(const Test &_test,
+                  const unsigned int _types) const;
+
+      /// \brief Margin added to the boxes of the leaves.
+      public: double margin = 0.1;
+
+      /// \brief Nodes, including free ones.
+      public: std::vector<SpatialIndexNode> nodes;
+
+      /// \brief Root node, -1 if the tree is empty.
+      public: int root = -1;
+
+      /// \brief First free node, -1 if none.
+      public: int freeList = -1;
+
+      /// \brief Proxies of the entities.
+      public: std::unordered_map<const Entity *, SpatialIndexProxy> proxies;
+
+      /// \brief Links whose box must be recomputed.
+      public: std::unordered_set<const Entity *> dirtyLinks;
+
+      /// \brief Models whose box must be recomputed.
+      public: std::unordered_set<const Entity *> dirtyModels;
+
+      /// \brief Revision of the index.
+      public: uint64_t revision = 0;
+
+      /// \brief Protects all of the above.
+      public: mutable std::mutex mutex;
+    };
+  }
+}
+
+using namespace gazebo;
+using namespace physics;
+
+/////////////////////////////////////////////////
+/// \brief Check if a box isn't empty.
+/// \param[in] _box The box.
+/// \return True if the minimum is below the maximum on all axes.
+static bool validBox(const ignition::math::AxisAlignedBox &_box)
+{
+  return _box.Min().X() <= _box.Max().X() &&
+         _box.Min().Y() <= _box.Max().Y() &&
+         _box.Min().Z() <= _box.Max().Z();
+}
+
+/////////////////////////////////////////////////
+/// \brief Get the union of two boxes.
+/// \param[in] _a First box.
+/// \param[in] _b Second box.
+/// \return The union.
+static ignition::math::AxisAlignedBox merge(
+    const ignition::math::AxisAlignedBox &_a,
+    const ignition::math::AxisAlignedBox &_b)
+{
+  return ignition::math::AxisAlignedBox(
+      ignition::math::Vector3d(std::min(_a.Min().X(), _b.Min().X()),
+                               std::min(_a.Min().Y(), _b.Min().Y()),
+                               std::min(_a.Min().Z(), _b.Min().Z())),
+      ignition::math::Vector3d(std::max(_a.Max().X(), _b.Max().X()),
+                               std::max(_a.Max().Y(), _b.Max().Y()),
+                               std::max(_a.Max().Z(), _b.Max().Z())));
+}
+
+/////////////////////////////////////////////////
+/// \brief Get the surface area of a box, the cost of the tree heuristic.
+/// Sizes are clamped so that unbounded shapes, such as planes, keep the
+/// cost finite.
+/// \param[in] _box The box.
+/// \return The area.
+static double area(const ignition::math::AxisAlignedBox &_box)
+{
+  const double maxSize = 1e9;
+  const double x = std::min(_box.Max().X() - _box.Min().X(), maxSize);
+  const double y = std::min(_box.Max().Y() - _box.Min().Y(), maxSize);
+  const double z = std::min(_box.Max().Z() - _box.Min().Z(), maxSize);
+  return 2.0 * (x * y + y * z + z * x);
+}
+
+/////////////////////////////////////////////////
+/// \brief Check if a box contains another one.
+/// \param[in] _outer The outer box.
+/// \param[in] _inner The inner box.
+/// \return True if the inner box is inside the outer one.
+static bool contains(const ignition::math::AxisAlignedBox &_outer,
+    const ignition::math::AxisAlignedBox &_inner)
+{
+  return _outer.Min().X() <= _inner.Min().X() &&
+         _outer.Min().Y() <= _inner.Min().Y() &&
+         _outer.Min().Z() <= _inner.Min().Z() &&
+         _outer.Max().X() >= _inner.Max().X() &&
+         _outer.Max().Y() >= _inner.Max().Y() &&
+         _outer.Max().Z() >= _inner.Max().Z();
+}
+
+/////////////////////////////////////////////////
+/// \brief Check if two boxes overlap.
+/// \param[in] _a First box.
+/// \param[in] _b Second box.
+/// \return True if they overlap or touch.
+static bool overlap(const ignition::math::AxisAlignedBox &_a,
+    const ignition::math::AxisAlignedBox &_b)
+{
+  return _a.Min().X() <= _b.Max().X() && _b.Min().X() <= _a.Max().X() &&
+         _a.Min().Y() <= _b.Max().Y() && _b.Min().Y() <= _a.Max().Y() &&
+         _a.Min().Z() <= _b.Max().Z() && _b.Min().Z() <= _a.Max().Z();
+}
+
+/////////////////////////////////////////////////
+/// \brief Get the squared distance from a point to a box.
+/// \param[in] _box The box.
+/// \param[in] _point The point.
+/// \return The squared distance, 0 if the point is inside.
+static double distanceSquared(const ignition::math::AxisAlignedBox &_box,
+    const ignition::math::Vector3d &_point)
+{
+  double result = 0;
+  for (int i = 0; i < 3; ++i)
+  {
+    const double d = std::max(std::max(_box.Min()[i] - _point[i], 0.0),
+        _point[i] - _box.Max()[i]);
+    result += d * d;
+  }
+  return result;
+}
+
+/////////////////////////////////////////////////
+int SpatialIndexPrivate::AllocateNode()
+{
+  if (this->freeList < 0)
+  {
+    this->nodes.emplace_back();
+    this->nodes.back().height = 0;
+    return static_cast<int>(this->nodes.size()) - 1;
+  }
+
+  const int node = this->freeList;
+  this->freeList = this->nodes[node].parent;
+  this->nodes[node] = SpatialIndexNode();
+  this->nodes[node].height = 0;
+  return node;
+}
+
+/////////////////////////////////////////////////
+void SpatialIndexPrivate::FreeNode(const int _node)
+{
+  this->nodes[_node].parent = this->freeList;
+  this->nodes[_node].height = -1;
+  this->nodes[_node].proxy = nullptr;
+  this->freeList = _node;
+}
+
+/////////////////////////////////////////////////
+void SpatialIndexPrivate::InsertLeaf(const int _leaf)
+{
+  if (this->root < 0)
+  {
+    this->root = _leaf;
+    this->nodes[_leaf].parent = -1;
+    return;
+  }
+
+  // Find the best sibling, descending where the cost increases the least
+  const ignition::math::AxisAlignedBox leafBox = this->nodes[_leaf].box;
+  int index = this->root;
+  while (this->nodes[index].child1 >= 0)
+  {
+    const SpatialIndexNode &node = this->nodes[index];
+    const double nodeArea = area(node.box);
+    const double combinedArea = area(merge(node.box, leafBox));
+
+    // Cost of creating a parent for this node and the leaf, and minimum
+    // cost of pushing the leaf further down
+    const double cost = 2.0 * combinedArea;
+    const double inheritance = 2.0 * (combinedArea - nodeArea);
+
+    double childCost[2];
+    const int children[2] = {node.child1, node.child2};
+    for (int i = 0; i < 2; ++i)
+    {
+      const SpatialIndexNode &child = this->nodes[children[i]];
+      const double mergedArea = area(merge(child.box, leafBox));
+      if (child.child1 < 0)
+        childCost[i] = mergedArea + inheritance;
+      else
+        childCost[i] = mergedArea - area(child.box) + inheritance;
+    }
+
+    if (cost < childCost[0] && cost < childCost[1])
+      break;
+
+    index = childCost[0] < childCost[1] ? children[0] : children[1];
+  }
+
+  // Create a parent for the sibling and the leaf
+  const int sibling = index;
+  const int oldParent = this->nodes[sibling].parent;
+  const int newParent = this->AllocateNode();
+  this->nodes[newParent].parent = oldParent;
+  this->nodes[newParent].box = merge(leafBox, this->nodes[sibling].box);
+  this->nodes[newParent].height = this->nodes[sibling].height + 1;
+  this->nodes[newParent].child1 = sibling;
+  this->nodes[newParent].child2 = _leaf;
+  this->nodes[sibling].parent = newParent;
+  this->nodes[_leaf].parent = newParent;
+
+  if (oldParent < 0)
+    this->root = newParent;
+  else if (this->nodes[oldParent].child1 == sibling)
+    this->nodes[oldParent].child1 = newParent;
+  else
+    this->nodes[oldParent].child2 = newParent;
+
+  this->Refit(this->nodes[_leaf].parent);
+}
+
+/////////////////////////////////////////////////
+void SpatialIndexPrivate::RemoveLeaf(const int _leaf)
+{
+  if (_leaf == this->root)
+  {
+    this->root = -1;
+    return;
+  }
+
+  const int parent = this->nodes[_leaf].parent;
+  const int grandParent = this->nodes[parent].parent;
+  const int sibling = this->nodes[parent].child1 == _leaf ?
+    this->nodes[parent].child2 : this->nodes[parent].child1;
+
+  // The sibling takes the place of the parent
+  this->nodes[sibling].parent = grandParent;
+  this->FreeNode(parent);
+  if (grandParent < 0)
+  {
+    this->root = sibling;
+    return;
+  }
+
+  if (this->nodes[grandParent].child1 == parent)
+    this->nodes[grandParent].child1 = sibling;
+  else
+    this->nodes[grandParent].child2 = sibling;
+
+  this->Refit(grandParent);
+}
+
+/////////////////////////////////////////////////
+void SpatialIndexPrivate::Refit(int _node)
+{
+  while (_node >= 0)
+  {
+    _node = this->Balance(_node);
+
+    SpatialIndexNode &node = this->nodes[_node];
+    const SpatialIndexNode &child1 = this->nodes[node.child1];
+    const SpatialIndexNode &child2 = this->nodes[node.child2];
+    node.height = 1 + std::max(child1.height, child2.height);
+    node.box = merge(child1.box, child2.box);
+
+    _node = node.parent;
+  }
+}
+
+/////////////////////////////////////////////////
+int SpatialIndexPrivate::Balance(const int _node)
+{
+  // Rotate the higher child up, as in Box2D's b2DynamicTree
+  const int a = _node;
+  if (this->nodes[a].child1 < 0 || this->nodes[a].height < 2)
+    return a;
+
+  const int b = this->nodes[a].child1;
+  const int c = this->nodes[a].child2;
+  const int balance = this->nodes[c].height - this->nodes[b].height;
+  if (balance >= -1 && balance <= 1)
+    return a;
+
+  // Higher child, and its other sibling
+  const int up = balance > 1 ? c : b;
+  const int other = balance > 1 ? b : c;
+  const int f = this->nodes[up].child1;
+  const int g = this->nodes[up].child2;
+
+  // The higher child takes the place of a
+  this->nodes[up].child1 = a;
+  this->nodes[up].parent = this->nodes[a].parent;
+  this->nodes[a].parent = up;
+
+  const int upParent = this->nodes[up].parent;
+  if (upParent < 0)
+    this->root = up;
+  else if (this->nodes[upParent].child1 == a)
+    this->nodes[upParent].child1 = up;
+  else
+    this->nodes[upParent].child2 = up;
+
+  // The higher grandchild stays under the child, the other one moves to a
+  const int keep = this->nodes[f].height > this->nodes[g].height ? f : g;
+  const int move = keep == f ? g : f;
+  this->nodes[up].child2 = keep;
+  if (balance > 1)
+    this->nodes[a].child2 = move;
+  else
+    this->nodes[a].child1 = move;
+  this->nodes[move].parent = a;
+
+  this->nodes[a].box = merge(this->nodes[other].box, this->nodes[move].box);
+  this->nodes[a].height = 1 + std::max(this->nodes[other].height,
+      this->nodes[move].height);
+  this->nodes[up].box = merge(this->nodes[a].box, this->nodes[keep].box);
+  this->nodes[up].height = 1 + std::max(this->nodes[a].height,
+      this->nodes[keep].height);
+
+  return up;
+}
+
+/////////////////////////////////////////////////
+void SpatialIndexPrivate::UpdateLeaf(SpatialIndexProxy &_proxy)
+{
+  if (!_proxy.hasBox)
+  {
+    if (_proxy.node >= 0)
+    {
+      this->RemoveLeaf(_proxy.node);
+      this->FreeNode(_proxy.node);
+      _proxy.node = -1;
+    }
+    return;
+  }
+
+  if (_proxy.node >= 0)
+  {
+    // Entities moving within the margin don't change the tree
+    if (contains(this->nodes[_proxy.node].box, _proxy.box))
+      return;
+    this->RemoveLeaf(_proxy.node);
+  }
+  else
+  {
+    _proxy.node = this->AllocateNode();
+    this->nodes[_proxy.node].proxy = &_proxy;
+  }
+
+  const ignition::math::Vector3d margin(
+      this->margin, this->margin, this->margin);
+  this->nodes[_proxy.node].box = ignition::math::AxisAlignedBox(
+      _proxy.box.Min() - margin, _proxy.box.Max() + margin);
+  this->InsertLeaf(_proxy.node);
+}
+
+/////////////////////////////////////////////////
+template<typename Test>
+std::vector<EntityPtr> SpatialIndexPrivate::Query(const Test &_test,
+    const unsigned int _types) const
+{
+  std::vector<EntityPtr> result;
+  if (this->root < 0)
+    return result;
+
+  std::vector<int> stack;
+  stack.push_back(this->root);
+  while (!stack.empty())
+  {
+    const SpatialIndexNode &node = this->nodes[stack.back()];
+    stack.pop_back();
+
+    if (!_test(node.box))
+      continue;
+
+    if (node.child1 >= 0)
+    {
+      stack.push_back(node.child1);
+      stack.push_back(node.child2);
+    }
+    else if ((node.proxy->type & _types) && _test(node.proxy->box))
+    {
+      EntityPtr entity = node.proxy->entity.lock();
+      if (entity)
+        result.push_back(entity);
+    }
+  }
+  return result;
+}
+
+/////////////////////////////////////////////////
+SpatialIndex::SpatialIndex()
+  : dataPtr(new SpatialIndexPrivate)
+{
+}
+
+/////////////////////////////////////////////////
+SpatialIndex::~SpatialIndex()
+{
+}
+
+/////////////////////////////////////////////////
+void SpatialIndex::SetMargin(const double _margin)
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->margin = std::max(0.0, _margin);
+}
+
+/////////////////////////////////////////////////
+double SpatialIndex::Margin() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->margin;
+}
+
+/////////////////////////////////////////////////
+void SpatialIndex::Add(Entity *_entity)
+{
+  if (!_entity || !(_entity->HasType(Base::MODEL) ||
+        _entity->HasType(Base::LINK)))
+  {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  if (this->dataPtr->proxies.count(_entity))
+    return;
+
+  this->dataPtr->revision++;
+  SpatialIndexProxy &proxy = this->dataPtr->proxies[_entity];
+  proxy.entity =
+    boost::static_pointer_cast<Entity>(_entity->shared_from_this());
+  if (_entity->HasType(Base::MODEL))
+  {
+    proxy.type = Base::MODEL;
+    this->dataPtr->dirtyModels.insert(_entity);
+  }
+  else
+  {
+    proxy.type = Base::LINK;
+    proxy.model = static_cast<Link *>(_entity)->GetModel().get();
+    this->dataPtr->dirtyLinks.insert(_entity);
+  }
+}
+
+/////////////////////////////////////////////////
+void SpatialIndex::Remove(Entity *_entity)
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  auto iter = this->dataPtr->proxies.find(_entity);
+  if (iter == this->dataPtr->proxies.end())
+    return;
+
+  iter->second.hasBox = false;
+  this->dataPtr->UpdateLeaf(iter->second);
+  this->dataPtr->proxies.erase(iter);
+  this->dataPtr->revision++;
+  this->dataPtr->dirtyLinks.erase(_entity);
+  this->dataPtr->dirtyModels.erase(_entity);
+}
+
+/////////////////////////////////////////////////
+unsigned int SpatialIndex::Count() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->proxies.size();
+}
+
+/////////////////////////////////////////////////
+uint64_t SpatialIndex::Revision() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->revision;
+}
+
+/////////////////////////////////////////////////
+void SpatialIndex::MarkDirty(Entity *_entity)
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->dirtyLinks.insert(_entity);
+}
+
+/////////////////////////////////////////////////
+void SpatialIndex::MarkDirty(const std::list<Entity *> &_entities)
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->dirtyLinks.insert(_entities.begin(), _entities.end());
+}
+
+/////////////////////////////////////////////////
+void SpatialIndex::Refresh()
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+
+  // Links first, their boxes make up the boxes of the models
+  bool moved = false;
+  for (auto const entity : this->dataPtr->dirtyLinks)
+  {
+    auto iter = this->dataPtr->proxies.find(entity);
+    if (iter == this->dataPtr->proxies.end() ||
+        iter->second.type != Base::LINK)
+    {
+      continue;
+    }
+    moved = true;
+
+    SpatialIndexProxy &proxy = iter->second;
+    proxy.box = static_cast<const Link *>(entity)->BoundingBox();
+    proxy.hasBox = validBox(proxy.box);
+    this->dataPtr->UpdateLeaf(proxy);
+
+    if (proxy.model && this->dataPtr->proxies.count(proxy.model))
+      this->dataPtr->dirtyModels.insert(proxy.model);
+  }
+  this->dataPtr->dirtyLinks.clear();
+  if (moved)
+    this->dataPtr->revision++;
+
+  for (auto const entity : this->dataPtr->dirtyModels)
+  {
+    auto iter = this->dataPtr->proxies.find(entity);
+    if (iter == this->dataPtr->proxies.end())
+      continue;
+
+    SpatialIndexProxy &proxy = iter->second;
+    proxy.hasBox = false;
+    for (auto const &link : static_cast<const Model *>(entity)->GetLinks())
+    {
+      auto linkIter = this->dataPtr->proxies.find(link.get());
+      if (linkIter == this->dataPtr->proxies.end() ||
+          !linkIter->second.hasBox)
+      {
+        continue;
+      }
+
+      proxy.box = proxy.hasBox ? merge(proxy.box, linkIter->second.box) :
+        linkIter->second.box;
+      proxy.hasBox = true;
+    }
+    this->dataPtr->UpdateLeaf(proxy);
+  }
+  this->dataPtr->dirtyModels.clear();
+}
+
+/////////////////////////////////////////////////
+bool SpatialIndex::BoundingBox(const Entity *_entity,
+    ignition::math::AxisAlignedBox &_box) const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  auto iter = this->dataPtr->proxies.find(_entity);
+  if (iter == this->dataPtr->proxies.end() || !iter->second.hasBox)
+    return false;
+
+  _box = iter->second.box;
+  return true;
+}
+
+/////////////////////////////////////////////////
+std::vector<EntityPtr> SpatialIndex::FrustumQuery(
+    const ignition::math::Frustum &_frustum, const unsigned int _types) const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->Query(
+      [&_frustum](const ignition::math::AxisAlignedBox &_box)
+      {
+        return _frustum.Contains(_box);
+      }, _types);
+}
+
+/////////////////////////////////////////////////
+std::vector<EntityPtr> SpatialIndex::BoxQuery(
+    const ignition::math::AxisAlignedBox &_box,
+    const unsigned int _types) const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->Query(
+      [&_box](const ignition::math::AxisAlignedBox &_nodeBox)
+      {
+        return overlap(_box, _nodeBox);
+      }, _types);
+}
+
+/////////////////////////////////////////////////
+std::vector<EntityPtr> SpatialIndex::SphereQuery(
+    const ignition::math::Vector3d &_center, const double _radius,
+    const unsigned int _types) const
+{
+  const double radius2 = _radius * _radius;
+
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->Query(
+      [&_center, radius2](const ignition::math::AxisAlignedBox &_box)
+      {
+        return distanceSquared(_box, _center) <= radius2;
+      }, _types);
+}
+
+/////////////////////////////////////////////////
+std::vector<EntityPtr> SpatialIndex::NearestQuery(
+    const ignition::math::Vector3d &_point, const unsigned int _count,
+    const unsigned int _types) const
+{
+  std::vector<EntityPtr> result;
+
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  if (this->dataPtr->root < 0 || _count == 0)
+    return result;
+
+  // Best first search. Leaves are queued a second time with the distance to
+  // the box of their entity, which isn't smaller than the one to their
+  // enlarged box.
+  using Entry = std::tuple<double, int, bool>;
+  std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+  queue.emplace(distanceSquared(
+        this->dataPtr->nodes[this->dataPtr->root].box, _point),
+      this->dataPtr->root, false);
+
+  while (!queue.empty() && result.size() < _count)
+  {
+    const int index = std::get<1>(queue.top());
+    const bool exact = std::get<2>(queue.top());
+    queue.pop();
+
+    const SpatialIndexNode &node = this->dataPtr->nodes[index];
+    if (exact)
+    {
+      EntityPtr entity = node.proxy->entity.lock();
+      if (entity)
+        result.push_back(entity);
+    }
+    else if (node.child1 >= 0)
+    {
+      for (auto const child : {node.child1, node.child2})
+      {
+        queue.emplace(distanceSquared(this->dataPtr->nodes[child].box,
+              _point), child, false);
+      }
+    }
+    else if (node.proxy->type & _types)
+    {
+      queue.emplace(distanceSquared(node.proxy->box, _point), index, true);
+    }
+  }
+  return result;
+}
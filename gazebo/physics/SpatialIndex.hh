@@ -0,0 +1,166 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GAZEBO_PHYSICS_SPATIALINDEX_HH_
+#define GAZEBO_PHYSICS_SPATIALINDEX_HH_
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <vector>
+
+#include <ignition/math/AxisAlignedBox.hh>
+#include <ignition/math/Frustum.hh>
+#include <ignition/math/Vector3.hh>
+
+#include "gazebo/physics/Base.hh"
+#include "gazebo/physics/PhysicsTypes.hh"
+#include "gazebo/util/system.hh"
+
+namespace gazebo
+{
+  namespace physics
+  {
+    // Forward declare private data class.
+    class SpatialIndexPrivate;
+
+    /// \addtogroup gazebo_physics
+    /// \{
+
+    /// \class SpatialIndex SpatialIndex.hh physics/physics.hh
+    /// \brief Dynamic bounding volume tree of the models and links of a
+    /// world, used to find entities by location without visiting all of
+    /// them.
+    ///
+    /// Links are added by Link::Init and models by Model::Init, and both
+    /// are removed by their Fini. Moved links are marked dirty, by
+    /// World::Update for the poses computed by the physics engine and by
+    /// Link::OnPoseChange for the poses set from gazebo. Refresh then
+    /// recomputes the boxes of the dirty links and of their models. The
+    /// tree holds boxes enlarged by a margin, so that entities moving less
+    /// than the margin don't change the tree.
+    ///
+    /// The box of a model is the union of the boxes of its links, as
+    /// Model::BoundingBox, and entities without collisions aren't found by
+    /// queries. Queries can run on any thread, and return the entities
+    /// whose boxes, as of the last Refresh, match.
+    class GZ_PHYSICS_VISIBLE SpatialIndex
+    {
+      /// \brief Constructor.
+      public: SpatialIndex();
+
+      /// \brief Destructor.
+      public: ~SpatialIndex();
+
+      /// \brief Set the margin added to the boxes in the tree. Applies to
+      /// the entities reinserted afterwards.
+      /// \param[in] _margin Margin in meters.
+      public: void SetMargin(const double _margin);
+
+      /// \brief Get the margin added to the boxes in the tree.
+      /// \return Margin in meters.
+      public: double Margin() const;
+
+      /// \brief Add a model or a link. Its box is computed by the next
+      /// Refresh.
+      /// \param[in] _entity The model or link.
+      public: void Add(Entity *_entity);
+
+      /// \brief Remove a model or a link.
+      /// \param[in] _entity The model or link.
+      public: void Remove(Entity *_entity);
+
+      /// \brief Get the number of models and links in the index.
+      /// \return Number of entities.
+      public: unsigned int Count() const;
+
+      /// \brief Get the revision of the index, incremented when entities
+      /// are added or removed, and by each Refresh with moved links. It
+      /// can be used to cache results computed from a static scene.
+      /// \return The revision.
+      public: uint64_t Revision() const;
+
+      /// \brief Mark a link as moved, so that the next Refresh recomputes
+      /// its box and the box of its model.
+      /// \param[in] _entity The link. Other entities are ignored.
+      public: void MarkDirty(Entity *_entity);
+
+      /// \brief Mark links as moved.
+      /// \param[in] _entities The links, such as the dirty poses of a
+      /// world. Other entities are ignored.
+      public: void MarkDirty(const std::list<Entity *> &_entities);
+
+      /// \brief Recompute the boxes of the dirty entities and update the
+      /// tree. Must be called on the physics thread.
+      public: void Refresh();
+
+      /// \brief Get the box of an entity, as of the last Refresh.
+      /// \param[in] _entity The model or link.
+      /// \param[out] _box Its box.
+      /// \return False if the entity isn't in the index or has no box.
+      public: bool BoundingBox(const Entity *_entity,
+                  ignition::math::AxisAlignedBox &_box) const;
+
+      /// \brief Find the entities whose boxes intersect a frustum, with
+      /// the test of ignition::math::Frustum::Contains.
+      /// \param[in] _frustum The frustum.
+      /// \param[in] _types Types of entities to find, a combination of
+      /// Base::MODEL and Base::LINK.
+      /// \return The entities.
+      public: std::vector<EntityPtr> FrustumQuery(
+                  const ignition::math::Frustum &_frustum,
+                  const unsigned int _types = Base::MODEL | Base::LINK) const;
+
+      /// \brief Find the entities whose boxes intersect a box.
+      /// \param[in] _box The box.
+      /// \param[in] _types Types of entities to find, a combination of
+      /// Base::MODEL and Base::LINK.
+      /// \return The entities.
+      public: std::vector<EntityPtr> BoxQuery(
+                  const ignition::math::AxisAlignedBox &_box,
+                  const unsigned int _types = Base::MODEL | Base::LINK) const;
+
+      /// \brief Find the entities whose boxes intersect a sphere.
+      /// \param[in] _center Center of the sphere.
+      /// \param[in] _radius Radius of the sphere.
+      /// \param[in] _types Types of entities to find, a combination of
+      /// Base::MODEL and Base::LINK.
+      /// \return The entities.
+      public: std::vector<EntityPtr> SphereQuery(
+                  const ignition::math::Vector3d &_center,
+                  const double _radius,
+                  const unsigned int _types = Base::MODEL | Base::LINK) const;
+
+      /// \brief Find the entities whose boxes are nearest to a point.
+      /// \param[in] _point The point.
+      /// \param[in] _count Maximum number of entities to find.
+      /// \param[in] _types Types of entities to find, a combination of
+      /// Base::MODEL and Base::LINK.
+      /// \return The entities, nearest first. Entities whose boxes contain
+      /// the point are at distance 0.
+      public: std::vector<EntityPtr> NearestQuery(
+                  const ignition::math::Vector3d &_point,
+                  const unsigned int _count,
+                  const unsigned int _types = Base::MODEL | Base::LINK) const;
+
+      /// \internal
+      /// \brief Private data pointer.
+      private: std::unique_ptr<SpatialIndexPrivate> dataPtr;
+    };
+    /// \}
+  }
+}
+#endif
@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <set>
+#include <string>
+#include <vector>
+
+#include "gazebo/physics/SpatialIndex.hh"
+#include "gazebo/test/ServerFixture.hh"
+
+using namespace gazebo;
+
+class SpatialIndexTest : public ServerFixture {};
+
+/////////////////////////////////////////////////
+/// \brief Get the scoped names of entities.
+/// \param[in] _entities The entities.
+/// \return Their names.
+std::set<std::string> names(const std::vector<physics::EntityPtr> &_entities)
+{
+  std::set<std::string> result;
+  for (auto const &entity : _entities)
+    result.insert(entity->GetScopedName());
+  return result;
+}
+
+/////////////////////////////////////////////////
+TEST_F(SpatialIndexTest, Queries)
+{
+  this->Load("worlds/shapes.world", true);
+  physics::WorldPtr world = physics::get_world("default");
+  ASSERT_TRUE(world != nullptr);
+
+  physics::SpatialIndex *index = world->SpatialIndex();
+  ASSERT_TRUE(index != nullptr);
+
+  // Ground plane, box, sphere and cylinder, each with one link
+  EXPECT_EQ(8u, index->Count());
+
+  // The box of a model is the union of the boxes of its links
+  physics::ModelPtr box = world->ModelByName("box");
+  ASSERT_TRUE(box != nullptr);
+  ignition::math::AxisAlignedBox aabb;
+  ASSERT_TRUE(index->BoundingBox(box.get(), aabb));
+  EXPECT_EQ(box->BoundingBox(), aabb);
+  ASSERT_TRUE(index->BoundingBox(box->GetLink("link").get(), aabb));
+  EXPECT_EQ(box->GetLink("link")->BoundingBox(), aabb);
+
+  // The box is at the origin, the sphere at y = 1.5 and the cylinder at
+  // y = -1.5. The ground plane is below z = 0.
+  std::set<std::string> expected = {"box", "sphere"};
+  EXPECT_EQ(expected, names(index->BoxQuery(ignition::math::AxisAlignedBox(
+            ignition::math::Vector3d(-0.1, 0.2, 0.2),
+            ignition::math::Vector3d(0.1, 1.2, 0.8)), physics::Base::MODEL)));
+
+  expected = {"sphere::link"};
+  EXPECT_EQ(expected, names(index->SphereQuery(
+          ignition::math::Vector3d(0, 3, 2), 1.5, physics::Base::LINK)));
+
+  auto nearest = index->NearestQuery(ignition::math::Vector3d(0, -3, 4), 1,
+      physics::Base::MODEL);
+  ASSERT_EQ(1u, nearest.size());
+  EXPECT_EQ("cylinder", nearest[0]->GetScopedName());
+
+  // Frustum looking at the sphere from above, away from the ground
+  ignition::math::Frustum frustum(0.1, 2.8, IGN_DTOR(20), 1.0,
+      ignition::math::Pose3d(0, 1.5, 3, 0, IGN_PI_2, 0));
+  expected = {"sphere"};
+  EXPECT_EQ(expected, names(index->FrustumQuery(frustum,
+          physics::Base::MODEL)));
+
+  // Moved entities are found at their new location after a step
+  physics::ModelPtr sphere = world->ModelByName("sphere");
+  ASSERT_TRUE(sphere != nullptr);
+  sphere->SetWorldPose(ignition::math::Pose3d(10, 10, 0.5, 0, 0, 0));
+  world->Step(1);
+
+  EXPECT_TRUE(index->SphereQuery(ignition::math::Vector3d(0, 3, 2), 1.5,
+        physics::Base::LINK).empty());
+  expected = {"sphere", "sphere::link"};
+  EXPECT_EQ(expected, names(index->SphereQuery(
+          ignition::math::Vector3d(10, 10, 2), 1.2)));
+
+  // Removed entities aren't found anymore
+  world->RemoveModel("sphere");
+  EXPECT_EQ(6u, index->Count());
+  EXPECT_TRUE(index->SphereQuery(ignition::math::Vector3d(10, 10, 2),
+        1.2).empty());
+}
+
+/////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
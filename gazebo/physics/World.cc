@@ -22,9 +22,12 @@
 
 #include <sdf/sdf.hh>
 
+#include <cmath>
 #include <deque>
+#include <limits>
 #include <list>
 #include <set>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -51,6 +54,9 @@
 #include "gazebo/common/Events.hh"
 #include "gazebo/common/Exception.hh"
 #include "gazebo/common/Console.hh"
+#include "gazebo/common/HeightmapData.hh"
+#include "gazebo/common/MeshManager.hh"
+#include "gazebo/common/Pacer.hh"
 #include "gazebo/common/Plugin.hh"
 #include "gazebo/common/SdfFrameSemantics.hh"
 #include "gazebo/common/Time.hh"
@@ -77,6 +83,9 @@
 #include "gazebo/physics/Light.hh"
 #include "gazebo/physics/Actor.hh"
 #include "gazebo/physics/Wind.hh"
+#include "gazebo/physics/ForceField.hh"
+#include "gazebo/physics/SpatialIndex.hh"
+#include "gazebo/physics/LineOfSight.hh"
 #include "gazebo/physics/WorldPrivate.hh"
 #include "gazebo/physics/World.hh"
 #include "gazebo/common/SphericalCoordinates.hh"
@@ -106,6 +115,108 @@ class ModelUpdate_TBB
   private: Model_V *models;
 };
 
+/////////////////////////////////////////////////
+/// \brief Collect the resolved paths of the meshes and heightmaps used by
+/// the collisions below an SDF element.
+/// \param[in] _sdf Element to scan.
+/// \param[out] _meshes Paths to mesh files.
+/// \param[out] _heightmaps Paths to heightmap files.
+static void collectCollisionAssets(sdf::ElementPtr _sdf,
+    std::vector<std::string> &_meshes, std::vector<std::string> &_heightmaps)
+{
+  if (_sdf->GetName() == "collision")
+  {
+    if (!_sdf->HasElement("geometry"))
+      return;
+
+    sdf::ElementPtr geomElem = _sdf->GetElement("geometry");
+    for (auto const &type : {"mesh", "heightmap"})
+    {
+      if (!geomElem->HasElement(type))
+        continue;
+
+      // Resolve the uri like MeshShape and HeightmapShape do, so that the
+      // preloaded data is found under the same name.
+      std::string filename = common::find_file(
+          geomElem->GetElement(type)->Get<std::string>("uri"));
+      if (filename.empty() || filename == "__default__")
+        continue;
+
+      if (std::string(type) == "mesh")
+        _meshes.push_back(filename);
+      else
+        _heightmaps.push_back(filename);
+    }
+    return;
+  }
+
+  sdf::ElementPtr childElem = _sdf->GetFirstElement();
+  while (childElem)
+  {
+    collectCollisionAssets(childElem, _meshes, _heightmaps);
+    childElem = childElem->GetNextElement();
+  }
+}
+
+/////////////////////////////////////////////////
+/// \brief Configure a pacer from the <gazebo:pacer> element of a world.
+/// \param[in] _sdf The world element.
+/// \param[in] _pacer The pacer to configure.
+static void loadPacer(sdf::ElementPtr _sdf, common::Pacer *_pacer)
+{
+  if (!_sdf->HasElement("gazebo:pacer"))
+    return;
+  sdf::ElementPtr pacerElem = _sdf->GetElement("gazebo:pacer");
+
+  if (pacerElem->HasElement("gazebo:catch_up"))
+  {
+    const std::string policy =
+      pacerElem->GetElement("gazebo:catch_up")->Get<std::string>();
+    if (policy == "none")
+      _pacer->SetCatchUpPolicy(common::Pacer::CATCH_UP_NONE);
+    else if (policy == "bounded")
+      _pacer->SetCatchUpPolicy(common::Pacer::CATCH_UP_BOUNDED);
+    else if (policy == "full")
+      _pacer->SetCatchUpPolicy(common::Pacer::CATCH_UP_FULL);
+    else
+    {
+      gzerr << "Invalid <gazebo:catch_up> policy [" << policy
+            << "], expected none, bounded or full\n";
+    }
+  }
+
+  if (pacerElem->HasElement("gazebo:max_catch_up_steps"))
+  {
+    _pacer->SetMaxCatchUpSteps(pacerElem->GetElement(
+          "gazebo:max_catch_up_steps")->Get<unsigned int>());
+  }
+
+  if (pacerElem->HasElement("gazebo:spin_time"))
+  {
+    _pacer->SetSpinTime(
+        pacerElem->GetElement("gazebo:spin_time")->Get<double>());
+  }
+
+  if (pacerElem->HasElement("gazebo:cpu_affinity"))
+  {
+    // A list of CPU indices, separated by spaces
+    std::istringstream stream(
+        pacerElem->GetElement("gazebo:cpu_affinity")->Get<std::string>());
+    std::vector<unsigned int> cpus;
+    unsigned int cpu;
+    while (stream >> cpu)
+      cpus.push_back(cpu);
+
+    if (!stream.eof())
+    {
+      gzerr << "Invalid <gazebo:cpu_affinity> [" << stream.str()
+            << "], expected a list of CPU indices\n";
+    }
+    else
+      _pacer->SetCpuAffinity(cpus);
+  }
+}
+
 //////////////////////////////////////////////////
 World::World(const std::string &_name)
   : dataPtr(new WorldPrivate)
@@ -146,7 +257,7 @@ World::World(const std::string &_name)
   this->dataPtr->enableWind = true;
   this->dataPtr->enableAtmosphere = true;
 
-  this->dataPtr->sleepOffset = common::Time(0);
+  this->dataPtr->pacer.reset(new common::Pacer());
 
   this->dataPtr->prevStatTime = common::Time::GetWallTime();
   this->dataPtr->prevProcessMsgsTime = common::Time::GetWallTime();
@@ -258,6 +369,10 @@ void World::Load(sdf::ElementPtr _sdf)
   this->dataPtr->statPub =
     this->dataPtr->node->Advertise<msgs::WorldStatistics>(
         "~/world_stats", 100, 5);
+  this->dataPtr->pacingPub =
+    this->dataPtr->node->Advertise<msgs::PacingStatistics>(
+        "~/world_stats/pacing", 100, 5);
+  loadPacer(this->dataPtr->sdf, this->dataPtr->pacer.get());
   this->dataPtr->modelPub = this->dataPtr->node->Advertise<msgs::Model>(
       "~/model/info");
   this->dataPtr->lightPub = this->dataPtr->node->Advertise<msgs::Light>(
@@ -297,6 +412,10 @@ void World::Load(sdf::ElementPtr _sdf)
 
   this->dataPtr->wind->Load(windElem);
 
+  this->dataPtr->forceField.reset(new physics::ForceField(*this));
+  this->dataPtr->spatialIndex.reset(new physics::SpatialIndex());
+  this->dataPtr->lineOfSight.reset(new physics::LineOfSight(*this));
+
   // This should come after loading physics engine
   sdf::ElementPtr atmosphereElem = this->dataPtr->sdf->GetElement("atmosphere");
 
@@ -332,6 +451,26 @@ void World::Load(sdf::ElementPtr _sdf)
   this->dataPtr->rootElement->SetName(this->Name());
   this->dataPtr->rootElement->SetWorld(shared_from_this());
 
+  // Decode the meshes and heightmaps of all collisions on worker threads,
+  // so that creating the entities below only hits the caches.
+  {
+    common::Time startTime = common::Time::GetWallTime();
+    std::vector<std::string> meshes;
+    std::vector<std::string> heightmaps;
+    collectCollisionAssets(this->dataPtr->sdf, meshes, heightmaps);
+
+    unsigned int meshCount = common::MeshManager::Instance()->Preload(meshes);
+    unsigned int heightmapCount =
+      common::HeightmapDataLoader::Preload(heightmaps);
+
+    if (meshCount > 0 || heightmapCount > 0)
+    {
+      gzlog << "Preloaded " << meshCount << " meshes and " << heightmapCount
+            << " heightmaps in "
+            << (common::Time::GetWallTime() - startTime).Double() << " s\n";
+    }
+  }
+
   // A special order is necessary when loading a world that contains state
   // information. The joints must be created last, otherwise they get
   // initialized improperly.
@@ -343,6 +482,9 @@ void World::Load(sdf::ElementPtr _sdf)
       this->ModelByIndex(i)->LoadJoints();
   }
 
+  // Free heightmaps that no shape claimed.
+  common::HeightmapDataLoader::ClearPreloaded();
+
   // TODO: Performance test to see if TBB model updating is necessary
   // Choose threaded or unthreaded model updating depending on the number of
   // models in the scene
@@ -420,6 +562,9 @@ void World::Init(UpdateScenePosesFunc _func)
   // Initialize the physics engine
   this->dataPtr->physicsEngine->Init();
 
+  // Compute the boxes of the entities for the queries before the first step
+  this->dataPtr->spatialIndex->Refresh();
+
   this->dataPtr->presetManager = PresetManagerPtr(
       new PresetManager(this->dataPtr->physicsEngine, this->dataPtr->sdf));
 
@@ -534,7 +679,7 @@ void World::RunLoop()
   if (this->IsPaused())
     this->dataPtr->pauseStartTime = this->dataPtr->startTime;
 
-  this->dataPtr->prevStepWallTime = common::Time::GetWallTime();
+  this->dataPtr->pacer->Reset();
 
   // Get the first state
   this->dataPtr->prevStates[0] = WorldState(shared_from_this());
@@ -671,6 +816,20 @@ void World::SetSensorWaitFunc(std::function<void(double, double)> _func)
   this->dataPtr->waitForSensors = _func;
 }
 
+/////////////////////////////////////////////////
+void World::SetSensorPipelining(const bool _enable)
+{
+  std::lock_guard<std::recursive_mutex> lock(this->dataPtr->receiveMutex);
+  this->dataPtr->sensorPipelining = _enable;
+  this->dataPtr->scenePosesTime = std::numeric_limits<double>::quiet_NaN();
+}
+
+/////////////////////////////////////////////////
+bool World::SensorPipelining() const
+{
+  return this->dataPtr->sensorPipelining;
+}
+
 //////////////////////////////////////////////////
 void World::Step()
 {
@@ -693,42 +852,28 @@ void World::Step()
 
   DIAG_TIMER_LAP("World::Step", "publishWorldStats");
 
-  if (this->dataPtr->waitForSensors)
+  // When pipelined, the wait happens before the next poses are sent to the
+  // scene instead, see ProcessMessages.
+  if (this->dataPtr->waitForSensors &&
+      !(this->dataPtr->sensorPipelining && this->dataPtr->updateScenePoses))
+  {
     this->dataPtr->waitForSensors(this->dataPtr->simTime.Double(),
         this->dataPtr->physicsEngine->GetMaxStepSize());
-
-  double updatePeriod = this->dataPtr->physicsEngine->GetUpdatePeriod();
-  // sleep here to get the correct update rate
-  common::Time tmpTime = common::Time::GetWallTime();
-  common::Time sleepTime = this->dataPtr->prevStepWallTime +
-    common::Time(updatePeriod) - tmpTime - this->dataPtr->sleepOffset;
-
-  common::Time actualSleep;
-  if (sleepTime > 0)
-  {
-    common::Time::Sleep(sleepTime);
-    actualSleep = common::Time::GetWallTime() - tmpTime;
   }
-  else
-    sleepTime = 0;
 
-  // exponentially avg out
-  this->dataPtr->sleepOffset = (actualSleep - sleepTime) * 0.01 +
-                      this->dataPtr->sleepOffset * 0.99;
+  // Wait for the deadline of this step. Changing the update rate restarts
+  // the schedule.
+  this->dataPtr->pacer->SetPeriod(
+      this->dataPtr->physicsEngine->GetUpdatePeriod());
+  this->dataPtr->pacer->Wait();
 
-  DIAG_TIMER_LAP("World::Step", "sleepOffset");
+  DIAG_TIMER_LAP("World::Step", "pacer");
 
-  // throttling update rate, with sleepOffset as tolerance
-  // the tolerance is needed as the sleep time is not exact
-  if (common::Time::GetWallTime() - this->dataPtr->prevStepWallTime +
-      this->dataPtr->sleepOffset >= common::Time(updatePeriod))
   {
     std::lock_guard<std::recursive_mutex> lock(this->dataPtr->worldUpdateMutex);
 
     DIAG_TIMER_LAP("World::Step", "worldUpdateMutex");
 
-    this->dataPtr->prevStepWallTime = common::Time::GetWallTime();
-
     double stepTime = this->dataPtr->physicsEngine->GetMaxStepSize();
 
     if (!this->IsPaused() || this->dataPtr->stepInc > 0
@@ -750,6 +895,11 @@ void World::Step()
       if (util::LogRecord::Instance()->BufferSize() > 0)
         util::LogRecord::Instance()->Notify();
       this->dataPtr->pauseTime += stepTime;
+
+      // Entities moved while paused
+      boost::recursive_mutex::scoped_lock plock(
+          *this->Physics()->GetPhysicsUpdateMutex());
+      this->dataPtr->spatialIndex->Refresh();
     }
   }
 
@@ -788,6 +938,50 @@ void World::Step(const unsigned int _steps)
   }
 }
 
+//////////////////////////////////////////////////
+void World::StepDetached(const unsigned int _steps)
+{
+  // The calling thread may change from one call to the next.
+  this->dataPtr->physicsEngine->InitForThread();
+
+  {
+    std::lock_guard<std::recursive_mutex> lock(this->dataPtr->worldUpdateMutex);
+
+    if (!this->dataPtr->pluginsLoaded)
+    {
+      this->LoadPlugins();
+      this->dataPtr->pluginsLoaded = true;
+    }
+
+    for (unsigned int i = 0; i < _steps; ++i)
+    {
+      // query timestep to allow dynamic time step size updates
+      this->dataPtr->simTime += this->dataPtr->physicsEngine->GetMaxStepSize();
+      this->dataPtr->iterations++;
+      this->Update();
+    }
+  }
+
+  this->ProcessMessages();
+}
+
+//////////////////////////////////////////////////
+/// \brief Add the time elapsed since the start of a phase of
+/// World::Update to its accumulated time, and start the next phase.
+/// \param[in,out] _data World data.
+/// \param[in] _phase Phase that ended.
+/// \param[in,out] _start Start time of the phase, set to the current
+/// time.
+static void profileLap(WorldPrivate *_data,
+    const WorldPrivate::UpdatePhase _phase,
+    std::chrono::steady_clock::time_point &_start)
+{
+  auto now = std::chrono::steady_clock::now();
+  _data->updatePhaseTimes[_phase] +=
+    std::chrono::duration<double>(now - _start).count();
+  _start = now;
+}
+
 //////////////////////////////////////////////////
 void World::Update()
 {
@@ -806,8 +1000,21 @@ void World::Update()
   }
   DIAG_TIMER_LAP("World::Update", "needsReset");
 
+  const bool profile = this->dataPtr->profileUpdates;
+  std::chrono::steady_clock::time_point lapStart;
+  if (profile)
+    lapStart = std::chrono::steady_clock::now();
+
   this->dataPtr->updateInfo.simTime = this->SimTime();
   this->dataPtr->updateInfo.realTime = this->RealTime();
+
+  // Wind and force fields, evaluated for all links in one pass
+  this->dataPtr->forceField->Update();
+
+  DIAG_TIMER_LAP("World::Update", "ForceField::Update");
+  if (profile)
+    profileLap(this->dataPtr, WorldPrivate::PHASE_FORCE_FIELDS, lapStart);
+
   event::Events::worldUpdateBegin(this->dataPtr->updateInfo);
 
   DIAG_TIMER_LAP("World::Update", "Events::worldUpdateBegin");
@@ -816,11 +1023,15 @@ void World::Update()
   (*this.*dataPtr->modelUpdateFunc)();
 
   DIAG_TIMER_LAP("World::Update", "Model::Update");
+  if (profile)
+    profileLap(this->dataPtr, WorldPrivate::PHASE_MODELS, lapStart);
 
   // This must be called before PhysicsEngine::UpdatePhysics for ODE.
   this->dataPtr->physicsEngine->UpdateCollision();
 
   DIAG_TIMER_LAP("World::Update", "PhysicsEngine::UpdateCollision");
+  if (profile)
+    profileLap(this->dataPtr, WorldPrivate::PHASE_COLLISION, lapStart);
 
   // Wait for logging to finish, if it's running.
   if (util::LogRecord::Instance()->Running())
@@ -851,6 +1062,8 @@ void World::Update()
     this->dataPtr->physicsEngine->UpdatePhysics();
 
     DIAG_TIMER_LAP("World::Update", "PhysicsEngine::UpdatePhysics");
+    if (profile)
+      profileLap(this->dataPtr, WorldPrivate::PHASE_PHYSICS, lapStart);
 
     // do this after physics update as
     //   ode --> MoveCallback sets the dirtyPoses
@@ -865,10 +1078,21 @@ void World::Update()
         dirtyEntity->SetWorldPose(dirtyEntity->DirtyPose(), false);
       }
 
+      this->dataPtr->spatialIndex->MarkDirty(this->dataPtr->dirtyPoses);
       this->dataPtr->dirtyPoses.clear();
+      this->dataPtr->spatialIndex->Refresh();
     }
 
     DIAG_TIMER_LAP("World::Update", "SetWorldPose(dirtyPoses)");
+    if (profile)
+      profileLap(this->dataPtr, WorldPrivate::PHASE_POSES, lapStart);
+  }
+  else
+  {
+    // Poses can still be set from gazebo
+    boost::recursive_mutex::scoped_lock plock(
+        *this->Physics()->GetPhysicsUpdateMutex());
+    this->dataPtr->spatialIndex->Refresh();
   }
 
   // Only update state information if logging data.
@@ -883,11 +1107,44 @@ void World::Update()
 
   event::Events::worldUpdateEnd();
 
+  if (profile)
+  {
+    profileLap(this->dataPtr, WorldPrivate::PHASE_CONTACTS, lapStart);
+    this->dataPtr->profiledUpdates++;
+  }
+
   gazebo::util::IntrospectionManager::Instance()->Update();
 
   DIAG_TIMER_STOP("World::Update");
 }
 
+//////////////////////////////////////////////////
+void World::SetUpdateProfiling(const bool _enable)
+{
+  std::lock_guard<std::recursive_mutex> lock(this->dataPtr->worldUpdateMutex);
+  if (_enable)
+  {
+    this->dataPtr->updatePhaseTimes.fill(0.0);
+    this->dataPtr->profiledUpdates = 0;
+  }
+  this->dataPtr->profileUpdates = _enable;
+}
+
+//////////////////////////////////////////////////
+std::map<std::string, double> World::UpdateProfile() const
+{
+  std::lock_guard<std::recursive_mutex> lock(this->dataPtr->worldUpdateMutex);
+  const auto &times = this->dataPtr->updatePhaseTimes;
+  return {
+    {"force_fields", times[WorldPrivate::PHASE_FORCE_FIELDS]},
+    {"models", times[WorldPrivate::PHASE_MODELS]},
+    {"collision", times[WorldPrivate::PHASE_COLLISION]},
+    {"physics", times[WorldPrivate::PHASE_PHYSICS]},
+    {"poses", times[WorldPrivate::PHASE_POSES]},
+    {"contacts", times[WorldPrivate::PHASE_CONTACTS]},
+    {"updates", static_cast<double>(this->dataPtr->profiledUpdates)}};
+}
+
 //////////////////////////////////////////////////
 void World::Fini()
 {
@@ -913,6 +1170,7 @@ void World::Fini()
     this->dataPtr->guiPub.reset();
     this->dataPtr->responsePub.reset();
     this->dataPtr->statPub.reset();
+    this->dataPtr->pacingPub.reset();
     this->dataPtr->modelPub.reset();
     this->dataPtr->lightPub.reset();
     this->dataPtr->lightFactoryPub.reset();
@@ -981,6 +1239,9 @@ void World::Fini()
   this->dataPtr->userCmdManager.reset();
 
   this->dataPtr->atmosphere.reset();
+  this->dataPtr->forceField.reset();
+  this->dataPtr->lineOfSight.reset();
+  this->dataPtr->spatialIndex.reset();
   this->dataPtr->wind.reset();
 
   // Engine shouldn't outlive world
@@ -1051,6 +1312,30 @@ Wind &World::Wind() const
   return *this->dataPtr->wind;
 }
 
+//////////////////////////////////////////////////
+ForceField *World::ForceField() const
+{
+  return this->dataPtr->forceField.get();
+}
+
+//////////////////////////////////////////////////
+SpatialIndex *World::SpatialIndex() const
+{
+  return this->dataPtr->spatialIndex.get();
+}
+
+//////////////////////////////////////////////////
+LineOfSight *World::LineOfSight() const
+{
+  return this->dataPtr->lineOfSight.get();
+}
+
+//////////////////////////////////////////////////
+common::Pacer *World::Pacer() const
+{
+  return this->dataPtr->pacer.get();
+}
+
 //////////////////////////////////////////////////
 Atmosphere &World::Atmosphere() const
 {
@@ -2237,6 +2522,7 @@ void World::ProcessFactoryMsgs()
       if (model != nullptr)
       {
         model->Init();
+        this->dataPtr->spatialIndex->Refresh();
         model->LoadPlugins();
       }
     }
@@ -2658,6 +2944,18 @@ bool World::OnLog(std::ostringstream &_stream)
 //////////////////////////////////////////////////
 void World::ProcessMessages()
 {
+  // The scene merges the poses it receives. Before the poses of this step
+  // replace the previous ones, let the sensors due at the previous step
+  // capture them. This is done without holding any lock, so the sensors
+  // can keep rendering while physics computes the next step.
+  if (this->dataPtr->sensorPipelining && this->dataPtr->waitForSensors &&
+      this->dataPtr->updateScenePoses &&
+      !std::isnan(this->dataPtr->scenePosesTime))
+  {
+    this->dataPtr->waitForSensors(this->dataPtr->scenePosesTime,
+        this->dataPtr->physicsEngine->GetMaxStepSize());
+  }
+
   {
     std::lock_guard<std::recursive_mutex> lock(this->dataPtr->receiveMutex);
 
@@ -2668,10 +2966,12 @@ void World::ProcessMessages()
         (this->dataPtr->poseLocalPub &&
          this->dataPtr->poseLocalPub->HasConnections()))
     {
-      msgs::PosesStamped msg;
+      // The message is shared by the publishers, without copies
+      boost::shared_ptr<msgs::PosesStamped> msg =
+        this->dataPtr->posesPool.Acquire();
 
       // Time stamp this PosesStamped message
-      msgs::Set(msg.mutable_time(), this->SimTime());
+      msgs::Set(msg->mutable_time(), this->SimTime());
 
       if (!this->dataPtr->publishModelPoses.empty() ||
           !this->dataPtr->publishLightPoses.empty())
@@ -2684,7 +2984,7 @@ void World::ProcessMessages()
           {
             ModelPtr m = modelList.front();
             modelList.pop_front();
-            msgs::Pose *poseMsg = msg.add_pose();
+            msgs::Pose *poseMsg = msg->add_pose();
 
             // Publish the model's relative pose
             poseMsg->set_name(m->GetScopedName());
@@ -2695,7 +2995,7 @@ void World::ProcessMessages()
             Link_V links = m->GetLinks();
             for (auto const &link : links)
             {
-              poseMsg = msg.add_pose();
+              poseMsg = msg->add_pose();
               poseMsg->set_name(link->GetScopedName());
               poseMsg->set_id(link->GetId());
               msgs::Set(poseMsg, link->RelativePose());
@@ -2710,7 +3010,7 @@ void World::ProcessMessages()
 
         for (auto const &light : this->dataPtr->publishLightPoses)
         {
-          msgs::Pose *poseMsg = msg.add_pose();
+          msgs::Pose *poseMsg = msg->add_pose();
 
           // Publish the light's pose
           poseMsg->set_name(light->GetScopedName());
@@ -2735,7 +3035,9 @@ void World::ProcessMessages()
       // Execute callback to export Pose msg
       if (this->dataPtr->updateScenePoses)
       {
-        this->dataPtr->updateScenePoses(this->Name(), msg);
+        this->dataPtr->updateScenePoses(this->Name(), *msg);
+        if (this->dataPtr->sensorPipelining)
+          this->dataPtr->scenePosesTime = this->SimTime().Double();
       }
     }
 
@@ -2854,6 +3156,32 @@ void World::PublishWorldStats()
 
   if (this->dataPtr->statPub && this->dataPtr->statPub->HasConnections())
     this->dataPtr->statPub->Publish(this->dataPtr->worldStatsMsg);
+
+  if (this->dataPtr->pacingPub &&
+      this->dataPtr->pacingPub->HasConnections())
+  {
+    common::PacerStatistics stats = this->dataPtr->pacer->Statistics();
+
+    msgs::PacingStatistics pacingMsg;
+    msgs::Set(pacingMsg.mutable_real_time(), this->RealTime());
+    pacingMsg.set_period(this->dataPtr->pacer->Period());
+    pacingMsg.set_steps(stats.steps);
+    pacingMsg.set_late_steps(stats.lateSteps);
+    pacingMsg.set_mean_latency(stats.meanLatency);
+    pacingMsg.set_max_latency(stats.maxLatency);
+    pacingMsg.set_mean_jitter(stats.meanJitter);
+    pacingMsg.set_max_jitter(stats.maxJitter);
+    for (unsigned int i = 0; i < stats.latencyHistogram.size(); ++i)
+    {
+      if (i + 1 < stats.latencyHistogram.size())
+      {
+        pacingMsg.add_latency_bounds(
+            common::PacerStatistics::LatencyBound(i));
+      }
+      pacingMsg.add_latency_histogram(stats.latencyHistogram[i]);
+    }
+    this->dataPtr->pacingPub->Publish(pacingMsg);
+  }
   this->dataPtr->prevStatTime = common::Time::GetWallTime();
 }
 
@@ -17,6 +17,7 @@
 #ifndef GAZEBO_PHYSICS_WORLD_HH_
 #define GAZEBO_PHYSICS_WORLD_HH_
 
+#include <map>
 #include <vector>
 #include <list>
 #include <set>
@@ -155,6 +156,42 @@ namespace gazebo
       /// \return Reference to the wind.
       public: physics::Wind &Wind() const;
 
+      /// \brief Get the force field stage of the world, which evaluates
+      /// the wind and the registered force field providers before each
+      /// physics update.
+      /// \return Pointer to the force field, nullptr if the world is not
+      /// loaded.
+      public: physics::ForceField *ForceField() const;
+
+      /// \brief Get the spatial index of the models and links of the
+      /// world, refreshed after each update from the poses of the moved
+      /// links.
+      /// \return Pointer to the spatial index, nullptr if the world is not
+      /// loaded.
+      public: physics::SpatialIndex *SpatialIndex() const;
+
+      /// \brief Get the batched line of sight queries of the world.
+      /// \return Pointer to the line of sight queries, nullptr if the world
+      /// is not loaded.
+      public: physics::LineOfSight *LineOfSight() const;
+
+      /// \brief Get the pacer which keeps the steps of the world at the
+      /// real time update rate. It can be used to change the catch up
+      /// policy, or to pin the world thread to a set of CPUs. These can
+      /// also be set in the world SDF, for example:
+      ///
+      ///   <gazebo:pacer>
+      ///     <gazebo:catch_up>bounded</gazebo:catch_up>
+      ///     <gazebo:max_catch_up_steps>5</gazebo:max_catch_up_steps>
+      ///     <gazebo:spin_time>0.0001</gazebo:spin_time>
+      ///     <gazebo:cpu_affinity>2 3</gazebo:cpu_affinity>
+      ///   </gazebo:pacer>
+      ///
+      /// The catch up policy is none, bounded or full. Its statistics are
+      /// published on ~/world_stats/pacing.
+      /// \return Pointer to the pacer.
+      public: common::Pacer *Pacer() const;
+
       /// \brief Return the spherical coordinates converter.
       /// \return Pointer to the spherical coordinates converter.
       public: common::SphericalCoordinatesPtr SphericalCoords() const;
@@ -331,6 +368,27 @@ namespace gazebo
       /// \param[in] _steps The number of steps the World should take.
       public: void Step(const unsigned int _steps);
 
+      /// \brief Step the world forward in time on the calling thread,
+      /// without real-time pacing. This is meant for worlds that do not
+      /// run their own update loop, such as worlds created by
+      /// physics::fork_world.
+      /// \param[in] _steps The number of steps the World should take.
+      public: void StepDetached(const unsigned int _steps);
+
+      /// \brief Enable or disable timing of the phases of an update. The
+      /// accumulated times are reset when profiling is enabled.
+      /// \param[in] _enable True to time updates.
+      /// \sa UpdateProfile
+      public: void SetUpdateProfiling(const bool _enable);
+
+      /// \brief Get the accumulated wall time of the phases of an update
+      /// since profiling was enabled, in seconds. The phases are
+      /// "force_fields", "models", "collision", "physics", "poses" and
+      /// "contacts". The "updates" entry holds the number of updates timed.
+      /// \return Map of phase names to times.
+      /// \sa SetUpdateProfiling
+      public: std::map<std::string, double> UpdateProfile() const;
+
       /// \brief Load a plugin
       /// \param[in] _filename The filename of the plugin.
       /// \param[in] _name A unique name for the plugin.
@@ -463,6 +521,22 @@ namespace gazebo
       /// \param[in] function to be called
       public: void SetSensorWaitFunc(std::function<void(double, double)> _func);
 
+      /// \brief Pipeline the sensors with physics in lockstep mode. When
+      /// enabled, physics computes step N+1 while the sensors render step N
+      /// from the poses sent to the scene. Physics only blocks before
+      /// sending the poses of step N+1, until the sensors due at step N have
+      /// captured them, so sensor data keeps the time stamps of strict
+      /// lockstep. Has no effect unless the scene poses are updated through
+      /// the direct API.
+      /// \param[in] _enable True to enable pipelining.
+      /// \sa SetSensorWaitFunc
+      public: void SetSensorPipelining(const bool _enable);
+
+      /// \brief Get whether the sensors are pipelined with physics.
+      /// \return True if pipelining is enabled.
+      /// \sa SetSensorPipelining
+      public: bool SensorPipelining() const;
+
       /// \cond
       /// This is an internal function.
       /// \brief Get a model by id.
@@ -660,6 +734,11 @@ namespace gazebo
 
       /// Friend SimbodyPhysics so that it has access to dataPtr->dirtyPoses
       private: friend class SimbodyPhysics;
+
+      /// Friend fork_world so that it can hold dataPtr->worldUpdateMutex
+      /// while it copies the world.
+      private: friend WorldPtr fork_world(WorldPtr _world,
+                   const std::string &_name);
     };
     /// \}
   }
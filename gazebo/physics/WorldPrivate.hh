@@ -17,9 +17,12 @@
 #ifndef GAZEBO_PHYSICS_WORLDPRIVATE_HH_
 #define GAZEBO_PHYSICS_WORLDPRIVATE_HH_
 
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <deque>
 #include <vector>
+#include <limits>
 #include <list>
 #include <memory>
 #include <set>
@@ -32,11 +35,13 @@
 #include <ignition/transport.hh>
 
 #include "gazebo/common/Event.hh"
+#include "gazebo/common/Pacer.hh"
 #include "gazebo/common/Time.hh"
 #include "gazebo/common/URI.hh"
 
 #include "gazebo/msgs/msgs.hh"
 
+#include "gazebo/transport/MessagePool.hh"
 #include "gazebo/transport/TransportTypes.hh"
 
 #include "gazebo/physics/PhysicsTypes.hh"
@@ -49,8 +54,8 @@ namespace gazebo
     /// \brief Private data class for World.
     class WorldPrivate
     {
-      /// \brief For keeping track of time step throttling.
-      public: common::Time prevStepWallTime;
+      /// \brief Paces the steps at the real time update rate.
+      public: std::unique_ptr<common::Pacer> pacer;
 
       /// \brief Pointer the physics engine.
       public: PhysicsEnginePtr physicsEngine;
@@ -58,6 +63,15 @@ namespace gazebo
       /// \brief Unique pointer the wind. The world owns this pointer.
       public: std::unique_ptr<Wind> wind;
 
+      /// \brief Force field stage, evaluated before each physics update.
+      public: std::unique_ptr<ForceField> forceField;
+
+      /// \brief Spatial index of the models and links.
+      public: std::unique_ptr<SpatialIndex> spatialIndex;
+
+      /// \brief Batched line of sight queries.
+      public: std::unique_ptr<LineOfSight> lineOfSight;
+
       /// \brief Unique pointer the atmosphere model.
       /// The world owns this pointer.
       public: std::unique_ptr<Atmosphere> atmosphere;
@@ -101,6 +115,9 @@ namespace gazebo
       /// \brief Publisher for world statistics messages.
       public: transport::PublisherPtr statPub;
 
+      /// \brief Publisher for pacing statistics messages.
+      public: transport::PublisherPtr pacingPub;
+
       /// \brief Publisher for request response messages.
       public: transport::PublisherPtr responsePub;
 
@@ -152,6 +169,10 @@ namespace gazebo
       /// \brief Outgoing world statistics message.
       public: msgs::WorldStatistics worldStatsMsg;
 
+      /// \brief Pose messages built by ProcessMessages each step, recycled
+      /// once they are sent.
+      public: transport::MessagePool<msgs::PosesStamped> posesPool;
+
       /// \brief Outgoing scene message.
       public: msgs::Scene sceneMsg;
 
@@ -250,9 +271,6 @@ namespace gazebo
       /// \brief True if the plugins have been loaded.
       public: bool pluginsLoaded;
 
-      /// \brief sleep timing error offset due to clock wake up latency
-      public: common::Time sleepOffset;
-
       /// \brief Last time incoming messages were processed.
       public: common::Time prevProcessMsgsTime;
 
@@ -383,8 +401,52 @@ namespace gazebo
       /// \brief Callback function intended to call the scene with updated Poses
       public: UpdateScenePosesFunc updateScenePoses;
 
+      /// \brief True to pipeline the sensors with physics.
+      public: bool sensorPipelining = false;
+
+      /// \brief Sim time of the last poses sent to the scene, NaN if none
+      /// were sent since pipelining was enabled.
+      public: double scenePosesTime = std::numeric_limits<double>::quiet_NaN();
+
       /// \brief SDF World DOM object
       public: std::unique_ptr<sdf::World> worldSDFDom;
+
+      /// \brief Phases of World::Update timed when profiling is enabled.
+      public: enum UpdatePhase
+      {
+        /// \brief ForceField::Update.
+        PHASE_FORCE_FIELDS,
+
+        /// \brief Events::worldUpdateBegin and Model::Update.
+        PHASE_MODELS,
+
+        /// \brief PhysicsEngine::UpdateCollision.
+        PHASE_COLLISION,
+
+        /// \brief Events::beforePhysicsUpdate and
+        /// PhysicsEngine::UpdatePhysics.
+        PHASE_PHYSICS,
+
+        /// \brief Propagation of the poses changed by the physics engine.
+        PHASE_POSES,
+
+        /// \brief ContactManager::PublishContacts and
+        /// Events::worldUpdateEnd.
+        PHASE_CONTACTS,
+
+        /// \brief Number of phases.
+        PHASE_COUNT
+      };
+
+      /// \brief True to time the phases of World::Update.
+      public: bool profileUpdates = false;
+
+      /// \brief Accumulated wall time of each phase of World::Update, in
+      /// seconds.
+      public: std::array<double, PHASE_COUNT> updatePhaseTimes{};
+
+      /// \brief Number of updates timed.
+      public: uint64_t profiledUpdates = 0;
     };
   }
 }
@@ -15,6 +15,7 @@
  *
 */
 
+#include "gazebo/common/Pacer.hh"
 #include "gazebo/physics/PhysicsTypes.hh"
 #include "gazebo/physics/World.hh"
 #include "gazebo/test/ServerFixture.hh"
@@ -216,6 +217,82 @@ TEST_F(WorldTest, Stop)
   EXPECT_TRUE(world->Running());
 }
 
+//////////////////////////////////////////////////
+TEST_F(WorldTest, UpdateProfile)
+{
+  this->Load("worlds/shapes.world", true);
+
+  auto world = physics::get_world("default");
+  ASSERT_NE(nullptr, world);
+
+  // Profiling is disabled by default
+  world->Step(10);
+  auto profile = world->UpdateProfile();
+  EXPECT_DOUBLE_EQ(0.0, profile["updates"]);
+  EXPECT_DOUBLE_EQ(0.0, profile["physics"]);
+
+  world->SetUpdateProfiling(true);
+  world->Step(20);
+  profile = world->UpdateProfile();
+  EXPECT_EQ(7u, profile.size());
+  EXPECT_DOUBLE_EQ(20.0, profile["updates"]);
+  for (auto const &phase : {"force_fields", "models", "collision", "physics",
+        "poses", "contacts"})
+  {
+    EXPECT_GE(profile[phase], 0.0) << phase;
+  }
+  EXPECT_GT(profile["physics"], 0.0);
+
+  // Enabling profiling again resets the accumulated times
+  world->SetUpdateProfiling(true);
+  EXPECT_DOUBLE_EQ(0.0, world->UpdateProfile()["updates"]);
+
+  // Times stop accumulating once profiling is disabled
+  world->Step(5);
+  world->SetUpdateProfiling(false);
+  world->Step(5);
+  EXPECT_DOUBLE_EQ(5.0, world->UpdateProfile()["updates"]);
+}
+
+//////////////////////////////////////////////////
+TEST_F(WorldTest, Pacer)
+{
+  this->Load("worlds/shapes.world", true);
+
+  auto world = physics::get_world("default");
+  ASSERT_NE(nullptr, world);
+
+  common::Pacer *pacer = world->Pacer();
+  ASSERT_NE(nullptr, pacer);
+
+  // The world loop is paced at the real time update rate, even when paused
+  pacer->ResetStatistics();
+  common::Time::MSleep(100);
+  EXPECT_DOUBLE_EQ(world->Physics()->GetUpdatePeriod(), pacer->Period());
+  EXPECT_GT(pacer->Statistics().steps, 0u);
+
+  // Changing the update rate changes the period
+  world->Physics()->SetRealTimeUpdateRate(100);
+  world->Step(1);
+  EXPECT_DOUBLE_EQ(0.01, pacer->Period());
+}
+
+//////////////////////////////////////////////////
+TEST_F(WorldTest, PacerSDF)
+{
+  this->Load("test/worlds/pacer.world", true);
+
+  auto world = physics::get_world("default");
+  ASSERT_NE(nullptr, world);
+
+  common::Pacer *pacer = world->Pacer();
+  ASSERT_NE(nullptr, pacer);
+  EXPECT_EQ(common::Pacer::CATCH_UP_BOUNDED, pacer->CatchUpPolicy());
+  EXPECT_EQ(5u, pacer->MaxCatchUpSteps());
+  EXPECT_DOUBLE_EQ(0.0001, pacer->SpinTime());
+  EXPECT_EQ(std::vector<unsigned int>({0}), pacer->CpuAffinity());
+}
+
 //////////////////////////////////////////////////
 int main(int argc, char **argv)
 {
@@ -21,6 +21,8 @@
 
 #include "gazebo/common/Assert.hh"
 #include "gazebo/physics/Link.hh"
+#include "gazebo/physics/SpatialIndex.hh"
+#include "gazebo/physics/World.hh"
 #include "gazebo/physics/bullet/BulletPhysics.hh"
 #include "gazebo/physics/bullet/BulletLink.hh"
 #include "gazebo/physics/bullet/BulletMotionState.hh"
@@ -81,6 +83,12 @@ void BulletMotionState::setWorldTransform(const btTransform &/*_cogWorldTrans*/)
   // \TODO: consider using the dirtyPose mechanism employed by ODE.
   this->link->SetWorldPose(pose, false);
 
+  // Without the notification, the spatial index has to be told that the
+  // link moved
+  WorldPtr world = this->link->GetWorld();
+  if (world && world->SpatialIndex())
+    world->SpatialIndex()->MarkDirty(this->link.get());
+
   // below is inefficient as we end up double caching for some joints
   // should consider adding a "dirty" flag.
   // or trying doing this during BulletPhysics::InternalTickCallback(...)
@@ -16,10 +16,23 @@
 */
 
 #include <algorithm>
+#include <map>
+#include <mutex>
 #include <string>
 
 #include <ignition/math/Rand.hh>
 
+#ifdef LIBBULLET_VERSION_GE_288
+#include <BulletCollision/CollisionDispatch/btCollisionDispatcherMt.h>
+// The path of the multi-threaded solver header is too long for one line
+#define GZ_BULLET_SOLVER_MT_HEADER \
+  <BulletDynamics/ConstraintSolver/btSequentialImpulseConstraintSolverMt.h>
+#include GZ_BULLET_SOLVER_MT_HEADER
+#undef GZ_BULLET_SOLVER_MT_HEADER
+#include <BulletDynamics/Dynamics/btDiscreteDynamicsWorldMt.h>
+#include <LinearMath/btThreads.h>
+#endif
+
 #include "gazebo/physics/bullet/BulletTypes.hh"
 #include "gazebo/physics/bullet/BulletLink.hh"
 #include "gazebo/physics/bullet/BulletCollision.hh"
@@ -69,6 +82,38 @@ GZ_REGISTER_PHYSICS_ENGINE("bullet", BulletPhysics)
 extern ContactAddedCallback gContactAddedCallback;
 extern ContactProcessedCallback gContactProcessedCallback;
 
+/// \brief Multi-threading state of a bullet physics engine.
+struct BulletThreading
+{
+  /// \brief Pool of solvers used to solve the simulation islands in
+  /// parallel, nullptr if the dynamics world is single-threaded.
+  btConstraintSolver *solverPool = nullptr;
+
+  /// \brief Number of threads used to step the dynamics world.
+  int islandThreads = 1;
+};
+
+// Added here to avoid breaking the ABI
+// TODO move to BulletPhysics when merging forward
+/// \brief Multi-threading state of each bullet physics engine.
+static std::map<const BulletPhysics *, BulletThreading> bulletThreading;
+
+/// \brief Protects bulletThreading, shared by the engines of all the
+/// worlds.
+static std::mutex bulletThreadingMutex;
+
+//////////////////////////////////////////////////
+/// \brief Get the multi-threading state of an engine. Entries of a map
+/// aren't moved by insertions, so the reference stays valid until the
+/// engine is destroyed.
+/// \param[in] _engine The engine.
+/// \return The state, created if needed.
+static BulletThreading &threading(const BulletPhysics *_engine)
+{
+  std::lock_guard<std::mutex> lock(bulletThreadingMutex);
+  return bulletThreading[_engine];
+}
+
 //////////////////////////////////////////////////
 struct CollisionFilter : public btOverlapFilterCallback
 {
@@ -237,6 +282,30 @@ void InternalTickCallback(btDynamicsWorld *_world, btScalar _timeStep)
   UpdateContacts(_world, _timeStep);
 }
 
+#ifdef LIBBULLET_VERSION_GE_288
+//////////////////////////////////////////////////
+/// \brief Get the task scheduler of the multi-threaded dynamics worlds.
+/// Bullet has a single scheduler, shared by all of the worlds, which is
+/// created on first use. TBB is preferred, since Gazebo already uses it.
+/// \return The scheduler, nullptr if Bullet was built without thread
+/// support.
+static btITaskScheduler *taskScheduler()
+{
+  static btITaskScheduler *scheduler = []()
+  {
+    btITaskScheduler *result = btGetTBBTaskScheduler();
+    if (!result)
+      result = btGetOpenMPTaskScheduler();
+    if (!result)
+      result = btCreateDefaultTaskScheduler();
+    if (result)
+      btSetTaskScheduler(result);
+    return result;
+  }();
+  return scheduler;
+}
+#endif
+
 //////////////////////////////////////////////////
 bool ContactCallback(btManifoldPoint &_cp,
     const btCollisionObjectWrapper *_obj0, int /*_partId0*/, int /*_index0*/,
@@ -266,9 +335,6 @@ BulletPhysics::BulletPhysics(WorldPtr _world)
   // Default setup for memory and collisions
   this->collisionConfig = new btDefaultCollisionConfiguration();
 
-  // Default collision dispatcher, a multi-threaded dispatcher may be available
-  this->dispatcher = new btCollisionDispatcher(this->collisionConfig);
-
   // Broadphase collision detection uses axis-aligned bounding boxes (AABB)
   // to detect pairs of objects that may be in contact.
   // The narrow-phase collision detection evaluates each pair generated by the
@@ -281,40 +347,133 @@ BulletPhysics::BulletPhysics(WorldPtr _world)
   // Here we are using btDbvtBroadphase.
   this->broadPhase = new btDbvtBroadphase();
 
-  // Create btSequentialImpulseConstraintSolver, the default constraint solver.
-  // Note that a multi-threaded solver may be available.
-  this->solver = new btSequentialImpulseConstraintSolver;
-
-  // Create a btDiscreteDynamicsWorld, which is used for discrete rigid bodies.
-  // An alternative is btSoftRigidDynamicsWorld, which handles both soft and
-  // rigid bodies.
-  this->dynamicsWorld = new btDiscreteDynamicsWorld(this->dispatcher,
-      this->broadPhase, this->solver, this->collisionConfig);
-
   btOverlapFilterCallback *filterCallback = new CollisionFilter();
-  btOverlappingPairCache* pairCache = this->dynamicsWorld->getPairCache();
+  btOverlappingPairCache* pairCache =
+      this->broadPhase->getOverlappingPairCache();
   GZ_ASSERT(pairCache != nullptr,
       "Bullet broadphase overlapping pair cache is null");
   pairCache->setOverlapFilterCallback(filterCallback);
 
+  // The dynamics world is single-threaded until island_threads is set
+  this->dispatcher = nullptr;
+  this->solver = nullptr;
+  this->dynamicsWorld = nullptr;
+  this->CreateDynamicsWorld(false);
+
   // TODO: Enable this to do custom contact setting
   gContactAddedCallback = ContactCallback;
   gContactProcessedCallback = ContactProcessed;
 
-  this->dynamicsWorld->setInternalTickCallback(
-      InternalTickCallback, static_cast<void *>(this));
-
   // Set random seed for physics engine based on gazebo's random seed.
   // Note: this was moved from physics::PhysicsEngine constructor.
   this->SetSeed(ignition::math::Rand::Seed());
+}
+
+//////////////////////////////////////////////////
+void BulletPhysics::CreateDynamicsWorld(const bool _multiThreaded)
+{
+  // Delete in reverse-order of creation
+  BulletThreading &state = threading(this);
+  delete this->dynamicsWorld;
+  delete this->solver;
+  delete state.solverPool;
+  delete this->dispatcher;
+  state.solverPool = nullptr;
+
+#ifdef LIBBULLET_VERSION_GE_288
+  if (_multiThreaded)
+  {
+    // The multi-threaded dispatcher runs the narrowphase of the collision
+    // pairs in parallel. The simulation islands are solved in parallel by a
+    // pool of sequential impulse solvers, and the islands too large to be
+    // solved by one thread are split in batches by the multi-threaded
+    // solver.
+    this->dispatcher = new btCollisionDispatcherMt(this->collisionConfig);
+    btConstraintSolverPoolMt *pool =
+        new btConstraintSolverPoolMt(BT_MAX_THREAD_COUNT);
+    state.solverPool = pool;
+    this->solver = new btSequentialImpulseConstraintSolverMt;
+    this->dynamicsWorld = new btDiscreteDynamicsWorldMt(this->dispatcher,
+        this->broadPhase, pool, this->solver, this->collisionConfig);
+  }
+  else
+#endif
+  {
+    GZ_ASSERT(!_multiThreaded, "Bullet multi-threading is not available");
+
+    // Default collision dispatcher
+    this->dispatcher = new btCollisionDispatcher(this->collisionConfig);
+
+    // Create btSequentialImpulseConstraintSolver, the default constraint
+    // solver.
+    this->solver = new btSequentialImpulseConstraintSolver;
+
+    // Create a btDiscreteDynamicsWorld, which is used for discrete rigid
+    // bodies. An alternative is btSoftRigidDynamicsWorld, which handles both
+    // soft and rigid bodies.
+    this->dynamicsWorld = new btDiscreteDynamicsWorld(this->dispatcher,
+        this->broadPhase, this->solver, this->collisionConfig);
+  }
+
+  // Contacts are reported once the step is solved, from the thread that
+  // steps the world.
+  this->dynamicsWorld->setInternalTickCallback(
+      InternalTickCallback, static_cast<void *>(this));
+
+  btGImpactCollisionAlgorithm::registerAlgorithm(this->dispatcher);
+}
+
+//////////////////////////////////////////////////
+bool BulletPhysics::SetIslandThreads(const int _threads)
+{
+  boost::recursive_mutex::scoped_lock lock(*this->physicsUpdateMutex);
+
+  BulletThreading &state = threading(this);
+  const int threads = std::max(1, _threads);
+  if (threads == state.islandThreads)
+    return true;
+
+#ifdef LIBBULLET_VERSION_GE_288
+  btITaskScheduler *scheduler = taskScheduler();
+  if (!scheduler)
+  {
+    gzwarn << "Bullet was built without BT_THREADSAFE, "
+           << "island_threads is ignored\n";
+    return false;
+  }
 
-  btGImpactCollisionAlgorithm::registerAlgorithm(dispatcher);
+  if (!state.solverPool && threads > 1)
+  {
+    // Collision objects can't be moved to another dynamics world, since
+    // links and joints keep pointers to it.
+    if (this->dynamicsWorld->getNumCollisionObjects() > 0)
+    {
+      gzwarn << "Bullet island_threads must be set before models are "
+             << "loaded\n";
+      return false;
+    }
+    this->CreateDynamicsWorld(true);
+  }
+
+  // The scheduler is shared by all the dynamics worlds
+  scheduler->setNumThreads(
+      std::min(threads, scheduler->getMaxNumThreads()));
+  state.islandThreads = threads;
+  return true;
+#else
+  gzwarn << "Bullet " << BT_BULLET_VERSION << " doesn't support "
+         << "multi-threading, island_threads is ignored\n";
+  return false;
+#endif
 }
 
 //////////////////////////////////////////////////
 BulletPhysics::~BulletPhysics()
 {
   this->Fini();
+
+  std::lock_guard<std::mutex> lock(bulletThreadingMutex);
+  bulletThreading.erase(this);
 }
 
 //////////////////////////////////////////////////
@@ -324,6 +483,20 @@ void BulletPhysics::Load(sdf::ElementPtr _sdf)
 
   sdf::ElementPtr bulletElem = this->sdf->GetElement("bullet");
 
+  // Must come first, since it may replace the dynamics world. The
+  // sdformat bullet schema has no island_threads element yet, so the
+  // option is also read from the custom <gazebo:island_threads> element.
+  sdf::ElementPtr solverElem = bulletElem->GetElement("solver");
+  if (solverElem->HasElement("island_threads"))
+  {
+    this->SetIslandThreads(solverElem->Get<int>("island_threads"));
+  }
+  else if (solverElem->HasElement("gazebo:island_threads"))
+  {
+    this->SetIslandThreads(
+        solverElem->GetElement("gazebo:island_threads")->Get<int>());
+  }
+
   auto g = this->world->Gravity();
   // ODEPhysics checks this, so we will too.
   if (g == ignition::math::Vector3d::Zero)
@@ -528,6 +701,10 @@ void BulletPhysics::Fini()
     delete this->solver;
   this->solver = nullptr;
 
+  BulletThreading &state = threading(this);
+  delete state.solverPool;
+  state.solverPool = nullptr;
+
   if (this->broadPhase)
     delete this->broadPhase;
   this->broadPhase = nullptr;
@@ -645,6 +822,10 @@ bool BulletPhysics::SetParam(const std::string &_key, const boost::any &_value)
       double value = any_cast<double>(_value);
       bulletElem->GetElement("solver")->GetElement("min_step_size")->Set(value);
     }
+    else if (_key == "island_threads")
+    {
+      return this->SetIslandThreads(any_cast<int>(_value));
+    }
     else
     {
       return PhysicsEngine::SetParam(_key, _value);
@@ -707,6 +888,8 @@ bool BulletPhysics::GetParam(const std::string &_key, boost::any &_value) const
     _value = this->sdf->GetElement("max_contacts")->Get<int>();
   else if (_key == "min_step_size")
     _value = bulletElem->GetElement("solver")->Get<double>("min_step_size");
+  else if (_key == "island_threads")
+    _value = threading(this).islandThreads;
   else
   {
     return PhysicsEngine::GetParam(_key, _value);
@@ -172,6 +172,19 @@ namespace gazebo
       // Documentation inherited
       public: virtual void SetSORPGSIters(unsigned int iters);
 
+      /// \brief Create the dispatcher, the solver and the dynamics world.
+      /// The dynamics world must not hold any collision object.
+      /// \param[in] _multiThreaded True to create the multi-threaded
+      /// versions, which dispatch the collision pairs and solve the
+      /// simulation islands in parallel.
+      private: void CreateDynamicsWorld(const bool _multiThreaded);
+
+      /// \brief Set the number of threads used to step the dynamics world.
+      /// \param[in] _threads Number of threads.
+      /// \return False if multi-threading is not available, or if it was
+      /// requested after collision objects were added.
+      private: bool SetIslandThreads(const int _threads);
+
       private: btBroadphaseInterface *broadPhase;
       private: btDefaultCollisionConfiguration *collisionConfig;
       private: btCollisionDispatcher *dispatcher;
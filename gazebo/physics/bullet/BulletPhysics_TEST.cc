@@ -108,6 +108,14 @@ TEST_F(BulletPhysics_TEST, PhysicsParam)
   EXPECT_DOUBLE_EQ(splitImpulsePenetrationThreshold,
     splitImpulsePenetrationThresholdRet);
 
+  // The dynamics world can't become multi-threaded once models are loaded
+  value = bulletPhysics->GetParam("island_threads");
+  EXPECT_EQ(1, boost::any_cast<int>(value));
+  EXPECT_TRUE(bulletPhysics->SetParam("island_threads", 1));
+  EXPECT_FALSE(bulletPhysics->SetParam("island_threads", 4));
+  value = bulletPhysics->GetParam("island_threads");
+  EXPECT_EQ(1, boost::any_cast<int>(value));
+
   // Set params to different values and verify the old values are correctly
   // replaced by the new ones.
   iters = 55;
@@ -267,6 +275,49 @@ TEST_F(BulletPhysics_TEST, PhysicsMsgParam)
   PhysicsMsgParam();
 }
 
+/////////////////////////////////////////////////
+/// Test stepping a multi-threaded dynamics world
+TEST_F(BulletPhysics_TEST, IslandThreads)
+{
+  Load("test/worlds/bullet_island_threads.world", true);
+  WorldPtr world = get_world("default");
+  ASSERT_TRUE(world != nullptr);
+
+  PhysicsEnginePtr physics = world->Physics();
+  ASSERT_TRUE(physics != nullptr);
+  EXPECT_EQ(physics->GetType(), "bullet");
+
+  // The world is multi-threaded only if Bullet supports it
+  int threads = boost::any_cast<int>(physics->GetParam("island_threads"));
+  if (threads == 1)
+  {
+    gzwarn << "Bullet multi-threading is not available, "
+           << "skipping test" << std::endl;
+    return;
+  }
+  EXPECT_EQ(4, threads);
+
+  // The boxes fall and rest on the ground plane
+  world->Step(1000);
+  for (int i = 0; i < 4; ++i)
+  {
+    ModelPtr model = world->ModelByName("box_" + std::to_string(i));
+    ASSERT_TRUE(model != nullptr);
+    EXPECT_NEAR(0.5, model->WorldPose().Pos().Z(), 1e-2);
+  }
+
+  // The thread count can still change, without a new dynamics world
+  EXPECT_TRUE(physics->SetParam("island_threads", 2));
+  threads = boost::any_cast<int>(physics->GetParam("island_threads"));
+  EXPECT_EQ(2, threads);
+  world->Step(100);
+  for (int i = 0; i < 4; ++i)
+  {
+    ModelPtr model = world->ModelByName("box_" + std::to_string(i));
+    EXPECT_NEAR(0.5, model->WorldPose().Pos().Z(), 1e-2);
+  }
+}
+
 /////////////////////////////////////////////////
 /// Main
 int main(int argc, char **argv)
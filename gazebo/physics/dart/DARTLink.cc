@@ -305,6 +305,7 @@ void DARTLink::OnPoseChange()
   }
 
   Link::OnPoseChange();
+  this->dataPtr->syncedTransformValid = false;
 
   // DART body node always have its parent joint.
   dart::dynamics::Joint *joint = this->dataPtr->dtBodyNode->getParentJoint();
@@ -554,8 +555,8 @@ void DARTLink::AddForceAtWorldPosition(const ignition::math::Vector3d &_force,
     return;
   }
 
-  this->dataPtr->dtBodyNode->addExtForce(DARTTypes::ConvVec3(_pos),
-                                DARTTypes::ConvVec3(_force),
+  this->dataPtr->dtBodyNode->addExtForce(DARTTypes::ConvVec3(_force),
+                                DARTTypes::ConvVec3(_pos),
                                 false, false);
 }
 
@@ -956,9 +957,21 @@ void DARTLink::updateDirtyPoseFromDARTTransformation()
   }
 
   // Step 1: get dart body's transformation
+  const Eigen::Isometry3d &transform =
+      this->dataPtr->dtBodyNode->getTransform();
+
+  // Bodies at rest keep exactly the same transformation, their pose doesn't
+  // need to be synchronized again.
+  if (this->dataPtr->syncedTransformValid &&
+      transform.matrix() == this->dataPtr->syncedTransform.matrix())
+  {
+    return;
+  }
+  this->dataPtr->syncedTransform = transform;
+  this->dataPtr->syncedTransformValid = true;
+
   // Step 2: set gazebo link's pose using the transformation
-  ignition::math::Pose3d newPose = DARTTypes::ConvPoseIgn(
-      this->dataPtr->dtBodyNode->getTransform());
+  ignition::math::Pose3d newPose = DARTTypes::ConvPoseIgn(transform);
 
   // Set the new pose to this link
   this->dirtyPose = newPose;
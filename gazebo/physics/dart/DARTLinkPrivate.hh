@@ -51,7 +51,9 @@ namespace gazebo
           dartChildJoints {},
           isSoftBody(false),
           staticLink(false),
-          dtWeldJointConst(nullptr)
+          dtWeldJointConst(nullptr),
+          syncedTransform(Eigen::Isometry3d::Identity()),
+          syncedTransformValid(false)
       {
       }
 
@@ -180,6 +182,13 @@ namespace gazebo
 
       /// \brief Weld joint constraint for SetLinkStatic()
       public: dart::constraint::WeldJointConstraintPtr dtWeldJointConst;
+
+      /// \brief DART transformation last copied to the link pose.
+      public: Eigen::Isometry3d syncedTransform;
+
+      /// \brief True if syncedTransform is still the pose of the link. Reset
+      /// when the pose is set from gazebo.
+      public: bool syncedTransformValid;
     };
   }
 }
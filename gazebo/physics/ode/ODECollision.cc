@@ -19,7 +19,12 @@
  * Date: 13 Feb 2006
  */
 
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
 #include <sstream>
+#include <unordered_map>
+#include <vector>
 
 #include "gazebo/common/Assert.hh"
 #include "gazebo/common/Console.hh"
@@ -32,6 +37,31 @@
 using namespace gazebo;
 using namespace physics;
 
+/// \brief Convex geoms that replace the geom of a collision in the
+/// generation of contacts.
+struct ConvexHulls
+{
+  /// \brief ODE ids of the convex geoms.
+  std::vector<dGeomID> ids;
+
+  /// \brief Position of each convex geom in the frame of the collision
+  /// geom.
+  std::vector<ignition::math::Vector3d> centers;
+};
+
+// Added here to avoid breaking the ABI
+// TODO move to ODECollision when merging forward
+/// \brief Convex hulls of the collisions that have some.
+static std::unordered_map<const ODECollision *, ConvexHulls> convexHulls;
+
+/// \brief Protects convexHulls. Lookups from the collision callbacks only
+/// take a shared lock.
+static std::shared_timed_mutex convexHullsMutex;
+
+/// \brief Number of entries in convexHulls, so that the collision
+/// callbacks skip the lookup when no collision has hulls.
+static std::atomic<size_t> convexHullsCount{0};
+
 //////////////////////////////////////////////////
 ODECollision::ODECollision(LinkPtr _link)
 : Collision(_link)
@@ -88,6 +118,9 @@ void ODECollision::Fini()
      this->spaceId = nullptr;
      */
 
+  // The hulls use the arrays of the shape, which is released below
+  this->ClearConvexHulls();
+
   Collision::Fini();
 }
 
@@ -203,6 +236,104 @@ ODESurfaceParamsPtr ODECollision::GetODESurface() const
   return boost::dynamic_pointer_cast<ODESurfaceParams>(this->surface);
 }
 
+/////////////////////////////////////////////////
+void ODECollision::AddConvexHull(dGeomID _hullId,
+    const ignition::math::Vector3d &_center)
+{
+  dGeomSetData(_hullId, this);
+
+  std::lock_guard<std::shared_timed_mutex> lock(convexHullsMutex);
+  ConvexHulls &hulls = convexHulls[this];
+  hulls.ids.push_back(_hullId);
+  hulls.centers.push_back(_center);
+  convexHullsCount = convexHulls.size();
+}
+
+/////////////////////////////////////////////////
+void ODECollision::ClearConvexHulls()
+{
+  if (convexHullsCount == 0)
+    return;
+
+  std::lock_guard<std::shared_timed_mutex> lock(convexHullsMutex);
+  auto iter = convexHulls.find(this);
+  if (iter == convexHulls.end())
+    return;
+
+  for (auto const hullId : iter->second.ids)
+    dGeomDestroy(hullId);
+  convexHulls.erase(iter);
+  convexHullsCount = convexHulls.size();
+}
+
+/////////////////////////////////////////////////
+unsigned int ODECollision::ConvexHullCount() const
+{
+  if (convexHullsCount == 0)
+    return 0;
+
+  std::shared_lock<std::shared_timed_mutex> lock(convexHullsMutex);
+  auto iter = convexHulls.find(this);
+  return iter == convexHulls.end() ? 0 : iter->second.ids.size();
+}
+
+/////////////////////////////////////////////////
+dGeomID ODECollision::ConvexHullId(const unsigned int _index) const
+{
+  if (convexHullsCount == 0)
+    return nullptr;
+
+  std::shared_lock<std::shared_timed_mutex> lock(convexHullsMutex);
+  auto iter = convexHulls.find(this);
+  if (iter == convexHulls.end() || _index >= iter->second.ids.size())
+    return nullptr;
+  return iter->second.ids[_index];
+}
+
+/////////////////////////////////////////////////
+void ODECollision::PlaceConvexHulls()
+{
+  if (convexHullsCount == 0 || !this->collisionId)
+    return;
+
+  std::shared_lock<std::shared_timed_mutex> lock(convexHullsMutex);
+  auto iter = convexHulls.find(this);
+  if (iter == convexHulls.end())
+    return;
+  const ConvexHulls &hulls = iter->second;
+
+  // Hulls of dynamic collisions are offset from the body like the
+  // collision geom, the others are placed in the world.
+  dBodyID body = dGeomGetBody(this->collisionId);
+  const dReal *pos = body ? dGeomGetOffsetPosition(this->collisionId) :
+    dGeomGetPosition(this->collisionId);
+  const dReal *rot = body ? dGeomGetOffsetRotation(this->collisionId) :
+    dGeomGetRotation(this->collisionId);
+
+  for (unsigned int i = 0; i < hulls.ids.size(); ++i)
+  {
+    dVector3 center = {hulls.centers[i].X(), hulls.centers[i].Y(),
+      hulls.centers[i].Z(), 0};
+    dVector3 offset;
+    dMultiply0_331(offset, rot, center);
+
+    if (body)
+    {
+      if (dGeomGetBody(hulls.ids[i]) != body)
+        dGeomSetBody(hulls.ids[i], body);
+      dGeomSetOffsetPosition(hulls.ids[i], pos[0] + offset[0],
+          pos[1] + offset[1], pos[2] + offset[2]);
+      dGeomSetOffsetRotation(hulls.ids[i], rot);
+    }
+    else
+    {
+      dGeomSetPosition(hulls.ids[i], pos[0] + offset[0],
+          pos[1] + offset[1], pos[2] + offset[2]);
+      dGeomSetRotation(hulls.ids[i], rot);
+    }
+  }
+}
+
 /////////////////////////////////////////////////
 void ODECollision::OnPoseChangeGlobal()
 {
@@ -227,6 +358,8 @@ void ODECollision::OnPoseChangeGlobal()
   dGeomSetPosition(this->collisionId, localPose.Pos().X(),
       localPose.Pos().Y(), localPose.Pos().Z());
   dGeomSetQuaternion(this->collisionId, q);
+
+  this->PlaceConvexHulls();
 }
 
 /////////////////////////////////////////////////
@@ -254,6 +387,8 @@ void ODECollision::OnPoseChangeRelative()
   dGeomSetOffsetPosition(this->collisionId,
       localPose.Pos().X(), localPose.Pos().Y(), localPose.Pos().Z());
   dGeomSetOffsetQuaternion(this->collisionId, q);
+
+  this->PlaceConvexHulls();
 }
 
 /////////////////////////////////////////////////
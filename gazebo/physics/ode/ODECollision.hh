@@ -22,6 +22,8 @@
 #ifndef _ODECOLLISION_HH_
 #define _ODECOLLISION_HH_
 
+#include <ignition/math/Vector3.hh>
+
 #include "gazebo/physics/ode/ode_inc.h"
 
 #include "gazebo/physics/PhysicsTypes.hh"
@@ -90,6 +92,33 @@ namespace gazebo
       /// \return Dynamically casted pointer to ODESurfaceParams.
       public: ODESurfaceParamsPtr GetODESurface() const;
 
+      /// \brief Add a convex hull that replaces the collision geom in the
+      /// generation of contacts. The collision takes ownership of the hull,
+      /// which must not be in a space.
+      /// \param[in] _hullId ODE id of the convex geom.
+      /// \param[in] _center Position of the origin of the convex geom in
+      /// the frame of the collision geom.
+      /// \sa PlaceConvexHulls
+      public: void AddConvexHull(dGeomID _hullId,
+                  const ignition::math::Vector3d &_center);
+
+      /// \brief Destroy the convex hulls of the collision.
+      public: void ClearConvexHulls();
+
+      /// \brief Get the number of convex hulls.
+      /// \return Number of convex hulls, 0 if the collision geom is used.
+      public: unsigned int ConvexHullCount() const;
+
+      /// \brief Get a convex hull.
+      /// \param[in] _index Index of the hull.
+      /// \return ODE id of the convex geom, or null if _index is out of
+      /// range.
+      public: dGeomID ConvexHullId(const unsigned int _index) const;
+
+      /// \brief Move the convex hulls to the pose of the collision geom,
+      /// and attach them to its body.
+      public: void PlaceConvexHulls();
+
       /// \brief Used when this is static to set the posse.
       private: void OnPoseChangeGlobal();
 
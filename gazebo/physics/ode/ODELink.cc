@@ -336,6 +336,7 @@ void ODELink::UpdateCollisionOffsets()
           dGeomSetOffsetPosition(g->GetCollisionId(),
               localPose.Pos().X(), localPose.Pos().Y(), localPose.Pos().Z());
           dGeomSetOffsetQuaternion(g->GetCollisionId(), q);
+          g->PlaceConvexHulls();
         }
       }
     }
@@ -14,6 +14,10 @@
  * limitations under the License.
  *
 */
+#include <map>
+#include <mutex>
+#include <vector>
+
 #include "gazebo/common/Mesh.hh"
 #include "gazebo/common/Assert.hh"
 #include "gazebo/common/Console.hh"
@@ -25,6 +29,27 @@
 using namespace gazebo;
 using namespace physics;
 
+/// \brief Arrays of the convex geoms of a mesh, which ODE doesn't copy.
+struct ConvexHullArrays
+{
+  /// \brief Planes of each convex geom.
+  std::vector<std::vector<dReal>> planes;
+
+  /// \brief Points of each convex geom.
+  std::vector<std::vector<dReal>> points;
+
+  /// \brief Polygons of each convex geom.
+  std::vector<std::vector<unsigned int>> polygons;
+};
+
+// Added here to avoid breaking the ABI
+// TODO move to ODEMesh when merging forward
+/// \brief Convex geom arrays of the meshes that have some.
+static std::map<const ODEMesh *, ConvexHullArrays> convexHullArrays;
+
+/// \brief Protects convexHullArrays.
+static std::mutex convexHullArraysMutex;
+
 //////////////////////////////////////////////////
 ODEMesh::ODEMesh()
 {
@@ -39,6 +64,9 @@ ODEMesh::~ODEMesh()
   delete [] this->vertices;
   delete [] this->indices;
   dGeomTriMeshDataDestroy(this->odeData);
+
+  std::lock_guard<std::mutex> lock(convexHullArraysMutex);
+  convexHullArrays.erase(this);
 }
 
 //////////////////////////////////////////////////
@@ -89,6 +117,9 @@ void ODEMesh::Init(const common::SubMesh *_subMesh, ODECollisionPtr _collision,
   unsigned int numVertices = _subMesh->GetVertexCount();
   unsigned int numIndices = _subMesh->GetIndexCount();
 
+  // The arrays of a previous mesh are replaced when the mesh is rebuilt
+  delete [] this->vertices;
+  delete [] this->indices;
   this->vertices = nullptr;
   this->indices = nullptr;
 
@@ -110,6 +141,9 @@ void ODEMesh::Init(const common::Mesh *_mesh, ODECollisionPtr _collision,
   unsigned int numVertices = _mesh->GetVertexCount();
   unsigned int numIndices = _mesh->GetIndexCount();
 
+  // The arrays of a previous mesh are replaced when the mesh is rebuilt
+  delete [] this->vertices;
+  delete [] this->indices;
   this->vertices = nullptr;
   this->indices = nullptr;
 
@@ -120,6 +154,83 @@ void ODEMesh::Init(const common::Mesh *_mesh, ODECollisionPtr _collision,
   this->CreateMesh(numVertices, numIndices, _collision, _scale);
 }
 
+//////////////////////////////////////////////////
+void ODEMesh::InitConvexHulls(const std::vector<common::ConvexHull> &_hulls,
+    ODECollisionPtr _collision, const ignition::math::Vector3d &_scale)
+{
+  _collision->ClearConvexHulls();
+
+  // Entries of a map aren't moved by insertions, so the arrays stay valid
+  // when other meshes add theirs.
+  std::lock_guard<std::mutex> lock(convexHullArraysMutex);
+  ConvexHullArrays &arrays = convexHullArrays[this];
+  arrays.planes.clear();
+  arrays.points.clear();
+  arrays.polygons.clear();
+
+  for (auto const &hull : _hulls)
+  {
+    // ODE expects the points relative to an origin inside of the hull
+    std::vector<ignition::math::Vector3d> points;
+    ignition::math::Vector3d center;
+    for (auto const &v : hull.vertices)
+    {
+      points.push_back(v * _scale);
+      center += points.back();
+    }
+    if (points.empty())
+      continue;
+    center /= points.size();
+
+    std::vector<dReal> pointArray;
+    for (auto &p : points)
+    {
+      p -= center;
+      pointArray.push_back(p.X());
+      pointArray.push_back(p.Y());
+      pointArray.push_back(p.Z());
+    }
+
+    std::vector<dReal> planeArray;
+    std::vector<unsigned int> polygonArray;
+    for (unsigned int i = 0; i + 2 < hull.indices.size(); i += 3)
+    {
+      const ignition::math::Vector3d &a = points[hull.indices[i]];
+      const ignition::math::Vector3d &b = points[hull.indices[i + 1]];
+      const ignition::math::Vector3d &c = points[hull.indices[i + 2]];
+      ignition::math::Vector3d normal = (b - a).Cross(c - a);
+      if (normal.Length() <= 0)
+        continue;
+      normal.Normalize();
+
+      planeArray.push_back(normal.X());
+      planeArray.push_back(normal.Y());
+      planeArray.push_back(normal.Z());
+      planeArray.push_back(normal.Dot(a));
+
+      polygonArray.push_back(3);
+      polygonArray.push_back(hull.indices[i]);
+      polygonArray.push_back(hull.indices[i + 1]);
+      polygonArray.push_back(hull.indices[i + 2]);
+    }
+    if (planeArray.size() < 16)
+      continue;
+
+    // Moving the arrays keeps their data, which the geoms point to
+    arrays.planes.push_back(std::move(planeArray));
+    arrays.points.push_back(std::move(pointArray));
+    arrays.polygons.push_back(std::move(polygonArray));
+
+    dGeomID hullId = dCreateConvex(nullptr,
+        arrays.planes.back().data(), arrays.planes.back().size() / 4,
+        arrays.points.back().data(), arrays.points.back().size() / 3,
+        arrays.polygons.back().data());
+    _collision->AddConvexHull(hullId, center);
+  }
+
+  _collision->PlaceConvexHulls();
+}
+
 //////////////////////////////////////////////////
 void ODEMesh::CreateMesh(unsigned int _numVertices, unsigned int _numIndices,
     ODECollisionPtr _collision, const ignition::math::Vector3d &_scale)
@@ -18,8 +18,11 @@
 #ifndef GAZEBO_PHYSICS_ODE_ODEMESH_HH_
 #define GAZEBO_PHYSICS_ODE_ODEMESH_HH_
 
+#include <vector>
+
 #include <ignition/math/Vector3.hh>
 
+#include "gazebo/common/ConvexDecomposition.hh"
 #include "gazebo/physics/ode/ODETypes.hh"
 #include "gazebo/physics/ode/ode_inc.h"
 #include "gazebo/physics/MeshShape.hh"
@@ -57,6 +60,17 @@ namespace gazebo
                       ODECollisionPtr _collision,
                       const ignition::math::Vector3d &_scale);
 
+      /// \brief Add convex geoms to the collision, that replace the mesh
+      /// in collisions with the geoms of other collisions.
+      /// \param[in] _hulls Convex decomposition of the mesh.
+      /// \param[in] _collision Pointer to the collision object.
+      /// \param[in] _scale Scaling factor.
+      /// \sa ODECollision::AddConvexHull
+      public: void InitConvexHulls(
+                  const std::vector<common::ConvexHull> &_hulls,
+                  ODECollisionPtr _collision,
+                  const ignition::math::Vector3d &_scale);
+
       /// \brief Update the collision mesh.
       public: virtual void Update();
 
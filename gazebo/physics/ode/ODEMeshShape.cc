@@ -14,6 +14,11 @@
  * limitations under the License.
  *
 */
+#include <string>
+#include <vector>
+
+#include "gazebo/common/CommonIface.hh"
+#include "gazebo/common/ConvexDecomposition.hh"
 #include "gazebo/common/Mesh.hh"
 #include "gazebo/common/Assert.hh"
 #include "gazebo/common/Console.hh"
@@ -54,19 +59,119 @@ void ODEMeshShape::Load(sdf::ElementPtr _sdf)
 void ODEMeshShape::Init()
 {
   MeshShape::Init();
+  this->InitODEMesh();
+}
+
+//////////////////////////////////////////////////
+void ODEMeshShape::SetScale(const ignition::math::Vector3d &_scale)
+{
+  if (_scale.X() < 0 || _scale.Y() < 0 || _scale.Z() < 0)
+    return;
+
+  if (_scale == this->Size())
+    return;
+
+  MeshShape::SetScale(_scale);
+
+  // The trimesh and the hulls are scaled when they are built
+  this->InitODEMesh();
+}
+
+//////////////////////////////////////////////////
+void ODEMeshShape::InitODEMesh()
+{
   if (!this->mesh)
     return;
 
+  ODECollisionPtr collision =
+    boost::static_pointer_cast<ODECollision>(this->collisionParent);
+  collision->ClearConvexHulls();
+
   if (this->submesh)
   {
-    this->odeMesh->Init(this->submesh,
-        boost::static_pointer_cast<ODECollision>(this->collisionParent),
+    this->odeMesh->Init(this->submesh, collision,
         this->sdf->Get<ignition::math::Vector3d>("scale"));
   }
   else
   {
-    this->odeMesh->Init(this->mesh,
-        boost::static_pointer_cast<ODECollision>(this->collisionParent),
+    this->odeMesh->Init(this->mesh, collision,
         this->sdf->Get<ignition::math::Vector3d>("scale"));
   }
+
+  if (this->sdf->HasElement("gazebo:convex_decomposition"))
+    this->InitConvexDecomposition();
+}
+
+//////////////////////////////////////////////////
+void ODEMeshShape::InitConvexDecomposition()
+{
+  sdf::ElementPtr elem =
+    this->sdf->GetElement("gazebo:convex_decomposition");
+
+  common::ConvexDecomposition decomposition;
+  if (elem->HasElement("gazebo:max_convex_hulls"))
+  {
+    decomposition.SetMaxHulls(
+        elem->GetElement("gazebo:max_convex_hulls")->Get<unsigned int>());
+  }
+  if (elem->HasElement("gazebo:concavity"))
+  {
+    decomposition.SetConcavity(
+        elem->GetElement("gazebo:concavity")->Get<double>());
+  }
+
+  float *vertArray = nullptr;
+  int *indArray = nullptr;
+  unsigned int vertCount, indCount;
+  std::string submeshName;
+  if (this->submesh)
+  {
+    this->submesh->FillArrays(&vertArray, &indArray);
+    vertCount = this->submesh->GetVertexCount();
+    indCount = this->submesh->GetIndexCount();
+    submeshName = this->submesh->GetName();
+  }
+  else
+  {
+    this->mesh->FillArrays(&vertArray, &indArray);
+    vertCount = this->mesh->GetVertexCount();
+    indCount = this->mesh->GetIndexCount();
+  }
+
+  std::vector<ignition::math::Vector3d> vertices(vertCount);
+  for (unsigned int i = 0; i < vertCount; ++i)
+  {
+    vertices[i].Set(vertArray[i * 3], vertArray[i * 3 + 1],
+        vertArray[i * 3 + 2]);
+  }
+  std::vector<unsigned int> indices(indArray, indArray + indCount);
+  delete [] vertArray;
+  delete [] indArray;
+
+  // The decomposition is computed once and cached next to the mesh file.
+  // The hulls are decomposed before scaling, so that models that scale
+  // the same mesh differently share the cache file.
+  std::vector<common::ConvexHull> hulls;
+  const std::string filename = common::find_file(
+      this->sdf->Get<std::string>("uri"));
+  if (filename.empty())
+  {
+    hulls = decomposition.Decompose(vertices, indices);
+  }
+  else
+  {
+    hulls = decomposition.Decompose(vertices, indices,
+        common::ConvexDecomposition::CacheFilename(filename, submeshName));
+  }
+
+  if (hulls.empty())
+  {
+    gzwarn << "Unable to decompose mesh[" << this->GetMeshURI()
+           << "] into convex hulls, using the triangle mesh instead\n";
+    return;
+  }
+
+  this->odeMesh->InitConvexHulls(hulls,
+      boost::static_pointer_cast<ODECollision>(this->collisionParent),
+      this->sdf->Get<ignition::math::Vector3d>("scale"));
 }
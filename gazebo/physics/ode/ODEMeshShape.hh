@@ -49,6 +49,20 @@ namespace gazebo
       // Documentation inherited
       public: virtual void Update();
 
+      /// \brief Set the scale of the mesh, and rebuild the triangle mesh
+      /// and the convex hulls of the collision at the new scale.
+      /// \param[in] _scale Scale of the mesh.
+      public: virtual void SetScale(const ignition::math::Vector3d &_scale);
+
+      /// \brief Build the triangle mesh of the collision, and its convex
+      /// hulls if the mesh has a <gazebo:convex_decomposition> element.
+      private: void InitODEMesh();
+
+      /// \brief Decompose the mesh into convex hulls, as specified by the
+      /// <gazebo:convex_decomposition> element of the mesh, and add them
+      /// to the collision.
+      private: void InitConvexDecomposition();
+
       /// \brief ODE collision mesh helper class.
       private: ODEMesh *odeMesh;
     };
@@ -355,6 +355,46 @@ void ODEPhysics::InitForThread()
   dAllocateODEDataForThread(dAllocateMaskAll);
 }
 
+//////////////////////////////////////////////////
+/// \brief Copy the collide bitmasks of the collisions in a space to the
+/// filter bits of their geoms, so that the broadphase rejects the pairs
+/// that ODEPhysics::Collide would discard. A space gets the union of the
+/// bits of its geoms, which rejects pairs of links that share no bit
+/// without visiting their collisions.
+/// \param[in] _geom Geom or space to update.
+/// \return The filter bits of _geom.
+static unsigned long updateFilterBits(dGeomID _geom)
+{
+  unsigned long bits = ~0ul;
+
+  if (dGeomIsSpace(_geom))
+  {
+    dSpaceID space = (dSpaceID)_geom;
+    const int count = dSpaceGetNumGeoms(space);
+    if (count > 0)
+      bits = 0;
+    for (int i = 0; i < count; ++i)
+      bits |= updateFilterBits(dSpaceGetGeom(space, i));
+  }
+  else
+  {
+    // Collisions with an empty bitmask collide with nothing, but are
+    // still seen by rays, which use the default filter bits. They are
+    // discarded by ODEPhysics::Collide.
+    const ODECollision *collision =
+      static_cast<const ODECollision*>(dGeomGetData(_geom));
+    const unsigned int mask =
+      collision ? collision->GetSurface()->collideBitmask : 0;
+    if (mask != 0)
+      bits = mask;
+  }
+
+  if (dGeomGetFilterBits(_geom) != bits)
+    dGeomSetFilterBits(_geom, bits);
+
+  return bits;
+}
+
 //////////////////////////////////////////////////
 void ODEPhysics::UpdateCollision()
 {
@@ -371,6 +411,11 @@ void ODEPhysics::UpdateCollision()
   // Reset the contact count
   this->contactManager->ResetCount();
 
+  // Reject the pairs of collisions that share no collide bit in the
+  // broadphase. Masks can be changed at any time through SurfaceParams,
+  // so they are copied to ODE before each collision pass.
+  updateFilterBits((dGeomID)this->dataPtr->spaceId);
+
   // Do collision detection; this will add contacts to the contact group
   dSpaceCollide(this->dataPtr->spaceId, this, CollisionCallback);
   DIAG_TIMER_LAP("ODEPhysics::UpdateCollision", "dSpaceCollide");
@@ -997,11 +1042,80 @@ void ODEPhysics::CollisionCallback(void *_data, dGeomID _o1, dGeomID _o2)
 }
 
 
+//////////////////////////////////////////////////
+/// \brief Generate the contacts between two collisions. Collisions that
+/// have convex hulls are replaced by their hulls, unless the other
+/// collision is a triangle mesh, which has no collider with convex geoms.
+/// \param[in] _collision1 First collision.
+/// \param[in] _collision2 Second collision.
+/// \param[out] _contacts Array of MAX_COLLIDE_RETURNS contacts.
+/// \return Number of contacts.
+static unsigned int collideHulls(const ODECollision *_collision1,
+    const ODECollision *_collision2, dContactGeom *_contacts)
+{
+  const unsigned int hullCount1 = _collision1->ConvexHullCount();
+  const unsigned int hullCount2 = _collision2->ConvexHullCount();
+
+  if ((hullCount1 == 0 && hullCount2 == 0) ||
+      (hullCount1 == 0 && _collision1->GetCollisionClass() == dTriMeshClass) ||
+      (hullCount2 == 0 && _collision2->GetCollisionClass() == dTriMeshClass))
+  {
+    return dCollide(_collision1->GetCollisionId(),
+        _collision2->GetCollisionId(), MAX_COLLIDE_RETURNS, _contacts,
+        sizeof(_contacts[0]));
+  }
+
+  // Get the geoms once, the hulls are looked up in a shared table
+  auto geoms = [](const ODECollision *_collision, const unsigned int _count)
+  {
+    std::vector<dGeomID> result;
+    if (_count == 0)
+      result.push_back(_collision->GetCollisionId());
+    for (unsigned int i = 0; i < _count; ++i)
+    {
+      dGeomID hullId = _collision->ConvexHullId(i);
+      if (hullId)
+        result.push_back(hullId);
+    }
+    return result;
+  };
+  const std::vector<dGeomID> geoms1 = geoms(_collision1, hullCount1);
+  const std::vector<dGeomID> geoms2 = geoms(_collision2, hullCount2);
+
+  unsigned int numc = 0;
+  for (dGeomID g1 : geoms1)
+  {
+    dReal aabb1[6];
+    dGeomGetAABB(g1, aabb1);
+
+    for (unsigned int j = 0; j < geoms2.size() &&
+        numc < MAX_COLLIDE_RETURNS; ++j)
+    {
+      dGeomID g2 = geoms2[j];
+      dReal aabb2[6];
+      dGeomGetAABB(g2, aabb2);
+
+      if (aabb1[0] > aabb2[1] || aabb2[0] > aabb1[1] ||
+          aabb1[2] > aabb2[3] || aabb2[2] > aabb1[3] ||
+          aabb1[4] > aabb2[5] || aabb2[4] > aabb1[5])
+      {
+        continue;
+      }
+
+      numc += dCollide(g1, g2, MAX_COLLIDE_RETURNS - numc, _contacts + numc,
+          sizeof(_contacts[0]));
+    }
+  }
+
+  return numc;
+}
+
 //////////////////////////////////////////////////
 void ODEPhysics::Collide(ODECollision *_collision1, ODECollision *_collision2,
                          dContactGeom *_contactCollisions)
 {
-  // Filter collisions based on collide bitmask.
+  // Filter collisions based on collide bitmask. Most pairs are rejected in
+  // the broadphase already, see updateFilterBits.
   if ((_collision1->GetSurface()->collideBitmask &
         _collision2->GetSurface()->collideBitmask) == 0)
     return;
@@ -1051,8 +1165,7 @@ void ODEPhysics::Collide(ODECollision *_collision1, ODECollision *_collision2,
     maxCollide = _collision2->GetMaxContacts();
 
   // Generate the contacts
-  numc = dCollide(_collision1->GetCollisionId(), _collision2->GetCollisionId(),
-      MAX_COLLIDE_RETURNS, _contactCollisions, sizeof(_contactCollisions[0]));
+  numc = collideHulls(_collision1, _collision2, _contactCollisions);
 
   // Return if no contacts.
   if (numc == 0)
@@ -512,10 +512,18 @@ void SimbodyLink::AddRelativeForce(const ignition::math::Vector3d &/*_force*/)
 
 /////////////////////////////////////////////////
 void SimbodyLink::AddForceAtWorldPosition(
-    const ignition::math::Vector3d &/*_force*/,
-    const ignition::math::Vector3d &/*_pos*/)
+    const ignition::math::Vector3d &_force,
+    const ignition::math::Vector3d &_pos)
 {
-  gzerr << "Not implemented.\n";
+  SimTK::Vec3 f(SimbodyPhysics::Vector3ToVec3(_force));
+  SimTK::Vec3 station = this->masterMobod.findStationAtGroundPoint(
+      this->simbodyPhysics->integ->getState(),
+      SimbodyPhysics::Vector3ToVec3(_pos));
+
+  this->simbodyPhysics->discreteForces.addForceToBodyPoint(
+    this->simbodyPhysics->integ->updAdvancedState(),
+    this->masterMobod,
+    station, f);
 }
 
 /////////////////////////////////////////////////
@@ -616,3 +624,28 @@ void SimbodyLink::SetDirtyPose(const ignition::math::Pose3d &_pose)
 {
   this->dirtyPose = _pose;
 }
+
+//////////////////////////////////////////////////
+bool SimbodyLink::UpdateDirtyPose(const SimTK::State &_state)
+{
+  const ignition::math::Pose3d pose = SimbodyPhysics::Transform2PoseIgn(
+    this->masterMobod.getBodyTransform(_state));
+
+  // Bodies at rest keep exactly the same transform, their pose doesn't need
+  // to be synchronized again. Pose3d::operator== has a tolerance, so the
+  // components are compared exactly.
+  const ignition::math::Pose3d &worldPose = this->WorldPose();
+  if (pose.Pos().X() == worldPose.Pos().X() &&
+      pose.Pos().Y() == worldPose.Pos().Y() &&
+      pose.Pos().Z() == worldPose.Pos().Z() &&
+      pose.Rot().W() == worldPose.Rot().W() &&
+      pose.Rot().X() == worldPose.Rot().X() &&
+      pose.Rot().Y() == worldPose.Rot().Y() &&
+      pose.Rot().Z() == worldPose.Rot().Z())
+  {
+    return false;
+  }
+
+  this->dirtyPose = pose;
+  return true;
+}
@@ -166,6 +166,13 @@ namespace gazebo
       /// \param[in] New dirty pose
       public: void SetDirtyPose(const ignition::math::Pose3d &_pose);
 
+      /// \brief Set the dirty pose from the transform of the master
+      /// mobilized body, if it differs from the world pose of the link.
+      /// \param[in] _state Simbody state to read the transform from.
+      /// \return True if the dirty pose was set and the link must be added
+      /// to the dirty poses of the world.
+      public: bool UpdateDirtyPose(const SimTK::State &_state);
+
       // Documentation inherited.
       public: virtual void UpdateMass();
 
@@ -685,11 +685,11 @@ void SimbodyPhysics::UpdatePhysics()
     {
       physics::SimbodyLinkPtr simbodyLink =
         boost::dynamic_pointer_cast<physics::SimbodyLink>(*lx);
-      auto pose = SimbodyPhysics::Transform2PoseIgn(
-        simbodyLink->masterMobod.getBodyTransform(s));
-      simbodyLink->SetDirtyPose(pose);
-      this->world->dataPtr->dirtyPoses.push_back(
-        boost::static_pointer_cast<Entity>(*lx).get());
+      if (simbodyLink->UpdateDirtyPose(s))
+      {
+        this->world->dataPtr->dirtyPoses.push_back(
+          boost::static_pointer_cast<Entity>(*lx).get());
+      }
     }
 
     physics::Joint_V joints = (*mi)->GetJoints();
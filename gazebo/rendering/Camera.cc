@@ -36,6 +36,7 @@
 #include "gazebo/common/Events.hh"
 #include "gazebo/common/Console.hh"
 #include "gazebo/common/Exception.hh"
+#include "gazebo/common/ImageConversion.hh"
 #include "gazebo/common/VideoEncoder.hh"
 
 #include "gazebo/rendering/ogre_gazebo.h"
@@ -1311,105 +1312,11 @@ void Camera::ConvertRGBToBAYER(unsigned char *_dst,
     const unsigned char *_src, const std::string &_format, const int _width,
     const int _height)
 {
-  if (_src)
+  if (_src && _width > 0 && _height > 0)
   {
     // do last minute conversion if Bayer pattern is requested, go from R8G8B8
-    if (_format == "BAYER_RGGB8")
-    {
-      for (int i = 0; i < _width; i++)
-      {
-        for (int j = 0; j < _height; j++)
-        {
-          //
-          // RG
-          // GB
-          //
-          // determine position
-          if (j%2)  // even column
-            if (i%2)  // even row, red
-              _dst[i+j*_width] = _src[i*3+j*_width*3+2];
-            else  // odd row, green
-              _dst[i+j*_width] = _src[i*3+j*_width*3+1];
-          else  // odd column
-            if (i%2)  // even row, green
-              _dst[i+j*_width] = _src[i*3+j*_width*3+1];
-            else  // odd row, blue
-              _dst[i+j*_width] = _src[i*3+j*_width*3+0];
-        }
-      }
-    }
-    else if (_format == "BAYER_BGGR8")
-    {
-      for (int i = 0; i < _width; i++)
-      {
-        for (int j = 0; j < _height; j++)
-        {
-          //
-          // BG
-          // GR
-          //
-          // determine position
-          if (j%2)  // even column
-            if (i%2)  // even row, blue
-              _dst[i+j*_width] = _src[i*3+j*_width*3+0];
-            else  // odd row, green
-              _dst[i+j*_width] = _src[i*3+j*_width*3+1];
-          else  // odd column
-            if (i%2)  // even row, green
-              _dst[i+j*_width] = _src[i*3+j*_width*3+1];
-            else  // odd row, red
-              _dst[i+j*_width] = _src[i*3+j*_width*3+2];
-        }
-      }
-    }
-    else if (_format == "BAYER_GBRG8")
-    {
-      for (int i = 0; i < _width; i++)
-      {
-        for (int j = 0; j < _height; j++)
-        {
-          //
-          // GB
-          // RG
-          //
-          // determine position
-          if (j%2)  // even column
-            if (i%2)  // even row, green
-              _dst[i+j*_width] = _src[i*3+j*_width*3+1];
-            else  // odd row, blue
-              _dst[i+j*_width] = _src[i*3+j*_width*3+2];
-          else  // odd column
-            if (i%2)  // even row, red
-              _dst[i+j*_width] = _src[i*3+j*_width*3+0];
-            else  // odd row, green
-              _dst[i+j*_width] = _src[i*3+j*_width*3+1];
-        }
-      }
-    }
-    else if (_format == "BAYER_GRBG8")
-    {
-      for (int i = 0; i < _width; i++)
-      {
-        for (int j = 0; j < _height; j++)
-        {
-          //
-          // GR
-          // BG
-          //
-          // determine position
-          if (j%2)  // even column
-            if (i%2)  // even row, green
-              _dst[i+j*_width] = _src[i*3+j*_width*3+1];
-            else  // odd row, red
-              _dst[i+j*_width] = _src[i*3+j*_width*3+0];
-          else  // odd column
-            if (i%2)  // even row, blue
-              _dst[i+j*_width] = _src[i*3+j*_width*3+2];
-            else  // odd row, green
-              _dst[i+j*_width] = _src[i*3+j*_width*3+1];
-        }
-      }
-    }
+    common::convertRGBToBayer(_src, _dst, _width, _height,
+        common::Image::ConvertPixelFormat(_format));
   }
 }
 
@@ -339,20 +339,21 @@ bool CameraSensor::UpdateImpl(const bool /*_force*/)
     auto simTime = this->scene->SimTime();
     if (this->imagePub && this->imagePub->HasConnections())
     {
-      msgs::ImageStamped msg;
-      msgs::Set(msg.mutable_time(), simTime);
-      msg.mutable_image()->set_width(this->camera->ImageWidth());
-      msg.mutable_image()->set_height(this->camera->ImageHeight());
-      msg.mutable_image()->set_pixel_format(common::Image::ConvertPixelFormat(
-            this->camera->ImageFormat()));
-
-      msg.mutable_image()->set_step(this->camera->ImageWidth() *
+      // Handed over to the publisher, which doesn't copy the image again
+      std::unique_ptr<msgs::ImageStamped> msg(new msgs::ImageStamped);
+      msgs::Set(msg->mutable_time(), simTime);
+      msg->mutable_image()->set_width(this->camera->ImageWidth());
+      msg->mutable_image()->set_height(this->camera->ImageHeight());
+      msg->mutable_image()->set_pixel_format(
+          common::Image::ConvertPixelFormat(this->camera->ImageFormat()));
+
+      msg->mutable_image()->set_step(this->camera->ImageWidth() *
           this->camera->ImageDepth());
-      msg.mutable_image()->set_data(this->camera->ImageData(),
-          msg.image().width() * this->camera->ImageDepth() *
-          msg.image().height());
+      msg->mutable_image()->set_data(this->camera->ImageData(),
+          msg->image().width() * this->camera->ImageDepth() *
+          msg->image().height());
 
-      this->imagePub->Publish(msg);
+      this->imagePub->Publish(std::move(msg));
     }
 
     if (this->imagePubIgn.HasConnections())
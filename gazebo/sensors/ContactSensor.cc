@@ -23,6 +23,7 @@
 
 #include "gazebo/physics/PhysicsIface.hh"
 #include "gazebo/physics/Contact.hh"
+#include "gazebo/physics/ContactFeed.hh"
 #include "gazebo/physics/World.hh"
 #include "gazebo/physics/Collision.hh"
 #include "gazebo/physics/ContactManager.hh"
@@ -112,12 +113,19 @@ void ContactSensor::Load(const std::string &_worldName)
     // request the contact manager to publish messages to a custom topic for
     // this sensor
     physics::ContactManager *mgr = this->world->Physics()->GetContactManager();
-    std::string topic = mgr->CreateFilter(this->dataPtr->filterName,
-        this->dataPtr->collisions);
-    if (!this->dataPtr->contactSub)
+    mgr->CreateFilter(this->dataPtr->filterName, this->dataPtr->collisions);
+
+    // Read the filtered contacts in-process, the filter topic is left to
+    // other subscribers. Contacts are only stored while the sensor is
+    // active.
+    if (!this->dataPtr->contactFeed)
     {
-      this->dataPtr->contactSub = this->node->Subscribe(topic,
-          &ContactSensor::OnContacts, this);
+      this->dataPtr->contactFeed = mgr->Feed(this->dataPtr->filterName);
+      if (this->dataPtr->contactFeed)
+      {
+        this->dataPtr->contactFeed->SetReaderActive(
+            [this]() {return this->IsActive();});
+      }
     }
   }
 }
@@ -133,62 +141,39 @@ bool ContactSensor::UpdateImpl(const bool /*_force*/)
 {
   std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
 
-  // Don't do anything if there is no new data to process.
-  if (this->dataPtr->incomingContacts.empty())
+  if (!this->dataPtr->contactFeed)
     return false;
 
-  std::vector<std::string>::iterator collIter;
-  std::string collision1;
+  // Don't do anything if there is no new data to process. Steps without
+  // contacts don't reach the feed, so check if the world stepped instead.
+  if (!this->dataPtr->contactFeed->Read() &&
+      this->world->SimTime() == this->lastMeasurementTime)
+  {
+    return false;
+  }
 
   // Clear the outgoing contact message.
   this->dataPtr->contactsMsg.clear_contact();
 
-  // Iterate over all the contact messages
-  for (auto iter = this->dataPtr->incomingContacts.begin();
-       iter != this->dataPtr->incomingContacts.end(); ++iter)
+  // Iterate over all the contacts since the last update
+  const physics::ContactFeed &feed = *this->dataPtr->contactFeed;
+  for (unsigned int i = 0; i < feed.RecordCount(); ++i)
   {
-    // Iterate over all the contacts in the message
-    for (int i = 0; i < (*iter)->contact_size(); ++i)
+    const physics::ContactRecord &record = feed.Record(i);
+
+    // If this sensor is monitoring one of the collision's in the
+    // contact, then add the contact to our outgoing message.
+    if (std::find(this->dataPtr->collisions.begin(),
+          this->dataPtr->collisions.end(), record.collision1) !=
+        this->dataPtr->collisions.end() ||
+        std::find(this->dataPtr->collisions.begin(),
+          this->dataPtr->collisions.end(), record.collision2) !=
+        this->dataPtr->collisions.end())
     {
-      collision1 = (*iter)->contact(i).collision1();
-
-      // Try to find the first collision's name
-      collIter = std::find(this->dataPtr->collisions.begin(),
-          this->dataPtr->collisions.end(), collision1);
-
-      // If unable to find the first collision's name, try the second
-      if (collIter == this->dataPtr->collisions.end())
-      {
-        collision1 = (*iter)->contact(i).collision2();
-        collIter = std::find(this->dataPtr->collisions.begin(),
-            this->dataPtr->collisions.end(), collision1);
-      }
-
-      // If this sensor is monitoring one of the collision's in the
-      // contact, then add the contact to our outgoing message.
-      if (collIter != this->dataPtr->collisions.end())
-      {
-        int count = (*iter)->contact(i).position_size();
-
-        // Check to see if the contact arrays all have the same size.
-        if (count != (*iter)->contact(i).normal_size() ||
-            count != (*iter)->contact(i).wrench_size() ||
-            count != (*iter)->contact(i).depth_size())
-        {
-          gzerr << "Contact message has invalid array sizes\n";
-          continue;
-        }
-
-        // Copy the contact message.
-        msgs::Contact *contactMsg = this->dataPtr->contactsMsg.add_contact();
-        contactMsg->CopyFrom((*iter)->contact(i));
-      }
+      record.FillMsg(*this->dataPtr->contactsMsg.add_contact());
     }
   }
 
-  // Clear the incoming contact list.
-  this->dataPtr->incomingContacts.clear();
-
   this->lastMeasurementTime = this->world->SimTime();
   msgs::Set(this->dataPtr->contactsMsg.mutable_time(),
             this->lastMeasurementTime);
@@ -213,7 +198,11 @@ void ContactSensor::Fini()
     mgr->RemoveFilter(this->dataPtr->filterName);
   }
 
-  this->dataPtr->contactSub.reset();
+  if (this->dataPtr->contactFeed)
+  {
+    this->dataPtr->contactFeed->SetReaderActive(std::function<bool ()>());
+    this->dataPtr->contactFeed.reset();
+  }
   this->dataPtr->contactsPub.reset();
   Sensor::Fini();
 }
@@ -294,23 +283,6 @@ std::map<std::string, gazebo::physics::Contact> ContactSensor::Contacts(
   return result;
 }
 
-//////////////////////////////////////////////////
-void ContactSensor::OnContacts(ConstContactsPtr &_msg)
-{
-  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
-
-  // Only store information if the sensor is active
-  if (this->IsActive())
-  {
-    // Store the contacts message for processing in UpdateImpl
-    this->dataPtr->incomingContacts.push_back(_msg);
-
-    // Prevent the incomingContacts list to grow indefinitely.
-    if (this->dataPtr->incomingContacts.size() > 100)
-      this->dataPtr->incomingContacts.pop_front();
-  }
-}
-
 //////////////////////////////////////////////////
 bool ContactSensor::IsActive() const
 {
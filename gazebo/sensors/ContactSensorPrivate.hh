@@ -18,10 +18,10 @@
 #define _GAZEBO_SENSORS_CONTACTSENSOR_PRIVATE_HH_
 
 #include <vector>
-#include <list>
 #include <string>
 #include <mutex>
 
+#include "gazebo/physics/PhysicsTypes.hh"
 #include "gazebo/transport/TransportTypes.hh"
 #include "gazebo/msgs/msgs.hh"
 
@@ -39,8 +39,8 @@ namespace gazebo
       /// \brief Output contact information.
       public: transport::PublisherPtr contactsPub;
 
-      /// \brief Subscription to contact messages from the physics engine
-      public: transport::SubscriberPtr contactSub;
+      /// \brief In-process feed of the contacts of the filter.
+      public: physics::ContactFeedPtr contactFeed;
 
       /// \brief Mutex to protect reads and writes.
       public: mutable std::mutex mutex;
@@ -48,13 +48,6 @@ namespace gazebo
       /// \brief Contacts message used to output sensor data.
       public: msgs::Contacts contactsMsg;
 
-      /// \type ContactMsgs_L
-      /// List of contact messages
-      typedef std::list<boost::shared_ptr<msgs::Contacts const> > ContactMsgs_L;
-
-      /// \brief List of incoming messages.
-      public: ContactMsgs_L incomingContacts;
-
       /// \brief Name of filter used to filter contact messages.
       public: std::string filterName;
     };
@@ -16,6 +16,8 @@
 */
 #include <functional>
 
+#include "gazebo/common/ImageConversion.hh"
+
 #include "gazebo/physics/World.hh"
 
 #include "gazebo/rendering/DepthCamera.hh"
@@ -142,17 +144,18 @@ bool DepthCameraSensor::UpdateImpl(const bool /*_force*/)
       // generating point clouds instead
       this->dataPtr->depthCamera->DepthData())
   {
-    msgs::ImageStamped msg;
-    msgs::Set(msg.mutable_time(), this->scene->SimTime());
-    msg.mutable_image()->set_width(this->camera->ImageWidth());
-    msg.mutable_image()->set_height(this->camera->ImageHeight());
-    msg.mutable_image()->set_pixel_format(common::Image::R_FLOAT32);
+    // Handed over to the publisher, which doesn't copy the image again
+    std::unique_ptr<msgs::ImageStamped> msg(new msgs::ImageStamped);
+    msgs::Set(msg->mutable_time(), this->scene->SimTime());
+    msg->mutable_image()->set_width(this->camera->ImageWidth());
+    msg->mutable_image()->set_height(this->camera->ImageHeight());
+    msg->mutable_image()->set_pixel_format(common::Image::R_FLOAT32);
 
 
-    msg.mutable_image()->set_step(this->camera->ImageWidth() *
+    msg->mutable_image()->set_step(this->camera->ImageWidth() *
         this->camera->ImageDepth());
 
-    unsigned int depthSamples = msg.image().width() * msg.image().height();
+    unsigned int depthSamples = msg->image().width() * msg->image().height();
     float f;
     // cppchecker recommends using sizeof(varname)
     unsigned int depthBufferSize = depthSamples * sizeof(f);
@@ -160,23 +163,14 @@ bool DepthCameraSensor::UpdateImpl(const bool /*_force*/)
     if (!this->dataPtr->depthBuffer)
       this->dataPtr->depthBuffer = new float[depthSamples];
 
-    memcpy(this->dataPtr->depthBuffer, this->dataPtr->depthCamera->DepthData(),
-        depthBufferSize);
+    // Mask ranges outside of min/max to +/- inf, as per REP 117
+    common::maskDepthRange(this->dataPtr->depthCamera->DepthData(),
+        this->dataPtr->depthBuffer, depthSamples, this->camera->NearClip(),
+        this->camera->FarClip());
 
-    for (unsigned int i = 0; i < depthSamples; ++i)
-    {
-      // Mask ranges outside of min/max to +/- inf, as per REP 117
-      if (this->dataPtr->depthBuffer[i] >= this->camera->FarClip())
-      {
-        this->dataPtr->depthBuffer[i] = ignition::math::INF_D;
-      }
-      else if (this->dataPtr->depthBuffer[i] <= this->camera->NearClip())
-      {
-        this->dataPtr->depthBuffer[i] = -ignition::math::INF_D;
-      }
-    }
-    msg.mutable_image()->set_data(this->dataPtr->depthBuffer, depthBufferSize);
-    this->imagePub->Publish(msg);
+    msg->mutable_image()->set_data(this->dataPtr->depthBuffer,
+        depthBufferSize);
+    this->imagePub->Publish(std::move(msg));
   }
 
   this->SetRendered(false);
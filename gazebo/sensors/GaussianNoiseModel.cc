@@ -14,6 +14,8 @@
  * limitations under the License.
  *
 */
+#include <cmath>
+
 #include <ignition/math/Helpers.hh>
 #include <ignition/math/Rand.hh>
 
@@ -147,8 +149,15 @@ void GaussianNoiseModel::Fini()
 //////////////////////////////////////////////////
 double GaussianNoiseModel::ApplyImpl(double _in, double _dt)
 {
+  const bool dynamicBias = this->dynamicBiasStdDev > 0 &&
+      this->dynamicBiasCorrTime > 0;
+
+  // Draw the samples of the white noise and of the dynamic bias at once
+  double samples[2];
+  this->SampleNormal(samples, dynamicBias ? 2 : 1);
+
   // Add independent (uncorrelated) Gaussian noise to each input value.
-  double whiteNoise = ignition::math::Rand::DblNormal(this->mean, this->stdDev);
+  double whiteNoise = this->mean + this->stdDev * samples[0];
 
   // Generate varying (correlated) bias for each input value.
   // This implementation is based on the one available in Rotors:
@@ -158,8 +167,7 @@ double GaussianNoiseModel::ApplyImpl(double _in, double _dt)
   //
   //  https://github.com/ethz-asl/kalibr/wiki/IMU-Noise-Model
   //
-  if (this->dynamicBiasStdDev > 0 &&
-      this->dynamicBiasCorrTime > 0)
+  if (dynamicBias)
   {
     const double sigmaB = this->dynamicBiasStdDev;
     const double tau = this->dynamicBiasCorrTime;
@@ -168,8 +176,7 @@ double GaussianNoiseModel::ApplyImpl(double _in, double _dt)
         tau / 2 * expm1(-2 * _dt / tau));
 
     const double phiD = exp(-_dt / tau);
-    this->bias = phiD * this->bias +
-      ignition::math::Rand::DblNormal(0, sigmaBD);
+    this->bias = phiD * this->bias + sigmaBD * samples[1];
   }
 
   double output = _in + this->bias + whiteNoise;
@@ -184,6 +191,56 @@ double GaussianNoiseModel::ApplyImpl(double _in, double _dt)
   return output;
 }
 
+//////////////////////////////////////////////////
+void GaussianNoiseModel::ApplyBatch(double *_data, const size_t _count,
+    const double _dt)
+{
+  // The dynamic bias is a random walk that changes with every value, so
+  // it has to be applied one value at a time.
+  if (this->dynamicBiasStdDev > 0 &&
+      this->dynamicBiasCorrTime > 0)
+  {
+    for (size_t i = 0; i < _count; ++i)
+    {
+      if (std::isfinite(_data[i]))
+        _data[i] = this->ApplyImpl(_data[i], _dt);
+    }
+    return;
+  }
+
+  const bool quantize = this->quantized &&
+      !ignition::math::equal(this->precision, 0.0, 1e-6);
+
+  // Values that are not finite are skipped without drawing a sample, like
+  // in Noise::Apply. The finite values are gathered in blocks, and the
+  // samples of a block are drawn at once.
+  const size_t blockSize = 64;
+  size_t indices[blockSize];
+  double samples[blockSize];
+
+  size_t i = 0;
+  while (i < _count)
+  {
+    size_t n = 0;
+    for (; i < _count && n < blockSize; ++i)
+    {
+      if (std::isfinite(_data[i]))
+        indices[n++] = i;
+    }
+
+    this->SampleNormal(samples, n);
+
+    for (size_t j = 0; j < n; ++j)
+    {
+      double output = _data[indices[j]] + this->bias +
+          (this->mean + this->stdDev * samples[j]);
+      if (quantize)
+        output = std::round(output / this->precision) * this->precision;
+      _data[indices[j]] = output;
+    }
+  }
+}
+
 //////////////////////////////////////////////////
 double GaussianNoiseModel::GetMean() const
 {
@@ -132,6 +132,19 @@ namespace gazebo
         /// \biref If type starts with GAUSSIAN, the correlation time of the
         /// process from which the dynamic bias will be driven.
         private: double dynamicBiasCorrTime;
+
+        /// \brief Apply noise to an array of data values, drawing the
+        /// samples in blocks. Called by Noise::Apply for the exact
+        /// GaussianNoiseModel and ImageGaussianNoiseModel types, since a
+        /// derived class may override ApplyImpl.
+        /// \param[in,out] _data Data values.
+        /// \param[in] _count Number of values in _data.
+        /// \param[in] _dt Time since the last call.
+        private: void ApplyBatch(double *_data, const size_t _count,
+                                 const double _dt);
+
+        /// Friend Noise so that it can call ApplyBatch
+        private: friend class Noise;
     };
 
     /// \class GaussianNoiseModel
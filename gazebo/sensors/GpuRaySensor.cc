@@ -15,6 +15,7 @@
  *
 */
 #include <boost/algorithm/string.hpp>
+#include <cmath>
 #include <functional>
 #include <ignition/math.hh>
 #include <ignition/math/Helpers.hh>
@@ -740,6 +741,7 @@ bool GpuRaySensor::UpdateImpl(const bool /*_force*/)
 
   auto dataIter = this->dataPtr->laserCam->LaserDataBegin();
   auto dataEnd = this->dataPtr->laserCam->LaserDataEnd();
+  int dataCount = 0;
   for (int i = 0; dataIter != dataEnd; ++dataIter, ++i)
   {
     const rendering::GpuLaserData data = *dataIter;
@@ -755,16 +757,33 @@ bool GpuRaySensor::UpdateImpl(const bool /*_force*/)
     {
       range = -ignition::math::INF_D;
     }
-    else if (this->noises.find(GPU_RAY_NOISE) != this->noises.end())
-    {
-      range = this->noises[GPU_RAY_NOISE]->Apply(range);
-      range = ignition::math::clamp(range,
-          this->dataPtr->rangeMin, this->dataPtr->rangeMax);
-    }
 
-    range = ignition::math::isnan(range) ? this->dataPtr->rangeMax : range;
     scan->set_ranges(i, range);
     scan->set_intensities(i, intensity);
+    dataCount = i + 1;
+  }
+
+  // Apply noise to the whole scan at once. Masked ranges are infinite, and
+  // are left unchanged by the noise model.
+  double *ranges = scan->mutable_ranges()->mutable_data();
+  auto noiseIter = this->noises.find(GPU_RAY_NOISE);
+  if (noiseIter != this->noises.end())
+  {
+    noiseIter->second->Apply(ranges, dataCount);
+    for (int i = 0; i < dataCount; ++i)
+    {
+      if (std::isfinite(ranges[i]))
+      {
+        ranges[i] = ignition::math::clamp(ranges[i],
+            this->dataPtr->rangeMin, this->dataPtr->rangeMax);
+      }
+    }
+  }
+
+  for (int i = 0; i < dataCount; ++i)
+  {
+    if (ignition::math::isnan(ranges[i]))
+      ranges[i] = this->dataPtr->rangeMax;
   }
 
   if (this->dataPtr->scanPub && this->dataPtr->scanPub->HasConnections())
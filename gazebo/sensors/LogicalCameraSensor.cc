@@ -14,11 +14,13 @@
  * limitations under the License.
  *
 */
+#include <algorithm>
 #include <boost/algorithm/string.hpp>
 #include "gazebo/transport/transport.hh"
 #include "gazebo/msgs/msgs.hh"
 #include "gazebo/physics/World.hh"
 #include "gazebo/physics/Model.hh"
+#include "gazebo/physics/SpatialIndex.hh"
 
 #include "gazebo/sensors/SensorFactory.hh"
 #include "gazebo/sensors/LogicalCameraSensorPrivate.hh"
@@ -111,28 +113,33 @@ void LogicalCameraSensor::Fini()
 
 //////////////////////////////////////////////////
 void LogicalCameraSensorPrivate::AddVisibleModels(
-    ignition::math::Pose3d &_myPose, const physics::Model_V &_models)
+    const ignition::math::Pose3d &_myPose, physics::World &_world)
 {
-  for (auto const &model : _models)
+  // Nested models are in the index too, so the models whose boxes don't
+  // contain their nested models are handled as well.
+  auto models = _world.SpatialIndex()->FrustumQuery(this->frustum,
+      physics::Base::MODEL);
+
+  // Report the models in the order they were created, as when the model
+  // tree was traversed.
+  std::sort(models.begin(), models.end(),
+      [](const physics::EntityPtr &_a, const physics::EntityPtr &_b)
+      {
+        return _a->GetId() < _b->GetId();
+      });
+
+  for (auto const &model : models)
   {
     auto const &scopedName = model->GetScopedName();
-    auto const aabb = model->BoundingBox();
-
-    if (this->modelName != scopedName && this->frustum.Contains(aabb))
-    {
-      // Add new model msg
-      msgs::LogicalCameraImage::Model *modelMsg = this->msg.add_model();
-
-      // Set the name and pose reported by the sensor.
-      modelMsg->set_name(scopedName);
-      msgs::Set(modelMsg->mutable_pose(),
-          model->WorldPose() - _myPose);
-    }
-    // Check nested models
-    // Note, the model AABB does not necessarily contain the nested model
-    // so nested models must be searched even if the frustum does not contain
-    // the parent model.
-    AddVisibleModels(_myPose, model->NestedModels());
+    if (this->modelName == scopedName)
+      continue;
+
+    // Add new model msg
+    msgs::LogicalCameraImage::Model *modelMsg = this->msg.add_model();
+
+    // Set the name and pose reported by the sensor.
+    modelMsg->set_name(scopedName);
+    msgs::Set(modelMsg->mutable_pose(), model->WorldPose() - _myPose);
   }
 }
 
@@ -155,8 +162,8 @@ bool LogicalCameraSensor::UpdateImpl(const bool _force)
     // Set the camera's pose in the message.
     msgs::Set(this->dataPtr->msg.mutable_pose(), myPose);
 
-    // Recursively check if models and nested models are in the frustum.
-    this->dataPtr->AddVisibleModels(myPose, this->world->Models());
+    // Check if models and nested models are in the frustum.
+    this->dataPtr->AddVisibleModels(myPose, *this->world);
 
     // Send the message.
     this->dataPtr->pub->Publish(this->dataPtr->msg);
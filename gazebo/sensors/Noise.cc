@@ -15,7 +15,19 @@
  *
 */
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <typeinfo>
+#include <unordered_map>
+
 #include <boost/function.hpp>
+#include <ignition/math/Helpers.hh>
+#include <ignition/math/Rand.hh>
+
 #include "gazebo/common/Assert.hh"
 #include "gazebo/common/Console.hh"
 
@@ -25,6 +37,85 @@
 using namespace gazebo;
 using namespace sensors;
 
+namespace
+{
+  /// \brief Increment between counter values, the golden ratio in 64 bits.
+  const uint64_t kGamma = 0x9E3779B97F4A7C15ULL;
+
+  /// \brief Number of samples converted per block by the batch sampler.
+  const size_t kBlockSize = 64;
+
+  /// \brief Finalizer of SplitMix64. Maps each 64 bit value to a
+  /// statistically independent looking 64 bit value.
+  inline uint64_t mix(uint64_t _z)
+  {
+    _z = (_z ^ (_z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    _z = (_z ^ (_z >> 27)) * 0x94D049BB133111EBULL;
+    return _z ^ (_z >> 31);
+  }
+
+  /// \brief Uniform value in [0, 1) at position _counter of the stream
+  /// identified by _key.
+  inline double uniform(const uint64_t _key, const uint64_t _counter)
+  {
+    return (mix(_key + _counter * kGamma) >> 11) * 0x1.0p-53;
+  }
+
+  /// \brief Box-Muller transform of two uniform values, with _u1 in (0, 1].
+  inline double boxMuller(const double _u1, const double _u2)
+  {
+    return std::sqrt(-2.0 * std::log(_u1)) * std::cos(2.0 * IGN_PI * _u2);
+  }
+
+  /// \brief Seed used by noise models that are not seeded explicitly. It
+  /// depends on the global seed, so that --seed still changes the noise.
+  uint64_t defaultSeed()
+  {
+    static std::atomic<uint64_t> instances(0);
+    return mix(static_cast<uint64_t>(ignition::math::Rand::Seed()) * kGamma +
+        instances++);
+  }
+
+  /// \brief Counter-based random stream of a noise model.
+  class NoiseStream
+  {
+    /// \brief Seed of the stream.
+    public: uint64_t seed = defaultSeed();
+
+    /// \brief Number of values drawn from the stream.
+    public: uint64_t counter = 0;
+  };
+
+  // Added here to avoid breaking the ABI
+  // TODO move to Noise when merging forward
+  /// \brief Random streams of the noise models. A stream is only used by
+  /// its noise model, so the mutex only protects the map.
+  std::unordered_map<const Noise *, std::unique_ptr<NoiseStream> >
+      noiseStreams;
+
+  /// \brief Protects noiseStreams. Lookups share the lock.
+  std::shared_timed_mutex noiseStreamsMutex;
+
+  /// \brief Get the random stream of a noise model, creating it if needed.
+  /// \param[in] _noise The noise model.
+  /// \return The stream, which lives until the noise model is destroyed.
+  NoiseStream &noiseStream(const Noise *_noise)
+  {
+    {
+      std::shared_lock<std::shared_timed_mutex> lock(noiseStreamsMutex);
+      auto iter = noiseStreams.find(_noise);
+      if (iter != noiseStreams.end())
+        return *iter->second;
+    }
+
+    std::lock_guard<std::shared_timed_mutex> lock(noiseStreamsMutex);
+    std::unique_ptr<NoiseStream> &stream = noiseStreams[_noise];
+    if (!stream)
+      stream.reset(new NoiseStream());
+    return *stream;
+  }
+}
+
 //////////////////////////////////////////////////
 NoisePtr NoiseFactory::NewNoiseModel(sdf::ElementPtr _sdf,
     const std::string &_sensorType)
@@ -75,11 +166,14 @@ NoisePtr NoiseFactory::NewNoiseModel(sdf::ElementPtr _sdf,
 Noise::Noise(NoiseType _type)
   : type(_type)
 {
+  noiseStream(this);
 }
 
 //////////////////////////////////////////////////
 Noise::~Noise()
 {
+  std::lock_guard<std::shared_timed_mutex> lock(noiseStreamsMutex);
+  noiseStreams.erase(this);
 }
 
 //////////////////////////////////////////////////
@@ -118,12 +212,84 @@ double Noise::Apply(double _in, double _dt)
     return this->ApplyImpl(_in, _dt);
 }
 
+//////////////////////////////////////////////////
+void Noise::Apply(double *_data, const size_t _count, const double _dt)
+{
+  if (this->type == NONE || !_data)
+    return;
+
+  // The Gaussian models draw their samples in blocks. Derived classes may
+  // override ApplyImpl, so they go through it one value at a time.
+  if (typeid(*this) == typeid(GaussianNoiseModel) ||
+      typeid(*this) == typeid(ImageGaussianNoiseModel))
+  {
+    static_cast<GaussianNoiseModel *>(this)->ApplyBatch(_data, _count, _dt);
+    return;
+  }
+
+  for (size_t i = 0; i < _count; ++i)
+  {
+    if (std::isfinite(_data[i]))
+      _data[i] = this->Apply(_data[i], _dt);
+  }
+}
+
 //////////////////////////////////////////////////
 double Noise::ApplyImpl(double _in, double /*_dt*/)
 {
   return _in;
 }
 
+//////////////////////////////////////////////////
+void Noise::SetSeed(const uint64_t _seed)
+{
+  NoiseStream &stream = noiseStream(this);
+  stream.seed = _seed;
+  stream.counter = 0;
+}
+
+//////////////////////////////////////////////////
+uint64_t Noise::Seed() const
+{
+  return noiseStream(this).seed;
+}
+
+//////////////////////////////////////////////////
+double Noise::SampleNormal()
+{
+  double sample;
+  this->SampleNormal(&sample, 1);
+  return sample;
+}
+
+//////////////////////////////////////////////////
+void Noise::SampleNormal(double *_samples, const size_t _count)
+{
+  NoiseStream &stream = noiseStream(this);
+
+  double u1[kBlockSize];
+  double u2[kBlockSize];
+
+  // Work in blocks, so that the hashing and the transform each run as a
+  // tight loop over plain arrays that the compiler can vectorize.
+  for (size_t start = 0; start < _count; start += kBlockSize)
+  {
+    const size_t n = std::min(kBlockSize, _count - start);
+    const uint64_t base = stream.counter + 2 * start;
+
+    for (size_t i = 0; i < n; ++i)
+    {
+      u1[i] = 1.0 - uniform(stream.seed, base + 2 * i);
+      u2[i] = uniform(stream.seed, base + 2 * i + 1);
+    }
+
+    for (size_t i = 0; i < n; ++i)
+      _samples[start + i] = boxMuller(u1[i], u2[i]);
+  }
+
+  stream.counter += 2 * _count;
+}
+
 //////////////////////////////////////////////////
 Noise::NoiseType Noise::GetNoiseType() const
 {
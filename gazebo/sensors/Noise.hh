@@ -18,6 +18,8 @@
 #ifndef _GAZEBO_NOISE_HH_
 #define _GAZEBO_NOISE_HH_
 
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 #include <string>
 
@@ -82,6 +84,16 @@ namespace gazebo
       /// \return Data with noise applied.
       public: double Apply(double _in, double _dt = 0.0);
 
+      /// \brief Apply noise to an array of data values in place. Values
+      /// that are not finite, such as masked ray ranges, are left unchanged
+      /// and draw nothing from the random stream. The result is the same as
+      /// calling Apply on each finite value in order.
+      /// \param[in,out] _data Data values.
+      /// \param[in] _count Number of values in _data.
+      /// \param[in] _dt Time since the last call.
+      public: void Apply(double *_data, const size_t _count,
+                         const double _dt = 0.0);
+
       /// \brief Apply noise to input data value. This gets overriden by
       /// derived classes, and called by Apply.
       /// \param[in] _in Input data value.
@@ -123,6 +135,30 @@ namespace gazebo
       /// \param[in] _out Output stream
       public: virtual void Print(std::ostream &_out) const;
 
+      /// \brief Set the seed of the random stream used by this noise model.
+      /// Each noise model draws from its own counter-based stream, so the
+      /// samples only depend on the seed and on the number of values drawn
+      /// so far, and not on the update order of other sensors. Setting the
+      /// seed restarts the stream.
+      /// \param[in] _seed Seed of the stream.
+      /// \sa Sensor::Init
+      public: void SetSeed(const uint64_t _seed);
+
+      /// \brief Get the seed of the random stream.
+      /// \return Seed of the stream.
+      public: uint64_t Seed() const;
+
+      /// \brief Draw a sample from the standard normal distribution, using
+      /// the stream of this noise model.
+      /// \return Sample with mean 0 and standard deviation 1.
+      protected: double SampleNormal();
+
+      /// \brief Draw samples from the standard normal distribution. This
+      /// returns the same samples as calling SampleNormal _count times.
+      /// \param[out] _samples Buffer that receives the samples.
+      /// \param[in] _count Number of samples to draw.
+      protected: void SampleNormal(double *_samples, const size_t _count);
+
       /// \brief Which type of noise we're applying
       private: NoiseType type;
 
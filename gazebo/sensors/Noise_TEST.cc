@@ -17,6 +17,10 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 #include <boost/accumulators/accumulators.hpp>
 #include <boost/accumulators/statistics/stats.hpp>
 #include <boost/accumulators/statistics/mean.hpp>
@@ -373,6 +377,102 @@ TEST_F(NoiseTest, OnApplyNoise)
   }
 }
 
+//////////////////////////////////////////////////
+// Test that applying noise to an array matches applying it to each value
+TEST_F(NoiseTest, ApplyBatch)
+{
+  const size_t count = 1001;
+  std::vector<double> data(count);
+  for (size_t i = 0; i < count; ++i)
+    data[i] = static_cast<double>(i) * 0.01;
+  data[3] = ignition::math::INF_D;
+  data[4] = -ignition::math::INF_D;
+  data[5] = ignition::math::NAN_D;
+
+  // Plain, quantized, and with a dynamic bias
+  sdf::ElementPtr dynamicBiasSdf = NoiseSdf("gaussian", 0.5, 2.0, 0, 0, 0);
+  dynamicBiasSdf->GetElement("dynamic_bias_stddev")->Set(0.1);
+  dynamicBiasSdf->GetElement("dynamic_bias_correlation_time")->Set(100.0);
+
+  for (auto const &noiseSdf : {NoiseSdf("gaussian", 0.5, 2.0, 0, 0, 0.0),
+      NoiseSdf("gaussian", 0.5, 2.0, 0, 0, 0.1), dynamicBiasSdf})
+  {
+    sensors::NoisePtr scalar = sensors::NoiseFactory::NewNoiseModel(
+        noiseSdf->Clone());
+    sensors::NoisePtr batch = sensors::NoiseFactory::NewNoiseModel(
+        noiseSdf->Clone());
+    scalar->SetSeed(42);
+    batch->SetSeed(42);
+
+    // Values that are not finite don't draw from the stream
+    std::vector<double> expected = data;
+    for (auto &value : expected)
+    {
+      if (std::isfinite(value))
+        value = scalar->Apply(value, 0.01);
+    }
+
+    std::vector<double> actual = data;
+    batch->Apply(actual.data(), actual.size(), 0.01);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+      if (std::isnan(expected[i]))
+        EXPECT_TRUE(std::isnan(actual[i]));
+      else
+        EXPECT_DOUBLE_EQ(expected[i], actual[i]);
+    }
+    EXPECT_EQ(ignition::math::INF_D, actual[3]);
+    EXPECT_EQ(-ignition::math::INF_D, actual[4]);
+
+    // Both streams are still in step
+    EXPECT_DOUBLE_EQ(scalar->Apply(1.0), batch->Apply(1.0));
+  }
+}
+
+//////////////////////////////////////////////////
+// Test the statistics and seeding of the per-model random stream
+TEST_F(NoiseTest, Seed)
+{
+  const double mean = 10.0;
+  const double stddev = 5.0;
+
+  sensors::NoisePtr noise = sensors::NoiseFactory::NewNoiseModel(
+      NoiseSdf("gaussian", mean, stddev, 0, 0, 0));
+  noise->SetSeed(1234);
+  EXPECT_EQ(1234u, noise->Seed());
+
+  const size_t count = 10000;
+  std::vector<double> data(count, 0.0);
+  noise->Apply(data.data(), count);
+
+  boost::accumulators::accumulator_set<double,
+    boost::accumulators::stats<boost::accumulators::tag::mean,
+                               boost::accumulators::tag::variance > > acc;
+  for (auto value : data)
+    acc(value);
+
+  // See comments in GaussianNoise function to explain these calculations.
+  double sampleStdDev = g_sigma*stddev / sqrt(count);
+  EXPECT_NEAR(boost::accumulators::mean(acc), mean, sampleStdDev);
+  double variance = stddev*stddev;
+  double sampleVariance2 = 2 * variance*variance / (count - 1);
+  EXPECT_NEAR(boost::accumulators::variance(acc),
+              variance, g_sigma*sqrt(sampleVariance2));
+
+  // Setting the same seed restarts the stream
+  noise->SetSeed(1234);
+  std::vector<double> again(count, 0.0);
+  noise->Apply(again.data(), count);
+  EXPECT_EQ(data, again);
+
+  // A different seed gives a different stream
+  noise->SetSeed(1235);
+  std::fill(again.begin(), again.end(), 0.0);
+  noise->Apply(again.data(), count);
+  EXPECT_NE(data, again);
+}
+
 /////////////////////////////////////////////////
 int main(int argc, char **argv)
 {
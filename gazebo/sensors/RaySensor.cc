@@ -14,6 +14,8 @@
  * limitations under the License.
  *
 */
+#include <cmath>
+
 #include <boost/algorithm/string.hpp>
 
 #include "gazebo/physics/World.hh"
@@ -483,20 +485,31 @@ bool RaySensor::UpdateImpl(const bool /*_force*/)
       {
         range = -ignition::math::INF_D;
       }
-      else if (this->noises.find(RAY_NOISE) !=
-               this->noises.end())
-      {
-        // currently supports only one noise model per laser sensor
-        range = this->noises[RAY_NOISE]->Apply(range);
-        range = ignition::math::clamp(range,
-            this->RangeMin(), this->RangeMax());
-      }
 
       scan->add_ranges(range);
       scan->add_intensities(intensity);
     }
   }
 
+  // Apply noise to the whole scan at once. Masked ranges are infinite, and
+  // are left unchanged by the noise model.
+  auto noiseIter = this->noises.find(RAY_NOISE);
+  if (noiseIter != this->noises.end())
+  {
+    // currently supports only one noise model per laser sensor
+    double *ranges = scan->mutable_ranges()->mutable_data();
+    const int rangeSize = scan->ranges_size();
+    noiseIter->second->Apply(ranges, rangeSize);
+    for (int i = 0; i < rangeSize; ++i)
+    {
+      if (std::isfinite(ranges[i]))
+      {
+        ranges[i] = ignition::math::clamp(ranges[i],
+            this->RangeMin(), this->RangeMax());
+      }
+    }
+  }
+
   if (this->dataPtr->scanPub && this->dataPtr->scanPub->HasConnections())
     this->dataPtr->scanPub->Publish(this->dataPtr->laserMsg);
 
@@ -14,6 +14,8 @@
  * limitations under the License.
  *
 */
+#include <ignition/math/Rand.hh>
+
 #include "gazebo/transport/transport.hh"
 
 #include "gazebo/physics/PhysicsIface.hh"
@@ -160,6 +162,26 @@ void Sensor::Init()
 {
   this->SetUpdateRate(this->sdf->Get<double>("update_rate"));
 
+  // Give each noise model its own random stream, derived from the global
+  // seed, the sensor name and the noise type. The noise is then the same
+  // from run to run, whatever order the sensors are updated in. FNV-1a is
+  // used since std::hash differs between standard libraries.
+  uint64_t nameHash = 0xCBF29CE484222325ULL;
+  for (const char c : this->ScopedName())
+  {
+    nameHash ^= static_cast<unsigned char>(c);
+    nameHash *= 0x100000001B3ULL;
+  }
+  for (auto &noise : this->noises)
+  {
+    if (noise.second)
+    {
+      noise.second->SetSeed(nameHash ^
+          (static_cast<uint64_t>(ignition::math::Rand::Seed()) << 32) ^
+          (static_cast<uint64_t>(noise.first) << 16));
+    }
+  }
+
   // Load the plugins
   if (this->sdf->HasElement("plugin"))
   {
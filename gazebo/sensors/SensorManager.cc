@@ -111,15 +111,18 @@ bool SensorManager::Running() const
 //////////////////////////////////////////////////
 void SensorManager::WaitForSensors(double _clk, double _dt)
 {
-  double tnext = this->NextRequiredTimestamp();
-
-  while (!std::isnan(tnext)
-      && ignition::math::lessOrNearEqual(tnext - _dt / 2.0, _clk)
-      && physics::worlds_running())
+  // The sensors are ready once none of them requires the current tick.
+  auto ready = [this, _clk, _dt]()
   {
-    this->WaitForPrerendered(0.001);
-    tnext = this->NextRequiredTimestamp();
-  }
+    double tnext = this->NextRequiredTimestamp();
+    return std::isnan(tnext) ||
+        !ignition::math::lessOrNearEqual(tnext - _dt / 2.0, _clk);
+  };
+
+  // The timeout is only used to check whether the worlds are still running
+  bool done = false;
+  while (!done && physics::worlds_running())
+    done = this->WaitForPrerendered(0.001, ready);
 }
 
 //////////////////////////////////////////////////
@@ -128,11 +131,18 @@ void SensorManager::Update(bool _force)
   {
     boost::recursive_mutex::scoped_lock lock(this->mutex);
 
-    if (this->worlds.empty() && physics::worlds_running() && this->initialized)
+    // Worlds without sensors are not added by CreateSensor. Mark them as
+    // initialized here, since their plugins are only loaded after that.
+    if (this->initialized && physics::worlds_running())
     {
-      auto world = physics::get_world();
-      this->worlds[world->Name()] = world;
-      world->_SetSensorsInitialized(true);
+      for (auto const &world : physics::get_worlds())
+      {
+        if (this->worlds.find(world->Name()) == this->worlds.end())
+        {
+          this->worlds[world->Name()] = world;
+          world->_SetSensorsInitialized(true);
+        }
+      }
     }
 
     if (!this->initSensors.empty())
@@ -448,11 +458,12 @@ void SensorManager::RemoveSensor(const std::string &_name)
 }
 
 //////////////////////////////////////////////////
-bool SensorManager::WaitForPrerendered(double _timeoutsec)
+bool SensorManager::WaitForPrerendered(double _timeoutsec,
+    const std::function<bool()> &_ready)
 {
   if (this->sensorContainers[sensors::IMAGE]->sensors.size() > 0)
     return ((ImageSensorContainer*)this->sensorContainers[sensors::IMAGE])
-                ->WaitForPrerendered(_timeoutsec);
+                ->WaitForPrerendered(_timeoutsec, _ready);
 
   return true;
 }
@@ -781,7 +792,11 @@ void SensorManager::ImageSensorContainer::Update(bool _force)
   // Signals end of prerender phase
   event::Events::preRenderEnded();
 
-  // Notify that prerender is over
+  // Notify that prerender is over. Taking the lock orders the notification
+  // after any waiter that evaluated its condition before the prerender.
+  {
+    std::lock_guard<std::mutex> lock(this->mutexPrerendered);
+  }
   this->conditionPrerendered.notify_all();
 
   // Tell all the cameras to render
@@ -794,14 +809,12 @@ void SensorManager::ImageSensorContainer::Update(bool _force)
 }
 
 //////////////////////////////////////////////////
-bool SensorManager::ImageSensorContainer::WaitForPrerendered(double _timeoutsec)
+bool SensorManager::ImageSensorContainer::WaitForPrerendered(double _timeoutsec,
+    const std::function<bool()> &_ready)
 {
-  std::cv_status ret;
-  std::mutex mtx;
-  std::unique_lock<std::mutex> lck(mtx);
-  ret = this->conditionPrerendered.wait_for(lck,
-      std::chrono::duration<double>(_timeoutsec));
-  return (ret == std::cv_status::no_timeout);
+  std::unique_lock<std::mutex> lck(this->mutexPrerendered);
+  return this->conditionPrerendered.wait_for(lck,
+      std::chrono::duration<double>(_timeoutsec), _ready);
 }
 
 /////////////////////////////////////////////////
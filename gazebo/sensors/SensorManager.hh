@@ -23,6 +23,8 @@
 #include <list>
 #include <map>
 #include <condition_variable>
+#include <functional>
+#include <mutex>
 
 #include <sdf/sdf.hh>
 
@@ -184,10 +186,13 @@ namespace gazebo
       /// \param[in] _dt world time step
       private: void WaitForSensors(double _clk, double _dt);
 
-      /// \brief Wait until pre-rendering phase is over.
+      /// \brief Wait until a pre-rendering phase makes a condition true.
       /// \param[in] _timeoutsec timeout expressed in seconds
+      /// \param[in] _ready Condition to wait for, evaluated with the
+      /// prerender lock held so that no prerender phase is missed.
       /// \return True if timeout has NOT been met
-      private: bool WaitForPrerendered(double _timeoutsec);
+      private: bool WaitForPrerendered(double _timeoutsec,
+                   const std::function<bool()> &_ready);
 
       /// \brief Add a new sensor to a sensor container.
       /// \param[in] _sensor Pointer to a sensor to add.
@@ -282,10 +287,13 @@ namespace gazebo
       /// the SensorContainer.
       private: class ImageSensorContainer : public SensorContainer
                {
-                 /// \brief Wait until pre-rendering phase is over.
+                 /// \brief Wait until a pre-rendering phase makes a
+                 /// condition true.
                  /// \param[in] _timeoutsec timeout expressed in seconds
+                 /// \param[in] _ready Condition to wait for.
                  /// \return True if timeout has NOT been met
-                 public: bool WaitForPrerendered(double _timeoutsec);
+                 public: bool WaitForPrerendered(double _timeoutsec,
+                             const std::function<bool()> &_ready);
 
                  /// \brief The special update for image based sensors.
                  /// \param[in] _force True to force the sensors to update,
@@ -294,6 +302,10 @@ namespace gazebo
 
                  /// \brief used to wait for the end of prerendering
                  private: std::condition_variable conditionPrerendered;
+
+                 /// \brief Protects the end of the prerender phase, so
+                 /// that waiters can't miss its notification.
+                 private: std::mutex mutexPrerendered;
                };
       /// \endcond
 
@@ -22,6 +22,7 @@
 #include "gazebo/physics/SurfaceParams.hh"
 #include "gazebo/physics/MeshShape.hh"
 #include "gazebo/physics/PhysicsEngine.hh"
+#include "gazebo/physics/ContactFeed.hh"
 #include "gazebo/physics/ContactManager.hh"
 #include "gazebo/physics/Collision.hh"
 
@@ -184,27 +185,26 @@ void SonarSensor::Load(const std::string &_worldName)
   this->dataPtr->sonarCollision->SetCollideBits(~GZ_SENSOR_COLLIDE);
   this->dataPtr->sonarCollision->SetCategoryBits(GZ_SENSOR_COLLIDE);
 
-  /*std::vector<std::string> collisions;
-  collisions.push_back(this->dataPtr->sonarCollision->GetScopedName());
-
+  // Create a contact filter for the collision shape, and read its contacts
+  // in-process
   physics::ContactManager *contactMgr =
     this->world->Physics()->GetContactManager();
-    */
-
-  // Create a contact topic for the collision shape
-  std::string topic =
-    this->world->Physics()->GetContactManager()->CreateFilter(
-        this->dataPtr->sonarCollision->GetScopedName(),
-        this->dataPtr->sonarCollision->GetScopedName());
-
-  // Subscribe to the contact topic
-  this->dataPtr->contactSub = this->node->Subscribe(topic,
-      &SonarSensor::OnContacts, this);
+  contactMgr->CreateFilter(this->dataPtr->sonarCollision->GetScopedName(),
+      this->dataPtr->sonarCollision->GetScopedName());
+  this->dataPtr->contactFeed =
+    contactMgr->Feed(this->dataPtr->sonarCollision->GetScopedName());
 
   // Advertise the sensor's topic on which we will output range data.
   this->dataPtr->sonarPub = this->node->Advertise<msgs::SonarStamped>(
       this->Topic());
 
+  // Contacts are only stored while the sensor is active
+  if (this->dataPtr->contactFeed)
+  {
+    this->dataPtr->contactFeed->SetReaderActive(
+        [this]() {return this->IsActive();});
+  }
+
   // Initialize the message that will be published on this->dataPtr->sonarPub.
   this->dataPtr->sonarMsg.mutable_sonar()->set_geometry(geometry);
   this->dataPtr->sonarMsg.mutable_sonar()->set_range_min(
@@ -242,8 +242,12 @@ void SonarSensor::Fini()
     mgr->RemoveFilter(this->dataPtr->sonarCollision->GetScopedName());
   }
 
+  if (this->dataPtr->contactFeed)
+  {
+    this->dataPtr->contactFeed->SetReaderActive(std::function<bool ()>());
+    this->dataPtr->contactFeed.reset();
+  }
   this->dataPtr->sonarPub.reset();
-  this->dataPtr->contactSub.reset();
   Sensor::Fini();
 }
 
@@ -294,10 +298,15 @@ bool SonarSensor::UpdateImpl(const bool /*_force*/)
 
   ignition::math::Vector3d pos;
 
+  // Take the contacts since the last update
+  if (this->dataPtr->contactFeed)
+    this->dataPtr->contactFeed->Read();
+  const unsigned int contactCount = this->dataPtr->contactFeed ?
+    this->dataPtr->contactFeed->RecordCount() : 0;
+
   // A 5-step hysteresis window was chosen to reduce range value from
   // bouncing.
-  if (!this->dataPtr->incomingContacts.empty() ||
-      this->dataPtr->emptyContactCount > 5)
+  if (contactCount > 0 || this->dataPtr->emptyContactCount > 5)
   {
     this->dataPtr->sonarMsg.mutable_sonar()->set_range(
         this->dataPtr->rangeMax);
@@ -308,46 +317,30 @@ bool SonarSensor::UpdateImpl(const bool /*_force*/)
     ++this->dataPtr->emptyContactCount;
   }
 
-
-  // Iterate over all the contact messages
-  for (auto iter = this->dataPtr->incomingContacts.begin();
-      iter != this->dataPtr->incomingContacts.end(); ++iter)
+  // Iterate over all the contacts
+  for (unsigned int i = 0; i < contactCount; ++i)
   {
-    // Iterate over all the contacts in the message
-    for (int i = 0; i < (*iter)->contact_size(); ++i)
+    const physics::ContactRecord &record =
+      this->dataPtr->contactFeed->Record(i);
+
+    for (size_t j = 0; j < record.positions.size(); ++j)
     {
-      // Debug output:
-      // std::cout << "C1[" << (*iter)->contact(i).collision1() << "]"
-      //   << "C2[" << (*iter)->contact(i).collision2() << "]\n";
+      // Get the contact position relative to the reference position.
+      pos = record.positions[j] - referencePose.Pos();
 
-      for (int j = 0; j < (*iter)->contact(i).position_size(); ++j)
+      // Compute the sensed range.
+      double len = pos.Length() - record.depths[j];
+
+      // Copy the contact position.
+      if (len < this->dataPtr->sonarMsg.sonar().range())
       {
-        // Get the contact position relative to the reference position.
-        pos = msgs::ConvertIgn((*iter)->contact(i).position(j)) -
-          referencePose.Pos();
-
-        // Compute the sensed range.
-        double len = pos.Length() - (*iter)->contact(i).depth(j);
-
-        // Debug output:
-        // std::cout << "  RP[" << referencePose << "]  P[" << pos
-        //   << "] L[" << len << "] D["
-        //   << (*iter)->contact(i).depth(j) << "]\n";
-
-        // Copy the contact message.
-        if (len < this->dataPtr->sonarMsg.sonar().range())
-        {
-          this->dataPtr->sonarMsg.mutable_sonar()->set_range(len);
-          msgs::Set(this->dataPtr->sonarMsg.mutable_sonar()->mutable_contact(),
-              referencePose.Rot().RotateVectorReverse(pos));
-        }
+        this->dataPtr->sonarMsg.mutable_sonar()->set_range(len);
+        msgs::Set(this->dataPtr->sonarMsg.mutable_sonar()->mutable_contact(),
+            referencePose.Rot().RotateVectorReverse(pos));
       }
     }
   }
 
-  // Clear the incoming contact list.
-  this->dataPtr->incomingContacts.clear();
-
   this->dataPtr->update(this->dataPtr->sonarMsg);
 
   if (this->dataPtr->sonarPub)
@@ -362,23 +355,6 @@ bool SonarSensor::IsActive() const
   return Sensor::IsActive() || this->dataPtr->sonarPub->HasConnections();
 }
 
-//////////////////////////////////////////////////
-void SonarSensor::OnContacts(ConstContactsPtr &_msg)
-{
-  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
-
-  // Only store information if the sensor is active
-  if (this->IsActive() && _msg->contact_size() > 0)
-  {
-    // Store the contacts message for processing in UpdateImpl
-    this->dataPtr->incomingContacts.push_back(_msg);
-
-    // Prevent the incomingContacts list to grow indefinitely.
-    if (this->dataPtr->incomingContacts.size() > 100)
-      this->dataPtr->incomingContacts.pop_front();
-  }
-}
-
 //////////////////////////////////////////////////
 event::ConnectionPtr SonarSensor::ConnectUpdate(
     std::function<void (msgs::SonarStamped)> _subscriber)
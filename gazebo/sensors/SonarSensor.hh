@@ -98,9 +98,6 @@ namespace gazebo
       // Documentation inherited
       protected: virtual void Fini();
 
-      /// \brief Callback for contact messages from the physics engine.
-      private: void OnContacts(ConstContactsPtr &_msg);
-
       /// \internal
       /// \brief Internal data pointer
       private: std::unique_ptr<SonarSensorPrivate> dataPtr;
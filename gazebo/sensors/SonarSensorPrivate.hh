@@ -17,7 +17,6 @@
 #ifndef _GAZEBO_SENSORS_SONARSENSOR_PRIVATE_HH_
 #define _GAZEBO_SENSORS_SONARSENSOR_PRIVATE_HH_
 
-#include <list>
 #include <mutex>
 #include <ignition/math/Pose3.hh>
 
@@ -33,9 +32,6 @@ namespace gazebo
     /// \brief Sonar sensor private data
     class SonarSensorPrivate
     {
-      /// \brief Contact messages list type
-      typedef std::list<boost::shared_ptr<msgs::Contacts const> > ContactMsgs_L;
-
       /// \brief Update event.
       public: event::EventT<void(msgs::SonarStamped)> update;
 
@@ -48,8 +44,8 @@ namespace gazebo
       /// \brief Parent entity of this sensor
       public: physics::EntityPtr parentEntity;
 
-      /// \brief Subscription to contact messages from the physics engine
-      public: transport::SubscriberPtr contactSub;
+      /// \brief In-process feed of the contacts of the sonar shape.
+      public: physics::ContactFeedPtr contactFeed;
 
       /// \brief Publishes the sonarMsg.
       public: transport::PublisherPtr sonarPub;
@@ -60,9 +56,6 @@ namespace gazebo
       /// \brief Mutex used to protect reading/writing the sonar message.
       public: std::mutex mutex;
 
-      /// \brief List of received contacts from the sonar collision shape.
-      public: ContactMsgs_L incomingContacts;
-
       /// \brief Pose of the sonar shape's midpoint.
       public: ignition::math::Pose3d sonarMidPose;
 
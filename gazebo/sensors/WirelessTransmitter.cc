@@ -14,6 +14,9 @@
  * limitations under the License.
  *
 */
+#include <algorithm>
+#include <cmath>
+#include <vector>
 #include <ignition/math/Rand.hh>
 
 #include "gazebo/msgs/msgs.hh"
@@ -79,10 +82,18 @@ void WirelessTransmitter::Init()
 {
   WirelessTransceiver::Init();
 
-  // This ray will be used in SignalStrength() for checking obstacles
-  // between the transmitter and a given point.
-  this->dataPtr->testRay = boost::dynamic_pointer_cast<RayShape>(
-      this->world->Physics()->CreateShape("ray", CollisionPtr()));
+  // Iterate using a rectangular grid, but only choose the points within
+  // a circunference of radius MaxRadius
+  for (double x = -this->dataPtr->MaxRadius;
+       x <= this->dataPtr->MaxRadius; x += this->dataPtr->Step)
+  {
+    for (double y = -this->dataPtr->MaxRadius;
+         y <= this->dataPtr->MaxRadius; y += this->dataPtr->Step)
+    {
+      if (std::hypot(x, y) <= this->dataPtr->MaxRadius)
+        this->dataPtr->cells.push_back(ignition::math::Vector2d(x, y));
+    }
+  }
 }
 
 //////////////////////////////////////////////////
@@ -92,38 +103,46 @@ bool WirelessTransmitter::UpdateImpl(const bool /*_force*/)
 
   if (this->dataPtr->visualize)
   {
-    msgs::PropagationGrid msg;
-    ignition::math::Pose3d pos;
-    ignition::math::Pose3d worldPose;
-    double strength;
-    msgs::PropagationParticle *p;
-
-    // Iterate using a rectangular grid, but only choose the points within
-    // a circunference of radius MaxRadius
-    for (double x = -this->dataPtr->MaxRadius;
-         x <= this->dataPtr->MaxRadius; x += this->dataPtr->Step)
+    physics::LineOfSight *lineOfSight = this->world->LineOfSight();
+
+    // Obstacles are only searched again if the transmitter or the scene
+    // moved. They are searched for all the cells in one batch.
+    if (!this->dataPtr->cached ||
+        this->dataPtr->cachedPose != this->referencePose ||
+        this->dataPtr->cachedRevision != lineOfSight->Revision())
     {
-      for (double y = -this->dataPtr->MaxRadius;
-           y <= this->dataPtr->MaxRadius; y += this->dataPtr->Step)
+      this->dataPtr->segments.clear();
+      for (auto const &cell : this->dataPtr->cells)
       {
-        pos.Set(x, y, 0.0, 0, 0, 0);
-
-        worldPose = pos + this->referencePose;
-
-        if (this->referencePose.Pos().Distance(worldPose.Pos()) <=
-            this->dataPtr->MaxRadius)
-        {
-          // For the propagation model assume the receiver antenna has the same
-          // gain as the transmitter
-          strength = this->SignalStrength(worldPose, this->Gain());
-
-          // Add a new particle to the grid
-          p = msg.add_particle();
-          p->set_x(x);
-          p->set_y(y);
-          p->set_signal_level(strength);
-        }
+        ignition::math::Pose3d worldPose =
+          ignition::math::Pose3d(cell.X(), cell.Y(), 0.0, 0, 0, 0) +
+          this->referencePose;
+        this->dataPtr->segments.push_back(ignition::math::Line3d(
+              this->referencePose.Pos(), worldPose.Pos()));
       }
+
+      this->dataPtr->cachedRevision = lineOfSight->Evaluate(
+          this->dataPtr->segments, this->dataPtr->obstacles);
+      this->dataPtr->cachedPose = this->referencePose;
+      this->dataPtr->cached = true;
+    }
+
+    msgs::PropagationGrid msg;
+    for (size_t i = 0; i < this->dataPtr->cells.size(); ++i)
+    {
+      const ignition::math::Vector2d &cell = this->dataPtr->cells[i];
+
+      // For the propagation model assume the receiver antenna has the same
+      // gain as the transmitter
+      double strength = this->PropagationModel(
+          std::max(1.0, cell.Length()),
+          this->dataPtr->obstacles[i] < ignition::math::INF_D, this->Gain());
+
+      // Add a new particle to the grid
+      msgs::PropagationParticle *p = msg.add_particle();
+      p->set_x(cell.X());
+      p->set_y(cell.Y());
+      p->set_signal_level(strength);
     }
     this->pub->Publish(msg);
   }
@@ -148,44 +167,36 @@ double WirelessTransmitter::SignalStrength(
     const ignition::math::Pose3d &_receiver,
     const double _rxGain)
 {
-  std::string entityName;
-  double dist;
-  ignition::math::Vector3d end = _receiver.Pos();
-  ignition::math::Vector3d start = this->referencePose.Pos();
-
-  // Avoid computing the intersection of coincident points
-  // This prevents an assertion in bullet (issue #849)
-  if (start == end)
-  {
-    end.Z() += 0.00001;
-  }
+  // Looking for obstacles between start and end points, in a snapshot of
+  // the world, so the physics engine isn't blocked
+  // ToDo: The segment intersects with my own collision model. Fix it.
+  std::vector<ignition::math::Line3d> segments = {ignition::math::Line3d(
+      this->referencePose.Pos(), _receiver.Pos())};
+  std::vector<double> obstacles;
+  this->world->LineOfSight()->Evaluate(segments, obstacles);
 
-  // Acquire the mutex for avoiding race condition with the physics engine
-  boost::recursive_mutex::scoped_lock lock(*(
-        this->world->Physics()->GetPhysicsUpdateMutex()));
-
-  // Compute the value of n depending on the obstacles between Tx and Rx
-  double n = WirelessTransmitterPrivate::NEmpty;
+  double distance = std::max(1.0,
+      this->referencePose.Pos().Distance(_receiver.Pos()));
 
-  // Looking for obstacles between start and end points
-  this->dataPtr->testRay->SetPoints(start, end);
-  this->dataPtr->testRay->GetIntersection(dist, entityName);
+  return this->PropagationModel(distance,
+      obstacles[0] < ignition::math::INF_D, _rxGain);
+}
 
-  // ToDo: The ray intersects with my own collision model. Fix it.
-  if (entityName != "")
-  {
-    n = WirelessTransmitterPrivate::NObstacle;
-  }
+/////////////////////////////////////////////////
+double WirelessTransmitter::PropagationModel(const double _distance,
+    const bool _obstructed, const double _rxGain) const
+{
+  // Compute the value of n depending on the obstacles between Tx and Rx
+  double n = _obstructed ? WirelessTransmitterPrivate::NObstacle :
+    WirelessTransmitterPrivate::NEmpty;
 
-  double distance = std::max(1.0,
-      this->referencePose.Pos().Distance(_receiver.Pos()));
   double x = std::abs(ignition::math::Rand::DblNormal(0.0,
         WirelessTransmitterPrivate::ModelStdDev));
   double wavelength = common::SpeedOfLight / (this->Freq() * 1000000);
 
   // Hata-Okumara propagation model
   double rxPower = this->Power() + this->Gain() + _rxGain - x +
-      20 * log10(wavelength) - 20 * log10(4 * M_PI) - 10 * n * log10(distance);
+      20 * log10(wavelength) - 20 * log10(4 * M_PI) - 10 * n * log10(_distance);
 
   return rxPower;
 }
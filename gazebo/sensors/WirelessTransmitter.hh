@@ -73,6 +73,15 @@ namespace gazebo
       /// \return The standard deviation of the propagation model.
       public: double ModelStdDev() const;
 
+      /// \brief Evaluate the propagation model.
+      /// \param[in] _distance Distance to the receiver, at least 1 m.
+      /// \param[in] _obstructed True if there are obstacles between the
+      /// transmitter and the receiver.
+      /// \param[in] _rxGain Receiver gain value
+      /// \return Signal strength (dBm).
+      private: double PropagationModel(const double _distance,
+          const bool _obstructed, const double _rxGain) const;
+
       /// \internal
       /// \brief Private data pointer
       private: std::unique_ptr<WirelessTransmitterPrivate> dataPtr;
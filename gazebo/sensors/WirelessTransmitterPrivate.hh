@@ -17,8 +17,12 @@
 #ifndef _GAZEBO_SENSORS_WIRELESSTRANSMITTER_PRIVATE_HH_
 #define _GAZEBO_SENSORS_WIRELESSTRANSMITTER_PRIVATE_HH_
 
+#include <cstdint>
 #include <string>
-#include "gazebo/physics/PhysicsTypes.hh"
+#include <vector>
+#include <ignition/math/Line3.hh>
+#include <ignition/math/Pose3.hh>
+#include <ignition/math/Vector2.hh>
 
 namespace gazebo
 {
@@ -57,8 +61,25 @@ namespace gazebo
       /// \brief Reception frequency (MHz).
       public: double freq = 2442.0;
 
-      // \brief Ray used to test for collisions when placing entities
-      public: physics::RayShapePtr testRay;
+      /// \brief Offsets of the cells of the propagation grid, within
+      /// MaxRadius of the transmitter.
+      public: std::vector<ignition::math::Vector2d> cells;
+
+      /// \brief Segments from the transmitter to the cells.
+      public: std::vector<ignition::math::Line3d> segments;
+
+      /// \brief Distances from the transmitter to the first obstacle
+      /// towards each cell, for cachedPose and cachedRevision.
+      public: std::vector<double> obstacles;
+
+      /// \brief Transmitter pose the obstacles were found from.
+      public: ignition::math::Pose3d cachedPose;
+
+      /// \brief Revision of the world the obstacles were found in.
+      public: uint64_t cachedRevision = 0;
+
+      /// \brief True once obstacles were found.
+      public: bool cached = false;
     };
   }
 }
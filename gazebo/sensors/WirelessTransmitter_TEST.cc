@@ -24,6 +24,7 @@ class WirelessTransmitter_TEST : public ServerFixture
     public: WirelessTransmitter_TEST();
     public: void TestCreateWirelessTransmitter();
     public: void TestSignalStrength();
+    public: void TestSignalStrengthOccluded();
     public: void TestUpdateImpl();
     public: void TestUpdateImplNoVisual();
     public: void TestInvalidFreq();
@@ -159,6 +160,31 @@ void WirelessTransmitter_TEST::TestSignalStrength()
   EXPECT_NEAR(signStrengthAvg, -62.0, this->tx->ModelStdDev());
 }
 
+/////////////////////////////////////////////////
+/// \brief Test the signal strength through an obstacle
+void WirelessTransmitter_TEST::TestSignalStrengthOccluded()
+{
+  int samples = 100;
+  double signStrengthAvg = 0.0;
+  ignition::math::Pose3d txPoseOccluded(
+      ignition::math::Vector3d(-3.0, -3.0, 0.055),
+      ignition::math::Quaterniond(0, 0, 0));
+
+  // Place a box between the transmitter and the receiver
+  SpawnBox("obstacle", ignition::math::Vector3d(1, 1, 1),
+      ignition::math::Vector3d(-1.5, -1.5, 0.5),
+      ignition::math::Vector3d::Zero, true);
+
+  for (int i = 0; i < samples; ++i)
+  {
+    this->tx->Update(true);
+    signStrengthAvg += this->tx->SignalStrength(txPoseOccluded, tx->Gain());
+  }
+  signStrengthAvg /= samples;
+
+  EXPECT_NEAR(signStrengthAvg, -100.6, this->tx->ModelStdDev());
+}
+
 /////////////////////////////////////////////////
 /// \brief Callback executed for every propagation grid message received
 void WirelessTransmitter_TEST::TxMsg(const ConstPropagationGridPtr &_msg)
@@ -254,6 +280,12 @@ TEST_F(WirelessTransmitter_TEST, TestSignalStrength)
   TestSignalStrength();
 }
 
+/////////////////////////////////////////////////
+TEST_F(WirelessTransmitter_TEST, TestSignalStrengthOccluded)
+{
+  TestSignalStrengthOccluded();
+}
+
 /////////////////////////////////////////////////
 TEST_F(WirelessTransmitter_TEST, TestUpdateImpl)
 {
@@ -29,6 +29,7 @@
 #include "gazebo/msgs/msgs.hh"
 #include "gazebo/common/Exception.hh"
 
+#include "gazebo/transport/MessagePool.hh"
 #include "gazebo/transport/TransportTypes.hh"
 #include "gazebo/util/system.hh"
 
@@ -144,7 +145,11 @@ namespace gazebo
                   boost::function<void(uint32_t)> _cb, uint32_t _id)
               {
                 this->SetLatching(false);
-                boost::shared_ptr<M> m(new M);
+
+                // Messages parsed for all the subscribers of this type,
+                // recycled once the callbacks drop them
+                static MessagePool<M> pool;
+                boost::shared_ptr<M> m = pool.Acquire();
                 m->ParseFromString(_newdata);
                 this->callback(m);
                 if (!_cb.empty())
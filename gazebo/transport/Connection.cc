@@ -49,6 +49,11 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <set>
+
 #include <boost/bind.hpp>
 #include <boost/function.hpp>
 #include <boost/lexical_cast.hpp>
@@ -84,6 +89,14 @@ static bool addressIsLoopback(const boost::asio::ip::address_v4 &_addr)
   return (_addr.to_ulong() & 0xFF000000) == 0x7F000000;
 }
 
+// Added here to avoid breaking the ABI
+// TODO move to Connection when merging forward
+/// \brief Connections whose written messages carry trace stamps.
+static std::set<const Connection *> tracedConnections;
+
+/// \brief Mutex to protect tracedConnections.
+static std::mutex tracedConnectionsMutex;
+
 //////////////////////////////////////////////////
 Connection::Connection()
 {
@@ -125,6 +138,7 @@ Connection::Connection()
 Connection::~Connection()
 {
   this->Shutdown();
+  this->SetTracing(false);
 
   if (iomanager)
   {
@@ -302,24 +316,39 @@ void Connection::EnqueueMsg(const std::string &_buffer,
     return;
   }
 
+  const bool traced = this->Tracing();
+  const std::size_t traceSize = traced ? TraceStamps::kFrameSize : 0;
+
   char headerBuffer[HEADER_LENGTH + 1];
   snprintf(headerBuffer, HEADER_LENGTH + 1, "%08x",
-      static_cast<unsigned int>(_buffer.size()));
+      static_cast<unsigned int>(_buffer.size() + traceSize) |
+      (traced ? kTraceFrameFlag : 0u));
+
+  std::string frame;
+  frame.reserve(HEADER_LENGTH + traceSize + _buffer.size());
+  frame.append(headerBuffer, HEADER_LENGTH);
+  if (traced)
+  {
+    // The write stamp is filled in by ProcessWriteQueue
+    const TraceStamps *trace = currentTrace();
+    const int64_t stamps[3] = {trace ? trace->publish : 0, traceClock(), 0};
+    frame.append(reinterpret_cast<const char *>(stamps), traceSize);
+  }
+  frame.append(_buffer);
 
   {
     boost::recursive_mutex::scoped_lock lock(this->writeMutex);
 
     if (this->writeQueue.empty() ||
         (this->writeCount > 0 && this->writeQueue.size() == 1) ||
-        (this->writeQueue.back().size() + HEADER_LENGTH + _buffer.size() >
-         4096))
+        (this->writeQueue.back().size() + frame.size() > 4096))
     {
-      this->writeQueue.push_back(std::string(headerBuffer) + _buffer);
+      this->writeQueue.push_back(std::move(frame));
       this->callbacks.push_back({std::make_pair(_cb, _id)});
     }
     else
     {
-      this->writeQueue.back() += std::string(headerBuffer) + _buffer;
+      this->writeQueue.back() += frame;
       this->callbacks.back().push_back(std::make_pair(_cb, _id));
     }
   }
@@ -354,6 +383,9 @@ void Connection::ProcessWriteQueue(bool _blocking)
 
   this->writeCount++;
 
+  if (this->Tracing())
+    StampWrite(this->writeQueue.front());
+
   // Write the serialized data to the socket. We use
   // "gather-write" to send both the head and the data in
   // a single write operation
@@ -549,6 +581,8 @@ bool Connection::Read(std::string &data)
 
   // Parse the header to get the size of the incoming data packet
   incoming_size = this->ParseHeader(std::string(header, HEADER_LENGTH));
+  const bool traced = (incoming_size & kTraceFrameFlag) != 0;
+  incoming_size &= ~static_cast<std::size_t>(kTraceFrameFlag);
   if (incoming_size > 0)
   {
     incoming.resize(incoming_size);
@@ -570,7 +604,10 @@ bool Connection::Read(std::string &data)
     if (error)
       throw boost::system::system_error(error);
 
-    data = std::string(&incoming[0], incoming.size());
+    // Trace stamps are only used by asynchronous reads
+    const std::size_t offset =
+      traced ? std::min(TraceStamps::kFrameSize, incoming.size()) : 0;
+    data = std::string(incoming.data() + offset, incoming.size() - offset);
     result = true;
   }
 
@@ -641,6 +678,67 @@ std::size_t Connection::ParseHeader(const std::string &header)
   return data_size;
 }
 
+//////////////////////////////////////////////////
+void Connection::SetTracing(const bool _enable)
+{
+  bool changed;
+  {
+    std::lock_guard<std::mutex> lock(tracedConnectionsMutex);
+    if (_enable)
+      changed = tracedConnections.insert(this).second;
+    else
+      changed = tracedConnections.erase(this) > 0;
+  }
+
+  if (changed)
+    requestTrace(_enable);
+}
+
+//////////////////////////////////////////////////
+bool Connection::Tracing() const
+{
+  // Avoid the lock while nothing is traced
+  if (!traceRequested())
+    return false;
+
+  std::lock_guard<std::mutex> lock(tracedConnectionsMutex);
+  return tracedConnections.count(this) > 0;
+}
+
+//////////////////////////////////////////////////
+TraceStamps Connection::ReadTraceStamps(const char *_data)
+{
+  TraceStamps trace;
+  trace.read = traceClock();
+  std::memcpy(&trace.publish, _data, sizeof(int64_t));
+  std::memcpy(&trace.enqueue, _data + sizeof(int64_t), sizeof(int64_t));
+  std::memcpy(&trace.write, _data + 2 * sizeof(int64_t), sizeof(int64_t));
+  return trace;
+}
+
+//////////////////////////////////////////////////
+void Connection::StampWrite(std::string &_buffer)
+{
+  const int64_t now = traceClock();
+
+  // Walk the frames of the buffer, using the size in their headers
+  std::size_t offset = 0;
+  while (offset + HEADER_LENGTH <= _buffer.size())
+  {
+    const std::string header = _buffer.substr(offset, HEADER_LENGTH);
+    const uint32_t size = std::strtoul(header.c_str(), nullptr, 16);
+    offset += HEADER_LENGTH;
+
+    if ((size & kTraceFrameFlag) &&
+        offset + TraceStamps::kFrameSize <= _buffer.size())
+    {
+      std::memcpy(&_buffer[offset + 2 * sizeof(int64_t)], &now, sizeof(now));
+    }
+
+    offset += size & ~kTraceFrameFlag;
+  }
+}
+
 //////////////////////////////////////////////////
 void Connection::ReadLoop(const ReadCallback &cb)
 {
@@ -37,6 +37,7 @@
 #include "gazebo/common/Console.hh"
 #include "gazebo/common/Exception.hh"
 #include "gazebo/common/WeakBind.hh"
+#include "gazebo/transport/Trace.hh"
 #include "gazebo/util/system.hh"
 
 #define HEADER_LENGTH 8
@@ -248,20 +249,26 @@ namespace gazebo
 
                   inboundData_size = this->ParseHeader(header);
 
+                  // Traced frames start with trace stamps
+                  const bool traced =
+                    (inboundData_size & kTraceFrameFlag) != 0;
+                  inboundData_size &= ~static_cast<std::size_t>(
+                      kTraceFrameFlag);
+
                  if (inboundData_size > 0)
                   {
                     // Start the asynchronous call to receive data
                     this->inboundData.resize(inboundData_size);
 
                     void (Connection::*f)(const boost::system::error_code &e,
-                        boost::tuple<Handler>) =
+                        boost::tuple<Handler>, const bool) =
                       &Connection::OnReadData<Handler>;
 
                     boost::asio::async_read(*this->socket,
                         boost::asio::buffer(this->inboundData),
                         common::weakBind(f, this->shared_from_this(),
                                     boost::asio::placeholders::error,
-                                    _handler));
+                                    _handler, traced));
                   }
                   else
                   {
@@ -290,9 +297,11 @@ namespace gazebo
       /// as a parameter
       /// \param[in] _e Error code, if any, associated with the read
       /// \param[in] _handler Callback to invoke on received data
+      /// \param[in] _traced True if the data starts with trace stamps
       private: template<typename Handler>
                void OnReadData(const boost::system::error_code &_e,
-                              boost::tuple<Handler> _handler)
+                              boost::tuple<Handler> _handler,
+                              const bool _traced)
               {
                 if (_e)
                 {
@@ -300,9 +309,18 @@ namespace gazebo
                     this->isOpen = false;
                 }
 
+                TraceStamps trace;
+                std::size_t offset = 0;
+                if (_traced &&
+                    this->inboundData.size() >= TraceStamps::kFrameSize)
+                {
+                  trace = this->ReadTraceStamps(this->inboundData.data());
+                  offset = TraceStamps::kFrameSize;
+                }
+
                 // Inform caller that data has been received
-                std::string data(&this->inboundData[0],
-                                  this->inboundData.size());
+                std::string data(this->inboundData.data() + offset,
+                                  this->inboundData.size() - offset);
                 this->inboundData.clear();
 
                 if (data.empty())
@@ -310,8 +328,23 @@ namespace gazebo
 
                 if (!_e && !transport::is_stopped())
                 {
+                  boost::function<void (const std::string &)> func =
+                    boost::get<0>(_handler);
+                  if (trace.read)
+                  {
+                    // Let the nodes receiving the data keep its stamps
+                    const boost::function<void (const std::string &)>
+                      handler = func;
+                    func = [handler, trace](const std::string &_data)
+                    {
+                      setCurrentTrace(&trace);
+                      handler(_data);
+                      setCurrentTrace(nullptr);
+                    };
+                  }
+
                   ConnectionReadTask *task = new(tbb::task::allocate_root())
-                        ConnectionReadTask(boost::get<0>(_handler), data);
+                        ConnectionReadTask(func, data);
                   tbb::task::enqueue(*task);
 
                   // Non-tbb version:
@@ -329,6 +362,17 @@ namespace gazebo
       /// \brief Handle on-write callbacks
       public: void ProcessWriteQueue(bool _blocking = false);
 
+      /// \brief Set whether the messages written to this connection carry
+      /// trace stamps. Only enabled for subscribers that asked for them,
+      /// since other peers can't read traced frames.
+      /// \param[in] _enable True to send trace stamps.
+      public: void SetTracing(const bool _enable);
+
+      /// \brief Get whether the messages written to this connection carry
+      /// trace stamps.
+      /// \return True if they do.
+      public: bool Tracing() const;
+
       /// \brief Get the ID of the connection.
       /// \return The connection's unique ID.
       public: unsigned int GetId() const;
@@ -360,6 +404,16 @@ namespace gazebo
       /// \param[in] _header Header as a string
       private: std::size_t ParseHeader(const std::string &_header);
 
+      /// \brief Read the stamps at the start of a traced frame, and stamp
+      /// the read.
+      /// \param[in] _data Start of the frame, after its header.
+      /// \return The stamps.
+      private: static TraceStamps ReadTraceStamps(const char *_data);
+
+      /// \brief Stamp the write of the traced frames of a buffer.
+      /// \param[in,out] _buffer Frames about to be written.
+      private: static void StampWrite(std::string &_buffer);
+
       /// \brief the read thread
       private: void ReadLoop(const ReadCallback &_cb);
 
@@ -56,6 +56,32 @@ class TopicManagerConnectionTask : public tbb::task
   private: msgs::Publish pub;
 };
 
+// Added here to avoid breaking the ABI of the singleton
+// TODO move to ConnectionManager when merging forward
+/// \brief Advertise and subscribe requests waiting to be sent to the
+/// master.
+class PendingRegistrations
+{
+  /// \brief Advertisements waiting to be sent to the master.
+  public: msgs::Publishers advertisements;
+
+  /// \brief Subscriptions waiting to be sent to the master.
+  public: msgs::Subscribers subscriptions;
+
+  /// \brief Mutex to protect the pending registrations. It is held
+  /// while they are enqueued on the master connection, so that a later
+  /// unadvertise or unsubscribe can't overtake them.
+  public: boost::mutex mutex;
+};
+
+/// \brief Get the pending registrations of the ConnectionManager.
+/// \return The pending registrations.
+static PendingRegistrations &pendingRegistrations()
+{
+  static PendingRegistrations pending;
+  return pending;
+}
+
 //////////////////////////////////////////////////
 ConnectionManager::ConnectionManager()
 {
@@ -270,6 +296,8 @@ void ConnectionManager::RunUpdate()
     }
   }
 
+  this->FlushRegistrations();
+
   if (this->masterConn)
     this->masterConn->ProcessWriteQueue();
 
@@ -483,6 +511,10 @@ void ConnectionManager::OnRead(ConnectionPtr _connection,
     SubscriptionTransportPtr subLink(new SubscriptionTransport());
     subLink->Init(_connection, sub.latching());
 
+    // Only send trace stamps to subscribers that asked for them
+    if (sub.trace())
+      _connection->SetTracing(true);
+
     // Connect the publisher to this transport mechanism
     TopicManager::Instance()->ConnectPubToSub(sub.topic(), subLink);
   }
@@ -497,13 +529,58 @@ void ConnectionManager::Advertise(const std::string &topic,
   if (!this->initialized)
     return;
 
-  msgs::Publish msg;
-  msg.set_topic(topic);
-  msg.set_msg_type(msgType);
-  msg.set_host(this->serverConn->GetLocalAddress());
-  msg.set_port(this->serverConn->GetLocalPort());
+  // Queue the advertisement, it will be sent to the master in a batch on
+  // the next update.
+  {
+    PendingRegistrations &pending = pendingRegistrations();
+    boost::mutex::scoped_lock lock(pending.mutex);
+    msgs::Publish *msg = pending.advertisements.add_publisher();
+    msg->set_topic(topic);
+    msg->set_msg_type(msgType);
+    msg->set_host(this->serverConn->GetLocalAddress());
+    msg->set_port(this->serverConn->GetLocalPort());
+  }
+
+  this->TriggerUpdate();
+}
+
+//////////////////////////////////////////////////
+void ConnectionManager::FlushRegistrations()
+{
+  if (!this->masterConn)
+    return;
 
-  this->masterConn->EnqueueMsg(msgs::Package("advertise", msg));
+  // The requests are enqueued before the lock is released, so that they
+  // reach the master before an unadvertise or unsubscribe that is
+  // enqueued by another thread after this call.
+  PendingRegistrations &pending = pendingRegistrations();
+  boost::mutex::scoped_lock lock(pending.mutex);
+
+  // A single registration is sent with the plain message type.
+  if (pending.advertisements.publisher_size() == 1)
+  {
+    this->masterConn->EnqueueMsg(
+        msgs::Package("advertise", pending.advertisements.publisher(0)));
+  }
+  else if (pending.advertisements.publisher_size() > 1)
+  {
+    this->masterConn->EnqueueMsg(
+        msgs::Package("advertise_batch", pending.advertisements));
+  }
+
+  if (pending.subscriptions.subscriber_size() == 1)
+  {
+    this->masterConn->EnqueueMsg(
+        msgs::Package("subscribe", pending.subscriptions.subscriber(0)));
+  }
+  else if (pending.subscriptions.subscriber_size() > 1)
+  {
+    this->masterConn->EnqueueMsg(
+        msgs::Package("subscribe_batch", pending.subscriptions));
+  }
+
+  pending.advertisements.Clear();
+  pending.subscriptions.Clear();
 }
 
 //////////////////////////////////////////////////
@@ -532,6 +609,8 @@ void ConnectionManager::Unadvertise(const std::string &_topic)
 
   if (this->masterConn)
   {
+    // Make sure a pending advertisement reaches the master first.
+    this->FlushRegistrations();
     this->masterConn->EnqueueMsg(msgs::Package("unadvertise", msg), true);
   }
 }
@@ -570,6 +649,9 @@ void ConnectionManager::GetTopicNamespaces(std::list<std::string> &_namespaces)
 //////////////////////////////////////////////////
 void ConnectionManager::Unsubscribe(const msgs::Subscribe &_sub)
 {
+  // Make sure a pending subscription reaches the master first.
+  this->FlushRegistrations();
+
   // Inform the master that we want to unsubscribe from a topic.
   this->masterConn->EnqueueMsg(msgs::Package("unsubscribe", _sub), true);
 }
@@ -586,6 +668,9 @@ void ConnectionManager::Unsubscribe(const std::string &_topic,
     msg.set_host(this->serverConn->GetLocalAddress());
     msg.set_port(this->serverConn->GetLocalPort());
 
+    // Make sure a pending subscription reaches the master first.
+    this->FlushRegistrations();
+
     // Inform the master that we want to unsubscribe from a topic.
     this->masterConn->EnqueueMsg(msgs::Package("unsubscribe", msg), true);
   }
@@ -610,17 +695,22 @@ void ConnectionManager::Subscribe(const std::string &_topic,
   // to establish a connection.
   // if (!conn)
   {
-    msgs::Subscribe msg;
-    msg.set_topic(_topic);
-    msg.set_msg_type(_msgType);
-    msg.set_host(this->serverConn->GetLocalAddress());
-    msg.set_port(this->serverConn->GetLocalPort());
-    msg.set_latching(_latching);
+    // Inform the master that we want to subscribe to a topic. The request
+    // is sent in a batch on the next update, and will result in
+    // Connection::OnMasterRead getting called with a packet type of
+    // "publisher_subscribe"
+    {
+      PendingRegistrations &pending = pendingRegistrations();
+      boost::mutex::scoped_lock lock(pending.mutex);
+      msgs::Subscribe *msg = pending.subscriptions.add_subscriber();
+      msg->set_topic(_topic);
+      msg->set_msg_type(_msgType);
+      msg->set_host(this->serverConn->GetLocalAddress());
+      msg->set_port(this->serverConn->GetLocalPort());
+      msg->set_latching(_latching);
+    }
 
-    // Inform the master that we want to subscribe to a topic.
-    // This will result in Connection::OnMasterRead getting called with a
-    // packet type of "publisher_update"
-    this->masterConn->EnqueueMsg(msgs::Package("subscribe", msg));
+    this->TriggerUpdate();
   }
 }
 
@@ -164,6 +164,10 @@ namespace gazebo
       /// \brief Run the manager update loop once
       private: void RunUpdate();
 
+      /// \brief Send the queued advertise and subscribe requests to the
+      /// master as batched registration messages.
+      private: void FlushRegistrations();
+
       /// \brief Condition used to trigger an update.
       private: boost::condition_variable updateCondition;
 
@@ -0,0 +1,172 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GAZEBO_TRANSPORT_MESSAGEPOOL_HH_
+#define GAZEBO_TRANSPORT_MESSAGEPOOL_HH_
+
+#include <boost/shared_ptr.hpp>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace gazebo
+{
+  namespace transport
+  {
+    /// \addtogroup gazebo_transport
+    /// \{
+
+    /// \class MessagePool MessagePool.hh transport/transport.hh
+    /// \brief A pool of protobuf messages of one type, used to avoid
+    /// allocating a new message for each message published or received.
+    ///
+    /// Messages are handed out as shared pointers, and go back to the pool
+    /// once the last reference to them is dropped, so they can be given to
+    /// subscribers and publishers like any other message. Messages are
+    /// cleared when recycled, which keeps the memory of their strings and
+    /// repeated fields, so a recycled message is filled without allocating
+    /// when the content has a similar size.
+    template<typename M>
+    class MessagePool
+    {
+      /// \brief Default number of free messages kept by a pool.
+      public: static const size_t kDefaultCapacity = 8;
+
+      /// \brief Constructor.
+      /// \param[in] _capacity Maximum number of free messages kept. Bounds
+      /// the memory held by the pool, since recycled messages keep the
+      /// memory of their largest content.
+      public: explicit MessagePool(const size_t _capacity = kDefaultCapacity)
+              : state(std::make_shared<State>())
+              {
+                this->state->capacity = _capacity;
+              }
+
+      /// \brief Get a cleared message, recycled if possible.
+      /// \return The message.
+      public: boost::shared_ptr<M> Acquire()
+              {
+                M *msg = this->Pop();
+                if (!msg)
+                  msg = new M;
+                return boost::shared_ptr<M>(msg, Recycler(this->state));
+              }
+
+      /// \brief Get a cleared message, recycled if possible. Used by pools
+      /// of google::protobuf::Message, whose messages are created from a
+      /// prototype.
+      /// \param[in] _prototype Message of the type of the messages of the
+      /// pool.
+      /// \return The message.
+      public: boost::shared_ptr<M> Acquire(const M &_prototype)
+              {
+                M *msg = this->Pop();
+                if (!msg)
+                  msg = _prototype.New();
+                return boost::shared_ptr<M>(msg, Recycler(this->state));
+              }
+
+      /// \brief Get the number of free messages.
+      /// \return The number of messages waiting to be recycled.
+      public: size_t FreeCount() const
+              {
+                std::lock_guard<std::mutex> lock(this->state->mutex);
+                return this->state->free.size();
+              }
+
+      /// \brief Take a free message.
+      /// \return The message, or null if there are none.
+      private: M *Pop()
+               {
+                 std::lock_guard<std::mutex> lock(this->state->mutex);
+                 if (this->state->free.empty())
+                   return nullptr;
+
+                 M *msg = this->state->free.back();
+                 this->state->free.pop_back();
+                 return msg;
+               }
+
+      /// \brief Free messages, shared with the messages handed out so they
+      /// can be recycled or deleted after the pool is destroyed.
+      private: class State
+               {
+                 /// \brief Destructor. Deletes the free messages.
+                 public: ~State()
+                         {
+                           for (auto msg : this->free)
+                             delete msg;
+                         }
+
+                 /// \brief Protects free.
+                 public: std::mutex mutex;
+
+                 /// \brief Free messages.
+                 public: std::vector<M *> free;
+
+                 /// \brief Maximum number of free messages.
+                 public: size_t capacity = 0;
+               };
+
+      /// \brief Deleter of the messages handed out, which gives them back
+      /// to the pool.
+      private: class Recycler
+               {
+                 /// \brief Constructor.
+                 /// \param[in] _state State of the pool.
+                 public: explicit Recycler(const std::shared_ptr<State> &_state)
+                         : state(_state)
+                         {
+                         }
+
+                 /// \brief Recycle a message, or delete it if the pool is
+                 /// full or destroyed.
+                 /// \param[in] _msg The message.
+                 public: void operator()(M *_msg) const
+                         {
+                           std::shared_ptr<State> pool = this->state.lock();
+                           if (pool)
+                           {
+                             _msg->Clear();
+
+                             std::lock_guard<std::mutex> lock(pool->mutex);
+                             if (pool->free.size() < pool->capacity)
+                             {
+                               pool->free.push_back(_msg);
+                               return;
+                             }
+                           }
+                           delete _msg;
+                         }
+
+                 /// \brief State of the pool.
+                 private: std::weak_ptr<State> state;
+               };
+
+      /// \brief State of the pool.
+      private: std::shared_ptr<State> state;
+
+      // Messages refer to the state of the pool that created them
+      private: MessagePool(const MessagePool &) = delete;
+      private: MessagePool &operator=(const MessagePool &) = delete;
+    };
+
+    template<typename M>
+    const size_t MessagePool<M>::kDefaultCapacity;
+    /// \}
+  }
+}
+#endif
@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "gazebo/msgs/msgs.hh"
+#include "gazebo/transport/MessagePool.hh"
+#include "test/util.hh"
+
+using namespace gazebo;
+
+class MessagePoolTest : public gazebo::testing::AutoLogFixture { };
+
+/////////////////////////////////////////////////
+TEST_F(MessagePoolTest, Recycle)
+{
+  transport::MessagePool<msgs::PosesStamped> pool;
+  EXPECT_EQ(0u, pool.FreeCount());
+
+  boost::shared_ptr<msgs::PosesStamped> msg = pool.Acquire();
+  msgs::Set(msg->mutable_time(), common::Time(1, 0));
+  msg->add_pose()->set_name("box");
+  const msgs::PosesStamped *address = msg.get();
+
+  // Still referenced by a subscriber
+  boost::shared_ptr<msgs::PosesStamped const> copy = msg;
+  msg.reset();
+  EXPECT_EQ(0u, pool.FreeCount());
+  EXPECT_EQ("box", copy->pose(0).name());
+
+  copy.reset();
+  EXPECT_EQ(1u, pool.FreeCount());
+
+  // The same message comes back, cleared
+  msg = pool.Acquire();
+  EXPECT_EQ(address, msg.get());
+  EXPECT_EQ(0, msg->pose_size());
+  EXPECT_FALSE(msg->has_time());
+  EXPECT_EQ(0u, pool.FreeCount());
+}
+
+/////////////////////////////////////////////////
+TEST_F(MessagePoolTest, Capacity)
+{
+  transport::MessagePool<msgs::Contacts> pool(2);
+
+  std::vector<boost::shared_ptr<msgs::Contacts> > acquired;
+  for (int i = 0; i < 4; ++i)
+    acquired.push_back(pool.Acquire());
+
+  acquired.clear();
+  EXPECT_EQ(2u, pool.FreeCount());
+}
+
+/////////////////////////////////////////////////
+TEST_F(MessagePoolTest, Prototype)
+{
+  transport::MessagePool<google::protobuf::Message> pool;
+
+  msgs::GzString prototype;
+  prototype.set_data("prototype");
+
+  boost::shared_ptr<google::protobuf::Message> msg = pool.Acquire(prototype);
+  EXPECT_EQ(prototype.GetTypeName(), msg->GetTypeName());
+  msg->CopyFrom(prototype);
+  EXPECT_EQ("prototype",
+      boost::dynamic_pointer_cast<msgs::GzString>(msg)->data());
+
+  msg.reset();
+  EXPECT_EQ(1u, pool.FreeCount());
+
+  msg = pool.Acquire(prototype);
+  EXPECT_FALSE(boost::dynamic_pointer_cast<msgs::GzString>(msg)->has_data());
+}
+
+/////////////////////////////////////////////////
+TEST_F(MessagePoolTest, OutlivePool)
+{
+  boost::shared_ptr<msgs::IMU> msg;
+  {
+    transport::MessagePool<msgs::IMU> pool;
+    msg = pool.Acquire();
+    msg->set_entity_name("imu");
+  }
+
+  // Deleted instead of recycled
+  EXPECT_EQ("imu", msg->entity_name());
+  msg.reset();
+}
+
+/////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
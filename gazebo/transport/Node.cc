@@ -16,7 +16,15 @@
 */
 #include <boost/algorithm/string.hpp>
 #include <boost/bind.hpp>
+
+#include <list>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+
 #include "gazebo/transport/TransportIface.hh"
+#include "gazebo/transport/Trace.hh"
 #include "gazebo/transport/Node.hh"
 
 using namespace gazebo;
@@ -24,6 +32,57 @@ using namespace transport;
 
 unsigned int Node::idCounter = 0;
 
+/// \brief Trace stamps of the traced incoming messages of a node, per
+/// topic, with the index of each message in the list of its topic.
+typedef std::map<std::string, std::list<std::pair<size_t, TraceStamps> > >
+  NodeTraces;
+
+// Added here to avoid breaking the ABI
+// TODO move to Node when merging forward.
+/// \brief Trace stamps of the incoming messages of the nodes. The first
+/// element is for incomingMsgs, the second for incomingMsgsLocal.
+static std::map<const Node *, std::pair<NodeTraces, NodeTraces> > nodeTraces;
+
+/// \brief Protects nodeTraces.
+static std::mutex nodeTracesMutex;
+
+/////////////////////////////////////////////////
+/// \brief Take the trace stamps of the incoming messages of a node.
+/// \param[in] _node The node.
+/// \param[in] _local True for the messages of incomingMsgsLocal.
+/// \return The trace stamps.
+static NodeTraces takeTraces(const Node *_node, const bool _local)
+{
+  std::lock_guard<std::mutex> lock(nodeTracesMutex);
+  NodeTraces result;
+
+  auto iter = nodeTraces.find(_node);
+  if (iter == nodeTraces.end())
+    return result;
+
+  result.swap(_local ? iter->second.second : iter->second.first);
+  if (iter->second.first.empty() && iter->second.second.empty())
+    nodeTraces.erase(iter);
+  return result;
+}
+
+/////////////////////////////////////////////////
+/// \brief Add the trace stamps of an incoming message of a node.
+/// \param[in] _node The node.
+/// \param[in] _local True for a message of incomingMsgsLocal.
+/// \param[in] _topic Topic of the message.
+/// \param[in] _index Index of the message in the list of its topic.
+/// \param[in] _stamps Trace stamps of the message.
+static void addTrace(const Node *_node, const bool _local,
+    const std::string &_topic, const size_t _index,
+    const TraceStamps &_stamps)
+{
+  std::lock_guard<std::mutex> lock(nodeTracesMutex);
+  auto &traces = nodeTraces[_node];
+  (_local ? traces.second : traces.first)[_topic].push_back(
+      std::make_pair(_index, _stamps));
+}
+
 extern void dummy_callback_fn(uint32_t);
 
 /////////////////////////////////////////////////
@@ -38,6 +97,9 @@ Node::Node()
 Node::~Node()
 {
   this->Fini();
+
+  std::lock_guard<std::mutex> lock(nodeTracesMutex);
+  nodeTraces.erase(this);
 }
 
 /////////////////////////////////////////////////
@@ -195,7 +257,14 @@ void Node::ProcessPublishers()
 bool Node::HandleData(const std::string &_topic, const std::string &_msg)
 {
   boost::recursive_mutex::scoped_lock lock(this->incomingMutex);
-  this->incomingMsgs[_topic].push_back(_msg);
+  std::list<std::string> &msgs = this->incomingMsgs[_topic];
+
+  // Stamps of the message read by the current connection task
+  const TraceStamps *trace = currentTrace();
+  if (trace && tracingEnabled())
+    addTrace(this, false, _topic, msgs.size(), *trace);
+
+  msgs.push_back(_msg);
   ConnectionManager::Instance()->TriggerUpdate();
   return true;
 }
@@ -204,7 +273,18 @@ bool Node::HandleData(const std::string &_topic, const std::string &_msg)
 bool Node::HandleMessage(const std::string &_topic, MessagePtr _msg)
 {
   boost::recursive_mutex::scoped_lock lock(this->incomingMutex);
-  this->incomingMsgsLocal[_topic].push_back(_msg);
+  std::list<MessagePtr> &msgs = this->incomingMsgsLocal[_topic];
+
+  // Stamps set by the Publisher of this process that sends the message
+  const TraceStamps *trace = currentTrace();
+  if (trace && tracingEnabled())
+  {
+    TraceStamps stamps = *trace;
+    stamps.enqueue = traceClock();
+    addTrace(this, true, _topic, msgs.size(), stamps);
+  }
+
+  msgs.push_back(_msg);
   ConnectionManager::Instance()->TriggerUpdate();
   return true;
 }
@@ -228,6 +308,7 @@ void Node::ProcessIncoming()
     std::map<std::string, std::list<std::string> >::iterator endIter;
 
     boost::recursive_mutex::scoped_lock lock2(this->incomingMutex);
+    NodeTraces incomingTraces = takeTraces(this, false);
     inIter = this->incomingMsgs.begin();
     endIter = this->incomingMsgs.end();
 
@@ -243,9 +324,19 @@ void Node::ProcessIncoming()
         msgInIter = inIter->second.begin();
         msgEndIter = inIter->second.end();
 
+        std::list<std::pair<size_t, TraceStamps> > &traces =
+          incomingTraces[inIter->first];
+
         // For each message in the buffer
-        for (msgIter = msgInIter; msgIter != msgEndIter; ++msgIter)
+        size_t index = 0;
+        for (msgIter = msgInIter; msgIter != msgEndIter; ++msgIter, ++index)
         {
+          if (!traces.empty() && traces.front().first == index)
+          {
+            recordTrace(inIter->first, traces.front().second);
+            traces.pop_front();
+          }
+
           // Send the message to all callbacks
           for (liter = cbIter->second.begin();
               liter != cbIter->second.end(); ++liter)
@@ -266,6 +357,7 @@ void Node::ProcessIncoming()
     std::map<std::string, std::list<MessagePtr> >::iterator endIter;
 
     boost::recursive_mutex::scoped_lock lock2(this->incomingMutex);
+    NodeTraces incomingTraces = takeTraces(this, true);
     inIter = this->incomingMsgsLocal.begin();
     endIter = this->incomingMsgsLocal.end();
 
@@ -281,9 +373,19 @@ void Node::ProcessIncoming()
         msgInIter = inIter->second.begin();
         msgEndIter = inIter->second.end();
 
+        std::list<std::pair<size_t, TraceStamps> > &traces =
+          incomingTraces[inIter->first];
+
         // For each message in the buffer
-        for (msgIter = msgInIter; msgIter != msgEndIter; ++msgIter)
+        size_t index = 0;
+        for (msgIter = msgInIter; msgIter != msgEndIter; ++msgIter, ++index)
         {
+          if (!traces.empty() && traces.front().first == index)
+          {
+            recordTrace(inIter->first, traces.front().second);
+            traces.pop_front();
+          }
+
           // Send the message to all callbacks
           for (liter = cbIter->second.begin();
               liter != cbIter->second.end(); ++liter)
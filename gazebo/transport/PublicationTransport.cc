@@ -19,6 +19,7 @@
 #include "gazebo/transport/TopicManager.hh"
 #include "gazebo/transport/ConnectionManager.hh"
 #include "gazebo/transport/PublicationTransport.hh"
+#include "gazebo/transport/Trace.hh"
 #include "gazebo/common/WeakBind.hh"
 
 using namespace gazebo;
@@ -64,6 +65,7 @@ void PublicationTransport::Init(const ConnectionPtr &_conn, bool _latched)
   sub.set_host(this->connection->GetLocalAddress());
   sub.set_port(this->connection->GetLocalPort());
   sub.set_latching(_latched);
+  sub.set_trace(tracingEnabled());
 
   this->connection->EnqueueMsg(msgs::Package("sub", sub));
 
@@ -19,12 +19,21 @@
  */
 #include <boost/bind.hpp>
 
+#include <atomic>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+
 #include <ignition/math/Helpers.hh>
 
 #include "gazebo/common/Exception.hh"
 #include "gazebo/common/WeakBind.hh"
+#include "gazebo/transport/MessagePool.hh"
 #include "gazebo/transport/Node.hh"
 #include "gazebo/transport/TopicManager.hh"
+#include "gazebo/transport/Trace.hh"
 #include "gazebo/transport/Publisher.hh"
 
 using namespace gazebo;
@@ -32,12 +41,69 @@ using namespace transport;
 
 uint32_t Publisher::idCounter = 0;
 
+namespace gazebo
+{
+  namespace transport
+  {
+    // Added here to avoid breaking the ABI
+    // TODO move to Publisher when merging forward
+    /// \brief Publisher state added after the class layout was fixed.
+    class PublisherState
+    {
+      /// \brief Descriptor of the last message whose type was checked, to
+      /// avoid comparing the type names of each message.
+      public: std::atomic<const google::protobuf::Descriptor *> descriptor{
+                nullptr};
+
+      /// \brief False to skip the check for missing required fields.
+      public: std::atomic<bool> validate{true};
+
+      /// \brief Time the queued messages were published in nanoseconds, or
+      /// zero if they are not traced, in the order of Publisher::messages.
+      /// Protected by the mutex of the publisher.
+      public: std::list<int64_t> stamps;
+
+      /// \brief Copies of the messages published by reference, recycled
+      /// once they are sent and replaced as the latest message.
+      public: MessagePool<google::protobuf::Message> pool;
+    };
+  }
+}
+
+/// \brief State of each publisher.
+static std::map<const Publisher *, std::shared_ptr<PublisherState> >
+  publisherStates;
+
+/// \brief Mutex to protect publisherStates. Lookups only take a shared
+/// lock, so publishers on different threads don't wait for each other.
+static std::shared_timed_mutex publisherStatesMutex;
+
+/// \brief Get the state of a publisher. Called once per publish, the state
+/// is then passed down to the functions that need it.
+/// \param[in] _publisher The publisher.
+/// \return Its state, null once it is destroyed.
+static std::shared_ptr<PublisherState> publisherState(
+    const Publisher *_publisher)
+{
+  std::shared_lock<std::shared_timed_mutex> lock(publisherStatesMutex);
+  auto iter = publisherStates.find(_publisher);
+  if (iter == publisherStates.end())
+    return nullptr;
+  return iter->second;
+}
+
 //////////////////////////////////////////////////
 Publisher::Publisher(const std::string &_topic, const std::string &_msgType,
                      unsigned int _limit, double _hzRate)
   : topic(_topic), msgType(_msgType), queueLimit(_limit),
     updatePeriod(0)
 {
+  {
+    std::lock_guard<std::shared_timed_mutex> lock(publisherStatesMutex);
+    publisherStates[this].reset(new PublisherState);
+  }
+
+
   if (!ignition::math::equal(_hzRate, 0.0))
     this->updatePeriod = 1.0 / _hzRate;
 
@@ -50,6 +116,9 @@ Publisher::Publisher(const std::string &_topic, const std::string &_msgType,
 Publisher::~Publisher()
 {
   this->Fini();
+
+  std::lock_guard<std::shared_timed_mutex> lock(publisherStatesMutex);
+  publisherStates.erase(this);
 }
 
 //////////////////////////////////////////////////
@@ -84,18 +153,38 @@ bool Publisher::WaitForConnection(const common::Time &_timeout) const
 }
 
 //////////////////////////////////////////////////
-void Publisher::PublishImpl(const google::protobuf::Message &_message,
-                            bool _block)
+void Publisher::SetValidation(const bool _enable)
 {
-  if (_message.GetTypeName() != this->msgType)
-    gzthrow("Invalid message type\n");
+  auto state = publisherState(this);
+  if (state)
+    state->validate = _enable;
+}
 
-  if (!_message.IsInitialized())
+//////////////////////////////////////////////////
+bool Publisher::Accept(const google::protobuf::Message &_message,
+    PublisherState *_state)
+{
+  // Type names are only compared for new descriptors
+  if (!_state || _message.GetDescriptor() != _state->descriptor)
+  {
+    if (_message.GetTypeName() != this->msgType)
+      gzthrow("Invalid message type\n");
+    if (_state)
+      _state->descriptor = _message.GetDescriptor();
+  }
+
+#ifdef NDEBUG
+  const bool checkInitialized = !_state || _state->validate;
+#else
+  const bool checkInitialized = true;
+#endif
+
+  if (checkInitialized && !_message.IsInitialized())
   {
     gzerr << "Publishing an uninitialized message on topic[" <<
       this->topic << "]. Required field [" <<
       _message.InitializationErrorString() << "] missing.\n";
-    return;
+    return false;
   }
 
   // Check if a throttling rate has been set
@@ -109,27 +198,69 @@ void Publisher::PublishImpl(const google::protobuf::Message &_message,
         (this->currentTime - this->prevPublishTime).Double() <
         this->updatePeriod)
     {
-      return;
+      return false;
     }
 
     // Set the previous time a message was published
     this->prevPublishTime = this->currentTime;
   }
 
+  return true;
+}
+
+//////////////////////////////////////////////////
+void Publisher::PublishImpl(const google::protobuf::Message &_message,
+                            bool _block)
+{
+  auto state = publisherState(this);
+  if (!this->Accept(_message, state.get()))
+    return;
+
   // Save the latest message
-  MessagePtr msgPtr(_message.New());
+  MessagePtr msgPtr;
+  if (state)
+    msgPtr = state->pool.Acquire(_message);
+  else
+    msgPtr.reset(_message.New());
   msgPtr->CopyFrom(_message);
 
-  this->publication->SetPrevMsg(this->id, msgPtr);
+  this->Enqueue(msgPtr, _block, state.get());
+}
+
+//////////////////////////////////////////////////
+void Publisher::PublishImpl(MessagePtr _message, bool _block)
+{
+  if (!_message)
+  {
+    gzerr << "Publishing a null message on topic[" << this->topic << "]\n";
+    return;
+  }
+
+  auto state = publisherState(this);
+  if (this->Accept(*_message, state.get()))
+    this->Enqueue(_message, _block, state.get());
+}
+
+//////////////////////////////////////////////////
+void Publisher::Enqueue(MessagePtr _message, bool _block,
+    PublisherState *_state)
+{
+  this->publication->SetPrevMsg(this->id, _message);
+
+  const int64_t stamp = traceRequested() ? traceClock() : 0;
 
   {
     boost::mutex::scoped_lock lock(this->mutex);
 
-    this->messages.push_back(msgPtr);
+    this->messages.push_back(_message);
+    if (_state)
+      _state->stamps.push_back(stamp);
 
     if (this->messages.size() > this->queueLimit)
     {
       this->messages.pop_front();
+      if (_state && !_state->stamps.empty())
+        _state->stamps.pop_front();
 
       if (!queueLimitWarned)
       {
@@ -146,7 +277,7 @@ void Publisher::PublishImpl(const google::protobuf::Message &_message,
 
   if (_block)
   {
-    this->SendMessage();
+    this->SendMessage(_state);
   }
   else
   {
@@ -157,8 +288,16 @@ void Publisher::PublishImpl(const google::protobuf::Message &_message,
 
 //////////////////////////////////////////////////
 void Publisher::SendMessage()
+{
+  auto state = publisherState(this);
+  this->SendMessage(state.get());
+}
+
+//////////////////////////////////////////////////
+void Publisher::SendMessage(PublisherState *_state)
 {
   std::list<MessagePtr> localBuffer;
+  std::list<int64_t> localStamps;
   std::list<uint32_t> localIds;
 
   {
@@ -178,12 +317,16 @@ void Publisher::SendMessage()
     std::copy(this->messages.begin(), this->messages.end(),
         std::back_inserter(localBuffer));
     this->messages.clear();
+
+    if (_state)
+      localStamps.swap(_state->stamps);
   }
 
   // Only send messages if there is something to send
   if (!localBuffer.empty())
   {
     std::list<uint32_t>::iterator pubIter = localIds.begin();
+    std::list<int64_t>::iterator stampIter = localStamps.begin();
 
     // Send all the current messages
     for (std::list<MessagePtr>::iterator iter = localBuffer.begin();
@@ -212,10 +355,21 @@ void Publisher::SendMessage()
       // calling of OnPublishComplete() happens asynchronously though
       // (the subscriber callback SubscriptionTransport::HandleData() only
       // enqueues the message!).
+      // The stamp of traced messages is picked up by the connections and
+      // nodes the message is handed to.
+      TraceStamps trace;
+      if (stampIter != localStamps.end())
+        trace.publish = *stampIter++;
+      if (trace.publish)
+        setCurrentTrace(&trace);
+
       int result = this->publication->Publish(*iter,
           common::weakBind(&Publisher::OnPublishComplete,
               this->shared_from_this(), _1), *pubIter);
 
+      if (trace.publish)
+        setCurrentTrace(nullptr);
+
       // It is possible that OnPublishComplete() was called less times than
       // initially expected, which happens when a callback of the
       // transport::Publication was found invalid and deleted. In this case
@@ -320,6 +474,10 @@ void Publisher::Fini()
     this->SendMessage();
   this->messages.clear();
 
+  auto state = publisherState(this);
+  if (state)
+    state->stamps.clear();
+
   if (!this->topic.empty())
     TopicManager::Instance()->Unadvertise(this->topic, this->id);
 
@@ -27,6 +27,7 @@
 #include <string>
 #include <list>
 #include <map>
+#include <memory>
 
 #include "gazebo/common/Time.hh"
 #include "gazebo/transport/TransportTypes.hh"
@@ -36,6 +37,9 @@ namespace gazebo
 {
   namespace transport
   {
+    // Forward declare private data class.
+    class PublisherState;
+
     /// \addtogroup gazebo_transport
     /// \{
 
@@ -101,6 +105,34 @@ namespace gazebo
               void Publish(M _message, bool _block = false)
               { this->PublishImpl(_message, _block); }
 
+      /// \brief Publish a shared message on the topic without copying it.
+      /// The publisher keeps a reference to the message, which is handed
+      /// to local subscribers and kept as the latest message, so it must
+      /// not be modified afterwards.
+      /// \param[in] _message Message to be published
+      /// \param[in] _block Whether to block until the message is actually
+      /// written into the local message buffer, and SendMessage() is called.
+      public: template< typename M>
+              void Publish(const boost::shared_ptr<M> &_message,
+                           bool _block = false)
+              { this->PublishImpl(MessagePtr(_message), _block); }
+
+      /// \brief Publish a message on the topic without copying it, giving
+      /// its ownership to the publisher.
+      /// \param[in] _message Message to be published
+      /// \param[in] _block Whether to block until the message is actually
+      /// written into the local message buffer, and SendMessage() is called.
+      public: template< typename M>
+              void Publish(std::unique_ptr<M> _message, bool _block = false)
+              { this->PublishImpl(MessagePtr(_message.release()), _block); }
+
+      /// \brief Enable or disable the check for missing required fields
+      /// of the published messages, a traversal of the whole message. The
+      /// check can only be disabled in release builds, and is enabled by
+      /// default. The type of the messages is always checked.
+      /// \param[in] _enable False to skip the check.
+      public: void SetValidation(const bool _enable);
+
       /// \brief Get the number of outgoing messages
       /// \return The number of outgoing messages
       public: unsigned int GetOutgoingCount() const;
@@ -147,6 +179,33 @@ namespace gazebo
       private: void PublishImpl(const google::protobuf::Message &_message,
                                 bool _block);
 
+      /// \brief Implementation of Publish, for messages that aren't copied.
+      /// \param[in] _message Message to be published.
+      /// \param[in] _block Whether to block until the message is actually
+      /// written out.
+      private: void PublishImpl(MessagePtr _message, bool _block);
+
+      /// \brief Check the type and the required fields of a message, and
+      /// the throttling rate.
+      /// \param[in] _message Message to be published.
+      /// \param[in] _state State of this publisher, looked up once per
+      /// publish. Null once the publisher is destroyed.
+      /// \return True if the message should be published.
+      private: bool Accept(const google::protobuf::Message &_message,
+                           PublisherState *_state);
+
+      /// \brief Queue a message and trigger its sending.
+      /// \param[in] _message Message to be published.
+      /// \param[in] _block Whether to block until the message is actually
+      /// written out.
+      /// \param[in] _state State of this publisher, may be null.
+      private: void Enqueue(MessagePtr _message, bool _block,
+                            PublisherState *_state);
+
+      /// \brief Implementation of SendMessage.
+      /// \param[in] _state State of this publisher, may be null.
+      private: void SendMessage(PublisherState *_state);
+
       /// \brief Callback when a publish is completed
       /// \param[in] _id ID associated with the publication.
       private: void OnPublishComplete(uint32_t _id);
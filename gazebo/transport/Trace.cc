@@ -0,0 +1,224 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <mutex>
+
+#include "gazebo/transport/Trace.hh"
+
+using namespace gazebo;
+using namespace transport;
+
+namespace
+{
+  /// \brief True if tracing is enabled in this process.
+  std::atomic<bool> g_tracingEnabled(false);
+
+  /// \brief Number of reasons to stamp messages.
+  std::atomic<int> g_traceRequests(0);
+
+  /// \brief Stamps of the message handled by the current thread.
+  thread_local const TraceStamps *g_currentTrace = nullptr;
+
+  /// \brief Protects g_topicLatencies.
+  std::mutex g_latencyMutex;
+
+  /// \brief Latencies of the traced topics.
+  std::map<std::string, TopicLatency> g_topicLatencies;
+}
+
+const size_t TraceStamps::kFrameSize;
+const unsigned int LatencyHistogram::kBucketCount;
+
+/////////////////////////////////////////////////
+void LatencyHistogram::Add(const int64_t _ns)
+{
+  const int64_t ns = std::max<int64_t>(_ns, 0);
+
+  unsigned int bucket = 0;
+  for (int64_t us = ns / 1000; us > 0 && bucket < kBucketCount - 1; us >>= 1)
+    ++bucket;
+
+  ++this->buckets[bucket];
+  ++this->count;
+  this->sum += ns;
+  this->max = std::max(this->max, ns);
+}
+
+/////////////////////////////////////////////////
+uint64_t LatencyHistogram::Count() const
+{
+  return this->count;
+}
+
+/////////////////////////////////////////////////
+double LatencyHistogram::Mean() const
+{
+  return this->count > 0 ? this->sum / this->count * 1e-3 : 0.0;
+}
+
+/////////////////////////////////////////////////
+double LatencyHistogram::Max() const
+{
+  return this->max * 1e-3;
+}
+
+/////////////////////////////////////////////////
+double LatencyHistogram::Percentile(const double _percent) const
+{
+  if (this->count == 0)
+    return 0.0;
+
+  const double rank = std::ceil(
+      std::min(std::max(_percent, 0.0), 100.0) / 100.0 * this->count);
+
+  uint64_t total = 0;
+  for (unsigned int i = 0; i < kBucketCount; ++i)
+  {
+    total += this->buckets[i];
+    if (total > 0 && total >= rank)
+      return std::min(std::ldexp(1.0, i), this->Max());
+  }
+
+  return this->Max();
+}
+
+/////////////////////////////////////////////////
+uint64_t LatencyHistogram::BucketCount(const unsigned int _bucket) const
+{
+  return _bucket < kBucketCount ? this->buckets[_bucket] : 0;
+}
+
+/////////////////////////////////////////////////
+void TopicLatency::Add(const TraceStamps &_stamps, const int64_t _dispatch)
+{
+  if (_stamps.publish && _stamps.enqueue)
+  {
+    this->stages[LATENCY_PUBLISHER_QUEUE].Add(
+        _stamps.enqueue - _stamps.publish);
+  }
+
+  if (_stamps.enqueue && _stamps.write)
+    this->stages[LATENCY_WRITE_QUEUE].Add(_stamps.write - _stamps.enqueue);
+
+  if (_stamps.write && _stamps.read)
+    this->stages[LATENCY_NETWORK].Add(_stamps.read - _stamps.write);
+
+  const int64_t received = _stamps.read ? _stamps.read : _stamps.enqueue;
+  if (received)
+    this->stages[LATENCY_INCOMING_QUEUE].Add(_dispatch - received);
+
+  if (_stamps.publish)
+    this->stages[LATENCY_END_TO_END].Add(_dispatch - _stamps.publish);
+}
+
+/////////////////////////////////////////////////
+const LatencyHistogram &TopicLatency::Stage(const LatencyStage _stage) const
+{
+  return this->stages[_stage];
+}
+
+/////////////////////////////////////////////////
+std::string transport::latencyStageName(const LatencyStage _stage)
+{
+  switch (_stage)
+  {
+    case LATENCY_PUBLISHER_QUEUE:
+      return "publisher queue";
+    case LATENCY_WRITE_QUEUE:
+      return "write queue";
+    case LATENCY_NETWORK:
+      return "network";
+    case LATENCY_INCOMING_QUEUE:
+      return "incoming queue";
+    case LATENCY_END_TO_END:
+      return "end to end";
+    default:
+      return "";
+  }
+}
+
+/////////////////////////////////////////////////
+void transport::enableTracing(const bool _enable)
+{
+  if (g_tracingEnabled.exchange(_enable) != _enable)
+    requestTrace(_enable);
+}
+
+/////////////////////////////////////////////////
+bool transport::tracingEnabled()
+{
+  return g_tracingEnabled;
+}
+
+/////////////////////////////////////////////////
+std::map<std::string, TopicLatency> transport::topicLatencies()
+{
+  std::lock_guard<std::mutex> lock(g_latencyMutex);
+  return g_topicLatencies;
+}
+
+/////////////////////////////////////////////////
+void transport::clearTopicLatencies()
+{
+  std::lock_guard<std::mutex> lock(g_latencyMutex);
+  g_topicLatencies.clear();
+}
+
+/////////////////////////////////////////////////
+int64_t transport::traceClock()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+/////////////////////////////////////////////////
+bool transport::traceRequested()
+{
+  return g_traceRequests.load(std::memory_order_relaxed) > 0;
+}
+
+/////////////////////////////////////////////////
+void transport::requestTrace(const bool _add)
+{
+  g_traceRequests += _add ? 1 : -1;
+}
+
+/////////////////////////////////////////////////
+void transport::setCurrentTrace(const TraceStamps *_stamps)
+{
+  g_currentTrace = _stamps;
+}
+
+/////////////////////////////////////////////////
+const TraceStamps *transport::currentTrace()
+{
+  return g_currentTrace;
+}
+
+/////////////////////////////////////////////////
+void transport::recordTrace(const std::string &_topic,
+    const TraceStamps &_stamps)
+{
+  const int64_t dispatch = traceClock();
+
+  std::lock_guard<std::mutex> lock(g_latencyMutex);
+  g_topicLatencies[_topic].Add(_stamps, dispatch);
+}
@@ -0,0 +1,225 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GAZEBO_TRANSPORT_TRACE_HH_
+#define GAZEBO_TRANSPORT_TRACE_HH_
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <string>
+
+#include "gazebo/util/system.hh"
+
+namespace gazebo
+{
+  namespace transport
+  {
+    /// \addtogroup gazebo_transport
+    /// \{
+
+    /// \brief Flag set in the size of the frames that carry trace stamps.
+    static const uint32_t kTraceFrameFlag = 0x80000000u;
+
+    /// \brief Wall clock times, in nanoseconds, at which a message went
+    /// through the stages of the transport. Zero for the stages that were
+    /// not traced.
+    ///
+    /// Traced frames carry the publish, enqueue and write stamps, in this
+    /// order, before the serialized message. The read and dispatch stamps
+    /// are taken by the receiving process, so the network latency is only
+    /// meaningful when the clocks of both hosts are synchronized.
+    class GZ_TRANSPORT_VISIBLE TraceStamps
+    {
+      /// \brief Size of the stamps carried by traced frames.
+      public: static const size_t kFrameSize = 3 * sizeof(int64_t);
+
+      /// \brief Time the message was queued by Publisher::Publish.
+      public: int64_t publish = 0;
+
+      /// \brief Time the message was queued on a connection, or handed to
+      /// a node of the same process.
+      public: int64_t enqueue = 0;
+
+      /// \brief Time the write of the message to the socket started.
+      public: int64_t write = 0;
+
+      /// \brief Time the message was read from the socket.
+      public: int64_t read = 0;
+    };
+
+    /// \brief Stages whose latency is measured.
+    enum LatencyStage
+    {
+      /// \brief From the publish to the enqueue stamp, time spent in the
+      /// queue of the Publisher.
+      LATENCY_PUBLISHER_QUEUE = 0,
+
+      /// \brief From the enqueue to the write stamp, time spent in the
+      /// write queue of the Connection.
+      LATENCY_WRITE_QUEUE,
+
+      /// \brief From the write to the read stamp.
+      LATENCY_NETWORK,
+
+      /// \brief From the read stamp, or the enqueue stamp of messages
+      /// published in the same process, to the dispatch to the callbacks
+      /// by Node::ProcessIncoming.
+      LATENCY_INCOMING_QUEUE,
+
+      /// \brief From the publish stamp to the dispatch.
+      LATENCY_END_TO_END,
+
+      /// \brief Number of stages.
+      LATENCY_STAGE_COUNT
+    };
+
+    /// \brief Histogram of latencies, with power of two buckets.
+    class GZ_TRANSPORT_VISIBLE LatencyHistogram
+    {
+      /// \brief Number of buckets. Bucket 0 holds the latencies below 1
+      /// microsecond, and bucket i those in [2^(i-1), 2^i) microseconds.
+      public: static const unsigned int kBucketCount = 32;
+
+      /// \brief Add a latency. Negative latencies, caused by clocks that
+      /// are not synchronized, are counted as zero.
+      /// \param[in] _ns Latency in nanoseconds.
+      public: void Add(const int64_t _ns);
+
+      /// \brief Get the number of latencies.
+      /// \return The number of latencies.
+      public: uint64_t Count() const;
+
+      /// \brief Get the mean latency.
+      /// \return The mean latency in microseconds.
+      public: double Mean() const;
+
+      /// \brief Get the maximum latency.
+      /// \return The maximum latency in microseconds.
+      public: double Max() const;
+
+      /// \brief Get an upper bound of a percentile of the latencies.
+      /// \param[in] _percent Percentile, between 0 and 100.
+      /// \return Upper bound of the bucket of the percentile, in
+      /// microseconds.
+      public: double Percentile(const double _percent) const;
+
+      /// \brief Get the number of latencies in a bucket.
+      /// \param[in] _bucket Index of the bucket.
+      /// \return The number of latencies.
+      public: uint64_t BucketCount(const unsigned int _bucket) const;
+
+      /// \brief Number of latencies in each bucket.
+      private: std::array<uint64_t, kBucketCount> buckets{};
+
+      /// \brief Number of latencies.
+      private: uint64_t count = 0;
+
+      /// \brief Sum of the latencies, in nanoseconds.
+      private: double sum = 0;
+
+      /// \brief Maximum latency, in nanoseconds.
+      private: int64_t max = 0;
+    };
+
+    /// \brief Latencies of the stages of the messages of a topic.
+    class GZ_TRANSPORT_VISIBLE TopicLatency
+    {
+      /// \brief Add the latencies of a message.
+      /// \param[in] _stamps Trace stamps of the message.
+      /// \param[in] _dispatch Time the message was dispatched, in
+      /// nanoseconds.
+      public: void Add(const TraceStamps &_stamps, const int64_t _dispatch);
+
+      /// \brief Get the histogram of a stage.
+      /// \param[in] _stage The stage.
+      /// \return The histogram.
+      public: const LatencyHistogram &Stage(const LatencyStage _stage) const;
+
+      /// \brief Histogram of each stage.
+      private: std::array<LatencyHistogram, LATENCY_STAGE_COUNT> stages;
+    };
+
+    /// \brief Get the name of a stage.
+    /// \param[in] _stage The stage.
+    /// \return The name.
+    GZ_TRANSPORT_VISIBLE
+    std::string latencyStageName(const LatencyStage _stage);
+
+    /// \brief Enable the tracing of the messages received by this process.
+    /// Subscriptions made while tracing is enabled ask publishers of other
+    /// processes to send trace stamps, and the latencies of the messages
+    /// dispatched to the nodes of this process are aggregated per topic.
+    /// \param[in] _enable True to enable tracing.
+    GZ_TRANSPORT_VISIBLE
+    void enableTracing(const bool _enable);
+
+    /// \brief Get whether tracing is enabled in this process.
+    /// \return True if enabled.
+    GZ_TRANSPORT_VISIBLE
+    bool tracingEnabled();
+
+    /// \brief Get the latencies aggregated since the last call to
+    /// clearTopicLatencies.
+    /// \return Latencies of each traced topic.
+    GZ_TRANSPORT_VISIBLE
+    std::map<std::string, TopicLatency> topicLatencies();
+
+    /// \brief Clear the aggregated latencies.
+    GZ_TRANSPORT_VISIBLE
+    void clearTopicLatencies();
+
+    /// \cond
+    /// \brief Get the wall clock time used by trace stamps.
+    /// \return Nanoseconds since the epoch.
+    GZ_TRANSPORT_VISIBLE
+    int64_t traceClock();
+
+    /// \brief Get whether publishers should stamp their messages, because
+    /// tracing is enabled in this process or requested by a subscriber.
+    /// \return True if messages should be stamped.
+    GZ_TRANSPORT_VISIBLE
+    bool traceRequested();
+
+    /// \brief Count a reason to stamp messages, such as a traced
+    /// connection.
+    /// \param[in] _add True to add a reason, false to remove one.
+    GZ_TRANSPORT_VISIBLE
+    void requestTrace(const bool _add);
+
+    /// \brief Set the stamps of the message being handled by the current
+    /// thread.
+    /// \param[in] _stamps The stamps, or null once the message is handled.
+    GZ_TRANSPORT_VISIBLE
+    void setCurrentTrace(const TraceStamps *_stamps);
+
+    /// \brief Get the stamps of the message being handled by the current
+    /// thread.
+    /// \return The stamps, or null if the message is not traced.
+    GZ_TRANSPORT_VISIBLE
+    const TraceStamps *currentTrace();
+
+    /// \brief Add the latencies of a dispatched message.
+    /// \param[in] _topic Topic of the message.
+    /// \param[in] _stamps Trace stamps of the message.
+    GZ_TRANSPORT_VISIBLE
+    void recordTrace(const std::string &_topic, const TraceStamps &_stamps);
+    /// \endcond
+
+    /// \}
+  }
+}
+#endif
@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include "gazebo/transport/Trace.hh"
+#include "test/util.hh"
+
+using namespace gazebo;
+using namespace transport;
+
+class TraceTest : public gazebo::testing::AutoLogFixture { };
+
+/////////////////////////////////////////////////
+TEST_F(TraceTest, Histogram)
+{
+  LatencyHistogram histogram;
+  EXPECT_EQ(0u, histogram.Count());
+  EXPECT_DOUBLE_EQ(0.0, histogram.Mean());
+  EXPECT_DOUBLE_EQ(0.0, histogram.Percentile(50));
+
+  // 0.5 us, 3 us, 3 us, 100 us and a negative latency
+  histogram.Add(500);
+  histogram.Add(3000);
+  histogram.Add(3000);
+  histogram.Add(100000);
+  histogram.Add(-2000);
+
+  EXPECT_EQ(5u, histogram.Count());
+  EXPECT_DOUBLE_EQ(21.3, histogram.Mean());
+  EXPECT_DOUBLE_EQ(100.0, histogram.Max());
+
+  EXPECT_EQ(2u, histogram.BucketCount(0));
+  EXPECT_EQ(2u, histogram.BucketCount(2));
+  EXPECT_EQ(1u, histogram.BucketCount(7));
+  EXPECT_EQ(0u, histogram.BucketCount(LatencyHistogram::kBucketCount));
+
+  EXPECT_DOUBLE_EQ(1.0, histogram.Percentile(0));
+  EXPECT_DOUBLE_EQ(4.0, histogram.Percentile(50));
+  EXPECT_DOUBLE_EQ(4.0, histogram.Percentile(80));
+  EXPECT_DOUBLE_EQ(100.0, histogram.Percentile(99));
+}
+
+/////////////////////////////////////////////////
+TEST_F(TraceTest, TopicLatency)
+{
+  // Message sent to another process
+  TraceStamps remote;
+  remote.publish = 1000000;
+  remote.enqueue = 1010000;
+  remote.write = 1030000;
+  remote.read = 1060000;
+
+  // Message handed to a node of the same process
+  TraceStamps local;
+  local.publish = 2000000;
+  local.enqueue = 2001000;
+
+  TopicLatency latency;
+  latency.Add(remote, 1100000);
+  latency.Add(local, 2003000);
+
+  EXPECT_EQ(2u, latency.Stage(LATENCY_PUBLISHER_QUEUE).Count());
+  EXPECT_DOUBLE_EQ(5.5, latency.Stage(LATENCY_PUBLISHER_QUEUE).Mean());
+  EXPECT_EQ(1u, latency.Stage(LATENCY_WRITE_QUEUE).Count());
+  EXPECT_DOUBLE_EQ(20.0, latency.Stage(LATENCY_WRITE_QUEUE).Mean());
+  EXPECT_EQ(1u, latency.Stage(LATENCY_NETWORK).Count());
+  EXPECT_DOUBLE_EQ(30.0, latency.Stage(LATENCY_NETWORK).Mean());
+  EXPECT_EQ(2u, latency.Stage(LATENCY_INCOMING_QUEUE).Count());
+  EXPECT_DOUBLE_EQ(21.0, latency.Stage(LATENCY_INCOMING_QUEUE).Mean());
+  EXPECT_EQ(2u, latency.Stage(LATENCY_END_TO_END).Count());
+  EXPECT_DOUBLE_EQ(51.5, latency.Stage(LATENCY_END_TO_END).Mean());
+
+  EXPECT_EQ("end to end", latencyStageName(LATENCY_END_TO_END));
+}
+
+/////////////////////////////////////////////////
+TEST_F(TraceTest, Enable)
+{
+  EXPECT_FALSE(tracingEnabled());
+  EXPECT_FALSE(traceRequested());
+
+  enableTracing(true);
+  enableTracing(true);
+  EXPECT_TRUE(tracingEnabled());
+  EXPECT_TRUE(traceRequested());
+
+  // A traced connection keeps the messages stamped
+  requestTrace(true);
+  enableTracing(false);
+  EXPECT_FALSE(tracingEnabled());
+  EXPECT_TRUE(traceRequested());
+  requestTrace(false);
+  EXPECT_FALSE(traceRequested());
+
+  TraceStamps stamps;
+  stamps.publish = traceClock();
+  EXPECT_GT(stamps.publish, 0);
+  EXPECT_EQ(nullptr, currentTrace());
+  setCurrentTrace(&stamps);
+  EXPECT_EQ(&stamps, currentTrace());
+  setCurrentTrace(nullptr);
+
+  recordTrace("/gazebo/default/test", stamps);
+  std::map<std::string, TopicLatency> latencies = topicLatencies();
+  ASSERT_EQ(1u, latencies.count("/gazebo/default/test"));
+  EXPECT_EQ(1u, latencies["/gazebo/default/test"].Stage(
+        LATENCY_END_TO_END).Count());
+
+  clearTopicLatencies();
+  EXPECT_TRUE(topicLatencies().empty());
+}
+
+/////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -96,6 +96,16 @@ std::set<std::string> IntrospectionClient::Managers() const
 bool IntrospectionClient::NewFilter(const std::string &_managerId,
     const std::set<std::string> &_newItems, std::string &_filterId,
     std::string &_newTopic) const
+{
+  return this->NewFilter(_managerId, _newItems, 0.0, false, _filterId,
+      _newTopic);
+}
+
+//////////////////////////////////////////////////
+bool IntrospectionClient::NewFilter(const std::string &_managerId,
+    const std::set<std::string> &_newItems, const double _maxRate,
+    const bool _deltaOnly, std::string &_filterId,
+    std::string &_newTopic) const
 {
   if (_newItems.empty())
   {
@@ -117,6 +127,22 @@ bool IntrospectionClient::NewFilter(const std::string &_managerId,
     nextParam->mutable_value()->set_string_value(itemName);
   }
 
+  // Only send the optional settings when they differ from the defaults.
+  if (_maxRate > 0)
+  {
+    auto nextParam = req.add_param();
+    nextParam->set_name("max_rate");
+    nextParam->mutable_value()->set_type(gazebo::msgs::Any::DOUBLE);
+    nextParam->mutable_value()->set_double_value(_maxRate);
+  }
+  if (_deltaOnly)
+  {
+    auto nextParam = req.add_param();
+    nextParam->set_name("delta_only");
+    nextParam->mutable_value()->set_type(gazebo::msgs::Any::BOOLEAN);
+    nextParam->mutable_value()->set_bool_value(true);
+  }
+
   // Request the service.
   auto service = "/introspection/" + _managerId + "/filter_new";
   if (!this->dataPtr->node.Request(service, req,
@@ -15,6 +15,8 @@
  *
 */
 
+#include <functional>
+#include <mutex>
 #include <set>
 #include <string>
 #include <ignition/transport.hh>
@@ -181,6 +183,57 @@ TEST_F(IntrospectionClientTest, NewAndRemoveFilter)
   EXPECT_FALSE(this->callbackExecuted);
 }
 
+/////////////////////////////////////////////////
+TEST_F(IntrospectionClientTest, DeltaFilter)
+{
+  std::string filterId;
+  std::string topic;
+
+  // Create a filter that only receives the items that changed.
+  std::set<std::string> items = {"item1", "item2"};
+  EXPECT_TRUE(this->client.NewFilter(this->managerId, items, 0.0, true,
+      filterId, topic));
+  this->Subscribe(topic);
+
+  // The first update contains all the items.
+  this->manager->Update();
+  this->WaitForCallback();
+  EXPECT_TRUE(this->callbackExecuted);
+  this->callbackExecuted = false;
+
+  // The values didn't change, so nothing is published.
+  this->manager->Update();
+  this->WaitForCallback();
+  EXPECT_FALSE(this->callbackExecuted);
+
+  EXPECT_TRUE(this->client.RemoveFilter(this->managerId, filterId));
+}
+
+/////////////////////////////////////////////////
+TEST_F(IntrospectionClientTest, RateLimitedFilter)
+{
+  std::string filterId;
+  std::string topic;
+
+  // Create a filter limited to one update every 100 seconds.
+  std::set<std::string> items = {"item1", "item2"};
+  EXPECT_TRUE(this->client.NewFilter(this->managerId, items, 0.01, false,
+      filterId, topic));
+  this->Subscribe(topic);
+
+  this->manager->Update();
+  this->WaitForCallback();
+  EXPECT_TRUE(this->callbackExecuted);
+  this->callbackExecuted = false;
+
+  // Too early for the next update.
+  this->manager->Update();
+  this->WaitForCallback();
+  EXPECT_FALSE(this->callbackExecuted);
+
+  EXPECT_TRUE(this->client.RemoveFilter(this->managerId, filterId));
+}
+
 /////////////////////////////////////////////////
 TEST_F(IntrospectionClientTest, RemoveAllFilters)
 {
@@ -510,6 +563,72 @@ TEST_F(IntrospectionClientTest, Exception)
   EXPECT_TRUE(this->manager->Unregister("item4"));
 }
 
+/////////////////////////////////////////////////
+TEST_F(IntrospectionClientTest, ExceptionAfterValue)
+{
+  // A callback that only returns a value the first time it's called.
+  int calls = 0;
+  auto func = [&calls]()
+  {
+    if (calls++ > 0)
+      gzthrow("Simulating an exception in user callback");
+    return 2.0;
+  };
+  EXPECT_TRUE(this->manager->Register<double>("item5", func));
+
+  std::set<std::string> items = {"item1", "item5"};
+  std::string filterId;
+  std::string topic;
+  EXPECT_TRUE(this->client.NewFilter(this->managerId, items, filterId, topic));
+
+  std::mutex mutex;
+  std::set<std::string> received;
+  std::function<void(const gazebo::msgs::Param_V&)> cb =
+    [&mutex, &received](const gazebo::msgs::Param_V &_msg)
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      for (auto i = 0; i < _msg.param_size(); ++i)
+        received.insert(_msg.param(i).name());
+    };
+  ignition::transport::Node node;
+  EXPECT_TRUE(node.Subscribe(topic, cb));
+
+  auto waitForItem = [&mutex, &received](const std::string &_name)
+  {
+    for (int i = 0; i < 10; ++i)
+    {
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (received.count(_name))
+          return;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+  };
+
+  // The first update contains both items.
+  this->manager->Update();
+  waitForItem("item5");
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    EXPECT_EQ(1u, received.count("item1"));
+    EXPECT_EQ(1u, received.count("item5"));
+    received.clear();
+  }
+
+  // The callback of item5 fails now, so its old value isn't published again.
+  this->manager->Update();
+  waitForItem("item1");
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    EXPECT_EQ(1u, received.count("item1"));
+    EXPECT_EQ(0u, received.count("item5"));
+  }
+
+  EXPECT_TRUE(this->client.RemoveFilter(this->managerId, filterId));
+  EXPECT_TRUE(this->manager->Unregister("item5"));
+}
+
 /////////////////////////////////////////////////
 int main(int argc, char **argv)
 {
@@ -14,9 +14,14 @@
  * limitations under the License.
  *
  */
+#include <algorithm>
+#include <chrono>
 #include <functional>
+#include <memory>
 #include <set>
 #include <string>
+#include <utility>
+#include <vector>
 #include <ignition/math/Rand.hh>
 #include "gazebo/common/Assert.hh"
 #include "gazebo/common/Console.hh"
@@ -32,6 +37,78 @@
 using namespace gazebo;
 using namespace util;
 
+//////////////////////////////////////////////////
+/// \brief Compare two vectors field by field.
+/// \param[in] _a First vector.
+/// \param[in] _b Second vector.
+/// \return True when both vectors are exactly the same.
+static bool sameValue(const gazebo::msgs::Vector3d &_a,
+    const gazebo::msgs::Vector3d &_b)
+{
+  return _a.x() == _b.x() && _a.y() == _b.y() && _a.z() == _b.z();
+}
+
+//////////////////////////////////////////////////
+/// \brief Compare two quaternions field by field.
+/// \param[in] _a First quaternion.
+/// \param[in] _b Second quaternion.
+/// \return True when both quaternions are exactly the same.
+static bool sameValue(const gazebo::msgs::Quaternion &_a,
+    const gazebo::msgs::Quaternion &_b)
+{
+  return _a.x() == _b.x() && _a.y() == _b.y() && _a.z() == _b.z() &&
+         _a.w() == _b.w();
+}
+
+//////////////////////////////////////////////////
+/// \brief Compare the values of two messages, without serializing them.
+/// The comparison is exact, so that delta filters publish every change.
+/// \param[in] _a First value.
+/// \param[in] _b Second value.
+/// \return True when both messages hold the same value.
+static bool sameValue(const gazebo::msgs::Any &_a,
+    const gazebo::msgs::Any &_b)
+{
+  if (_a.type() != _b.type())
+    return false;
+
+  switch (_a.type())
+  {
+    case gazebo::msgs::Any::NONE:
+      return true;
+    case gazebo::msgs::Any::DOUBLE:
+      return _a.double_value() == _b.double_value();
+    case gazebo::msgs::Any::INT32:
+      return _a.int_value() == _b.int_value();
+    case gazebo::msgs::Any::STRING:
+      return _a.string_value() == _b.string_value();
+    case gazebo::msgs::Any::BOOLEAN:
+      return _a.bool_value() == _b.bool_value();
+    case gazebo::msgs::Any::VECTOR3D:
+      return sameValue(_a.vector3d_value(), _b.vector3d_value());
+    case gazebo::msgs::Any::COLOR:
+    {
+      const auto &ca = _a.color_value();
+      const auto &cb = _b.color_value();
+      return ca.r() == cb.r() && ca.g() == cb.g() && ca.b() == cb.b() &&
+             ca.a() == cb.a();
+    }
+    case gazebo::msgs::Any::POSE3D:
+      return _a.pose3d_value().name() == _b.pose3d_value().name() &&
+             sameValue(_a.pose3d_value().position(),
+                       _b.pose3d_value().position()) &&
+             sameValue(_a.pose3d_value().orientation(),
+                       _b.pose3d_value().orientation());
+    case gazebo::msgs::Any::QUATERNIOND:
+      return sameValue(_a.quaternion_value(), _b.quaternion_value());
+    case gazebo::msgs::Any::TIME:
+      return _a.time_value().sec() == _b.time_value().sec() &&
+             _a.time_value().nsec() == _b.time_value().nsec();
+    default:
+      return false;
+  }
+}
+
 //////////////////////////////////////////////////
 IntrospectionManager::IntrospectionManager()
   : dataPtr(new IntrospectionManagerPrivate)
@@ -110,10 +187,15 @@ bool IntrospectionManager::Register(const std::string &_item,
     return false;
   }
 
+  auto item = std::make_shared<IntrospectionItem>();
+  item->name = _item;
+  item->cb = _cb;
+
   this->dataPtr->allItemsKeys.insert(_item);
-  this->dataPtr->allItems[_item] = _cb;
+  this->dataPtr->allItems[_item] = item;
 
   this->dataPtr->itemsUpdated = true;
+  ++this->dataPtr->epoch;
 
   return true;
 }
@@ -135,6 +217,7 @@ bool IntrospectionManager::Unregister(const std::string &_item)
   this->dataPtr->allItems.erase(_item);
 
   this->dataPtr->itemsUpdated = true;
+  ++this->dataPtr->epoch;
 
   return true;
 }
@@ -146,6 +229,7 @@ void IntrospectionManager::Clear()
   this->dataPtr->allItemsKeys.clear();
   this->dataPtr->allItems.clear();
   this->dataPtr->itemsUpdated = true;
+  ++this->dataPtr->epoch;
 }
 
 //////////////////////////////////////////////////
@@ -164,88 +248,80 @@ std::set<std::string> IntrospectionManager::Items() const
 //////////////////////////////////////////////////
 void IntrospectionManager::Update()
 {
-  std::map<std::string, IntrospectionFilter> filtersCopy;
-  std::map<std::string, ObservedItem> observedItemsCopy;
-  std::map<std::string, std::function <gazebo::msgs::Any ()>> usedItemsCopy;
+  std::lock_guard<std::mutex> updateLock(this->dataPtr->updateMutex);
 
+  // Only rebuild the snapshot of the filters when an item or a filter
+  // changed since the last update. The snapshot holds handles to the items,
+  // so the callbacks can be called without holding the registry mutex.
   {
     std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+    if (this->dataPtr->snapshotEpoch != this->dataPtr->epoch)
+      this->RebuildSnapshot();
+  }
 
-    filtersCopy = this->dataPtr->filters;
-    observedItemsCopy = this->dataPtr->observedItems;
+  const auto now = std::chrono::steady_clock::now();
+  const uint64_t pass = ++this->dataPtr->updatePass;
 
-    for (const auto &observedItem: this->dataPtr->observedItems)
+  for (auto &filter : this->dataPtr->snapshot)
+  {
+    // Honor the rate limit of the filter.
+    if (filter.maxRate > 0 &&
+        filter.lastPublish != std::chrono::steady_clock::time_point() &&
+        now - filter.lastPublish <
+        std::chrono::duration<double>(1.0 / filter.maxRate))
     {
-      auto &item = observedItem.first;
-      // Sanity check: Make sure that someone registered this item.
-      if (this->dataPtr->allItemsKeys.count(item) == 0)
-      {
-        continue;
-      }
-
-      usedItemsCopy[item] = this->dataPtr->allItems[item];
+      continue;
     }
 
-    for (auto& filter: filtersCopy)
+    // Update the values of the items under observation. An item shared by
+    // several filters is only evaluated once per update.
+    for (auto &item : filter.items)
     {
-      for (auto const &item : filter.second.items)
+      if (item->evaluatedPass == pass)
+        continue;
+      item->evaluatedPass = pass;
+
+      try
       {
-        // Sanity check: Make sure that someone registered this item.
-        if (this->dataPtr->allItemsKeys.count(item) == 0)
+        gazebo::msgs::Any value = item->cb();
+        // Only delta filters need to know whether the value changed.
+        if (!item->trackChanges || item->version == 0 ||
+            !sameValue(value, item->lastValue))
         {
-          continue;
+          item->lastValue.Swap(&value);
+          ++item->version;
         }
-        usedItemsCopy[item] = this->dataPtr->allItems[item];
+        item->valid = true;
+      }
+      catch(...)
+      {
+        gzerr << "Exception caught calling user callback" << std::endl;
+        item->valid = false;
+        continue;
       }
     }
-  }
-
-  for (auto &observedItem : observedItemsCopy)
-  {
-    auto &item = observedItem.first;
-    auto itemIter = usedItemsCopy.find(item);
-
-    // Sanity check: Make sure that we can update the item.
-    if (itemIter == usedItemsCopy.end())
-      continue;
-
-    try
-    {
-      // Update the values of the items under observation.
-      gazebo::msgs::Any value = itemIter->second();
-      auto &lastValue = observedItem.second.lastValue;
-      lastValue.CopyFrom(value);
-    }
-    catch(...)
-    {
-      gzerr << "Exception caught calling user callback" << std::endl;
-      continue;
-    }
-  }
 
-  // Prepare the next message to be sent in each filter.
-  for (auto &filter : filtersCopy)
-  {
-    // First of all, clear the old message.
-    auto &nextMsg = filter.second.msg;
+    // Prepare the next message to be sent in this filter. Clearing the
+    // message keeps the allocated params around for reuse.
+    auto &nextMsg = filter.msg;
     nextMsg.Clear();
 
-    // Insert the last value of each item under observation for this filter.
-    for (auto const &item : filter.second.items)
+    for (size_t i = 0; i < filter.items.size(); ++i)
     {
-      // Sanity check: Make sure that someone registered this item.
-      if (usedItemsCopy.find(item) == usedItemsCopy.end())
-        continue;
+      const auto &item = filter.items[i];
 
       // Sanity check: Make sure that the value was updated.
       // (e.g.: an exception was not raised).
-      auto &lastValue = observedItemsCopy[item].lastValue;
-      if (lastValue.type() == gazebo::msgs::Any::NONE)
+      if (!item->valid)
+        continue;
+
+      // Delta filters only carry the items that changed.
+      if (filter.deltaOnly && item->version == filter.sentVersions[i])
         continue;
 
       auto nextParam = nextMsg.add_param();
-      nextParam->set_name(item);
-      nextParam->mutable_value()->CopyFrom(lastValue);
+      nextParam->set_name(item->name);
+      nextParam->mutable_value()->CopyFrom(item->lastValue);
     }
 
     // Sanity check: Make sure that we have at least one item updated.
@@ -253,21 +329,81 @@ void IntrospectionManager::Update()
       continue;
 
     // Publish the update for this filter.
-    std::string topicName = this->dataPtr->prefix + "filter/" + filter.first;
+    if (!filter.pub || !filter.pub.Publish(nextMsg))
+    {
+      gzerr << "Error publishing update for topic [" << filter.topic << "]"
+        << std::endl;
+      continue;
+    }
+
+    filter.lastPublish = now;
+    for (size_t i = 0; i < filter.items.size(); ++i)
+      filter.sentVersions[i] = filter.items[i]->version;
+  }
+
+  this->NotifyUpdates();
+}
+
+//////////////////////////////////////////////////
+void IntrospectionManager::RebuildSnapshot()
+{
+  std::vector<IntrospectionFilterState> snapshot;
+  snapshot.reserve(this->dataPtr->filters.size());
+
+  for (auto &item : this->dataPtr->allItems)
+    item.second->trackChanges = false;
+
+  for (auto const &filter : this->dataPtr->filters)
+  {
+    IntrospectionFilterState state;
+    state.id = filter.first;
+    state.topic = this->dataPtr->prefix + "filter/" + filter.first;
+    state.maxRate = filter.second.maxRate;
+    state.deltaOnly = filter.second.deltaOnly;
+
+    auto pubIter = this->dataPtr->filterPubs.find(state.topic);
+    if (pubIter != this->dataPtr->filterPubs.end())
+      state.pub = pubIter->second;
 
+    for (auto const &itemName : filter.second.items)
     {
-      std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
-      if (this->dataPtr->filterPubs.find(topicName) ==
-          this->dataPtr->filterPubs.end() ||
-          !this->dataPtr->filterPubs[topicName].Publish(nextMsg))
+      // Sanity check: Make sure that someone registered this item.
+      auto itemIter = this->dataPtr->allItems.find(itemName);
+      if (itemIter != this->dataPtr->allItems.end())
       {
-        gzerr << "Error publishing update for topic [" << topicName << "]"
-          << std::endl;
+        itemIter->second->trackChanges |= state.deltaOnly;
+        state.items.push_back(itemIter->second);
+      }
+    }
+    state.sentVersions.assign(state.items.size(), 0);
+
+    // Keep the publication state of filters that already existed, so that
+    // changing one filter doesn't reset the others.
+    for (auto &oldState : this->dataPtr->snapshot)
+    {
+      if (oldState.id != state.id)
+        continue;
+
+      state.lastPublish = oldState.lastPublish;
+      for (size_t i = 0; i < state.items.size(); ++i)
+      {
+        for (size_t j = 0; j < oldState.items.size(); ++j)
+        {
+          if (oldState.items[j] == state.items[i])
+          {
+            state.sentVersions[i] = oldState.sentVersions[j];
+            break;
+          }
+        }
       }
+      break;
     }
+
+    snapshot.push_back(std::move(state));
   }
 
-  this->NotifyUpdates();
+  this->dataPtr->snapshot.swap(snapshot);
+  this->dataPtr->snapshotEpoch = this->dataPtr->epoch;
 }
 
 //////////////////////////////////////////////////
@@ -298,7 +434,7 @@ void IntrospectionManager::NotifyUpdates()
 
 //////////////////////////////////////////////////
 bool IntrospectionManager::NewFilterImpl(const std::set<std::string> &_newItems,
-    std::string &_filterId)
+    const double _maxRate, const bool _deltaOnly, std::string &_filterId)
 {
   std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
 
@@ -330,11 +466,12 @@ bool IntrospectionManager::NewFilterImpl(const std::set<std::string> &_newItems,
   }
 
   // Add the items to the new filter.
-  this->dataPtr->filters[_filterId].items = _newItems;
+  auto &filter = this->dataPtr->filters[_filterId];
+  filter.items = _newItems;
+  filter.maxRate = _maxRate;
+  filter.deltaOnly = _deltaOnly;
 
-  // Register the new filter in the list of observed items.
-  for (auto const &item : _newItems)
-    this->dataPtr->observedItems[item].filters.emplace(_filterId);
+  ++this->dataPtr->epoch;
 
   return true;
 }
@@ -361,37 +498,10 @@ bool IntrospectionManager::UpdateFilterImpl(const std::string &_filterId,
     return false;
   }
 
-  // Save the old list of items.
-  auto oldItems = this->dataPtr->filters.at(_filterId).items;
-
   // Update the list of items for this filter.
   this->dataPtr->filters[_filterId].items = _newItems;
 
-  // The next block is needed for updating the 'observedItems' data structure
-  // that contains references to the filters.
-  {
-    // We need to ensure that the items that were part of the old filter but are
-    // not in the new filter are removed.
-    for (auto const &oldItem : oldItems)
-    {
-      if (_newItems.find(oldItem) == _newItems.end())
-      {
-        auto &filters = this->dataPtr->observedItems[oldItem].filters;
-        filters.erase(_filterId);
-
-        // If there is nobody interested in this item, remove it.
-        if (filters.empty())
-          this->dataPtr->observedItems.erase(oldItem);
-      }
-    }
-
-    // We need to add the new items that were not part of the old filter.
-    for (auto const &newItem : _newItems)
-    {
-      if (oldItems.find(newItem) == oldItems.end())
-        this->dataPtr->observedItems[newItem].filters.emplace(_filterId);
-    }
-  }
+  ++this->dataPtr->epoch;
 
   return true;
 }
@@ -424,22 +534,10 @@ bool IntrospectionManager::RemoveFilterImpl(const std::string &_filterId)
     this->dataPtr->filterPubs.erase(topicName);
   }
 
-  // Save the old list of items.
-  auto oldItems = this->dataPtr->filters.at(_filterId).items;
-
   // Let's remove the filter.
   this->dataPtr->filters.erase(_filterId);
 
-  // Remove any reference to this filter inside observedItems.
-  for (auto const &oldItem : oldItems)
-  {
-    auto &filters = this->dataPtr->observedItems[oldItem].filters;
-    filters.erase(_filterId);
-
-    // If there is nobody interested in this item, remove it.
-    if (filters.empty())
-      this->dataPtr->observedItems.erase(oldItem);
-  }
+  ++this->dataPtr->epoch;
 
   return true;
 }
@@ -459,11 +557,28 @@ bool IntrospectionManager::NewFilter(const gazebo::msgs::Param_V &_req,
   }
 
   std::set<std::string> requestedItems;
+  double maxRate = 0;
+  bool deltaOnly = false;
 
   // Store the new filter.
   for (auto i = 0; i < _req.param_size(); ++i)
   {
     auto param = _req.param(i);
+
+    // Optional filter settings.
+    if (param.name() == "max_rate" && param.has_value() &&
+        param.value().type() == gazebo::msgs::Any::DOUBLE)
+    {
+      maxRate = std::max(0.0, param.value().double_value());
+      continue;
+    }
+    else if (param.name() == "delta_only" && param.has_value() &&
+        param.value().type() == gazebo::msgs::Any::BOOLEAN)
+    {
+      deltaOnly = param.value().bool_value();
+      continue;
+    }
+
     if (!this->ValidateParameter(param, {"item"}))
     {
       gzwarn << "Invalid parameter[" << param.name() << "] "
@@ -476,7 +591,7 @@ bool IntrospectionManager::NewFilter(const gazebo::msgs::Param_V &_req,
   }
 
   std::string topicName;
-  if (!this->NewFilterImpl(requestedItems, topicName))
+  if (!this->NewFilterImpl(requestedItems, maxRate, deltaOnly, topicName))
   {
     gzwarn << "Ignoring request." << std::endl;
     return false;
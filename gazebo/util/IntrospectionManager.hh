@@ -86,7 +86,10 @@ namespace gazebo
       /// \brief Update all the items under observation and publish updates
       /// through all the topics. The message received in the update will
       /// contain the name and latest values of all the items specified
-      /// in the filter.
+      /// in the filter. Filters created with a maximum rate are skipped
+      /// until enough time has passed since their last message, and delta
+      /// filters only receive the items whose value changed, or no message
+      /// at all if nothing changed.
       /// If there are changes in the items list since the last update,
       /// a new message is published under the topic
       /// "/introspection/<manager_id>/items_update".
@@ -115,14 +118,24 @@ namespace gazebo
       /// will create a new topic for sending periodic updates of the items
       /// specified in the filter.
       /// \param[in] _newItems Non-empty set of items to observe.
+      /// \param[in] _maxRate Maximum publication rate in Hz, or zero to
+      /// publish on every update.
+      /// \param[in] _deltaOnly True to only publish the items whose value
+      /// changed since the last message of the filter.
       /// \param[out] _filterId Unique ID of the filter. You'll need this ID
       /// for future filter updates or for removing it. After the filter
       /// creation, a client should subscribe to the topic
       /// /introspection/filter/<filter_id> for receiving updates.
       /// \return True if the filter was successfully created or false otherwise
       private: bool NewFilterImpl(const std::set<std::string> &_newItems,
+                                  const double _maxRate,
+                                  const bool _deltaOnly,
                                   std::string &_filterId);
 
+      /// \brief Rebuild the snapshot of filters and item handles used by
+      /// Update. Must be called with the registry mutex locked.
+      private: void RebuildSnapshot();
+
       /// \brief Update an existing filter with a different set of items.
       /// \param[in] _filterId ID of the filter to update.
       /// \param[in] _newItems Non-empty set of items to be observed.
@@ -139,6 +152,9 @@ namespace gazebo
       /// \param[in] _req Input parameter of the service request. The service
       /// expects a collection of one or more parameters with name "item" and a
       /// value of type STRING containing the name of the item to observe.
+      /// Optionally, a parameter "max_rate" of type DOUBLE sets the maximum
+      /// publication rate in Hz, and a parameter "delta_only" of type
+      /// BOOLEAN requests messages with only the changed items.
       /// \param[out] _rep Output parameter of the service request. It contains
       /// the filter ID created.
       /// \return True when the operation succeed or false
@@ -17,11 +17,15 @@
 #ifndef GAZEBO_UTIL_INTROSPECTION_MANAGER_PRIVATE_HH_
 #define GAZEBO_UTIL_INTROSPECTION_MANAGER_PRIVATE_HH_
 
+#include <chrono>
+#include <cstdint>
 #include <functional>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <set>
 #include <string>
+#include <vector>
 #include <ignition/transport.hh>
 #include "gazebo/msgs/any.pb.h"
 #include "gazebo/msgs/param_v.pb.h"
@@ -31,57 +35,126 @@ namespace gazebo
 {
   namespace util
   {
+    /// \brief A registered item. Items are shared between the registry and
+    /// the snapshot used by IntrospectionManager::Update, so a handle stays
+    /// valid while an update is running, even if the item is unregistered.
+    struct IntrospectionItem
+    {
+      /// \brief Name of the item. E.g.: /default/world/model1/pose
+      std::string name;
+
+      /// \brief Callback used to get the last value of the item.
+      std::function<gazebo::msgs::Any ()> cb;
+
+      /// \brief Last value returned by the callback.
+      gazebo::msgs::Any lastValue;
+
+      /// \brief Incremented every time the value changes. Zero until the
+      /// first value is received. When changes aren't tracked, it's
+      /// incremented on every evaluation.
+      uint64_t version = 0;
+
+      /// \brief True when the item is observed by a delta filter, so new
+      /// values are compared against lastValue.
+      bool trackChanges = false;
+
+      /// \brief False when the callback failed in the last evaluation. The
+      /// item is then left out of the messages of that update.
+      bool valid = false;
+
+      /// \brief Last update pass in which the callback was called. Used to
+      /// call each callback at most once per update.
+      uint64_t evaluatedPass = 0;
+    };
+
+    /// \brief Shared pointer to an item.
+    using IntrospectionItemPtr = std::shared_ptr<IntrospectionItem>;
+
     /// \brief Private data for the IntrospectionFilter class.
     struct IntrospectionFilter
     {
       /// \brief Items observed by this filter.
       std::set<std::string> items;
 
-      /// \brief Message containing the next update. A message is a collection
-      /// of items and values.
-      msgs::Param_V msg;
+      /// \brief Maximum publication rate in Hz. Zero publishes on every
+      /// update.
+      double maxRate = 0;
+
+      /// \brief When true, messages only contain the items whose value
+      /// changed since the last message of this filter.
+      bool deltaOnly = false;
     };
 
-    /// \brief Todo.
-    struct ObservedItem
+    /// \brief State of a filter used by IntrospectionManager::Update. This
+    /// is rebuilt from the registry only when the registry changes.
+    struct IntrospectionFilterState
     {
-      /// \brief ToDo.
-      gazebo::msgs::Any lastValue;
+      /// \brief ID of the filter.
+      std::string id;
 
-      /// \brief ToDo.
-      std::set<std::string> filters;
+      /// \brief Topic where the filter publishes updates.
+      std::string topic;
+
+      /// \brief Publisher of the filter.
+      ignition::transport::Node::Publisher pub;
+
+      /// \brief Registered items observed by this filter.
+      std::vector<IntrospectionItemPtr> items;
+
+      /// \brief Version of each item in the last published message.
+      std::vector<uint64_t> sentVersions;
+
+      /// \brief Maximum publication rate in Hz, zero for no limit.
+      double maxRate = 0;
+
+      /// \brief Only publish changed items.
+      bool deltaOnly = false;
+
+      /// \brief Time of the last publication.
+      std::chrono::steady_clock::time_point lastPublish;
+
+      /// \brief Message containing the next update. A message is a
+      /// collection of items and values. It is kept between updates so that
+      /// its memory is reused.
+      msgs::Param_V msg;
     };
 
     /// \brief Private data for the IntrospectionManager class.
     class IntrospectionManagerPrivate
     {
       /// \brief List of active filters.
-      /// The key is the topic where the filter publishes updates.
+      /// The key is the filter ID.
       /// The value is the associated introspection filter.
       public: std::map<std::string, IntrospectionFilter> filters;
 
       /// \brief List of all registered items.
       /// The key contains the item name.
-      /// The value contains the string representation of the protobuf type
-      /// that stores the value.
-      /// E.g.: allItems["model1::pose"] = "gazebo::msgs::Pose"
-      public: std::map<std::string, std::function <gazebo::msgs::Any ()>>
-          allItems;
+      public: std::map<std::string, IntrospectionItemPtr> allItems;
 
       /// \brief Set of all registered items names.
       /// This is a convenience/performance enhancement for retreving
       /// registered keys.
       public: std::set<std::string> allItemsKeys;
 
-      /// \brief List of items that have at least one active observer.
-      /// The key contains the item name.
-      /// The value contains the last value stored for this item, as well as a
-      /// list of all the filters that contain the item.
-      public: std::map<std::string, ObservedItem> observedItems;
+      /// \brief Incremented every time the items or the filters change.
+      /// Protected by mutex.
+      public: uint64_t epoch = 1;
 
       /// \brief Mutex to make this class thread-safe.
       public: mutable std::mutex mutex;
 
+      /// \brief Serializes calls to Update, and protects the snapshot.
+      public: std::mutex updateMutex;
+
+      /// \brief Epoch of the registry when the snapshot was built.
+      public: uint64_t snapshotEpoch = 0;
+
+      /// \brief Snapshot of the filters used by Update.
+      public: std::vector<IntrospectionFilterState> snapshot;
+
+      /// \brief Number of calls to Update.
+      public: uint64_t updatePass = 0;
+
       /// \brief Node used for communications.
       public: ignition::transport::Node node;
 
@@ -0,0 +1,914 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "gazebo/common/Console.hh"
+#include "gazebo/util/TopicLog.hh"
+
+using namespace gazebo;
+using namespace util;
+
+namespace
+{
+  /// \brief Marker at the start of every file.
+  const char kFileMagic[8] = {'G', 'Z', 'T', 'L', 'O', 'G', '0', '1'};
+
+  /// \brief Marker at the end of files that have an index.
+  const char kEndMagic[8] = {'G', 'Z', 'T', 'L', 'I', 'N', 'D', 'X'};
+
+  /// \brief Size of the block tags.
+  const size_t kTagSize = 4;
+
+  /// \brief Size of a chunk header, after its tag.
+  const size_t kChunkHeaderSize = 8 + 4 + 8 + 8;
+
+  /// \brief Size of a message header.
+  const size_t kMessageHeaderSize = 8 + 4 + 4;
+
+  /// \brief Upper bound on the length of topic names and types, to reject
+  /// corrupted files early.
+  const uint32_t kMaxStringSize = 64 * 1024;
+
+  /// \brief Maximum number of full chunks waiting to be written, after
+  /// which Write blocks until the disk catches up.
+  const size_t kMaxQueuedChunks = 16;
+
+  /// \brief Description of a chunk, as stored in the index.
+  struct ChunkInfo
+  {
+    /// \brief Offset of the chunk tag in the file.
+    uint64_t offset = 0;
+
+    /// \brief Size of the messages of the chunk.
+    uint64_t size = 0;
+
+    /// \brief Time stamp of the first message, in nanoseconds.
+    int64_t start = 0;
+
+    /// \brief Time stamp of the last message, in nanoseconds.
+    int64_t end = 0;
+
+    /// \brief Number of messages.
+    uint32_t count = 0;
+  };
+
+  /// \brief Append a value to a buffer.
+  /// \param[in,out] _buffer The buffer.
+  /// \param[in] _value The value.
+  template<typename T>
+  void append(std::string &_buffer, const T _value)
+  {
+    _buffer.append(reinterpret_cast<const char *>(&_value), sizeof(T));
+  }
+
+  /// \brief Append a string, preceded by its length, to a buffer.
+  /// \param[in,out] _buffer The buffer.
+  /// \param[in] _value The string.
+  void appendString(std::string &_buffer, const std::string &_value)
+  {
+    append<uint32_t>(_buffer, _value.size());
+    _buffer.append(_value);
+  }
+
+  /// \brief Read a value from a stream.
+  /// \param[in] _in The stream.
+  /// \param[out] _value The value.
+  /// \return True on success.
+  template<typename T>
+  bool read(std::istream &_in, T &_value)
+  {
+    return static_cast<bool>(
+        _in.read(reinterpret_cast<char *>(&_value), sizeof(T)));
+  }
+
+  /// \brief Read a string, preceded by its length, from a stream.
+  /// \param[in] _in The stream.
+  /// \param[out] _value The string.
+  /// \return True on success.
+  bool readString(std::istream &_in, std::string &_value)
+  {
+    uint32_t size;
+    if (!read(_in, size) || size > kMaxStringSize)
+      return false;
+    _value.resize(size);
+    return size == 0 || static_cast<bool>(_in.read(&_value[0], size));
+  }
+
+  /// \brief Convert a time to nanoseconds.
+  /// \param[in] _time The time.
+  /// \return The time in nanoseconds.
+  int64_t toNanoseconds(const common::Time &_time)
+  {
+    return static_cast<int64_t>(_time.sec) * 1000000000 + _time.nsec;
+  }
+
+  /// \brief Convert nanoseconds to a time.
+  /// \param[in] _ns The time in nanoseconds.
+  /// \return The time.
+  common::Time fromNanoseconds(const int64_t _ns)
+  {
+    return common::Time(static_cast<int32_t>(_ns / 1000000000),
+                        static_cast<int32_t>(_ns % 1000000000));
+  }
+}
+
+namespace gazebo
+{
+  namespace util
+  {
+    /// \brief Messages accumulated before being written.
+    struct TopicLogChunk
+    {
+      /// \brief Topic blocks to write before the chunk.
+      std::string topics;
+
+      /// \brief Serialized messages, with their headers.
+      std::string payload;
+
+      /// \brief Number of messages.
+      uint32_t count = 0;
+
+      /// \brief Time stamp of the first message, in nanoseconds.
+      int64_t start = 0;
+
+      /// \brief Time stamp of the last message, in nanoseconds.
+      int64_t end = 0;
+    };
+
+    /// \internal
+    /// \brief Private data for the TopicLogWriter class.
+    class TopicLogWriterPrivate
+    {
+      /// \brief Body of the thread that writes chunks to the file.
+      public: void WriteThread();
+
+      /// \brief Write a chunk, and the topics added before it.
+      /// \param[in] _chunk The chunk.
+      public: void WriteChunk(const TopicLogChunk &_chunk);
+
+      /// \brief Write bytes to the file.
+      /// \param[in] _data The bytes.
+      /// \param[in] _size Number of bytes.
+      public: void WriteBytes(const char *_data, const size_t _size);
+
+      /// \brief Queue the current chunk for writing. The mutex must be
+      /// locked.
+      public: void QueueChunk();
+
+      /// \brief The file.
+      public: std::ofstream file;
+
+      /// \brief Size above which chunks are written.
+      public: size_t chunkSize = 0;
+
+      /// \brief Protects the members below, up to the write thread ones.
+      public: std::mutex mutex;
+
+      /// \brief Notified when chunks are queued or written.
+      public: std::condition_variable condition;
+
+      /// \brief Chunk receiving messages.
+      public: std::unique_ptr<TopicLogChunk> current;
+
+      /// \brief Full chunks, waiting to be written.
+      public: std::deque<std::unique_ptr<TopicLogChunk>> queue;
+
+      /// \brief Written chunks, kept to reuse their buffers.
+      public: std::vector<std::unique_ptr<TopicLogChunk>> freeChunks;
+
+      /// \brief Topic blocks not yet attached to a chunk.
+      public: std::string pendingTopics;
+
+      /// \brief Name and message type of the topics.
+      public: std::vector<std::pair<std::string, std::string>> topics;
+
+      /// \brief Time stamp of the last message, in nanoseconds.
+      public: int64_t lastStamp = 0;
+
+      /// \brief Number of messages written.
+      public: uint64_t messageCount = 0;
+
+      /// \brief Number of message bytes written.
+      public: uint64_t byteCount = 0;
+
+      /// \brief True to stop the write thread once the queue is empty.
+      public: bool stop = false;
+
+      /// \brief Thread writing chunks to the file.
+      public: std::thread writeThread;
+
+      /// \brief Index of the written chunks. Only used by the write thread.
+      public: std::vector<ChunkInfo> index;
+
+      /// \brief Current offset in the file. Only used by the write thread.
+      public: uint64_t offset = 0;
+    };
+
+    /// \internal
+    /// \brief Private data for the TopicLogReader class.
+    class TopicLogReaderPrivate
+    {
+      /// \brief Read the index at the end of the file.
+      /// \param[in] _fileSize Size of the file.
+      /// \return False if the file has no valid index.
+      public: bool ReadIndex(const uint64_t _fileSize);
+
+      /// \brief Build the index from the blocks of the file.
+      /// \param[in] _fileSize Size of the file.
+      public: void Scan(const uint64_t _fileSize);
+
+      /// \brief Add a topic.
+      /// \param[in] _id Id of the topic.
+      /// \param[in] _name Name of the topic.
+      /// \param[in] _msgType Type of the messages of the topic.
+      public: void AddTopic(const uint32_t _id, const std::string &_name,
+                  const std::string &_msgType);
+
+      /// \brief Read the messages of a chunk, unless it's already loaded.
+      /// \param[in] _chunk Index of the chunk.
+      /// \return True on success.
+      public: bool LoadChunk(const size_t _chunk);
+
+      /// \brief The file.
+      public: std::ifstream file;
+
+      /// \brief Name and message type of the topics.
+      public: std::vector<std::pair<std::string, std::string>> topics;
+
+      /// \brief Chunks of the file, in order.
+      public: std::vector<ChunkInfo> chunks;
+
+      /// \brief Number of messages.
+      public: uint64_t messageCount = 0;
+
+      /// \brief Index of the loaded chunk.
+      public: size_t loaded = std::string::npos;
+
+      /// \brief Messages of the loaded chunk.
+      public: std::string payload;
+
+      /// \brief Offsets of the messages in the payload.
+      public: std::vector<size_t> offsets;
+
+      /// \brief Time stamps of the messages, in nanoseconds.
+      public: std::vector<int64_t> stamps;
+
+      /// \brief Index of the chunk under the cursor.
+      public: size_t chunk = 0;
+
+      /// \brief Index of the message under the cursor, in its chunk.
+      public: size_t message = 0;
+    };
+  }
+}
+
+/////////////////////////////////////////////////
+TopicLogWriter::TopicLogWriter()
+  : dataPtr(new TopicLogWriterPrivate)
+{
+}
+
+/////////////////////////////////////////////////
+TopicLogWriter::~TopicLogWriter()
+{
+  this->Close();
+}
+
+/////////////////////////////////////////////////
+bool TopicLogWriter::Open(const std::string &_filename,
+    const size_t _chunkSize)
+{
+  this->Close();
+
+  this->dataPtr->file.open(_filename.c_str(),
+      std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!this->dataPtr->file.is_open())
+  {
+    gzerr << "Unable to open file[" << _filename << "] for writing.\n";
+    return false;
+  }
+
+  this->dataPtr->chunkSize = std::max<size_t>(_chunkSize, 1);
+  this->dataPtr->current.reset(new TopicLogChunk);
+  this->dataPtr->current->payload.reserve(this->dataPtr->chunkSize);
+  this->dataPtr->queue.clear();
+  this->dataPtr->pendingTopics.clear();
+  this->dataPtr->topics.clear();
+  this->dataPtr->lastStamp = 0;
+  this->dataPtr->messageCount = 0;
+  this->dataPtr->byteCount = 0;
+  this->dataPtr->stop = false;
+  this->dataPtr->index.clear();
+  this->dataPtr->offset = 0;
+
+  this->dataPtr->WriteBytes(kFileMagic, sizeof(kFileMagic));
+
+  this->dataPtr->writeThread =
+    std::thread(&TopicLogWriterPrivate::WriteThread, this->dataPtr.get());
+
+  return true;
+}
+
+/////////////////////////////////////////////////
+void TopicLogWriter::Close()
+{
+  if (!this->IsOpen())
+    return;
+
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+    this->dataPtr->QueueChunk();
+    this->dataPtr->stop = true;
+  }
+  this->dataPtr->condition.notify_all();
+  this->dataPtr->writeThread.join();
+
+  // Index of the topics and chunks, followed by its offset so that readers
+  // can find it from the end of the file.
+  std::string index("INDX");
+  append<uint32_t>(index, this->dataPtr->topics.size());
+  for (size_t i = 0; i < this->dataPtr->topics.size(); ++i)
+  {
+    append<uint32_t>(index, i);
+    appendString(index, this->dataPtr->topics[i].first);
+    appendString(index, this->dataPtr->topics[i].second);
+  }
+  append<uint64_t>(index, this->dataPtr->index.size());
+  for (auto const &info : this->dataPtr->index)
+  {
+    append(index, info.offset);
+    append(index, info.size);
+    append(index, info.start);
+    append(index, info.end);
+    append(index, info.count);
+  }
+  append(index, this->dataPtr->offset);
+  index.append(kEndMagic, sizeof(kEndMagic));
+  this->dataPtr->WriteBytes(index.data(), index.size());
+
+  this->dataPtr->file.close();
+  this->dataPtr->current.reset();
+  this->dataPtr->freeChunks.clear();
+}
+
+/////////////////////////////////////////////////
+bool TopicLogWriter::IsOpen() const
+{
+  return this->dataPtr->file.is_open();
+}
+
+/////////////////////////////////////////////////
+uint32_t TopicLogWriter::AddTopic(const std::string &_topic,
+    const std::string &_msgType)
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+
+  const uint32_t id = this->dataPtr->topics.size();
+  this->dataPtr->topics.push_back(std::make_pair(_topic, _msgType));
+
+  this->dataPtr->pendingTopics.append("TOPC");
+  append(this->dataPtr->pendingTopics, id);
+  appendString(this->dataPtr->pendingTopics, _topic);
+  appendString(this->dataPtr->pendingTopics, _msgType);
+
+  return id;
+}
+
+/////////////////////////////////////////////////
+void TopicLogWriter::Write(const uint32_t _topicId, const std::string &_data)
+{
+  const auto now = std::chrono::system_clock::now().time_since_epoch();
+  const int64_t ns =
+    std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+  this->Write(_topicId, fromNanoseconds(ns), _data.data(), _data.size());
+}
+
+/////////////////////////////////////////////////
+void TopicLogWriter::Write(const uint32_t _topicId,
+    const common::Time &_stamp, const char *_data, const size_t _size)
+{
+  std::unique_lock<std::mutex> lock(this->dataPtr->mutex);
+
+  if (!this->dataPtr->current)
+  {
+    gzerr << "Unable to write a message, no file is open.\n";
+    return;
+  }
+
+  if (_topicId >= this->dataPtr->topics.size())
+  {
+    gzerr << "Unable to write a message on unknown topic id["
+          << _topicId << "]\n";
+    return;
+  }
+
+  // Keep the stamps sorted, so that readers can seek with a binary search
+  const int64_t stamp =
+    std::max(toNanoseconds(_stamp), this->dataPtr->lastStamp);
+  this->dataPtr->lastStamp = stamp;
+
+  TopicLogChunk &chunk = *this->dataPtr->current;
+  if (chunk.count == 0)
+    chunk.start = stamp;
+  chunk.end = stamp;
+  ++chunk.count;
+
+  char header[kMessageHeaderSize];
+  const uint32_t size = _size;
+  std::memcpy(header, &stamp, sizeof(stamp));
+  std::memcpy(header + 8, &_topicId, sizeof(_topicId));
+  std::memcpy(header + 12, &size, sizeof(size));
+  chunk.payload.append(header, kMessageHeaderSize);
+  chunk.payload.append(_data, _size);
+
+  ++this->dataPtr->messageCount;
+  this->dataPtr->byteCount += _size;
+
+  if (chunk.payload.size() >= this->dataPtr->chunkSize)
+  {
+    // Apply back pressure if the disk can't keep up
+    this->dataPtr->condition.wait(lock, [this]
+        {
+          return this->dataPtr->queue.size() < kMaxQueuedChunks;
+        });
+    this->dataPtr->QueueChunk();
+    lock.unlock();
+    this->dataPtr->condition.notify_all();
+  }
+}
+
+/////////////////////////////////////////////////
+uint64_t TopicLogWriter::MessageCount() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->messageCount;
+}
+
+/////////////////////////////////////////////////
+uint64_t TopicLogWriter::ByteCount() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->byteCount;
+}
+
+/////////////////////////////////////////////////
+void TopicLogWriterPrivate::QueueChunk()
+{
+  if (this->current->count == 0 && this->pendingTopics.empty())
+    return;
+
+  this->current->topics.swap(this->pendingTopics);
+  this->queue.push_back(std::move(this->current));
+
+  if (this->freeChunks.empty())
+  {
+    this->current.reset(new TopicLogChunk);
+    this->current->payload.reserve(this->chunkSize);
+  }
+  else
+  {
+    this->current = std::move(this->freeChunks.back());
+    this->freeChunks.pop_back();
+  }
+}
+
+/////////////////////////////////////////////////
+void TopicLogWriterPrivate::WriteThread()
+{
+  while (true)
+  {
+    std::unique_ptr<TopicLogChunk> chunk;
+    {
+      std::unique_lock<std::mutex> lock(this->mutex);
+      this->condition.wait(lock, [this]
+          {
+            return this->stop || !this->queue.empty();
+          });
+
+      if (this->queue.empty())
+        break;
+
+      chunk = std::move(this->queue.front());
+      this->queue.pop_front();
+    }
+    this->condition.notify_all();
+
+    this->WriteChunk(*chunk);
+
+    chunk->topics.clear();
+    chunk->payload.clear();
+    chunk->count = 0;
+
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->freeChunks.push_back(std::move(chunk));
+  }
+}
+
+/////////////////////////////////////////////////
+void TopicLogWriterPrivate::WriteChunk(const TopicLogChunk &_chunk)
+{
+  this->WriteBytes(_chunk.topics.data(), _chunk.topics.size());
+
+  if (_chunk.count == 0)
+    return;
+
+  ChunkInfo info;
+  info.offset = this->offset;
+  info.size = _chunk.payload.size();
+  info.start = _chunk.start;
+  info.end = _chunk.end;
+  info.count = _chunk.count;
+  this->index.push_back(info);
+
+  std::string header("CHNK");
+  append(header, info.size);
+  append(header, info.count);
+  append(header, info.start);
+  append(header, info.end);
+  this->WriteBytes(header.data(), header.size());
+  this->WriteBytes(_chunk.payload.data(), _chunk.payload.size());
+}
+
+/////////////////////////////////////////////////
+void TopicLogWriterPrivate::WriteBytes(const char *_data, const size_t _size)
+{
+  if (!this->file.write(_data, _size))
+  {
+    gzerr << "Unable to write to the topic log.\n";
+    return;
+  }
+  this->offset += _size;
+}
+
+/////////////////////////////////////////////////
+TopicLogReader::TopicLogReader()
+  : dataPtr(new TopicLogReaderPrivate)
+{
+}
+
+/////////////////////////////////////////////////
+TopicLogReader::~TopicLogReader()
+{
+}
+
+/////////////////////////////////////////////////
+bool TopicLogReader::Open(const std::string &_filename)
+{
+  this->Close();
+
+  this->dataPtr->file.open(_filename.c_str(),
+      std::ios::in | std::ios::binary);
+  if (!this->dataPtr->file.is_open())
+  {
+    gzerr << "Unable to open file[" << _filename << "]\n";
+    return false;
+  }
+
+  char magic[sizeof(kFileMagic)];
+  if (!this->dataPtr->file.read(magic, sizeof(magic)) ||
+      std::memcmp(magic, kFileMagic, sizeof(magic)) != 0)
+  {
+    gzerr << "File[" << _filename << "] is not a topic log.\n";
+    this->Close();
+    return false;
+  }
+
+  this->dataPtr->file.seekg(0, std::ios::end);
+  const uint64_t fileSize = this->dataPtr->file.tellg();
+
+  if (!this->dataPtr->ReadIndex(fileSize))
+  {
+    gzwarn << "Topic log[" << _filename << "] has no index, it was probably "
+           << "not closed properly. Rebuilding the index.\n";
+    this->dataPtr->topics.clear();
+    this->dataPtr->chunks.clear();
+    this->dataPtr->Scan(fileSize);
+  }
+
+  this->dataPtr->messageCount = 0;
+  for (auto const &info : this->dataPtr->chunks)
+    this->dataPtr->messageCount += info.count;
+
+  return true;
+}
+
+/////////////////////////////////////////////////
+void TopicLogReader::Close()
+{
+  this->dataPtr->file.close();
+  this->dataPtr->file.clear();
+  this->dataPtr->topics.clear();
+  this->dataPtr->chunks.clear();
+  this->dataPtr->messageCount = 0;
+  this->dataPtr->loaded = std::string::npos;
+  this->dataPtr->payload.clear();
+  this->dataPtr->offsets.clear();
+  this->dataPtr->stamps.clear();
+  this->dataPtr->chunk = 0;
+  this->dataPtr->message = 0;
+}
+
+/////////////////////////////////////////////////
+bool TopicLogReader::IsOpen() const
+{
+  return this->dataPtr->file.is_open();
+}
+
+/////////////////////////////////////////////////
+uint32_t TopicLogReader::TopicCount() const
+{
+  return this->dataPtr->topics.size();
+}
+
+/////////////////////////////////////////////////
+std::string TopicLogReader::Topic(const uint32_t _topicId) const
+{
+  if (_topicId >= this->dataPtr->topics.size())
+    return "";
+  return this->dataPtr->topics[_topicId].first;
+}
+
+/////////////////////////////////////////////////
+std::string TopicLogReader::MsgType(const uint32_t _topicId) const
+{
+  if (_topicId >= this->dataPtr->topics.size())
+    return "";
+  return this->dataPtr->topics[_topicId].second;
+}
+
+/////////////////////////////////////////////////
+uint64_t TopicLogReader::MessageCount() const
+{
+  return this->dataPtr->messageCount;
+}
+
+/////////////////////////////////////////////////
+common::Time TopicLogReader::StartTime() const
+{
+  if (this->dataPtr->chunks.empty())
+    return common::Time::Zero;
+  return fromNanoseconds(this->dataPtr->chunks.front().start);
+}
+
+/////////////////////////////////////////////////
+common::Time TopicLogReader::EndTime() const
+{
+  if (this->dataPtr->chunks.empty())
+    return common::Time::Zero;
+  return fromNanoseconds(this->dataPtr->chunks.back().end);
+}
+
+/////////////////////////////////////////////////
+bool TopicLogReader::Seek(const common::Time &_time)
+{
+  const int64_t ns = toNanoseconds(_time);
+
+  // First chunk that ends at or after the time
+  auto const &chunks = this->dataPtr->chunks;
+  auto chunkIter = std::lower_bound(chunks.begin(), chunks.end(), ns,
+      [](const ChunkInfo &_info, const int64_t _ns)
+      {
+        return _info.end < _ns;
+      });
+
+  this->dataPtr->chunk = chunkIter - chunks.begin();
+  this->dataPtr->message = 0;
+
+  if (chunkIter == chunks.end() ||
+      !this->dataPtr->LoadChunk(this->dataPtr->chunk))
+  {
+    return false;
+  }
+
+  auto const &stamps = this->dataPtr->stamps;
+  this->dataPtr->message =
+    std::lower_bound(stamps.begin(), stamps.end(), ns) - stamps.begin();
+
+  return true;
+}
+
+/////////////////////////////////////////////////
+bool TopicLogReader::Next(uint32_t &_topicId, common::Time &_stamp,
+    std::string &_data)
+{
+  while (this->dataPtr->chunk < this->dataPtr->chunks.size())
+  {
+    if (!this->dataPtr->LoadChunk(this->dataPtr->chunk))
+      return false;
+
+    if (this->dataPtr->message < this->dataPtr->offsets.size())
+    {
+      const char *header =
+        &this->dataPtr->payload[this->dataPtr->offsets[this->dataPtr->message]];
+      uint32_t size;
+      std::memcpy(&_topicId, header + 8, sizeof(_topicId));
+      std::memcpy(&size, header + 12, sizeof(size));
+      _stamp = fromNanoseconds(this->dataPtr->stamps[this->dataPtr->message]);
+      _data.assign(header + kMessageHeaderSize, size);
+
+      ++this->dataPtr->message;
+      return true;
+    }
+
+    ++this->dataPtr->chunk;
+    this->dataPtr->message = 0;
+  }
+
+  return false;
+}
+
+/////////////////////////////////////////////////
+bool TopicLogReaderPrivate::ReadIndex(const uint64_t _fileSize)
+{
+  const uint64_t trailerSize = sizeof(uint64_t) + sizeof(kEndMagic);
+  if (_fileSize < sizeof(kFileMagic) + trailerSize)
+    return false;
+
+  this->file.clear();
+  this->file.seekg(_fileSize - trailerSize);
+
+  uint64_t indexOffset;
+  char magic[sizeof(kEndMagic)];
+  if (!read(this->file, indexOffset) ||
+      !this->file.read(magic, sizeof(magic)) ||
+      std::memcmp(magic, kEndMagic, sizeof(magic)) != 0 ||
+      indexOffset >= _fileSize - trailerSize)
+  {
+    return false;
+  }
+
+  this->file.seekg(indexOffset);
+
+  char tag[kTagSize];
+  uint32_t topicCount;
+  if (!this->file.read(tag, kTagSize) ||
+      std::memcmp(tag, "INDX", kTagSize) != 0 ||
+      !read(this->file, topicCount))
+  {
+    return false;
+  }
+
+  for (uint32_t i = 0; i < topicCount; ++i)
+  {
+    uint32_t id;
+    std::string name, msgType;
+    if (!read(this->file, id) || !readString(this->file, name) ||
+        !readString(this->file, msgType))
+    {
+      return false;
+    }
+    this->AddTopic(id, name, msgType);
+  }
+
+  uint64_t chunkCount;
+  if (!read(this->file, chunkCount) ||
+      chunkCount > _fileSize / (kTagSize + kChunkHeaderSize))
+  {
+    return false;
+  }
+
+  this->chunks.resize(chunkCount);
+  for (auto &info : this->chunks)
+  {
+    if (!read(this->file, info.offset) || !read(this->file, info.size) ||
+        !read(this->file, info.start) || !read(this->file, info.end) ||
+        !read(this->file, info.count))
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/////////////////////////////////////////////////
+void TopicLogReaderPrivate::Scan(const uint64_t _fileSize)
+{
+  this->file.clear();
+  uint64_t offset = sizeof(kFileMagic);
+
+  while (offset + kTagSize <= _fileSize)
+  {
+    this->file.seekg(offset);
+
+    char tag[kTagSize];
+    if (!this->file.read(tag, kTagSize))
+      break;
+
+    if (std::memcmp(tag, "TOPC", kTagSize) == 0)
+    {
+      uint32_t id;
+      std::string name, msgType;
+      if (!read(this->file, id) || !readString(this->file, name) ||
+          !readString(this->file, msgType))
+      {
+        break;
+      }
+      this->AddTopic(id, name, msgType);
+      offset = this->file.tellg();
+    }
+    else if (std::memcmp(tag, "CHNK", kTagSize) == 0)
+    {
+      ChunkInfo info;
+      info.offset = offset;
+      if (!read(this->file, info.size) || !read(this->file, info.count) ||
+          !read(this->file, info.start) || !read(this->file, info.end))
+      {
+        break;
+      }
+
+      // Drop the last chunk if it was only partially written
+      offset += kTagSize + kChunkHeaderSize + info.size;
+      if (offset > _fileSize)
+        break;
+
+      this->chunks.push_back(info);
+    }
+    else
+    {
+      break;
+    }
+  }
+
+  this->file.clear();
+}
+
+/////////////////////////////////////////////////
+void TopicLogReaderPrivate::AddTopic(const uint32_t _id,
+    const std::string &_name, const std::string &_msgType)
+{
+  if (_id >= this->topics.size())
+    this->topics.resize(_id + 1);
+  this->topics[_id] = std::make_pair(_name, _msgType);
+}
+
+/////////////////////////////////////////////////
+bool TopicLogReaderPrivate::LoadChunk(const size_t _chunk)
+{
+  if (_chunk == this->loaded)
+    return true;
+
+  const ChunkInfo &info = this->chunks[_chunk];
+
+  this->loaded = std::string::npos;
+  this->offsets.clear();
+  this->stamps.clear();
+  this->payload.resize(info.size);
+
+  this->file.clear();
+  this->file.seekg(info.offset + kTagSize + kChunkHeaderSize);
+  if (info.size > 0 && !this->file.read(&this->payload[0], info.size))
+  {
+    gzerr << "Unable to read chunk at offset[" << info.offset << "]\n";
+    return false;
+  }
+
+  this->offsets.reserve(info.count);
+  this->stamps.reserve(info.count);
+
+  size_t offset = 0;
+  while (offset + kMessageHeaderSize <= this->payload.size())
+  {
+    int64_t stamp;
+    uint32_t size;
+    std::memcpy(&stamp, &this->payload[offset], sizeof(stamp));
+    std::memcpy(&size, &this->payload[offset + 12], sizeof(size));
+
+    if (offset + kMessageHeaderSize + size > this->payload.size())
+    {
+      gzerr << "Corrupted chunk at offset[" << info.offset << "]\n";
+      break;
+    }
+
+    this->offsets.push_back(offset);
+    this->stamps.push_back(stamp);
+    offset += kMessageHeaderSize + size;
+  }
+
+  this->loaded = _chunk;
+  return true;
+}
@@ -0,0 +1,192 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GAZEBO_UTIL_TOPICLOG_HH_
+#define GAZEBO_UTIL_TOPICLOG_HH_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "gazebo/common/Time.hh"
+#include "gazebo/util/system.hh"
+
+namespace gazebo
+{
+  namespace util
+  {
+    // Forward declare private data classes
+    class TopicLogWriterPrivate;
+    class TopicLogReaderPrivate;
+
+    /// addtogroup gazebo_util
+    /// \{
+
+    /// \class TopicLogWriter TopicLog.hh util/util.hh
+    /// \brief Records serialized messages published on topics into a
+    /// chunked binary file, without decoding them.
+    ///
+    /// Messages are appended to an in-memory chunk which, once full, is
+    /// handed to a background thread that writes it to disk, so that Write
+    /// only copies the message. Each chunk starts with a header holding the
+    /// time range of its messages, and an index of all the chunks is
+    /// appended to the file on Close. Files that were not closed, for
+    /// instance after a crash, are still readable by TopicLogReader, which
+    /// rebuilds the index from the chunk headers.
+    ///
+    /// The file layout is a sequence of blocks, each starting with a four
+    /// character tag. Integers are stored in the byte order of the host.
+    /// - "TOPC": uint32 topic id, then the topic name and the message type,
+    ///   each preceded by its uint32 length.
+    /// - "CHNK": uint64 payload size, uint32 message count, int64 first and
+    ///   last time stamps in nanoseconds, then the messages. Each message
+    ///   is an int64 time stamp, a uint32 topic id, a uint32 size and the
+    ///   serialized data.
+    /// - "INDX": the topics and the offset, time range and message count of
+    ///   each chunk, followed by the uint64 offset of the block and an eight
+    ///   character end marker.
+    class GZ_UTIL_VISIBLE TopicLogWriter
+    {
+      /// \brief Constructor.
+      public: TopicLogWriter();
+
+      /// \brief Destructor. Closes the file.
+      public: ~TopicLogWriter();
+
+      /// \brief Create a file and start accepting messages.
+      /// \param[in] _filename Path to the file, overwritten if it exists.
+      /// \param[in] _chunkSize Size in bytes above which a chunk is written.
+      /// \return True if the file could be created.
+      public: bool Open(const std::string &_filename,
+                  const size_t _chunkSize = 4 * 1024 * 1024);
+
+      /// \brief Write pending messages and the index, and close the file.
+      public: void Close();
+
+      /// \brief Get whether a file is open.
+      /// \return True if a file is open.
+      public: bool IsOpen() const;
+
+      /// \brief Add a topic to the file.
+      /// \param[in] _topic Name of the topic.
+      /// \param[in] _msgType Type of the messages published on the topic.
+      /// \return Id of the topic, to be passed to Write.
+      public: uint32_t AddTopic(const std::string &_topic,
+                  const std::string &_msgType);
+
+      /// \brief Append a message, stamped with the current wall time.
+      /// Thread safe.
+      /// \param[in] _topicId Id of the topic, as returned by AddTopic.
+      /// \param[in] _data Serialized message.
+      public: void Write(const uint32_t _topicId, const std::string &_data);
+
+      /// \brief Append a message. Thread safe. Stamps older than the one of
+      /// the previous message are replaced by it, to keep the file sorted.
+      /// \param[in] _topicId Id of the topic, as returned by AddTopic.
+      /// \param[in] _stamp Time stamp of the message.
+      /// \param[in] _data Serialized message.
+      /// \param[in] _size Size of the serialized message.
+      public: void Write(const uint32_t _topicId, const common::Time &_stamp,
+                  const char *_data, const size_t _size);
+
+      /// \brief Get the number of messages written since Open.
+      /// \return The number of messages.
+      public: uint64_t MessageCount() const;
+
+      /// \brief Get the number of message bytes written since Open.
+      /// \return The number of bytes.
+      public: uint64_t ByteCount() const;
+
+      /// \internal
+      /// \brief Private data pointer.
+      private: std::unique_ptr<TopicLogWriterPrivate> dataPtr;
+    };
+
+    /// \class TopicLogReader TopicLog.hh util/util.hh
+    /// \brief Reads the messages of a file created by TopicLogWriter, in
+    /// the order they were recorded.
+    ///
+    /// Seeking is a binary search on the chunk index followed by one on
+    /// the messages of a single chunk, so only that chunk is read.
+    class GZ_UTIL_VISIBLE TopicLogReader
+    {
+      /// \brief Constructor.
+      public: TopicLogReader();
+
+      /// \brief Destructor.
+      public: ~TopicLogReader();
+
+      /// \brief Open a file and place the cursor on its first message.
+      /// \param[in] _filename Path to the file.
+      /// \return True if the file is a valid topic log.
+      public: bool Open(const std::string &_filename);
+
+      /// \brief Close the file.
+      public: void Close();
+
+      /// \brief Get whether a file is open.
+      /// \return True if a file is open.
+      public: bool IsOpen() const;
+
+      /// \brief Get the number of topics in the file. Topic ids range from
+      /// zero to this number.
+      /// \return The number of topics.
+      public: uint32_t TopicCount() const;
+
+      /// \brief Get the name of a topic.
+      /// \param[in] _topicId Id of the topic.
+      /// \return The name, or an empty string if the id is unknown.
+      public: std::string Topic(const uint32_t _topicId) const;
+
+      /// \brief Get the type of the messages of a topic.
+      /// \param[in] _topicId Id of the topic.
+      /// \return The type, or an empty string if the id is unknown.
+      public: std::string MsgType(const uint32_t _topicId) const;
+
+      /// \brief Get the number of messages in the file.
+      /// \return The number of messages.
+      public: uint64_t MessageCount() const;
+
+      /// \brief Get the time stamp of the first message.
+      /// \return The time stamp.
+      public: common::Time StartTime() const;
+
+      /// \brief Get the time stamp of the last message.
+      /// \return The time stamp.
+      public: common::Time EndTime() const;
+
+      /// \brief Place the cursor on the first message stamped at or after
+      /// a given time.
+      /// \param[in] _time Time to seek to.
+      /// \return False if no message is stamped at or after _time.
+      public: bool Seek(const common::Time &_time);
+
+      /// \brief Read the message under the cursor, and advance the cursor.
+      /// \param[out] _topicId Id of the topic of the message.
+      /// \param[out] _stamp Time stamp of the message.
+      /// \param[out] _data Serialized message.
+      /// \return False at the end of the file.
+      public: bool Next(uint32_t &_topicId, common::Time &_stamp,
+                  std::string &_data);
+
+      /// \internal
+      /// \brief Private data pointer.
+      private: std::unique_ptr<TopicLogReaderPrivate> dataPtr;
+    };
+    /// \}
+  }
+}
+#endif
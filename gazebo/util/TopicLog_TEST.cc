@@ -0,0 +1,177 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include <string>
+
+#include "gazebo/util/TopicLog.hh"
+#include "test/util.hh"
+
+using namespace gazebo;
+
+class TopicLogTest : public gazebo::testing::AutoLogFixture
+{
+  /// \brief Pick the path of the log file.
+  public: virtual void SetUp()
+  {
+    gazebo::testing::AutoLogFixture::SetUp();
+    this->path = boost::filesystem::temp_directory_path() /
+      boost::filesystem::unique_path("gazebo_topic_log_%%%%-%%%%");
+  }
+
+  /// \brief Remove the log file.
+  public: virtual void TearDown()
+  {
+    boost::filesystem::remove(this->path);
+    gazebo::testing::AutoLogFixture::TearDown();
+  }
+
+  /// \brief Write 1000 messages on two topics, one every millisecond from
+  /// t = 10 s, in chunks of about 1 kB.
+  public: void Record()
+  {
+    util::TopicLogWriter writer;
+    ASSERT_TRUE(writer.Open(this->path.string(), 1024));
+
+    uint32_t even = writer.AddTopic("/gazebo/default/even", "gazebo.msgs.Int");
+    uint32_t odd = writer.AddTopic("/gazebo/default/odd", "gazebo.msgs.Int");
+
+    for (int i = 0; i < 1000; ++i)
+    {
+      std::string data = "message " + std::to_string(i);
+      writer.Write(i % 2 ? odd : even, common::Time(10, i * 1000000),
+          data.data(), data.size());
+    }
+    EXPECT_EQ(1000u, writer.MessageCount());
+  }
+
+  /// \brief Check the content of a file written by Record.
+  public: void Check()
+  {
+    util::TopicLogReader reader;
+    ASSERT_TRUE(reader.Open(this->path.string()));
+
+    ASSERT_EQ(2u, reader.TopicCount());
+    EXPECT_EQ("/gazebo/default/even", reader.Topic(0));
+    EXPECT_EQ("/gazebo/default/odd", reader.Topic(1));
+    EXPECT_EQ("gazebo.msgs.Int", reader.MsgType(1));
+    EXPECT_EQ("", reader.Topic(2));
+
+    // Only the complete chunks of truncated files are read
+    const uint64_t count = reader.MessageCount();
+    EXPECT_LE(count, 1000u);
+    EXPECT_GT(count, 600u);
+    EXPECT_EQ(common::Time(10, 0), reader.StartTime());
+
+    uint32_t topicId;
+    common::Time stamp;
+    std::string data;
+    uint64_t read = 0;
+    while (reader.Next(topicId, stamp, data))
+    {
+      EXPECT_EQ(read % 2, topicId);
+      EXPECT_EQ(common::Time(10, read * 1000000), stamp);
+      EXPECT_EQ("message " + std::to_string(read), data);
+      ++read;
+    }
+    EXPECT_EQ(count, read);
+
+    // Seek forward and backward, between and on message stamps
+    ASSERT_TRUE(reader.Seek(common::Time(10, 500500000)));
+    ASSERT_TRUE(reader.Next(topicId, stamp, data));
+    EXPECT_EQ("message 501", data);
+    EXPECT_EQ(1u, topicId);
+
+    ASSERT_TRUE(reader.Seek(common::Time(10, 42000000)));
+    ASSERT_TRUE(reader.Next(topicId, stamp, data));
+    EXPECT_EQ("message 42", data);
+    ASSERT_TRUE(reader.Next(topicId, stamp, data));
+    EXPECT_EQ("message 43", data);
+
+    ASSERT_TRUE(reader.Seek(common::Time(0, 0)));
+    ASSERT_TRUE(reader.Next(topicId, stamp, data));
+    EXPECT_EQ("message 0", data);
+
+    EXPECT_FALSE(reader.Seek(common::Time(20, 0)));
+    EXPECT_FALSE(reader.Next(topicId, stamp, data));
+  }
+
+  /// \brief Path of the log file.
+  public: boost::filesystem::path path;
+};
+
+/////////////////////////////////////////////////
+TEST_F(TopicLogTest, WriteRead)
+{
+  this->Record();
+  this->Check();
+
+  util::TopicLogReader reader;
+  ASSERT_TRUE(reader.Open(this->path.string()));
+  EXPECT_EQ(1000u, reader.MessageCount());
+  EXPECT_EQ(common::Time(10, 999000000), reader.EndTime());
+}
+
+/////////////////////////////////////////////////
+TEST_F(TopicLogTest, Recover)
+{
+  // Truncate the file in the middle of a chunk, as after a crash
+  this->Record();
+  const uintmax_t size = boost::filesystem::file_size(this->path);
+  boost::filesystem::resize_file(this->path, size * 3 / 4);
+
+  this->Check();
+
+  util::TopicLogReader reader;
+  ASSERT_TRUE(reader.Open(this->path.string()));
+  EXPECT_LT(reader.MessageCount(), 1000u);
+}
+
+/////////////////////////////////////////////////
+TEST_F(TopicLogTest, Invalid)
+{
+  util::TopicLogReader reader;
+  EXPECT_FALSE(reader.Open(this->path.string()));
+  EXPECT_FALSE(reader.IsOpen());
+
+  util::TopicLogWriter writer;
+  EXPECT_TRUE(writer.Open(this->path.string()));
+  EXPECT_TRUE(writer.IsOpen());
+
+  // Unknown topic
+  writer.Write(3, "data");
+  EXPECT_EQ(0u, writer.MessageCount());
+  writer.Close();
+  EXPECT_FALSE(writer.IsOpen());
+
+  // Empty log
+  ASSERT_TRUE(reader.Open(this->path.string()));
+  EXPECT_EQ(0u, reader.TopicCount());
+  EXPECT_EQ(0u, reader.MessageCount());
+  uint32_t topicId;
+  common::Time stamp;
+  std::string data;
+  EXPECT_FALSE(reader.Next(topicId, stamp, data));
+}
+
+/////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
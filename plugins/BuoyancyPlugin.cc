@@ -15,10 +15,104 @@
  *
 */
 
+#include <functional>
+#include <memory>
+#include <vector>
+
 #include "gazebo/common/Assert.hh"
 #include "gazebo/common/Events.hh"
+#include "gazebo/physics/ForceField.hh"
 #include "plugins/BuoyancyPlugin.hh"
 
+/// \brief Name of the buoyancy provider in the world force field.
+static const char kProviderName[] = "buoyancy";
+
+namespace gazebo
+{
+  /// \brief Buoyancy of the links of all the BuoyancyPlugin instances of a
+  /// world.
+  class BuoyancyForceField : public physics::ForceFieldProvider
+  {
+    // Documentation inherited
+    public: virtual void Update(physics::ForceFieldState &_state)
+    {
+      // By Archimedes' principle,
+      // buoyancy = -(mass*gravity)*fluid_density/object_density
+      // object_density = mass/volume, so the mass term cancels.
+      // Therefore, buoyancy = -fluid_density*volume*gravity
+      for (size_t i = 0; i < this->rows.size(); ++i)
+      {
+        const unsigned int row = this->rows[i];
+        if (!_state.Valid(row))
+          continue;
+
+        const BuoyancyPlugin *owner = this->owners[i];
+        auto props = owner->volPropsMap.find(this->ids[i]);
+        if (props == owner->volPropsMap.end())
+          continue;
+
+        const ignition::math::Pose3d &pose = _state.poses[row];
+        _state.AddForceAtWorldPosition(row,
+            -owner->fluidDensity * props->second.volume * _state.gravity,
+            pose.Pos() + pose.Rot().RotateVector(props->second.cov));
+      }
+    }
+
+    /// \brief Add a link.
+    /// \param[in] _owner Plugin that owns the link.
+    /// \param[in] _row Row of the link in the force field.
+    /// \param[in] _id Id of the link, key of its volume properties.
+    public: void Add(const BuoyancyPlugin *_owner, const unsigned int _row,
+                const int _id)
+    {
+      this->owners.push_back(_owner);
+      this->rows.push_back(_row);
+      this->ids.push_back(_id);
+    }
+
+    /// \brief Remove the links of a plugin.
+    /// \param[in] _owner Plugin that owns the links.
+    /// \return Rows of the removed links.
+    public: std::vector<unsigned int> Remove(const BuoyancyPlugin *_owner)
+    {
+      std::vector<unsigned int> removed;
+      size_t kept = 0;
+      for (size_t i = 0; i < this->owners.size(); ++i)
+      {
+        if (this->owners[i] == _owner)
+        {
+          removed.push_back(this->rows[i]);
+          continue;
+        }
+        this->owners[kept] = this->owners[i];
+        this->rows[kept] = this->rows[i];
+        this->ids[kept] = this->ids[i];
+        ++kept;
+      }
+      this->owners.resize(kept);
+      this->rows.resize(kept);
+      this->ids.resize(kept);
+      return removed;
+    }
+
+    /// \brief Check if the provider has no links.
+    /// \return True if there are no links.
+    public: bool Empty() const
+    {
+      return this->rows.empty();
+    }
+
+    /// \brief Plugin that owns each link.
+    private: std::vector<const BuoyancyPlugin *> owners;
+
+    /// \brief Row of each link in the force field.
+    private: std::vector<unsigned int> rows;
+
+    /// \brief Id of each link.
+    private: std::vector<int> ids;
+  };
+}
+
 using namespace gazebo;
 
 GZ_REGISTER_MODEL_PLUGIN(BuoyancyPlugin)
@@ -30,13 +124,33 @@ BuoyancyPlugin::BuoyancyPlugin()
 {
 }
 
+/////////////////////////////////////////////////
+BuoyancyPlugin::~BuoyancyPlugin()
+{
+  if (!this->model || !this->model->GetWorld())
+    return;
+
+  physics::ForceField *field = this->model->GetWorld()->ForceField();
+  if (!field)
+    return;
+
+  auto provider = std::dynamic_pointer_cast<BuoyancyForceField>(
+      field->Provider(kProviderName));
+  if (!provider)
+    return;
+
+  for (auto const row : provider->Remove(this))
+    field->RemoveLink(row);
+  if (provider->Empty())
+    field->RemoveProvider(kProviderName);
+}
+
 /////////////////////////////////////////////////
 void BuoyancyPlugin::Load(physics::ModelPtr _model, sdf::ElementPtr _sdf)
 {
   GZ_ASSERT(_model != NULL, "Received NULL model pointer");
   this->model = _model;
-  physics::WorldPtr world = _model->GetWorld();
-  GZ_ASSERT(world != NULL, "Model is in a NULL world");
+  GZ_ASSERT(_model->GetWorld() != NULL, "Model is in a NULL world");
 
   GZ_ASSERT(_sdf != NULL, "Received NULL SDF pointer");
   this->sdf = _sdf;
@@ -146,8 +260,31 @@ void BuoyancyPlugin::Load(physics::ModelPtr _model, sdf::ElementPtr _sdf)
 /////////////////////////////////////////////////
 void BuoyancyPlugin::Init()
 {
-  this->updateConnection = event::Events::ConnectWorldUpdateBegin(
-      std::bind(&BuoyancyPlugin::OnUpdate, this));
+  for (auto link : this->model->GetLinks())
+  {
+    GZ_ASSERT(this->volPropsMap[link->GetId()].volume > 0,
+        "Nonpositive volume found in volume properties!");
+  }
+
+  physics::ForceField *field = this->model->GetWorld()->ForceField();
+  if (!field)
+  {
+    this->updateConnection = event::Events::ConnectWorldUpdateBegin(
+        std::bind(&BuoyancyPlugin::OnUpdate, this));
+    return;
+  }
+
+  // All the plugins of a world share one provider
+  auto provider = std::dynamic_pointer_cast<BuoyancyForceField>(
+      field->Provider(kProviderName));
+  if (!provider)
+  {
+    provider = std::make_shared<BuoyancyForceField>();
+    field->AddProvider(kProviderName, provider);
+  }
+
+  for (auto link : this->model->GetLinks())
+    provider->Add(this, field->AddLink(link.get()), link->GetId());
 }
 
 /////////////////////////////////////////////////
@@ -27,6 +27,8 @@
 
 namespace gazebo
 {
+  class BuoyancyForceField;
+
   /// \brief A class for storing the volume properties of a link.
   class VolumeProperties
   {
@@ -57,11 +59,17 @@ namespace gazebo
   /// to compute these properties from the link collision shapes. This
   /// computation will not be accurate if the object is not composed of simple
   /// collision shapes.
+  /// The buoyancy of all the plugin instances of a world is evaluated in a
+  /// single pass by the physics::ForceField of the world, which reads the
+  /// fluid density and volume properties of each plugin at every step.
   class GZ_PLUGIN_VISIBLE BuoyancyPlugin : public ModelPlugin
   {
     /// \brief Constructor.
     public: BuoyancyPlugin();
 
+    /// \brief Destructor.
+    public: virtual ~BuoyancyPlugin();
+
     /// \brief Read the model SDF to compute volume and center of volume for
     /// each link, and store those properties in volPropsMap.
     public: virtual void Load(physics::ModelPtr _model, sdf::ElementPtr _sdf);
@@ -69,7 +77,9 @@ namespace gazebo
     // Documentation inherited
     public: virtual void Init();
 
-    /// \brief Callback for World Update events.
+    /// \brief Callback for World Update events. It applies the buoyancy of
+    /// the links of this plugin alone, and is only connected when the world
+    /// has no force field.
     protected: virtual void OnUpdate();
 
     /// \brief Connection to World Update events.
@@ -88,6 +98,9 @@ namespace gazebo
     /// \brief Map of <link ID, point> pairs mapping link IDs to the CoV (center
     /// of volume) and volume of the link.
     protected: std::map<int, VolumeProperties> volPropsMap;
+
+    /// \brief The force field provider reads the volume properties.
+    friend class BuoyancyForceField;
   };
 }
 
@@ -17,16 +17,86 @@
 
 #include <algorithm>
 #include <functional>
+#include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <ignition/math/Pose3.hh>
 
 #include "gazebo/common/Assert.hh"
+#include "gazebo/physics/ForceField.hh"
 #include "gazebo/physics/physics.hh"
 #include "gazebo/sensors/SensorManager.hh"
 #include "gazebo/transport/transport.hh"
 #include "plugins/LiftDragPlugin.hh"
 
+/// \brief Name of the lift and drag provider in the world force field.
+static const char kProviderName[] = "lift_drag";
+
+namespace gazebo
+{
+  /// \brief Lift and drag of the surfaces of all the LiftDragPlugin
+  /// instances of a world.
+  class LiftDragForceField : public physics::ForceFieldProvider
+  {
+    // Documentation inherited
+    public: virtual void Update(physics::ForceFieldState &_state)
+    {
+      for (auto const &surface : this->surfaces)
+      {
+        if (_state.Valid(surface.second))
+          AddSurfaceForce(*surface.first, surface.second, _state);
+      }
+    }
+
+    /// \brief Add the lift and drag of the surface of a plugin. The
+    /// parameters are read from the plugin, which also receives the sweep
+    /// and angle of attack.
+    /// \param[in,out] _plugin Plugin of the surface.
+    /// \param[in] _row Row of the link of the surface.
+    /// \param[in,out] _state State of the links.
+    public: static void AddSurfaceForce(LiftDragPlugin &_plugin,
+                const unsigned int _row, physics::ForceFieldState &_state);
+
+    /// \brief Add the surface of a plugin.
+    /// \param[in] _plugin Plugin of the surface.
+    /// \param[in] _row Row of the link of the surface.
+    public: void Add(LiftDragPlugin *_plugin, const unsigned int _row)
+    {
+      this->surfaces.emplace_back(_plugin, _row);
+    }
+
+    /// \brief Remove the surfaces of a plugin.
+    /// \param[in] _plugin Plugin of the surfaces.
+    /// \return Rows of the removed surfaces.
+    public: std::vector<unsigned int> Remove(const LiftDragPlugin *_plugin)
+    {
+      std::vector<unsigned int> removed;
+      auto iter = std::remove_if(this->surfaces.begin(), this->surfaces.end(),
+          [&](const std::pair<LiftDragPlugin *, unsigned int> &_surface)
+          {
+            if (_surface.first != _plugin)
+              return false;
+            removed.push_back(_surface.second);
+            return true;
+          });
+      this->surfaces.erase(iter, this->surfaces.end());
+      return removed;
+    }
+
+    /// \brief Check if the provider has no surfaces.
+    /// \return True if there are no surfaces.
+    public: bool Empty() const
+    {
+      return this->surfaces.empty();
+    }
+
+    /// \brief Plugin and link row of all the surfaces.
+    private: std::vector<std::pair<LiftDragPlugin *, unsigned int>> surfaces;
+  };
+}
+
 using namespace gazebo;
 
 GZ_REGISTER_MODEL_PLUGIN(LiftDragPlugin)
@@ -60,6 +130,22 @@ LiftDragPlugin::LiftDragPlugin() : cla(1.0), cda(0.01), cma(0.01), rho(1.2041)
 /////////////////////////////////////////////////
 LiftDragPlugin::~LiftDragPlugin()
 {
+  if (!this->world)
+    return;
+
+  physics::ForceField *field = this->world->ForceField();
+  if (!field)
+    return;
+
+  auto provider = std::dynamic_pointer_cast<LiftDragForceField>(
+      field->Provider(kProviderName));
+  if (!provider)
+    return;
+
+  for (auto const row : provider->Remove(this))
+    field->RemoveLink(row);
+  if (provider->Empty())
+    field->RemoveProvider(kProviderName);
 }
 
 /////////////////////////////////////////////////
@@ -138,11 +224,6 @@ void LiftDragPlugin::Load(physics::ModelPtr _model,
       gzerr << "Link with name[" << linkName << "] not found. "
         << "The LiftDragPlugin will not generate forces\n";
     }
-    else
-    {
-      this->updateConnection = event::Events::ConnectWorldUpdateBegin(
-          std::bind(&LiftDragPlugin::OnUpdate, this));
-    }
   }
 
   if (_sdf->HasElement("control_joint_name"))
@@ -157,33 +238,79 @@ void LiftDragPlugin::Load(physics::ModelPtr _model,
 
   if (_sdf->HasElement("control_joint_rad_to_cl"))
     this->controlJointRadToCL = _sdf->Get<double>("control_joint_rad_to_cl");
+
+  if (!this->link)
+    return;
+
+  physics::ForceField *field = this->world->ForceField();
+  if (!field)
+  {
+    this->updateConnection = event::Events::ConnectWorldUpdateBegin(
+        std::bind(&LiftDragPlugin::OnUpdate, this));
+    return;
+  }
+
+  // All the plugins of a world share one provider
+  auto provider = std::dynamic_pointer_cast<LiftDragForceField>(
+      field->Provider(kProviderName));
+  if (!provider)
+  {
+    provider = std::make_shared<LiftDragForceField>();
+    field->AddProvider(kProviderName, provider);
+  }
+  provider->Add(this, field->AddLink(this->link.get()));
 }
 
 /////////////////////////////////////////////////
 void LiftDragPlugin::OnUpdate()
 {
   GZ_ASSERT(this->link, "Link was NULL");
+
+  // Evaluate the surface as a force field of a single link
+  physics::ForceFieldState state;
+  state.links.push_back(this->link.get());
+  state.poses.push_back(this->link->WorldPose());
+  state.cogs.push_back(this->link->WorldCoGPose().Pos());
+  state.linearVels.push_back(this->link->WorldCoGLinearVel());
+  state.angularVels.push_back(this->link->WorldAngularVel());
+  state.forces.push_back(ignition::math::Vector3d::Zero);
+  state.torques.push_back(ignition::math::Vector3d::Zero);
+  state.gravity = this->world->Gravity();
+
+  LiftDragForceField::AddSurfaceForce(*this, 0, state);
+
+  state.forces[0].Correct();
+  this->link->AddForceAtWorldPosition(state.forces[0], state.cogs[0]);
+  if (state.torques[0] != ignition::math::Vector3d::Zero)
+    this->link->AddTorque(state.torques[0]);
+}
+
+/////////////////////////////////////////////////
+void LiftDragForceField::AddSurfaceForce(LiftDragPlugin &_plugin,
+    const unsigned int _row, physics::ForceFieldState &_state)
+{
+  const unsigned int row = _row;
+  ignition::math::Vector3d cp = _plugin.cp;
+  cp.Correct();
+
+  // pose of body
+  const ignition::math::Pose3d &pose = _state.poses[row];
+
   // get linear velocity at cp in inertial frame
-  ignition::math::Vector3d vel = this->link->WorldLinearVel(this->cp);
+  ignition::math::Vector3d vel = _state.PointLinearVel(row,
+      pose.Pos() + pose.Rot().RotateVector(cp));
   ignition::math::Vector3d velI = vel;
   velI.Normalize();
 
-  // smoothing
-  // double e = 0.8;
-  // this->velSmooth = e*vel + (1.0 - e)*velSmooth;
-  // vel = this->velSmooth;
-
   if (vel.Length() <= 0.01)
     return;
 
-  // pose of body
-  ignition::math::Pose3d pose = this->link->WorldPose();
-
   // rotate forward and upward vectors into inertial frame
-  ignition::math::Vector3d forwardI = pose.Rot().RotateVector(this->forward);
+  ignition::math::Vector3d forwardI =
+    pose.Rot().RotateVector(_plugin.forward);
 
   ignition::math::Vector3d upwardI;
-  if (this->radialSymmetry)
+  if (_plugin.radialSymmetry)
   {
     // use inflow velocity to determine upward direction
     // which is the component of inflow perpendicular to forward direction.
@@ -192,7 +319,7 @@ void LiftDragPlugin::OnUpdate()
   }
   else
   {
-    upwardI = pose.Rot().RotateVector(this->upward);
+    upwardI = pose.Rot().RotateVector(_plugin.upward);
   }
 
   // spanwiseI: a vector normal to lift-drag-plane described in inertial frame
@@ -204,14 +331,15 @@ void LiftDragPlugin::OnUpdate()
   double sinSweepAngle = ignition::math::clamp(
       spanwiseI.Dot(velI), minRatio, maxRatio);
 
-  // get cos from trig identity
-  double cosSweepAngle = 1.0 - sinSweepAngle * sinSweepAngle;
-  this->sweep = asin(sinSweepAngle);
+  _plugin.sweep = asin(sinSweepAngle);
 
   // truncate sweep to within +/-90 deg
-  while (fabs(this->sweep) > 0.5 * M_PI)
-    this->sweep = this->sweep > 0 ? this->sweep - M_PI
-                                  : this->sweep + M_PI;
+  while (fabs(_plugin.sweep) > 0.5 * M_PI)
+    _plugin.sweep = _plugin.sweep > 0 ? _plugin.sweep - M_PI
+                                      : _plugin.sweep + M_PI;
+
+  // get cos from trig identity
+  double cosSweepAngle = 1.0 - sinSweepAngle * sinSweepAngle;
 
   // angle of attack is the angle between
   // velI projected into lift-drag plane
@@ -232,9 +360,6 @@ void LiftDragPlugin::OnUpdate()
   ignition::math::Vector3d liftI = spanwiseI.Cross(velInLDPlane);
   liftI.Normalize();
 
-  // get direction of moment
-  ignition::math::Vector3d momentDirection = spanwiseI;
-
   // compute angle between upwardI and liftI
   // in general, given vectors a and b:
   //   cos(theta) = a.Dot(b)/(a.Length()*b.Lenghth())
@@ -247,153 +372,87 @@ void LiftDragPlugin::OnUpdate()
   // forwardI points toward zero alpha
   // if forwardI is in the same direction as lift, alpha is positive.
   // liftI is in the same direction as forwardI?
+  double alpha;
   if (liftI.Dot(forwardI) >= 0.0)
-    this->alpha = this->alpha0 + acos(cosAlpha);
+    alpha = _plugin.alpha0 + acos(cosAlpha);
   else
-    this->alpha = this->alpha0 - acos(cosAlpha);
+    alpha = _plugin.alpha0 - acos(cosAlpha);
 
   // normalize to within +/-90 deg
-  while (fabs(this->alpha) > 0.5 * M_PI)
-    this->alpha = this->alpha > 0 ? this->alpha - M_PI
-                                  : this->alpha + M_PI;
+  while (fabs(alpha) > 0.5 * M_PI)
+    alpha = alpha > 0 ? alpha - M_PI : alpha + M_PI;
+  _plugin.alpha = alpha;
 
   // compute dynamic pressure
   double speedInLDPlane = velInLDPlane.Length();
-  double q = 0.5 * this->rho * speedInLDPlane * speedInLDPlane;
+  double q = 0.5 * _plugin.rho * speedInLDPlane * speedInLDPlane;
 
   // compute cl at cp, check for stall, correct for sweep
   double cl;
-  if (this->alpha > this->alphaStall)
+  if (alpha > _plugin.alphaStall)
   {
-    cl = (this->cla * this->alphaStall +
-          this->claStall * (this->alpha - this->alphaStall))
+    cl = (_plugin.cla * _plugin.alphaStall +
+          _plugin.claStall * (alpha - _plugin.alphaStall))
          * cosSweepAngle;
     // make sure cl is still great than 0
     cl = std::max(0.0, cl);
   }
-  else if (this->alpha < -this->alphaStall)
+  else if (alpha < -_plugin.alphaStall)
   {
-    cl = (-this->cla * this->alphaStall +
-          this->claStall * (this->alpha + this->alphaStall))
+    cl = (-_plugin.cla * _plugin.alphaStall +
+          _plugin.claStall * (alpha + _plugin.alphaStall))
          * cosSweepAngle;
     // make sure cl is still less than 0
     cl = std::min(0.0, cl);
   }
   else
-    cl = this->cla * this->alpha * cosSweepAngle;
+    cl = _plugin.cla * alpha * cosSweepAngle;
 
   // modify cl per control joint value
-  if (this->controlJoint)
+  if (_plugin.controlJoint)
   {
-    double controlAngle = this->controlJoint->Position(0);
-    cl = cl + this->controlJointRadToCL * controlAngle;
+    double controlAngle = _plugin.controlJoint->Position(0);
+    cl = cl + _plugin.controlJointRadToCL * controlAngle;
     /// \TODO: also change cm and cd
   }
 
   // compute lift force at cp
-  ignition::math::Vector3d lift = cl * q * this->area * liftI;
+  ignition::math::Vector3d lift = cl * q * _plugin.area * liftI;
 
   // compute cd at cp, check for stall, correct for sweep
   double cd;
-  if (this->alpha > this->alphaStall)
+  if (alpha > _plugin.alphaStall)
   {
-    cd = (this->cda * this->alphaStall +
-          this->cdaStall * (this->alpha - this->alphaStall))
+    cd = (_plugin.cda * _plugin.alphaStall +
+          _plugin.cdaStall * (alpha - _plugin.alphaStall))
          * cosSweepAngle;
   }
-  else if (this->alpha < -this->alphaStall)
+  else if (alpha < -_plugin.alphaStall)
   {
-    cd = (-this->cda * this->alphaStall +
-          this->cdaStall * (this->alpha + this->alphaStall))
+    cd = (-_plugin.cda * _plugin.alphaStall +
+          _plugin.cdaStall * (alpha + _plugin.alphaStall))
          * cosSweepAngle;
   }
   else
-    cd = (this->cda * this->alpha) * cosSweepAngle;
+    cd = (_plugin.cda * alpha) * cosSweepAngle;
 
   // make sure drag is positive
   cd = fabs(cd);
 
   // drag at cp
-  ignition::math::Vector3d drag = cd * q * this->area * dragDirection;
-
-  // compute cm at cp, check for stall, correct for sweep
-  double cm;
-  if (this->alpha > this->alphaStall)
-  {
-    cm = (this->cma * this->alphaStall +
-          this->cmaStall * (this->alpha - this->alphaStall))
-         * cosSweepAngle;
-    // make sure cm is still great than 0
-    cm = std::max(0.0, cm);
-  }
-  else if (this->alpha < -this->alphaStall)
-  {
-    cm = (-this->cma * this->alphaStall +
-          this->cmaStall * (this->alpha + this->alphaStall))
-         * cosSweepAngle;
-    // make sure cm is still less than 0
-    cm = std::min(0.0, cm);
-  }
-  else
-    cm = this->cma * this->alpha * cosSweepAngle;
+  ignition::math::Vector3d drag = cd * q * _plugin.area * dragDirection;
 
   /// \TODO: implement cm
-  /// for now, reset cm to zero, as cm needs testing
-  cm = 0.0;
-
-  // compute moment (torque) at cp
-  ignition::math::Vector3d moment = cm * q * this->area * momentDirection;
+  /// for now, the moment is zero, as cm needs testing
 
-  // moment arm from cg to cp in inertial plane
-  ignition::math::Vector3d momentArm = pose.Rot().RotateVector(
-    this->cp - this->link->GetInertial()->CoG());
-  // gzerr << this->cp << " : " << this->link->GetInertial()->GetCoG() << "\n";
-
-  // force and torque about cg in inertial frame
+  // force about cg in inertial frame
   ignition::math::Vector3d force = lift + drag;
-  // + moment.Cross(momentArm);
-
-  ignition::math::Vector3d torque = moment;
-  // - lift.Cross(momentArm) - drag.Cross(momentArm);
-
-  // debug
-  //
-  // if ((this->link->GetName() == "wing_1" ||
-  //      this->link->GetName() == "wing_2") &&
-  //     (vel.Length() > 50.0 &&
-  //      vel.Length() < 50.0))
-  if (0)
-  {
-    gzdbg << "=============================\n";
-    gzdbg << "sensor: [" << this->GetHandle() << "]\n";
-    gzdbg << "Link: [" << this->link->GetName()
-          << "] pose: [" << pose
-          << "] dynamic pressure: [" << q << "]\n";
-    gzdbg << "spd: [" << vel.Length()
-          << "] vel: [" << vel << "]\n";
-    gzdbg << "LD plane spd: [" << velInLDPlane.Length()
-          << "] vel : [" << velInLDPlane << "]\n";
-    gzdbg << "forward (inertial): " << forwardI << "\n";
-    gzdbg << "upward (inertial): " << upwardI << "\n";
-    gzdbg << "lift dir (inertial): " << liftI << "\n";
-    gzdbg << "Span direction (normal to LD plane): " << spanwiseI << "\n";
-    gzdbg << "sweep: " << this->sweep << "\n";
-    gzdbg << "alpha: " << this->alpha << "\n";
-    gzdbg << "lift: " << lift << "\n";
-    gzdbg << "drag: " << drag << " cd: "
-          << cd << " cda: " << this->cda << "\n";
-    gzdbg << "moment: " << moment << "\n";
-    gzdbg << "cp momentArm: " << momentArm << "\n";
-    gzdbg << "force: " << force << "\n";
-    gzdbg << "torque: " << torque << "\n";
-  }
 
   // Correct for nan or inf
   force.Correct();
-  this->cp.Correct();
-  torque.Correct();
 
-  // apply forces at cg (with torques for position shift)
-  this->link->AddForceAtRelativePosition(force, this->cp);
-  this->link->AddTorque(torque);
+  // apply force at cp. Like Link::AddForceAtRelativePosition in ODE, the
+  // position is taken relative to the center of gravity.
+  _state.AddForceAtWorldPosition(row, force,
+      _state.cogs[row] + pose.Rot().RotateVector(cp));
 }
@@ -28,7 +28,12 @@
 
 namespace gazebo
 {
+  class LiftDragForceField;
+
   /// \brief A plugin that simulates lift and drag.
+  /// The lift and drag of all the plugin instances of a world are evaluated
+  /// in a single pass by the physics::ForceField of the world, which reads
+  /// the parameters of each plugin at every step.
   class GZ_PLUGIN_VISIBLE LiftDragPlugin : public ModelPlugin
   {
     /// \brief Constructor.
@@ -40,7 +45,9 @@ namespace gazebo
     // Documentation Inherited.
     public: virtual void Load(physics::ModelPtr _model, sdf::ElementPtr _sdf);
 
-    /// \brief Callback for World Update events.
+    /// \brief Callback for World Update events. It applies the lift and
+    /// drag of this plugin alone, and is only connected when the world has
+    /// no force field.
     protected: virtual void OnUpdate();
 
     /// \brief Connection to World Update events.
@@ -136,6 +143,9 @@ namespace gazebo
 
     /// \brief SDF for this plugin;
     protected: sdf::ElementPtr sdf;
+
+    /// \brief The force field provider evaluates the plugin.
+    friend class LiftDragForceField;
   };
 }
 #endif
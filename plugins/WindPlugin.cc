@@ -20,20 +20,63 @@
 #include "gazebo/common/Assert.hh"
 #include "gazebo/common/Event.hh"
 #include "gazebo/common/Events.hh"
+#include "gazebo/physics/ForceField.hh"
 
 #include "gazebo/sensors/Noise.hh"
 
 #include "plugins/WindPlugin.hh"
 
+/// \brief Name of the wind drag provider in the world force field.
+static const char kProviderName[] = "wind_drag";
+
+namespace gazebo
+{
+  /// \brief Wind applied as a force on the mass of the links with the wind
+  /// enabled.
+  class WindForceField : public physics::ForceFieldProvider
+  {
+    /// \brief Constructor.
+    /// \param[in] _scalingFactor Scaling factor of the force.
+    public: explicit WindForceField(const double _scalingFactor)
+      : scalingFactor(_scalingFactor)
+    {
+    }
+
+    // Documentation inherited
+    public: virtual void Update(physics::ForceFieldState &_state)
+    {
+      for (size_t i = 0; i < _state.links.size(); ++i)
+      {
+        if (!_state.windEnabled[i] || !_state.links[i])
+          continue;
+
+        // Add wind velocity as a force to the body
+        const ignition::math::Vector3d vel =
+            _state.PointLinearVel(i, _state.poses[i].Pos());
+        _state.AddForceAtWorldPosition(i,
+            _state.links[i]->GetInertial()->Mass() * this->scalingFactor *
+            (_state.windVels[i] - vel), _state.cogs[i]);
+      }
+    }
+
+    /// \brief Scaling factor of the force.
+    private: double scalingFactor;
+  };
+}
+
 /// \brief Private class for WindPlugin
 class gazebo::WindPluginPrivate
 {
   /// \brief World pointer.
   public: physics::WorldPtr world;
 
-  /// \brief Connection to World Update events.
+  /// \brief Connection to World Update events, used when the world has no
+  /// force field.
   public: event::ConnectionPtr updateConnection;
 
+  /// \brief Wind drag provider, registered with the world force field.
+  public: std::shared_ptr<WindForceField> forceField;
+
   /// \brief Time for wind to rise
   public: double characteristicTimeForWindRise = 1;
 
@@ -97,6 +140,13 @@ WindPlugin::WindPlugin()
 {
 }
 
+/////////////////////////////////////////////////
+WindPlugin::~WindPlugin()
+{
+  if (this->dataPtr->forceField && this->dataPtr->world->ForceField())
+    this->dataPtr->world->ForceField()->RemoveProvider(kProviderName);
+}
+
 /////////////////////////////////////////////////
 void WindPlugin::Load(physics::WorldPtr _world, sdf::ElementPtr _sdf)
 {
@@ -223,8 +273,22 @@ void WindPlugin::Load(physics::WorldPtr _world, sdf::ElementPtr _sdf)
   wind.SetLinearVelFunc(std::bind(&WindPlugin::LinearVel, this,
         std::placeholders::_1, std::placeholders::_2));
 
-  this->dataPtr->updateConnection = event::Events::ConnectWorldUpdateBegin(
-          std::bind(&WindPlugin::OnUpdate, this));
+  // Force on mass approximation, applied by the world force field.
+  // This is not recommended. Please use the LiftDragPlugin instead.
+  physics::ForceField *field = this->dataPtr->world->ForceField();
+  if (!field)
+  {
+    this->dataPtr->updateConnection = event::Events::ConnectWorldUpdateBegin(
+        std::bind(&WindPlugin::OnUpdate, this));
+    return;
+  }
+  this->dataPtr->forceField = std::make_shared<WindForceField>(
+      this->dataPtr->forceApproximationScalingFactor);
+  if (!field->AddProvider(kProviderName, this->dataPtr->forceField))
+  {
+    gzerr << "Only one WindPlugin can be loaded per world" << std::endl;
+    this->dataPtr->forceField.reset();
+  }
 }
 
 /////////////////////////////////////////////////
@@ -50,6 +50,9 @@ namespace gazebo
     /// \brief Constructor.
     public: WindPlugin();
 
+    /// \brief Destructor.
+    public: virtual ~WindPlugin();
+
     // Documentation inherited
     public: virtual void Load(physics::WorldPtr _world, sdf::ElementPtr _sdf);
 
@@ -62,7 +65,9 @@ namespace gazebo
             const physics::Wind *_wind,
             const physics::Entity *_entity);
 
-    /// \brief Callback for World Update events.
+    /// \brief Callback for World Update events. It applies the force on
+    /// mass approximation, and is only connected when the world has no
+    /// force field.
     private: void OnUpdate();
 
     /// \internal
@@ -361,6 +361,70 @@ TEST_F(CameraSensor, StrictUpdateRate)
   delete [] img;
 }
 
+/////////////////////////////////////////////////
+TEST_F(CameraSensor, StrictUpdateRatePipelined)
+{
+  LoadArgs(" --lockstep_pipelined worlds/camera_strict_rate.world");
+
+  // Make sure the render engine is available.
+  if (rendering::RenderEngine::Instance()->GetRenderPathType() ==
+      rendering::RenderEngine::NONE)
+  {
+    gzerr << "No rendering engine, unable to run camera test\n";
+    return;
+  }
+
+  physics::WorldPtr world = physics::get_world("default");
+  ASSERT_TRUE(world != NULL);
+  EXPECT_TRUE(world->SensorPipelining());
+
+  std::string cameraName = "camera_sensor";
+  sensors::SensorPtr sensor = sensors::get_sensor(cameraName);
+  sensors::CameraSensorPtr camSensor =
+    std::dynamic_pointer_cast<sensors::CameraSensor>(sensor);
+  ASSERT_TRUE(camSensor != NULL);
+  unsigned int width = camSensor->ImageWidth();
+  unsigned int height = camSensor->ImageHeight();
+  imageCount = 0;
+  img = new unsigned char[width * height*3];
+  event::ConnectionPtr c = camSensor->Camera()->ConnectNewImageFrame(
+        std::bind(&::OnNewCameraFrame, &imageCount, img,
+          std::placeholders::_1, std::placeholders::_2, std::placeholders::_3,
+          std::placeholders::_4, std::placeholders::_5));
+
+  // how many images produced for 5 seconds (in simulated clock domain)
+  double updateRate = camSensor->UpdateRate();
+  int totalImages = 5 * updateRate;
+  double simT0 = 0.0;
+  common::Time lastStamp;
+
+  while (imageCount < totalImages)
+  {
+    if (imageCount == 0)
+    {
+      simT0 = world->SimTime().Double();
+    }
+
+    // Images are stamped with the time of the poses they render, which is
+    // never ahead of the world.
+    common::Time stamp = camSensor->LastMeasurementTime();
+    EXPECT_LE(lastStamp, stamp);
+    EXPECT_LE(stamp, world->SimTime());
+    lastStamp = stamp;
+    common::Time::MSleep(1);
+  }
+
+  // pipelining doesn't change the rate in the simulated clock domain
+  double dt = world->SimTime().Double() - simT0;
+  double rate = static_cast<double>(totalImages) / dt;
+  gzdbg << "timer [" << dt << "] seconds rate [" << rate << "] fps\n";
+  const double tolerance = 0.02;
+  EXPECT_GT(rate, updateRate * (1 - tolerance));
+  EXPECT_LT(rate, updateRate * (1 + tolerance));
+  c.reset();
+  delete [] img;
+}
+
 /////////////////////////////////////////////////
 TEST_F(CameraSensor, TopicName)
 {
@@ -0,0 +1,208 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <sstream>
+#include <string>
+
+#include <boost/filesystem.hpp>
+
+#include "gazebo/common/ConvexDecomposition.hh"
+#include "gazebo/physics/physics.hh"
+#include "gazebo/physics/ode/ODECollision.hh"
+#include "gazebo/test/ServerFixture.hh"
+
+using namespace gazebo;
+
+/// \brief U shaped mesh of 2 x 1 x 1, with a notch of 1 x 0.5 in its top.
+static const std::string g_meshFilename = TEST_PATH "/data/u_shape.obj";
+
+class ConvexDecompositionTest : public ServerFixture
+{
+  /// \brief Remove the hulls cached next to the mesh.
+  protected: virtual void TearDown()
+  {
+    boost::filesystem::remove(
+        common::ConvexDecomposition::CacheFilename(g_meshFilename));
+    ServerFixture::TearDown();
+  }
+};
+
+/////////////////////////////////////////////////
+/// \brief Get the SDF of a model with a decomposed U shaped mesh.
+/// \param[in] _name Name of the model.
+/// \param[in] _pose Pose of the model.
+/// \param[in] _static True for a static model.
+/// \return The SDF.
+static std::string uShape(const std::string &_name,
+    const ignition::math::Pose3d &_pose, const bool _static)
+{
+  std::ostringstream stream;
+  stream << "<sdf version='" << SDF_VERSION << "'>"
+    << "<model name='" << _name << "'>"
+    << "  <static>" << _static << "</static>"
+    << "  <pose>" << _pose << "</pose>"
+    << "  <link name='link'>"
+    << "    <inertial>"
+    << "      <pose>0 0 0.4 0 0 0</pose>"
+    << "      <mass>1.0</mass>"
+    << "    </inertial>"
+    << "    <collision name='collision'>"
+    << "      <geometry>"
+    << "        <mesh>"
+    << "          <uri>" << g_meshFilename << "</uri>"
+    << "          <gazebo:convex_decomposition>"
+    << "            <gazebo:max_convex_hulls>8</gazebo:max_convex_hulls>"
+    << "          </gazebo:convex_decomposition>"
+    << "        </mesh>"
+    << "      </geometry>"
+    << "    </collision>"
+    << "  </link>"
+    << "</model>"
+    << "</sdf>";
+  return stream.str();
+}
+
+/////////////////////////////////////////////////
+/// \brief Get the collision of a model spawned with uShape.
+/// \param[in] _model The model.
+/// \return The ODE collision.
+static physics::ODECollisionPtr collision(const physics::ModelPtr &_model)
+{
+  return boost::dynamic_pointer_cast<physics::ODECollision>(
+      _model->GetLink("link")->GetCollision("collision"));
+}
+
+/////////////////////////////////////////////////
+/// \brief Get the bounding box of the convex hulls of a collision.
+/// \param[in] _collision The collision.
+/// \param[out] _min Minimum corner of the box.
+/// \param[out] _max Maximum corner of the box.
+static void hullBox(const physics::ODECollisionPtr &_collision,
+    ignition::math::Vector3d &_min, ignition::math::Vector3d &_max)
+{
+  _min.Set(ignition::math::MAX_D, ignition::math::MAX_D,
+      ignition::math::MAX_D);
+  _max.Set(ignition::math::LOW_D, ignition::math::LOW_D,
+      ignition::math::LOW_D);
+
+  for (unsigned int i = 0; i < _collision->ConvexHullCount(); ++i)
+  {
+    dReal aabb[6];
+    dGeomGetAABB(_collision->ConvexHullId(i), aabb);
+    _min.Min(ignition::math::Vector3d(aabb[0], aabb[2], aabb[4]));
+    _max.Max(ignition::math::Vector3d(aabb[1], aabb[3], aabb[5]));
+  }
+}
+
+/////////////////////////////////////////////////
+TEST_F(ConvexDecompositionTest, HullContacts)
+{
+  this->Load("worlds/empty.world", true, "ode");
+  physics::WorldPtr world = physics::get_world("default");
+  ASSERT_TRUE(world != nullptr);
+
+  physics::ContactManager *contactManager =
+    world->Physics()->GetContactManager();
+  ASSERT_TRUE(contactManager != nullptr);
+  contactManager->SetNeverDropContacts(true);
+
+  // Drop the U on the ground plane, and a box in its notch
+  this->SpawnSDF(uShape("u_shape",
+        ignition::math::Pose3d(0, 0, 0.1, 0, 0, 0), false));
+  this->SpawnBox("box", ignition::math::Vector3d(0.4, 0.4, 0.4),
+      ignition::math::Vector3d(0, 0, 1.5), ignition::math::Vector3d::Zero);
+
+  physics::ModelPtr model = world->ModelByName("u_shape");
+  ASSERT_TRUE(model != nullptr);
+  physics::ModelPtr box = world->ModelByName("box");
+  ASSERT_TRUE(box != nullptr);
+
+  // The notch makes the mesh concave, so it has more than one hull
+  physics::ODECollisionPtr uCollision = collision(model);
+  ASSERT_TRUE(uCollision != nullptr);
+  EXPECT_GT(uCollision->ConvexHullCount(), 1u);
+
+  world->Step(1000);
+
+  // The U rests on the ground, and the box on the bottom of the notch,
+  // within the surface layer of the contacts
+  EXPECT_NEAR(0.0, model->WorldPose().Pos().Z(), 0.01);
+  EXPECT_NEAR(0.7, box->WorldPose().Pos().Z(), 0.01);
+  EXPECT_NEAR(0.0, box->WorldPose().Pos().X(), 0.01);
+
+  // The contacts of the U are generated by its hulls
+  bool groundContact = false;
+  bool boxContact = false;
+  for (auto const *contact : contactManager->GetContacts())
+  {
+    if (contact->collision1 != uCollision.get() &&
+        contact->collision2 != uCollision.get())
+    {
+      continue;
+    }
+
+    auto other = contact->collision1 == uCollision.get() ?
+      contact->collision2 : contact->collision1;
+    groundContact |= other->GetModel()->GetName() == "ground_plane";
+    boxContact |= other->GetModel()->GetName() == "box";
+  }
+  EXPECT_TRUE(groundContact);
+  EXPECT_TRUE(boxContact);
+}
+
+/////////////////////////////////////////////////
+TEST_F(ConvexDecompositionTest, SetScale)
+{
+  this->Load("worlds/empty.world", true, "ode");
+  physics::WorldPtr world = physics::get_world("default");
+  ASSERT_TRUE(world != nullptr);
+
+  this->SpawnSDF(uShape("u_shape",
+        ignition::math::Pose3d(0, 0, 1, 0, 0, 0), true));
+  physics::ModelPtr model = world->ModelByName("u_shape");
+  ASSERT_TRUE(model != nullptr);
+
+  physics::ODECollisionPtr uCollision = collision(model);
+  ASSERT_TRUE(uCollision != nullptr);
+  const unsigned int hullCount = uCollision->ConvexHullCount();
+  EXPECT_GT(hullCount, 1u);
+
+  ignition::math::Vector3d min, max;
+  hullBox(uCollision, min, max);
+  EXPECT_EQ(ignition::math::Vector3d(-1, -0.5, 1), min);
+  EXPECT_EQ(ignition::math::Vector3d(1, 0.5, 2), max);
+
+  // The trimesh and the hulls are rebuilt at the new scale
+  uCollision->GetShape()->SetScale(ignition::math::Vector3d(2, 3, 4));
+  EXPECT_EQ(hullCount, uCollision->ConvexHullCount());
+
+  hullBox(uCollision, min, max);
+  EXPECT_EQ(ignition::math::Vector3d(-2, -1.5, 1), min);
+  EXPECT_EQ(ignition::math::Vector3d(2, 1.5, 5), max);
+
+  dReal aabb[6];
+  dGeomGetAABB(uCollision->GetCollisionId(), aabb);
+  EXPECT_EQ(min, ignition::math::Vector3d(aabb[0], aabb[2], aabb[4]));
+  EXPECT_EQ(max, ignition::math::Vector3d(aabb[1], aabb[3], aabb[5]));
+}
+
+/////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
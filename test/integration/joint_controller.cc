@@ -15,6 +15,10 @@
  *
 */
 
+#include <cmath>
+#include <map>
+#include <string>
+
 #include <gtest/gtest.h>
 
 #include "gazebo/physics/World.hh"
@@ -173,6 +177,55 @@ TEST_F(JointControllerTest, JointCmd)
   EXPECT_DOUBLE_EQ(velPids[jointName].GetDGain(), 9);
 }
 
+/////////////////////////////////////////////////
+TEST_F(JointControllerTest, PidState)
+{
+  Load("worlds/simple_arm_test.world", true);
+  gazebo::physics::WorldPtr world = physics::get_world("default");
+  ASSERT_TRUE(world != NULL);
+  gazebo::physics::ModelPtr model = world->ModelByName("simple_arm");
+  gazebo::physics::JointControllerPtr jointController =
+    model->GetJointController();
+  gazebo::physics::JointPtr joint =
+    model->GetJoint("arm_shoulder_pan_joint");
+  ASSERT_TRUE(joint != NULL);
+  const std::string jointName = joint->GetScopedName();
+
+  world->Step(100);
+
+  // Command a position, and update the controller once
+  const double target = 1.0;
+  const double error = joint->Position(0) - target;
+  // Loose limits, so that the command isn't clamped
+  jointController->SetPositionPID(jointName,
+      common::PID(10, 0.1, 4.5, 1e3, -1e3, 1e6, -1e6));
+  EXPECT_TRUE(jointController->SetPositionTarget(jointName, target));
+  world->Step(1);
+
+  // The PIDs are returned with their current command and errors
+  std::map<std::string, common::PID> posPids =
+      jointController->GetPositionPIDs();
+  ASSERT_EQ(1u, posPids.count(jointName));
+  common::PID &pid = posPids.at(jointName);
+
+  const double dt = world->Physics()->GetMaxStepSize();
+  double pe, ie, de;
+  pid.GetErrors(pe, ie, de);
+  EXPECT_NEAR(pe, error, 1e-6);
+  EXPECT_NEAR(ie, error * dt, 1e-9);
+  EXPECT_NEAR(de, error / dt, 1e-3);
+  EXPECT_NEAR(pid.GetCmd(), -10 * pe - 0.1 * ie - 4.5 * de, 1e-6);
+  EXPECT_GT(std::abs(pid.GetCmd()), 0.0);
+
+  // Joints without a target keep their PIDs untouched
+  std::map<std::string, common::PID> velPids =
+      jointController->GetVelocityPIDs();
+  ASSERT_EQ(1u, velPids.count(jointName));
+  velPids.at(jointName).GetErrors(pe, ie, de);
+  EXPECT_DOUBLE_EQ(0.0, pe);
+  EXPECT_DOUBLE_EQ(0.0, velPids.at(jointName).GetCmd());
+}
+
 /////////////////////////////////////////////////
 /// Main
 int main(int argc, char **argv)
@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <string>
+
+#include "gazebo/physics/physics.hh"
+#include "gazebo/physics/ode/ODECollision.hh"
+#include "gazebo/test/ServerFixture.hh"
+
+using namespace gazebo;
+
+class MeshSimplifyTest : public ServerFixture
+{
+  /// \brief Get the number of triangles of a mesh collision in the
+  /// physics engine.
+  /// \param[in] _link Link of the collision.
+  /// \param[in] _name Name of the collision.
+  /// \return Number of triangles.
+  public: int TriangleCount(const physics::LinkPtr &_link,
+              const std::string &_name)
+  {
+    physics::ODECollisionPtr collision =
+      boost::dynamic_pointer_cast<physics::ODECollision>(
+          _link->GetCollision(_name));
+    if (!collision || !collision->GetCollisionId())
+      return -1;
+    return dGeomTriMeshGetTriangleCount(collision->GetCollisionId());
+  }
+};
+
+/////////////////////////////////////////////////
+TEST_F(MeshSimplifyTest, TriangleCount)
+{
+  this->Load("worlds/mesh_simplify.world", true, "ode");
+  physics::WorldPtr world = physics::get_world("default");
+  ASSERT_TRUE(world != nullptr);
+
+  physics::ModelPtr model = world->ModelByName("drill");
+  ASSERT_TRUE(model != nullptr);
+  physics::LinkPtr link = model->GetLink("link");
+  ASSERT_TRUE(link != nullptr);
+
+  // The collision without <gazebo:simplify> keeps the full mesh
+  EXPECT_EQ(1126, this->TriangleCount(link, "full"));
+
+  // The physics engine gets the simplified mesh
+  const int simplified = this->TriangleCount(link, "simplified");
+  EXPECT_GT(simplified, 0);
+  EXPECT_LE(simplified, 200);
+
+  // A bound on the error stops the simplification earlier
+  const int bounded = this->TriangleCount(link, "bounded");
+  EXPECT_GT(bounded, simplified);
+  EXPECT_LE(bounded, 1126);
+}
+
+/////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "gazebo/physics/physics.hh"
+#include "gazebo/physics/SpatialIndex.hh"
+#include "gazebo/test/ServerFixture.hh"
+#include "gazebo/test/helper_physics_generator.hh"
+
+using namespace gazebo;
+
+class PhysicsSpatialIndexTest : public ServerFixture,
+                                public testing::WithParamInterface<const char*>
+{
+  /// \brief Drop a sphere and check that the spatial index follows the
+  /// poses computed by the physics engine.
+  /// \param[in] _physicsEngine Type of physics engine to use.
+  public: void FallingSphere(const std::string &_physicsEngine);
+};
+
+/////////////////////////////////////////////////
+/// \brief Check if an entity is in a list.
+/// \param[in] _entities The list.
+/// \param[in] _entity The entity.
+/// \return True if it is.
+static bool contains(const std::vector<physics::EntityPtr> &_entities,
+    const physics::EntityPtr &_entity)
+{
+  return std::find(_entities.begin(), _entities.end(), _entity) !=
+    _entities.end();
+}
+
+/////////////////////////////////////////////////
+void PhysicsSpatialIndexTest::FallingSphere(const std::string &_physicsEngine)
+{
+  if (_physicsEngine == "simbody")
+  {
+    gzerr << "Bounding boxes not yet working with "
+          << _physicsEngine
+          << ", see issue #1148"
+          << std::endl;
+    return;
+  }
+
+  Load("worlds/empty.world", true, _physicsEngine);
+  physics::WorldPtr world = physics::get_world("default");
+  ASSERT_TRUE(world != NULL);
+
+  physics::SpatialIndex *index = world->SpatialIndex();
+  ASSERT_TRUE(index != NULL);
+
+  const double radius = 0.5;
+  SpawnSphere("sphere", ignition::math::Vector3d(0, 0, 3),
+      ignition::math::Vector3d::Zero, ignition::math::Vector3d::Zero, radius);
+  physics::ModelPtr model = world->ModelByName("sphere");
+  ASSERT_TRUE(model != NULL);
+  physics::LinkPtr link = model->GetLink();
+  ASSERT_TRUE(link != NULL);
+
+  const ignition::math::AxisAlignedBox start(
+      ignition::math::Vector3d(-1, -1, 2.4),
+      ignition::math::Vector3d(1, 1, 3.6));
+  const ignition::math::AxisAlignedBox ground(
+      ignition::math::Vector3d(-1, -1, -0.1),
+      ignition::math::Vector3d(1, 1, 1.1));
+
+  world->Step(1);
+  EXPECT_TRUE(contains(index->BoxQuery(start, physics::Base::LINK), link));
+
+  // Let the sphere fall and rest on the ground
+  world->Step(2000);
+  EXPECT_NEAR(link->WorldPose().Pos().Z(), radius, 0.01);
+
+  // The index moved the sphere with the pose set by the engine
+  ignition::math::AxisAlignedBox box;
+  ASSERT_TRUE(index->BoundingBox(link.get(), box));
+  const ignition::math::AxisAlignedBox linkBox = link->BoundingBox();
+  EXPECT_NEAR(box.Min().Z(), linkBox.Min().Z(), 1e-3);
+  EXPECT_NEAR(box.Max().Z(), linkBox.Max().Z(), 1e-3);
+  EXPECT_NEAR(box.Max().Z(), 2 * radius, 0.02);
+
+  EXPECT_FALSE(contains(index->BoxQuery(start, physics::Base::LINK), link));
+  EXPECT_TRUE(contains(index->BoxQuery(ground, physics::Base::LINK), link));
+  EXPECT_TRUE(contains(index->BoxQuery(ground, physics::Base::MODEL),
+        model));
+}
+
+/////////////////////////////////////////////////
+TEST_P(PhysicsSpatialIndexTest, FallingSphere)
+{
+  FallingSphere(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(PhysicsEngines, PhysicsSpatialIndexTest,
+                        PHYSICS_ENGINE_VALUES,);  // NOLINT
+
+/////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -181,7 +181,8 @@ void SurfaceTest::CollideWithoutContact(const std::string &_physicsEngine)
 //    - box3: 0x03
 // This set of bitmasks will make box1 collide with the ground plane,
 // box2 to pass through box1 and collide with the ground plane, and
-// box3 will collide with both box1 and box2.
+// box3 will collide with both box1 and box2. With ODE, the bitmask of
+// box3 is then changed to 0x04, so that it falls to the ground plane.
 ////////////////////////////////////////////////////////////////////////
 void SurfaceTest::CollideBitmask(const std::string &_physicsEngine)
 {
@@ -236,6 +237,22 @@ void SurfaceTest::CollideBitmask(const std::string &_physicsEngine)
   double fallVelocity = g.Z() * world->SimTime().Double();
   EXPECT_LT(box4->WorldLinearVel().Z(), fallVelocity*(1-g_physics_tol));
 
+  // Bitmasks can be changed while the world runs. The third box now only
+  // shares a bit with the ground plane, and falls through the other boxes.
+  // Bullet only reads the bitmasks when bodies are added to the world.
+  if (_physicsEngine == "ode")
+  {
+    physics::LinkPtr link3 = box3->GetLink();
+    ASSERT_TRUE(link3 != NULL);
+    ASSERT_EQ(1u, link3->GetCollisions().size());
+    link3->GetCollisions()[0]->GetSurface()->collideBitmask = 0x04;
+    link3->SetEnabled(true);
+    world->Step(steps);
+
+    EXPECT_NEAR(box3->WorldLinearVel().Z(), 0, 1e-3);
+    EXPECT_NEAR(box3->WorldPose().Pos().Z(), 0.5, 1e-3);
+  }
+
   Unload();
 }
 
@@ -186,6 +186,50 @@ TEST_F(TransportTest, DirectPublish)
   ASSERT_GT(timeout, 0) << "Not received a message in 10 seconds";
 }
 
+/////////////////////////////////////////////////
+// Publish messages without copying them
+TEST_F(TransportTest, SharedPublish)
+{
+  Load("worlds/empty.world");
+
+  g_stringMsg = false;
+
+  transport::NodePtr node = transport::NodePtr(new transport::Node());
+  node->Init();
+
+  transport::PublisherPtr pub = node->Advertise<msgs::GzString>("~/test");
+  transport::SubscriberPtr sub = node->Subscribe("~/test", &ReceiveStringMsg);
+
+  // The shared message is kept as the latest message, without a copy
+  boost::shared_ptr<msgs::GzString> msg(new msgs::GzString);
+  msg->set_data("shared");
+  pub->Publish(msg);
+  EXPECT_EQ(msg.get(), pub->GetPrevMsgPtr().get());
+
+  int timeout = 1000;
+  while (!g_stringMsg && --timeout > 0)
+    common::Time::MSleep(10);
+  EXPECT_TRUE(g_stringMsg);
+
+  // The publisher takes the ownership of unique messages
+  g_stringMsg = false;
+  std::unique_ptr<msgs::GzString> uniqueMsg(new msgs::GzString);
+  uniqueMsg->set_data("unique");
+  const msgs::GzString *rawMsg = uniqueMsg.get();
+  pub->Publish(std::move(uniqueMsg));
+  EXPECT_EQ(rawMsg, pub->GetPrevMsgPtr().get());
+
+  timeout = 1000;
+  while (!g_stringMsg && --timeout > 0)
+    common::Time::MSleep(10);
+  EXPECT_TRUE(g_stringMsg);
+
+  // The type is still checked
+  boost::shared_ptr<msgs::Vector3d> wrongMsg(new msgs::Vector3d);
+  msgs::Set(wrongMsg.get(), ignition::math::Vector3d::Zero);
+  EXPECT_THROW(pub->Publish(wrongMsg), common::Exception);
+}
+
 /////////////////////////////////////////////////
 void SinglePub()
 {
@@ -788,6 +832,55 @@ TEST_F(TransportTest, TryInit)
   EXPECT_EQ(physics::get_world()->Name(), node->GetTopicNamespace());
 }
 
+/////////////////////////////////////////////////
+// Latencies of the messages of a traced topic
+TEST_F(TransportTest, Latency)
+{
+  Load("worlds/empty.world");
+
+  transport::enableTracing(true);
+  transport::clearTopicLatencies();
+
+  transport::NodePtr node = transport::NodePtr(new transport::Node());
+  node->Init();
+  transport::PublisherPtr pub = node->Advertise<msgs::GzString>("~/latency");
+  transport::SubscriberPtr sub = node->Subscribe("~/latency",
+      &ReceiveStringMsg);
+
+  msgs::GzString msg;
+  msg.set_data("latency");
+  for (int i = 0; i < 10; ++i)
+  {
+    pub->Publish(msg);
+    common::Time::MSleep(10);
+  }
+
+  const std::string topic = "/gazebo/default/latency";
+  std::map<std::string, transport::TopicLatency> latencies;
+  for (int i = 0; i < 100; ++i)
+  {
+    latencies = transport::topicLatencies();
+    if (latencies.count(topic) &&
+        latencies[topic].Stage(transport::LATENCY_END_TO_END).Count() >= 10)
+      break;
+    common::Time::MSleep(10);
+  }
+
+  ASSERT_EQ(1u, latencies.count(topic));
+  const transport::TopicLatency &latency = latencies[topic];
+  EXPECT_EQ(10u, latency.Stage(transport::LATENCY_END_TO_END).Count());
+  EXPECT_EQ(10u, latency.Stage(transport::LATENCY_INCOMING_QUEUE).Count());
+
+  // Messages published in the same process are not written to a socket
+  EXPECT_EQ(0u, latency.Stage(transport::LATENCY_NETWORK).Count());
+
+  transport::enableTracing(false);
+  transport::clearTopicLatencies();
+  pub->Publish(msg);
+  common::Time::MSleep(100);
+  EXPECT_TRUE(transport::topicLatencies().empty());
+}
+
 /////////////////////////////////////////////////
 // Main
 int main(int argc, char **argv)
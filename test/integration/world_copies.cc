@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <string>
+#include "gazebo/test/ServerFixture.hh"
+
+using namespace gazebo;
+class WorldCopiesTest : public ServerFixture
+{
+};
+
+/////////////////////////////////////////////////
+// Load several copies of a world, and check that each one has its own
+// name and steps independently.
+TEST_F(WorldCopiesTest, WorldCopies)
+{
+  LoadArgs(" --world_copies 3 worlds/empty.world");
+
+  for (unsigned int i = 0; i < 3; ++i)
+  {
+    std::string name = "default_" + std::to_string(i);
+    ASSERT_TRUE(physics::has_world(name));
+    physics::WorldPtr world = physics::get_world(name);
+    ASSERT_TRUE(world != nullptr);
+    EXPECT_TRUE(world->ModelByName("ground_plane") != nullptr);
+  }
+  EXPECT_FALSE(physics::has_world("default"));
+
+  // Each world runs on its own thread, and should make progress.
+  physics::WorldPtr first = physics::get_world("default_0");
+  physics::WorldPtr last = physics::get_world("default_2");
+  uint32_t firstIters = first->Iterations();
+  uint32_t lastIters = last->Iterations();
+
+  int waitCount = 0;
+  while ((first->Iterations() <= firstIters ||
+          last->Iterations() <= lastIters) && ++waitCount < 100)
+  {
+    common::Time::MSleep(10);
+  }
+  EXPECT_LT(waitCount, 100);
+
+  // Stepping one world while it is paused must not affect the others.
+  first->SetPaused(true);
+  common::Time::MSleep(100);
+  firstIters = first->Iterations();
+  lastIters = last->Iterations();
+  common::Time::MSleep(100);
+  EXPECT_EQ(first->Iterations(), firstIters);
+  EXPECT_GT(last->Iterations(), lastIters);
+}
+
+/////////////////////////////////////////////////
+// Load several copies of a world without sensors, and check that each
+// copy loads the world plugin.
+TEST_F(WorldCopiesTest, WorldPlugin)
+{
+  LoadArgs(" --world_copies 3 worlds/world_copies_plugin.world");
+
+  // The plugin of each copy inserts a model
+  for (unsigned int i = 0; i < 3; ++i)
+  {
+    std::string name = "default_" + std::to_string(i);
+    ASSERT_TRUE(physics::has_world(name));
+    physics::WorldPtr world = physics::get_world(name);
+    ASSERT_TRUE(world != nullptr);
+
+    int waitCount = 0;
+    while (!world->ModelByName("rubble_0") && ++waitCount < 500)
+      common::Time::MSleep(10);
+    EXPECT_TRUE(world->ModelByName("rubble_0") != nullptr) << name;
+  }
+}
+
+/////////////////////////////////////////////////
+// Load a second world file next to the main world.
+TEST_F(WorldCopiesTest, ExtraWorld)
+{
+  LoadArgs(" --extra_world worlds/empty_different_name.world "
+      "worlds/empty.world");
+
+  EXPECT_TRUE(physics::has_world("default"));
+  EXPECT_TRUE(physics::has_world("not_the_default_world_name"));
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
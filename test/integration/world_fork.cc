@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <string>
+#include <vector>
+
+#include "gazebo/physics/physics.hh"
+#include "gazebo/test/ServerFixture.hh"
+
+using namespace gazebo;
+class WorldForkTest : public ServerFixture
+{
+};
+
+/////////////////////////////////////////////////
+// Fork a paused world several times, and step the forks in parallel.
+TEST_F(WorldForkTest, ForkAndStep)
+{
+  Load("worlds/shapes.world", true);
+  physics::WorldPtr world = physics::get_world("default");
+  ASSERT_TRUE(world != nullptr);
+
+  // Lift the box so that it falls in the forks.
+  physics::ModelPtr box = world->ModelByName("box");
+  ASSERT_TRUE(box != nullptr);
+  ignition::math::Pose3d startPose(0, 0, 2, 0, 0, 0);
+  box->SetWorldPose(startPose);
+
+  const unsigned int forkCount = 4;
+  std::vector<physics::WorldPtr> forks;
+  for (unsigned int i = 0; i < forkCount; ++i)
+  {
+    physics::WorldPtr fork =
+      physics::fork_world(world, "fork_" + std::to_string(i));
+    ASSERT_TRUE(fork != nullptr);
+    forks.push_back(fork);
+  }
+
+  // A name can't be used twice.
+  EXPECT_TRUE(physics::fork_world(world, "fork_0") == nullptr);
+
+  // Each fork starts from the state of the original world.
+  for (auto const &fork : forks)
+  {
+    physics::ModelPtr forkBox = fork->ModelByName("box");
+    ASSERT_TRUE(forkBox != nullptr);
+    EXPECT_EQ(startPose, forkBox->WorldPose());
+    EXPECT_NE(fork->Physics(), world->Physics());
+  }
+
+  physics::step_worlds(forks, 100);
+
+  // All forks are deterministic copies, and the original did not move.
+  double forkZ = forks[0]->ModelByName("box")->WorldPose().Pos().Z();
+  EXPECT_LT(forkZ, startPose.Pos().Z());
+  for (auto const &fork : forks)
+  {
+    EXPECT_EQ(100u, fork->Iterations() - world->Iterations());
+    EXPECT_DOUBLE_EQ(forkZ, fork->ModelByName("box")->WorldPose().Pos().Z());
+  }
+  EXPECT_EQ(startPose, box->WorldPose());
+
+  for (auto &fork : forks)
+    physics::remove_world(fork);
+  EXPECT_FALSE(physics::has_world("fork_0"));
+  EXPECT_TRUE(physics::has_world("default"));
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
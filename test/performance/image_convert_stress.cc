@@ -15,11 +15,13 @@
  *
 */
 #include <iostream>
+#include <vector>
 #include <boost/shared_ptr.hpp>
 
 #include "gazebo/test/ServerFixture.hh"
 #include "gazebo/msgs/msgs.hh"
 #include "gazebo/common/common.hh"
+#include "gazebo/common/ImageConversion.hh"
 
 using namespace std;
 using namespace gazebo;
@@ -62,6 +64,75 @@ TEST_F(ImageConvertStressTest, ManyConversions)
   EXPECT_LE(memAfter - memBefore, 2000);
 }
 
+/////////////////////////////////////////////////
+// Compare the FreeImage conversion path with the direct conversions in
+// common/ImageConversion.hh on a VGA frame.
+TEST_F(ImageConvertStressTest, ConversionThroughput)
+{
+  const unsigned int width = 640;
+  const unsigned int height = 480;
+  const size_t pixels = width * height;
+  const int iterations = 200;
+
+  std::vector<unsigned char> rgba(pixels * 4);
+  for (size_t i = 0; i < rgba.size(); ++i)
+    rgba[i] = static_cast<unsigned char>(i % 251);
+  std::vector<unsigned char> rgb(pixels * 3);
+
+  // RGBA to RGB through common::Image
+  common::Time start = common::Time::GetWallTime();
+  for (int i = 0; i < iterations; ++i)
+  {
+    common::Image image;
+    image.SetFromData(rgba.data(), width, height, common::Image::RGBA_INT8);
+    unsigned char *data = nullptr;
+    unsigned int size = 0;
+    image.GetRGBData(&data, size);
+    delete [] data;
+  }
+  double freeImageTime = (common::Time::GetWallTime() - start).Double();
+
+  // RGBA to RGB directly
+  start = common::Time::GetWallTime();
+  for (int i = 0; i < iterations; ++i)
+    common::convertRGBAToRGB(rgba.data(), rgb.data(), pixels);
+  double directTime = (common::Time::GetWallTime() - start).Double();
+
+  gzmsg << "RGBA to RGB, " << iterations << " frames: FreeImage "
+        << freeImageTime << " s, direct " << directTime << " s\n";
+
+  // Image to message, which used to copy the data twice
+  common::Image image;
+  image.SetFromData(rgb.data(), width, height, common::Image::RGB_INT8);
+  start = common::Time::GetWallTime();
+  for (int i = 0; i < iterations; ++i)
+  {
+    msgs::Image msg;
+    msgs::Set(&msg, image);
+    EXPECT_EQ(static_cast<size_t>(image.GetPitch() * height),
+        msg.data().size());
+  }
+  gzmsg << "Image to msgs::Image, " << iterations << " frames: "
+        << (common::Time::GetWallTime() - start).Double() << " s\n";
+
+  // Depth masking and 16-bit conversion
+  std::vector<float> depth(pixels);
+  for (size_t i = 0; i < pixels; ++i)
+    depth[i] = static_cast<float>(i % 2000) * 0.01f;
+  std::vector<float> masked(pixels);
+  std::vector<uint16_t> depth16(pixels);
+
+  start = common::Time::GetWallTime();
+  for (int i = 0; i < iterations; ++i)
+  {
+    common::maskDepthRange(depth.data(), masked.data(), pixels, 0.1f, 10.0f);
+    common::convertDepthToUInt16(masked.data(), depth16.data(), pixels,
+        1000.0f);
+  }
+  gzmsg << "Depth mask and 16-bit conversion, " << iterations << " frames: "
+        << (common::Time::GetWallTime() - start).Double() << " s\n";
+}
+
 /////////////////////////////////////////////////
 int main(int argc, char **argv)
 {
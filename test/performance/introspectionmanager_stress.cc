@@ -16,6 +16,12 @@
 */
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "gazebo/util/IntrospectionClient.hh"
 #include "gazebo/util/IntrospectionManager.hh"
 #include "gazebo/test/ServerFixture.hh"
 
@@ -45,6 +51,22 @@ class IntrospectionManagerTest : public ::testing::Test
     EXPECT_TRUE(this->manager->Items().empty());
   }
 
+  /// \brief Print statistics of a set of update times.
+  /// \param[in] _times Update times in seconds.
+  protected: void PrintStats(std::vector<double> _times)
+  {
+    auto n = _times.size();
+    std::sort(_times.begin(), _times.end());
+    auto sum = std::accumulate(_times.begin(), _times.end(), 0.0);
+
+    std::cerr << "Samples: " << n << std::endl;
+    std::cerr << "Max: " << _times.back() << std::endl;
+    std::cerr << "Min: " << _times.front() << std::endl;
+    // Not exactly median, but really close.
+    std::cerr << "Median: " << _times[n/2] << std::endl;
+    std::cerr << "Mean: " << sum / static_cast<double>(n) << std::endl;
+  }
+
   /// \brief Pointer to the introspection manager.
   protected: util::IntrospectionManager *manager;
 };
@@ -82,14 +104,72 @@ TEST_F(IntrospectionManagerTest, IntrospectionManagerStressTest)
     times.push_back((endTime - startTime).Double());
   }
 
-  auto n = times.size();
-  std::sort(times.begin(), times.end());
-  auto sum = std::accumulate(times.begin(), times.end(), 0.0);
+  this->PrintStats(times);
+}
+
+/////////////////////////////////////////////////
+// Observe a few hundred items, a third of which change on every update,
+// through a full filter, a delta filter and a rate limited filter.
+TEST_F(IntrospectionManagerTest, FilterUpdateStressTest)
+{
+  const size_t itemCount = 300;
+  std::vector<std::string> names;
+  unsigned int counter = 0;
+  for (size_t ii = 0; ii < itemCount; ++ii)
+  {
+    std::stringstream ss;
+    ss << "filtered_item" << ii;
+    names.push_back(ss.str());
+
+    std::function<double()> func;
+    if (ii % 3 == 0)
+      func = [&counter]() { return static_cast<double>(counter); };
+    else
+      func = []() { return 1.0; };
+    EXPECT_TRUE(this->manager->Register<double>(ss.str(), func));
+  }
+
+  std::set<std::string> items(names.begin(), names.end());
+  util::IntrospectionClient client;
+  std::string fullId, fullTopic;
+  std::string deltaId, deltaTopic;
+  std::string rateId, rateTopic;
+  ASSERT_TRUE(client.NewFilter(this->manager->Id(), items, fullId,
+      fullTopic));
+  ASSERT_TRUE(client.NewFilter(this->manager->Id(), items, 0.0, true,
+      deltaId, deltaTopic));
+  ASSERT_TRUE(client.NewFilter(this->manager->Id(), items, 10.0, false,
+      rateId, rateTopic));
+
+  std::atomic<size_t> deltaParams(0);
+  std::atomic<size_t> deltaMsgs(0);
+  std::function<void(const msgs::Param_V &)> deltaCb =
+    [&deltaParams, &deltaMsgs](const msgs::Param_V &_msg)
+    {
+      deltaParams += _msg.param_size();
+      ++deltaMsgs;
+    };
+  ignition::transport::Node node;
+  EXPECT_TRUE(node.Subscribe(deltaTopic, deltaCb));
+
+  std::vector<double> times;
+  for (size_t ii = 0; ii < 1000; ++ii)
+  {
+    ++counter;
+    common::Time startTime = common::Time::GetWallTime();
+    this->manager->Update();
+    common::Time endTime = common::Time::GetWallTime();
+    times.push_back((endTime - startTime).Double());
+  }
+
+  this->PrintStats(times);
+
+  // Wait for asynchronous comms
+  std::this_thread::sleep_for(std::chrono::milliseconds(500));
+  std::cerr << "Delta messages: " << deltaMsgs << ", average params: "
+            << (deltaMsgs ? deltaParams / deltaMsgs : 0) << std::endl;
 
-  std::cerr << "Samples: " << n << std::endl;
-  std::cerr << "Max: " << times.back() << std::endl;
-  std::cerr << "Min: " << times.front() << std::endl;
-  // Not exactly median, but really close.
-  std::cerr << "Median: " << times[n/2] << std::endl;
-  std::cerr << "Mean: " << sum / static_cast<double>(n) << std::endl;
+  EXPECT_TRUE(client.RemoveFilter(this->manager->Id(), fullId));
+  EXPECT_TRUE(client.RemoveFilter(this->manager->Id(), deltaId));
+  EXPECT_TRUE(client.RemoveFilter(this->manager->Id(), rateId));
 }
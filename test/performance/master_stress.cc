@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <list>
+#include <string>
+
+#include "gazebo/test/ServerFixture.hh"
+
+using namespace gazebo;
+
+class MasterStressTest : public ServerFixture
+{
+};
+
+/////////////////////////////////////////////////
+void MasterStressCB(ConstGzStringPtr &/*_msg*/)
+{
+}
+
+/////////////////////////////////////////////////
+// Emulate a large number of plugins, each advertising and subscribing to
+// a few dozen topics, and measure how long it takes the master to register
+// all of them.
+TEST_F(MasterStressTest, ManyTopics)
+{
+  Load("worlds/empty.world");
+
+  // Number of nodes, and number of topics per node
+  const unsigned int nodeCount = 200;
+  const unsigned int topicCount = 30;
+
+  std::list<transport::NodePtr> nodes;
+  std::list<transport::PublisherPtr> pubs;
+  std::list<transport::SubscriberPtr> subs;
+
+  common::Time startTime = common::Time::GetWallTime();
+
+  for (unsigned int i = 0; i < nodeCount; ++i)
+  {
+    nodes.push_back(transport::NodePtr(new transport::Node()));
+    nodes.back()->Init();
+
+    for (unsigned int j = 0; j < topicCount; ++j)
+    {
+      std::string topic = "~/master_stress/node" + std::to_string(i) +
+        "/topic" + std::to_string(j);
+      pubs.push_back(nodes.back()->Advertise<msgs::GzString>(topic));
+      subs.push_back(nodes.back()->Subscribe(topic, &MasterStressCB));
+    }
+  }
+  common::Time advertiseTime = common::Time::GetWallTime();
+
+  // Wait for the master to know about every topic
+  size_t topicsFound = 0;
+  int waitCount = 0;
+  while (topicsFound < nodeCount * topicCount && waitCount < 600)
+  {
+    common::Time::MSleep(100);
+    std::map<std::string, std::list<std::string> > topics =
+      transport::getAdvertisedTopics();
+
+    topicsFound = 0;
+    for (auto const &topic : topics["gazebo.msgs.GzString"])
+    {
+      if (topic.find("/master_stress/") != std::string::npos)
+        ++topicsFound;
+    }
+    ++waitCount;
+  }
+  common::Time settleTime = common::Time::GetWallTime();
+
+  EXPECT_LT(waitCount, 600);
+  EXPECT_EQ(topicsFound, nodeCount * topicCount);
+
+  gzmsg << "Advertised " << nodeCount * topicCount << " topics in "
+    << advertiseTime - startTime << " s, master settled after "
+    << settleTime - startTime << " s\n";
+
+  // Tear everything down, which exercises removal from the master
+  startTime = common::Time::GetWallTime();
+  subs.clear();
+  pubs.clear();
+  for (auto &node : nodes)
+    node->Fini();
+  nodes.clear();
+  gzmsg << "Removed all topics in "
+    << common::Time::GetWallTime() - startTime << " s\n";
+}
+
+/////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
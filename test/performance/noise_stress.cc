@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <algorithm>
+#include <sstream>
+#include <vector>
+
+#include <ignition/math/Rand.hh>
+
+#include "gazebo/common/Time.hh"
+#include "gazebo/sensors/Noise.hh"
+#include "gazebo/test/ServerFixture.hh"
+
+using namespace gazebo;
+
+class NoiseStressTest : public ServerFixture
+{
+};
+
+/////////////////////////////////////////////////
+// Compare the batch noise API against the per-sample path, on a scan the
+// size of a 64 beam lidar with 2048 samples per beam.
+TEST_F(NoiseStressTest, BatchGaussian)
+{
+  std::ostringstream noiseStream;
+  noiseStream << "<sdf version='1.6'>"
+              << "  <noise type='gaussian'>"
+              << "    <mean>0.0</mean>"
+              << "    <stddev>0.01</stddev>"
+              << "  </noise>"
+              << "</sdf>";
+  sdf::ElementPtr sdf(new sdf::Element);
+  sdf::initFile("noise.sdf", sdf);
+  sdf::readString(noiseStream.str(), sdf);
+
+  sensors::NoisePtr noise = sensors::NoiseFactory::NewNoiseModel(sdf);
+  ASSERT_TRUE(noise != nullptr);
+
+  const size_t count = 64 * 2048;
+  const int iterations = 50;
+  std::vector<double> ranges(count, 5.0);
+
+  // Per-sample path through the global generator, as the sensors used to
+  common::Time start = common::Time::GetWallTime();
+  for (int i = 0; i < iterations; ++i)
+  {
+    for (auto &range : ranges)
+      range = 5.0 + ignition::math::Rand::DblNormal(0.0, 0.01);
+  }
+  double globalTime = (common::Time::GetWallTime() - start).Double();
+
+  // Per-sample path through the noise model stream
+  start = common::Time::GetWallTime();
+  for (int i = 0; i < iterations; ++i)
+  {
+    for (auto &range : ranges)
+      range = noise->Apply(5.0);
+  }
+  double scalarTime = (common::Time::GetWallTime() - start).Double();
+
+  // Batch path
+  start = common::Time::GetWallTime();
+  for (int i = 0; i < iterations; ++i)
+  {
+    std::fill(ranges.begin(), ranges.end(), 5.0);
+    noise->Apply(ranges.data(), ranges.size());
+  }
+  double batchTime = (common::Time::GetWallTime() - start).Double();
+
+  gzmsg << iterations << " scans of " << count << " ranges:"
+        << " global generator " << globalTime << " s,"
+        << " per sample " << scalarTime << " s,"
+        << " batch " << batchTime << " s\n";
+
+  for (auto range : ranges)
+    EXPECT_NEAR(range, 5.0, 0.1);
+}
+
+/////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,599 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+// Physics throughput benchmarks. Each reference world is stepped headless
+// under every available physics engine, and the results are written as
+// JSON to the file named by GAZEBO_BENCHMARK_OUTPUT, or to stdout.
+// GAZEBO_BENCHMARK_ITERATIONS sets the number of timed steps.
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include "gazebo/common/Events.hh"
+#include "gazebo/physics/physics.hh"
+#include "gazebo/test/ServerFixture.hh"
+#include "gazebo/test/helper_physics_generator.hh"
+#include "test_config.h"
+
+using namespace gazebo;
+
+/// \brief Result of one benchmark run.
+struct BenchmarkResult
+{
+  /// \brief Name of the reference world.
+  std::string world;
+
+  /// \brief Physics engine.
+  std::string engine;
+
+  /// \brief True if the engine does not support the world.
+  bool skipped = false;
+
+  /// \brief Number of timed iterations.
+  unsigned int iterations = 0;
+
+  /// \brief Physics step size.
+  double stepSize = 0;
+
+  /// \brief Wall time of the timed iterations, in seconds.
+  double wallTime = 0;
+
+  /// \brief Simulated time of the timed iterations, in seconds.
+  double simTime = 0;
+
+  /// \brief Accumulated wall time of each phase of World::Update.
+  std::map<std::string, double> phases;
+
+  /// \brief Sum of the contact counts of all iterations.
+  uint64_t contacts = 0;
+
+  /// \brief Largest contact count of a single iteration.
+  unsigned int maxContacts = 0;
+};
+
+/// \brief Results of all benchmarks, written when the program exits.
+static std::vector<BenchmarkResult> g_results;
+
+/////////////////////////////////////////////////
+/// \brief SDF of a box link.
+/// \param[in] _name Link name.
+/// \param[in] _pose Link pose.
+/// \param[in] _size Box size.
+/// \param[in] _mass Link mass.
+/// \param[in] _surface SDF of the surface of the collision.
+/// \return SDF string.
+static std::string boxLink(const std::string &_name,
+    const ignition::math::Pose3d &_pose, const ignition::math::Vector3d &_size,
+    const double _mass, const std::string &_surface = "")
+{
+  const double ixx =
+    _mass / 12 * (_size.Y() * _size.Y() + _size.Z() * _size.Z());
+  const double iyy =
+    _mass / 12 * (_size.X() * _size.X() + _size.Z() * _size.Z());
+  const double izz =
+    _mass / 12 * (_size.X() * _size.X() + _size.Y() * _size.Y());
+
+  std::ostringstream sdf;
+  sdf << "<link name='" << _name << "'>"
+      << "  <pose>" << _pose << "</pose>"
+      << "  <inertial><mass>" << _mass << "</mass><inertia>"
+      << "    <ixx>" << ixx << "</ixx><iyy>" << iyy << "</iyy>"
+      << "    <izz>" << izz << "</izz>"
+      << "    <ixy>0</ixy><ixz>0</ixz><iyz>0</iyz>"
+      << "  </inertia></inertial>"
+      << "  <collision name='collision'><geometry><box>"
+      << "    <size>" << _size << "</size>"
+      << "  </box></geometry>" << _surface << "</collision>"
+      << "</link>";
+  return sdf.str();
+}
+
+/////////////////////////////////////////////////
+/// \brief SDF of a wheel link, a cylinder rotating about its local Z axis.
+/// \param[in] _name Link name.
+/// \param[in] _pose Link pose.
+/// \param[in] _surface SDF of the surface of the collision.
+/// \return SDF string.
+static std::string wheelLink(const std::string &_name,
+    const ignition::math::Pose3d &_pose, const std::string &_surface = "")
+{
+  std::ostringstream sdf;
+  sdf << "<link name='" << _name << "'>"
+      << "  <pose>" << _pose << "</pose>"
+      << "  <inertial><mass>0.5</mass><inertia>"
+      << "    <ixx>0.0013</ixx><iyy>0.0013</iyy><izz>0.0025</izz>"
+      << "    <ixy>0</ixy><ixz>0</ixz><iyz>0</iyz>"
+      << "  </inertia></inertial>"
+      << "  <collision name='collision'><geometry><cylinder>"
+      << "    <radius>0.1</radius><length>0.05</length>"
+      << "  </cylinder></geometry>" << _surface << "</collision>"
+      << "</link>";
+  return sdf.str();
+}
+
+/////////////////////////////////////////////////
+/// \brief SDF of a differential drive robot with two wheels and a caster.
+/// \param[in] _name Model name.
+/// \param[in] _pose Model pose.
+/// \param[in] _collideBitmask Collide bitmask of all the collisions.
+/// \return SDF string.
+static std::string robotModel(const std::string &_name,
+    const ignition::math::Pose3d &_pose,
+    const unsigned int _collideBitmask = 0xffff)
+{
+  std::ostringstream contact;
+  contact << "<contact><collide_bitmask>" << _collideBitmask
+          << "</collide_bitmask></contact>";
+  const std::string surface = "<surface>" + contact.str() + "</surface>";
+
+  std::ostringstream sdf;
+  sdf << "<model name='" << _name << "'>"
+      << "  <pose>" << _pose << "</pose>"
+      << boxLink("chassis", ignition::math::Pose3d(0, 0, 0.15, 0, 0, 0),
+                 ignition::math::Vector3d(0.4, 0.3, 0.1), 5.0, surface)
+      << wheelLink("left_wheel",
+          ignition::math::Pose3d(0.1, 0.18, 0.1, -IGN_PI_2, 0, 0), surface)
+      << wheelLink("right_wheel",
+          ignition::math::Pose3d(0.1, -0.18, 0.1, -IGN_PI_2, 0, 0), surface)
+      << "  <link name='caster'>"
+      << "    <pose>-0.15 0 0.05 0 0 0</pose>"
+      << "    <inertial><mass>0.1</mass><inertia>"
+      << "      <ixx>0.0001</ixx><iyy>0.0001</iyy><izz>0.0001</izz>"
+      << "      <ixy>0</ixy><ixz>0</ixz><iyz>0</iyz>"
+      << "    </inertia></inertial>"
+      << "    <collision name='collision'><geometry><sphere>"
+      << "      <radius>0.05</radius>"
+      << "    </sphere></geometry>"
+      << "    <surface><friction><ode><mu>0</mu><mu2>0</mu2></ode>"
+      << "    </friction>" << contact.str() << "</surface></collision>"
+      << "  </link>"
+      << "  <joint name='caster_joint' type='fixed'>"
+      << "    <parent>chassis</parent><child>caster</child>"
+      << "  </joint>";
+  for (auto const &side : {"left", "right"})
+  {
+    sdf << "  <joint name='" << side << "_wheel_joint' type='revolute'>"
+        << "    <parent>chassis</parent><child>" << side << "_wheel</child>"
+        << "    <axis><xyz>0 0 1</xyz></axis>"
+        << "  </joint>";
+  }
+  sdf << "</model>";
+  return sdf.str();
+}
+
+/////////////////////////////////////////////////
+/// \brief Wrap models in a world with a ground plane.
+/// \param[in] _models SDF of the models.
+/// \param[in] _groundPlane True to add a ground plane.
+/// \return SDF string.
+static std::string world(const std::string &_models,
+    const bool _groundPlane = true)
+{
+  std::ostringstream sdf;
+  sdf << "<?xml version='1.0'?>"
+      << "<sdf version='1.6'><world name='default'>"
+      << "  <physics type='ode'>"
+      << "    <max_step_size>0.001</max_step_size>"
+      << "    <real_time_update_rate>0</real_time_update_rate>"
+      << "  </physics>";
+  if (_groundPlane)
+  {
+    sdf << "  <model name='ground_plane'><static>true</static>"
+        << "    <link name='link'><collision name='collision'><geometry>"
+        << "      <plane><normal>0 0 1</normal><size>100 100</size></plane>"
+        << "    </geometry></collision></link>"
+        << "  </model>";
+  }
+  sdf << _models << "</world></sdf>";
+  return sdf.str();
+}
+
+/////////////////////////////////////////////////
+/// \brief Towers of stacked boxes resting on the ground.
+/// \return SDF string.
+static std::string boxStacksWorld()
+{
+  std::ostringstream models;
+  for (int tower = 0; tower < 8; ++tower)
+  {
+    for (int level = 0; level < 10; ++level)
+    {
+      models << "<model name='box_" << tower << "_" << level << "'>"
+             << boxLink("link", ignition::math::Pose3d(
+                  (tower % 4) * 1.0, (tower / 4) * 1.0, 0.1 + level * 0.2,
+                  0, 0, 0), ignition::math::Vector3d(0.2, 0.2, 0.2), 1.0)
+             << "</model>";
+    }
+  }
+  return world(models.str());
+}
+
+/////////////////////////////////////////////////
+/// \brief A fleet of differential drive robots on flat ground.
+/// \return SDF string.
+static std::string robotFleetWorld()
+{
+  std::ostringstream models;
+  for (int i = 0; i < 40; ++i)
+  {
+    models << robotModel("robot_" + std::to_string(i),
+        ignition::math::Pose3d((i % 8) * 1.5, (i / 8) * 1.5, 0, 0, 0, 0));
+  }
+  return world(models.str());
+}
+
+/////////////////////////////////////////////////
+/// \brief Groups of robots that overlap but don't collide with each other,
+/// because each robot of a group has its own collide bitmask bit.
+/// \return SDF string.
+static std::string isolatedRobotsWorld()
+{
+  std::ostringstream models;
+  for (int i = 0; i < 160; ++i)
+  {
+    const int group = i / 16;
+    models << robotModel("robot_" + std::to_string(i),
+        ignition::math::Pose3d((group % 5) * 1.5, (group / 5) * 1.5, 0,
+                               0, 0, (i % 16) * 0.1), 1u << (i % 16));
+  }
+  return world(models.str());
+}
+
+/////////////////////////////////////////////////
+/// \brief A pile of triangle mesh boxes.
+/// \return SDF string.
+static std::string trimeshContactsWorld()
+{
+  const std::string mesh =
+    std::string(PROJECT_SOURCE_PATH) + "/test/data/box.dae";
+
+  std::ostringstream models;
+  for (int i = 0; i < 60; ++i)
+  {
+    const double x = (i % 5) * 0.3;
+    const double y = ((i / 5) % 4) * 0.3;
+    const double z = 0.1 + (i / 20) * 0.25;
+    models << "<model name='mesh_" << i << "'>"
+           << "  <pose>" << x << " " << y << " " << z << " 0 0 0</pose>"
+           << "  <link name='link'>"
+           << "    <inertial><mass>1</mass><inertia>"
+           << "      <ixx>0.0067</ixx><iyy>0.0067</iyy><izz>0.0067</izz>"
+           << "      <ixy>0</ixy><ixz>0</ixz><iyz>0</iyz>"
+           << "    </inertia></inertial>"
+           << "    <collision name='collision'><geometry><mesh>"
+           << "      <uri>" << mesh << "</uri><scale>0.1 0.1 0.1</scale>"
+           << "    </mesh></geometry></collision>"
+           << "  </link>"
+           << "</model>";
+  }
+  return world(models.str());
+}
+
+/////////////////////////////////////////////////
+/// \brief A long pendulum of links connected by revolute joints.
+/// \return SDF string.
+static std::string kinematicChainWorld()
+{
+  const int linkCount = 60;
+  const double linkLength = 0.1;
+
+  std::ostringstream model;
+  // The model is rolled, so that the chain starts at an angle and swings
+  model << "<model name='chain'>"
+        << "  <pose>0 0 " << linkCount * linkLength + 1 << " 0.5 0 0</pose>";
+  for (int i = 0; i < linkCount; ++i)
+  {
+    model << boxLink("link_" + std::to_string(i),
+        ignition::math::Pose3d(0, 0, -(i + 0.5) * linkLength, 0, 0, 0),
+        ignition::math::Vector3d(0.02, 0.02, linkLength), 0.1);
+
+    model << "<joint name='joint_" << i << "' type='revolute'>"
+          << "  <pose>0 0 " << linkLength / 2 << " 0 0 0</pose>"
+          << "  <parent>"
+          << (i == 0 ? "world" : "link_" + std::to_string(i - 1))
+          << "  </parent>"
+          << "  <child>link_" << i << "</child>"
+          << "  <axis><xyz>1 0 0</xyz></axis>"
+          << "</joint>";
+  }
+  model << "</model>";
+
+  return world(model.str(), false);
+}
+
+/////////////////////////////////////////////////
+/// \brief Robots driving on a heightmap.
+/// \return SDF string.
+static std::string heightmapDrivingWorld()
+{
+  std::ostringstream models;
+  models << "<model name='heightmap'><static>true</static>"
+         << "  <link name='link'><collision name='collision'><geometry>"
+         << "    <heightmap>"
+         << "      <uri>file://media/materials/textures/heightmap_bowl.png"
+         << "      </uri>"
+         << "      <size>30 30 4</size><pos>0 0 0</pos>"
+         << "    </heightmap>"
+         << "  </geometry></collision></link>"
+         << "</model>";
+  for (int i = 0; i < 16; ++i)
+  {
+    models << robotModel("robot_" + std::to_string(i),
+        ignition::math::Pose3d((i % 4) * 2.0 - 3, (i / 4) * 2.0 - 3, 4.5,
+                               0, 0, i * 0.4));
+  }
+  return world(models.str(), false);
+}
+
+/////////////////////////////////////////////////
+/// \brief A warehouse of crates that never move, crossed by a few robots.
+/// \return SDF string.
+static std::string staticClutterWorld()
+{
+  std::ostringstream models;
+  for (int i = 0; i < 400; ++i)
+  {
+    models << "<model name='crate_" << i << "'><static>true</static>"
+           << boxLink("link", ignition::math::Pose3d(
+                (i % 20) * 1.0 - 10, (i / 20) * 1.0 - 10, 0.25, 0, 0, 0),
+                ignition::math::Vector3d(0.5, 0.5, 0.5), 10.0)
+           << "</model>";
+  }
+  for (int i = 0; i < 4; ++i)
+  {
+    models << robotModel("robot_" + std::to_string(i),
+        ignition::math::Pose3d(-9.5 + i * 5.0, -9.5, 0, 0, 0, IGN_PI_2));
+  }
+  return world(models.str());
+}
+
+/////////////////////////////////////////////////
+class PhysicsBenchmark : public ServerFixture,
+                         public testing::WithParamInterface<const char*>
+{
+  /// \brief Step a world and record the results.
+  /// \param[in] _name Name of the reference world.
+  /// \param[in] _sdf SDF of the world.
+  /// \param[in] _unsupported Engines that can't run the world.
+  public: void Run(const std::string &_name, const std::string &_sdf,
+                   const std::set<std::string> &_unsupported = {});
+};
+
+/////////////////////////////////////////////////
+void PhysicsBenchmark::Run(const std::string &_name, const std::string &_sdf,
+    const std::set<std::string> &_unsupported)
+{
+  const std::string engine = this->GetParam();
+
+  BenchmarkResult result;
+  result.world = _name;
+  result.engine = engine;
+
+  if (_unsupported.count(engine))
+  {
+    gzdbg << "Skipping [" << _name << "], not supported by [" << engine
+          << "]\n";
+    result.skipped = true;
+    g_results.push_back(result);
+    return;
+  }
+
+  unsigned int iterations = 2000;
+  const char *env = std::getenv("GAZEBO_BENCHMARK_ITERATIONS");
+  if (env)
+    iterations = std::max(1, std::atoi(env));
+
+  // Write the world to a temporary file and load it
+  const boost::filesystem::path worldPath =
+    boost::filesystem::temp_directory_path() /
+    boost::filesystem::unique_path("gazebo_benchmark_%%%%-%%%%.world");
+  {
+    std::ofstream file(worldPath.string());
+    file << _sdf;
+  }
+  this->Load(worldPath.string(), true, engine);
+  boost::filesystem::remove(worldPath);
+
+  physics::WorldPtr world = physics::get_world("default");
+  ASSERT_TRUE(world != nullptr);
+  physics::PhysicsEnginePtr physics = world->Physics();
+  ASSERT_TRUE(physics != nullptr);
+  EXPECT_EQ(physics->GetType(), engine);
+  physics->SetRealTimeUpdateRate(0.0);
+
+  // Keep contacts even without subscribers, so that they can be counted
+  physics::ContactManager *contactManager = physics->GetContactManager();
+  contactManager->SetNeverDropContacts(true);
+
+  // Drive the wheels of all robots
+  std::vector<physics::JointPtr> wheels;
+  for (auto const &model : world->Models())
+  {
+    for (auto const &joint : model->GetJoints())
+    {
+      if (joint->GetName().find("wheel_joint") != std::string::npos)
+        wheels.push_back(joint);
+    }
+  }
+  event::ConnectionPtr driveConnection = event::Events::ConnectWorldUpdateBegin(
+      [&wheels](const common::UpdateInfo &)
+      {
+        for (auto const &wheel : wheels)
+          wheel->SetForce(0, 1.0);
+      });
+
+  bool counting = false;
+  event::ConnectionPtr contactConnection = event::Events::ConnectWorldUpdateEnd(
+      [&]()
+      {
+        if (!counting)
+          return;
+        const unsigned int count = contactManager->GetContactCount();
+        result.contacts += count;
+        result.maxContacts = std::max(result.maxContacts, count);
+      });
+
+  // Let the world settle before timing it
+  world->Step(100);
+
+  counting = true;
+  world->SetUpdateProfiling(true);
+  const common::Time simStart = world->SimTime();
+  const common::Time wallStart = common::Time::GetWallTime();
+
+  world->Step(iterations);
+
+  const common::Time wallEnd = common::Time::GetWallTime();
+  counting = false;
+  result.phases = world->UpdateProfile();
+  world->SetUpdateProfiling(false);
+
+  result.iterations = iterations;
+  result.stepSize = physics->GetMaxStepSize();
+  result.wallTime = (wallEnd - wallStart).Double();
+  result.simTime = (world->SimTime() - simStart).Double();
+
+  gzmsg << _name << " [" << engine << "]: "
+        << result.simTime / std::max(result.wallTime, 1e-9)
+        << "x real time, " << result.contacts / iterations
+        << " contacts per step\n";
+
+  EXPECT_GT(result.wallTime, 0.0);
+  g_results.push_back(result);
+}
+
+/////////////////////////////////////////////////
+TEST_P(PhysicsBenchmark, BoxStacks)
+{
+  this->Run("box_stacks", boxStacksWorld());
+}
+
+/////////////////////////////////////////////////
+TEST_P(PhysicsBenchmark, RobotFleet)
+{
+  this->Run("robot_fleet", robotFleetWorld());
+}
+
+/////////////////////////////////////////////////
+TEST_P(PhysicsBenchmark, IsolatedRobots)
+{
+  this->Run("isolated_robots", isolatedRobotsWorld());
+}
+
+/////////////////////////////////////////////////
+TEST_P(PhysicsBenchmark, TrimeshContacts)
+{
+  // Simbody has no mesh collisions
+  this->Run("trimesh_contacts", trimeshContactsWorld(), {"simbody"});
+}
+
+/////////////////////////////////////////////////
+TEST_P(PhysicsBenchmark, KinematicChain)
+{
+  this->Run("kinematic_chain", kinematicChainWorld());
+}
+
+/////////////////////////////////////////////////
+TEST_P(PhysicsBenchmark, HeightmapDriving)
+{
+  // Simbody has no heightmap collisions
+  this->Run("heightmap_driving", heightmapDrivingWorld(), {"simbody"});
+}
+
+/////////////////////////////////////////////////
+TEST_P(PhysicsBenchmark, StaticClutter)
+{
+  this->Run("static_clutter", staticClutterWorld());
+}
+
+INSTANTIATE_TEST_CASE_P(PhysicsEngines, PhysicsBenchmark,
+                        PHYSICS_ENGINE_VALUES,);  // NOLINT
+
+/////////////////////////////////////////////////
+/// \brief Write the results as JSON.
+/// \param[in] _out Output stream.
+void writeResults(std::ostream &_out)
+{
+  _out << "{\n  \"benchmarks\": [";
+  for (size_t i = 0; i < g_results.size(); ++i)
+  {
+    const BenchmarkResult &r = g_results[i];
+    _out << (i == 0 ? "\n" : ",\n")
+         << "    {\"world\": \"" << r.world << "\", "
+         << "\"engine\": \"" << r.engine << "\", ";
+    if (r.skipped)
+    {
+      _out << "\"skipped\": true}";
+      continue;
+    }
+
+    const double rtf = r.wallTime > 0 ? r.simTime / r.wallTime : 0.0;
+    _out << "\"skipped\": false, "
+         << "\"iterations\": " << r.iterations << ", "
+         << "\"step_size\": " << r.stepSize << ", "
+         << "\"wall_time\": " << r.wallTime << ", "
+         << "\"sim_time\": " << r.simTime << ", "
+         << "\"real_time_factor\": " << rtf << ", "
+         << "\"contacts_per_step\": "
+         << static_cast<double>(r.contacts) / r.iterations << ", "
+         << "\"max_contacts\": " << r.maxContacts << ", "
+         << "\"phases\": {";
+
+    // Mean time of each phase per step, in seconds
+    const double updates = std::max(1.0, r.phases.count("updates") ?
+        r.phases.at("updates") : 0.0);
+    bool first = true;
+    for (auto const &phase : r.phases)
+    {
+      if (phase.first == "updates")
+        continue;
+      _out << (first ? "" : ", ") << "\"" << phase.first << "\": "
+           << phase.second / updates;
+      first = false;
+    }
+    _out << "}}";
+  }
+  _out << "\n  ]\n}\n";
+}
+
+/////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  const int result = RUN_ALL_TESTS();
+
+  const char *output = std::getenv("GAZEBO_BENCHMARK_OUTPUT");
+  if (output && *output)
+  {
+    std::ofstream file(output);
+    writeResults(file);
+    std::cout << "Wrote benchmark results to [" << output << "]\n";
+  }
+  else
+    writeResults(std::cout);
+
+  return result;
+}
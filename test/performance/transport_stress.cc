@@ -115,6 +115,75 @@ TEST_F(TransportStressTest, LocalPublish)
   delete [] fakeData;
 }
 
+/////////////////////////////////////////////////
+// Publish the same large image by copy and by shared pointer to a local
+// subscriber. The shared pointer isn't copied, so publishing should be
+// faster.
+TEST_F(TransportStressTest, SharedPublish)
+{
+  Load("worlds/empty.world");
+
+  // Number of messages to publish with each method
+  g_localPublishMessageCount = 500;
+
+  transport::NodePtr testNode = transport::NodePtr(new transport::Node());
+  testNode->Init("default");
+
+  transport::PublisherPtr pub = testNode->Advertise<msgs::Image>(
+      "~/test/shared_publish__", g_localPublishMessageCount);
+  pub->SetValidation(false);
+
+  transport::SubscriberPtr sub = testNode->Subscribe(
+      "~/test/shared_publish__", &LocalPublishCB);
+
+  unsigned int width = 1920;
+  unsigned int height = 1080;
+  std::string fakeData(width * height * 3, 'x');
+
+  // Create a large image message with fake data
+  boost::shared_ptr<msgs::Image> fakeMsg(new msgs::Image);
+  fakeMsg->set_width(width);
+  fakeMsg->set_height(height);
+  fakeMsg->set_pixel_format(0);
+  fakeMsg->set_step(width * 3);
+  fakeMsg->set_data(fakeData);
+
+  common::Time publishTime[2];
+  for (int shared = 0; shared < 2; ++shared)
+  {
+    g_localPublishCount = 0;
+    g_totalExpectedMsgCount = g_localPublishMessageCount;
+
+    common::Time startTime = common::Time::GetWallTime();
+    for (unsigned int i = 0; i < g_localPublishMessageCount; ++i)
+    {
+      if (shared)
+        pub->Publish(fakeMsg);
+      else
+        pub->Publish(*fakeMsg);
+    }
+    publishTime[shared] = common::Time::GetWallTime() - startTime;
+
+    // Wait for all the messages
+    int waitCount = 0;
+    while (g_localPublishCount < g_totalExpectedMsgCount && waitCount < 50)
+    {
+      common::Time::MSleep(100);
+      waitCount++;
+    }
+    EXPECT_LT(waitCount, 50);
+    EXPECT_EQ(g_totalExpectedMsgCount, g_localPublishCount);
+  }
+
+  EXPECT_LT(publishTime[1], publishTime[0]);
+
+  // Out time time for human testing purposes
+  gzmsg << "Time to publish " << g_localPublishMessageCount
+    << " copied messages = " << publishTime[0] << "\n";
+  gzmsg << "Time to publish " << g_localPublishMessageCount
+    << " shared messages = " << publishTime[1] << "\n";
+}
+
 /////////////////////////////////////////////////
 // Create a lot of nodes, each with a publisher and subscriber. Then send
 // out a few large messages.
@@ -26,6 +26,7 @@
 #include <sdf/sdf.hh>
 #include "gz_log.hh"
 #include "gz_marker.hh"
+#include "gz_record.hh"
 #include "gz_topic.hh"
 #include "gz.hh"
 
@@ -1307,6 +1308,7 @@ int main(int argc, char **argv)
   g_commandMap["model"] = new ModelCommand();
   g_commandMap["world"] = new WorldCommand();
   g_commandMap["physics"] = new PhysicsCommand();
+  g_commandMap["record"] = new RecordCommand();
   g_commandMap["stats"] = new StatsCommand();
   g_commandMap["topic"] = new TopicCommand();
   g_commandMap["log"] = new LogCommand();
@@ -0,0 +1,269 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <iomanip>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gazebo/util/TopicLog.hh>
+
+#include "gz_record.hh"
+
+using namespace gazebo;
+
+namespace
+{
+  /// \brief Appends the serialized messages of a topic to a topic log.
+  class TopicRecorder
+  {
+    /// \brief Constructor.
+    /// \param[in] _writer Topic log to write to.
+    /// \param[in] _topicId Id of the topic in the log.
+    public: TopicRecorder(util::TopicLogWriter &_writer,
+                const uint32_t _topicId)
+      : writer(_writer), topicId(_topicId)
+    {
+    }
+
+    /// \brief Raw subscription callback.
+    /// \param[in] _data Serialized message.
+    public: void OnData(const std::string &_data)
+    {
+      this->writer.Write(this->topicId, _data);
+    }
+
+    /// \brief Topic log to write to.
+    private: util::TopicLogWriter &writer;
+
+    /// \brief Id of the topic in the log.
+    private: const uint32_t topicId;
+  };
+}
+
+/////////////////////////////////////////////////
+RecordCommand::RecordCommand()
+  : Command("record", "Record and replay the messages published on topics")
+{
+  // Options that are visible to the user through help.
+  this->visibleOptions.add_options()
+    ("world-name,w", po::value<std::string>(), "World name.")
+    ("topic,t", po::value<std::vector<std::string> >()->composing(),
+     "Topic to record. May be repeated.")
+    ("output,o", po::value<std::string>(), "Topic log to record to.")
+    ("duration,d", po::value<double>(), "Duration (seconds) to record.")
+    ("play,p", po::value<std::string>(), "Topic log to replay.")
+    ("rate,r", po::value<double>()->default_value(1.0), "Playback rate. "
+     "A value <= 0 replays as fast as possible.")
+    ("start,s", po::value<double>()->default_value(0.0), "Time (seconds) "
+     "from the start of the log at which to start the playback.")
+    ("info,i", po::value<std::string>(), "Output information about a topic "
+     "log.");
+}
+
+/////////////////////////////////////////////////
+void RecordCommand::HelpDetailed()
+{
+  std::cerr <<
+    "\tRecord the messages published on topics, without decoding them,\n"
+    "\tand replay them with their recorded timing. If a name for the\n"
+    "\tworld, option -w, is not specified, the first world found on the\n"
+    "\tGazebo master will be used.\n"
+    "\n"
+    "\tExample:\n"
+    "\t  gz record -t ~/camera/link/camera/image -t ~/imu -o sensors.log\n"
+    "\t  gz record -p sensors.log -r 0.5 -s 10\n"
+    << std::endl;
+}
+
+/////////////////////////////////////////////////
+bool RecordCommand::TransportRequired()
+{
+  return this->vm.count("info") == 0;
+}
+
+/////////////////////////////////////////////////
+bool RecordCommand::RunImpl()
+{
+  if (this->vm.count("info"))
+    return this->Info(this->vm["info"].as<std::string>());
+
+  std::string worldName;
+  if (this->vm.count("world-name"))
+    worldName = this->vm["world-name"].as<std::string>();
+
+  this->node.reset(new transport::Node());
+  this->node->Init(worldName);
+
+  if (this->vm.count("play"))
+  {
+    return this->Play(this->vm["play"].as<std::string>(),
+        this->vm["rate"].as<double>(), this->vm["start"].as<double>());
+  }
+
+  if (this->vm.count("topic") && this->vm.count("output"))
+  {
+    return this->Record(this->vm["topic"].as<std::vector<std::string> >(),
+        this->vm["output"].as<std::string>());
+  }
+
+  this->Help();
+  return false;
+}
+
+/////////////////////////////////////////////////
+bool RecordCommand::Record(const std::vector<std::string> &_topics,
+    const std::string &_filename)
+{
+  util::TopicLogWriter writer;
+  if (!writer.Open(_filename))
+    return false;
+
+  std::vector<std::unique_ptr<TopicRecorder>> recorders;
+  std::vector<transport::SubscriberPtr> subscribers;
+  for (auto const &topic : _topics)
+  {
+    std::string topicName = this->node->DecodeTopicName(topic);
+    std::string msgTypeName = transport::getTopicMsgType(topicName);
+    if (msgTypeName.empty())
+    {
+      std::cerr << "Unable to get message type for topic[" << topic << "]\n";
+      continue;
+    }
+
+    recorders.emplace_back(new TopicRecorder(writer,
+          writer.AddTopic(topicName, msgTypeName)));
+    subscribers.push_back(this->node->Subscribe(topicName,
+          &TopicRecorder::OnData, recorders.back().get()));
+  }
+
+  if (subscribers.empty())
+    return false;
+
+  common::Time duration(-1, 0);
+  if (this->vm.count("duration"))
+    duration = common::Time(this->vm["duration"].as<double>());
+
+  this->Wait(duration);
+
+  subscribers.clear();
+  writer.Close();
+
+  std::cout << "Recorded " << writer.MessageCount() << " messages ("
+            << std::fixed << std::setprecision(2)
+            << writer.ByteCount() / 1.049e6 << " MB) to "
+            << _filename << "\n";
+
+  return true;
+}
+
+/////////////////////////////////////////////////
+bool RecordCommand::Play(const std::string &_filename, const double _rate,
+    const double _start)
+{
+  util::TopicLogReader reader;
+  if (!reader.Open(_filename))
+    return false;
+
+  std::vector<transport::PublisherPtr> publishers;
+  for (uint32_t i = 0; i < reader.TopicCount(); ++i)
+  {
+    publishers.push_back(this->node->Advertise(reader.Topic(i),
+          reader.MsgType(i)));
+  }
+
+  const common::Time logStart = reader.StartTime() + common::Time(_start);
+  if (!reader.Seek(logStart))
+    return true;
+
+  const common::Time wallStart = common::Time::GetWallTime();
+
+  uint32_t topicId;
+  common::Time stamp;
+  std::string data;
+  while (reader.Next(topicId, stamp, data))
+  {
+    if (_rate > 0)
+    {
+      common::Time target = wallStart +
+        common::Time((stamp - logStart).Double() / _rate);
+      common::Time delay = target - common::Time::GetWallTime();
+      if (delay > common::Time::Zero && this->Wait(delay))
+        break;
+    }
+
+    // Publishers only accept messages, so the data is parsed before being
+    // sent. The message is handed over to avoid a copy.
+    boost::shared_ptr<google::protobuf::Message> msg =
+      msgs::MsgFactory::NewMsg(reader.MsgType(topicId));
+    if (!msg || !msg->ParseFromString(data))
+    {
+      std::cerr << "Unable to parse message of type["
+                << reader.MsgType(topicId) << "]\n";
+      continue;
+    }
+    publishers[topicId]->Publish(msg);
+  }
+
+  // Give the publishers some time to send the last messages
+  for (auto const &pub : publishers)
+  {
+    for (int i = 0; i < 100 && pub->GetOutgoingCount() > 0; ++i)
+      common::Time::MSleep(10);
+  }
+
+  return true;
+}
+
+/////////////////////////////////////////////////
+bool RecordCommand::Info(const std::string &_filename)
+{
+  util::TopicLogReader reader;
+  if (!reader.Open(_filename))
+    return false;
+
+  std::cout << "File:      " << _filename << "\n"
+            << "Start:     " << reader.StartTime().FormattedString() << "\n"
+            << "End:       " << reader.EndTime().FormattedString() << "\n"
+            << "Duration:  " << (reader.EndTime() - reader.StartTime())
+            << "\n"
+            << "Messages:  " << reader.MessageCount() << "\n"
+            << "Topics:\n";
+
+  for (uint32_t i = 0; i < reader.TopicCount(); ++i)
+  {
+    std::cout << "  " << reader.Topic(i) << " ["
+              << reader.MsgType(i) << "]\n";
+  }
+
+  return true;
+}
+
+/////////////////////////////////////////////////
+bool RecordCommand::Wait(const common::Time &_timeout)
+{
+  boost::mutex::scoped_lock lock(this->sigMutex);
+  if (_timeout < common::Time::Zero)
+  {
+    this->sigCondition.wait(lock);
+    return true;
+  }
+
+  return this->sigCondition.timed_wait(lock,
+      boost::posix_time::microseconds(
+        static_cast<int64_t>(_timeout.Double() * 1e6)));
+}
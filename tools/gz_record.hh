@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GAZEBO_TOOLS_GZRECORD_HH_
+#define GAZEBO_TOOLS_GZRECORD_HH_
+
+#include <string>
+#include <vector>
+
+#include "gz.hh"
+
+namespace gazebo
+{
+  /// \brief Record command. Records the serialized messages published on
+  /// topics into a topic log, and replays them.
+  class RecordCommand : public Command
+  {
+    /// \brief Constructor
+    public: RecordCommand();
+
+    // Documentation inherited
+    public: virtual void HelpDetailed();
+
+    // Documentation inherited
+    protected: virtual bool RunImpl();
+
+    // Documentation inherited
+    protected: virtual bool TransportRequired();
+
+    /// \brief Record topics until interrupted.
+    /// \param[in] _topics Topics to record.
+    /// \param[in] _filename Path to the topic log to create.
+    /// \return True on success.
+    private: bool Record(const std::vector<std::string> &_topics,
+                 const std::string &_filename);
+
+    /// \brief Publish the messages of a topic log, with their recorded
+    /// timing.
+    /// \param[in] _filename Path to the topic log.
+    /// \param[in] _rate Playback rate, 2 replays twice as fast as recorded.
+    /// A value <= 0 replays as fast as possible.
+    /// \param[in] _start Time from the start of the log, in seconds, at
+    /// which to start.
+    /// \return True on success.
+    private: bool Play(const std::string &_filename, const double _rate,
+                 const double _start);
+
+    /// \brief Output information about a topic log.
+    /// \param[in] _filename Path to the topic log.
+    /// \return True on success.
+    private: bool Info(const std::string &_filename);
+
+    /// \brief Wait until interrupted or until a timeout.
+    /// \param[in] _timeout Time to wait. Waits until interrupted if
+    /// negative.
+    /// \return True if interrupted.
+    private: bool Wait(const common::Time &_timeout);
+
+    /// \brief Node pointer.
+    private: transport::NodePtr node;
+  };
+}
+#endif
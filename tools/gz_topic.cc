@@ -16,6 +16,9 @@
 */
 #include <google/protobuf/text_format.h>
 
+#include <iomanip>
+#include <map>
+
 #include <gazebo/gui/qt.h>
 #include <gazebo/gui/TopicSelector.hh>
 #include <gazebo/gui/viewers/TopicView.hh>
@@ -52,11 +55,13 @@ TopicCommand::TopicCommand()
      "View topic data using a QT widget.")
     ("hz,z", po::value<std::string>(), "Get publish frequency.")
     ("bw,b", po::value<std::string>(), "Get topic bandwidth.")
+    ("latency,a", po::value<std::string>(), "Get the latency of each "
+     "transport stage of a topic.")
     ("publish,p", po::value<std::string>(), "Publish message on a topic.")
     ("request,r", po::value<std::string>(), "Send a request.")
     ("unformatted,u", "Output data from echo without formatting.")
     ("duration,d", po::value<uint64_t>(), "Duration (seconds) to run. "
-     "Applicable with echo, hz, and bw")
+     "Applicable with echo, hz, bw, and latency")
     ("msg,m", po::value<std::string>(), "Message to send on topic. "
      "Applicable with publish and request")
     ("file,f", po::value<std::string>(), "Path to a file containing the "
@@ -96,6 +101,8 @@ bool TopicCommand::RunImpl()
     this->Hz(this->vm["hz"].as<std::string>());
   else if (this->vm.count("bw"))
     this->Bw(this->vm["bw"].as<std::string>());
+  else if (this->vm.count("latency"))
+    this->Latency(this->vm["latency"].as<std::string>());
   else if (this->vm.count("view"))
     this->View(this->vm["view"].as<std::string>());
   else if (this->vm.count("publish"))
@@ -347,6 +354,76 @@ void TopicCommand::Bw(const std::string &_topic)
     this->sigCondition.wait(lock);
 }
 
+/////////////////////////////////////////////////
+void TopicCommand::LatencyCB(const std::string &/*_data*/)
+{
+}
+
+/////////////////////////////////////////////////
+void TopicCommand::Latency(const std::string &_topic)
+{
+  const std::string topic = this->node->DecodeTopicName(_topic);
+
+  // Tracing must be enabled before subscribing, so that the publishers are
+  // asked to stamp their messages.
+  transport::enableTracing(true);
+  transport::clearTopicLatencies();
+  transport::SubscriberPtr sub = this->node->Subscribe(topic,
+      &TopicCommand::LatencyCB, this);
+
+  common::Time end(-1, 0);
+  if (this->vm.count("duration"))
+  {
+    end = common::Time::GetWallTime() +
+      common::Time(static_cast<double>(this->vm["duration"].as<uint64_t>()));
+  }
+
+  boost::mutex::scoped_lock lock(this->sigMutex);
+  while (end < common::Time::Zero || common::Time::GetWallTime() < end)
+  {
+    if (this->sigCondition.timed_wait(lock, boost::posix_time::seconds(1)))
+      break;
+
+    std::map<std::string, transport::TopicLatency> latencies =
+      transport::topicLatencies();
+    transport::clearTopicLatencies();
+
+    auto iter = latencies.find(topic);
+    if (iter == latencies.end())
+    {
+      std::cout << "No traced messages\n";
+      continue;
+    }
+
+    std::cout << std::setw(16) << std::left << "Stage [us]" << std::right
+              << std::setw(8) << "Count" << std::setw(12) << "Mean"
+              << std::setw(12) << "P50" << std::setw(12) << "P99"
+              << std::setw(12) << "Max" << "\n" << std::fixed
+              << std::setprecision(1);
+
+    for (int i = 0; i < transport::LATENCY_STAGE_COUNT; ++i)
+    {
+      const transport::LatencyStage stage =
+        static_cast<transport::LatencyStage>(i);
+      const transport::LatencyHistogram &histogram = iter->second.Stage(stage);
+      if (histogram.Count() == 0)
+        continue;
+
+      std::cout << std::setw(16) << std::left
+                << transport::latencyStageName(stage) << std::right
+                << std::setw(8) << histogram.Count()
+                << std::setw(12) << histogram.Mean()
+                << std::setw(12) << histogram.Percentile(50)
+                << std::setw(12) << histogram.Percentile(99)
+                << std::setw(12) << histogram.Max() << "\n";
+    }
+    std::cout << std::endl;
+  }
+
+  sub.reset();
+  transport::enableTracing(false);
+}
+
 /////////////////////////////////////////////////
 void TopicCommand::View(const std::string &_topic)
 {
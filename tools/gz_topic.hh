@@ -72,6 +72,16 @@ namespace gazebo
     /// \param[in] _topic Topic name.
     private: void Bw(const std::string &_topic);
 
+    /// \brief Output the latencies of the transport stages of a topic,
+    /// once per second.
+    /// \param[in] _topic Topic name.
+    private: void Latency(const std::string &_topic);
+
+    /// \brief Subscription callback used by Latency(). The latencies are
+    /// aggregated by the transport.
+    /// \param[in] _data Message data (unused).
+    private: void LatencyCB(const std::string &_data);
+
     /// \brief View topic information using QT.
     /// \param[in] _topic Name of the topic to view. Empty will bring up
     /// a topic selector.